@@ -0,0 +1,2075 @@
+#ifndef __THYROID_TEST_COMPRESSED__
+#define __THYROID_TEST_COMPRESSED__
+
+#include <stdint.h>
+
+
+uint16_t num_data = 3600;
+uint8_t num_input = 21;
+uint8_t num_output = 3;
+
+#include "fann.h"
+
+/* Compressed records: 65 bits each (uncompressed: 96 bytes) */
+#define COMPRESSED_NUM_INPUT                 21
+#define COMPRESSED_NUM_OUTPUT                3
+
+const fann_type compressed_dict[1206] = {
+    /* column 0 */
+    0.01, 0.02, 0.03, 0.04, 0.05, 0.07, 0.08, 0.09,
+    0.1, 0.11, 0.12, 0.13, 0.14, 0.15, 0.16, 0.17,
+    0.18, 0.19, 0.2, 0.21, 0.22, 0.23, 0.24, 0.25,
+    0.26, 0.27, 0.28, 0.29, 0.3, 0.31, 0.32, 0.33,
+    0.34, 0.35, 0.36, 0.37, 0.38, 0.39, 0.4, 0.41,
+    0.42, 0.43, 0.44, 0.45, 0.46, 0.47, 0.48, 0.49,
+    0.5, 0.51, 0.515, 0.52, 0.5219, 0.53, 0.54, 0.55,
+    0.56, 0.57, 0.58, 0.59, 0.6, 0.61, 0.62, 0.63,
+    0.64, 0.65, 0.66, 0.67, 0.68, 0.69, 0.7, 0.71,
+    0.72, 0.73, 0.74, 0.75, 0.76, 0.77, 0.78, 0.79,
+    0.8, 0.81, 0.82, 0.83, 0.84, 0.85, 0.86, 0.87,
+    0.88, 0.89, 0.9, 0.91, 0.92, 0.93, 0.94, 0.95,
+    /* column 1 */
+    0, 1,
+    /* column 2 */
+    0, 1,
+    /* column 3 */
+    0, 1,
+    /* column 4 */
+    0, 1,
+    /* column 5 */
+    0, 1,
+    /* column 6 */
+    0, 1,
+    /* column 7 */
+    0, 1,
+    /* column 8 */
+    0, 1,
+    /* column 9 */
+    0, 1,
+    /* column 10 */
+    0, 1,
+    /* column 11 */
+    0, 1,
+    /* column 12 */
+    0, 1,
+    /* column 13 */
+    0, 1,
+    /* column 14 */
+    0,
+    /* column 15 */
+    0, 1,
+    /* column 16 */
+    0, 1e-05, 2e-05, 3e-05, 4e-05, 5e-05, 6e-05, 7e-05,
+    8e-05, 9e-05, 0.0001, 0.00011, 0.00012, 0.00013, 0.00014, 0.00015,
+    0.00016, 0.00017, 0.00018, 0.00019, 0.0002, 0.00021, 0.00022, 0.00023,
+    0.00024, 0.00025, 0.00026, 0.00027, 0.00028, 0.00029, 0.0003, 0.00031,
+    0.00032, 0.00033, 0.00034, 0.00035, 0.00036, 0.00037, 0.00038, 0.00039,
+    0.0004, 0.00041, 0.00042, 0.00043, 0.00044, 0.00045, 0.00046, 0.00047,
+    0.00048, 0.00049, 0.0005, 0.00051, 0.00052, 0.00054, 0.00055, 0.00056,
+    0.00057, 0.00058, 0.0006, 0.00061, 0.00062, 0.00063, 0.00064, 0.00065,
+    0.00066, 0.00067, 0.00068, 0.00069, 0.0007, 0.00071, 0.00072, 0.00073,
+    0.00074, 0.00075, 0.00076, 0.00077, 0.00078, 0.00079, 0.0008, 0.00081,
+    0.00082, 0.00083, 0.00084, 0.00085, 0.00086, 0.00087, 0.00088, 0.00089,
+    0.0009, 0.00091, 0.00092, 0.00093, 0.00094, 0.00095, 0.00096, 0.00097,
+    0.00098, 0.00099, 0.001, 0.00101, 0.00103, 0.00104, 0.0011, 0.00112,
+    0.0012, 0.0013, 0.0014, 0.0015, 0.0016, 0.0017, 0.0018, 0.00189,
+    0.0019, 0.002, 0.00208, 0.0022, 0.0023, 0.00232, 0.0024, 0.0025,
+    0.0026, 0.0027, 0.0028, 0.0029, 0.003, 0.0031, 0.0032, 0.0033,
+    0.0034, 0.0035, 0.0036, 0.0037, 0.0038, 0.0039, 0.004, 0.0041,
+    0.00419, 0.0043, 0.0044, 0.0045, 0.0046, 0.00469, 0.0048, 0.0049,
+    0.005, 0.0051, 0.0052, 0.0053, 0.0054, 0.0055, 0.0056, 0.0057,
+    0.00573, 0.0058, 0.0059, 0.006, 0.0061, 0.0062, 0.0063, 0.0064,
+    0.0065, 0.0066, 0.0067, 0.0068, 0.0069, 0.007, 0.0071, 0.0072,
+    0.0073, 0.0074, 0.0075, 0.0076, 0.0077, 0.0078, 0.0079, 0.008,
+    0.00809, 0.0082, 0.00829, 0.00839, 0.0085, 0.00859, 0.00879, 0.00889,
+    0.009, 0.00909, 0.00929, 0.00939, 0.0095, 0.0097, 0.00989, 0.01,
+    0.01029, 0.011, 0.0115, 0.0119, 0.012, 0.01209, 0.013, 0.014,
+    0.0144, 0.015, 0.016, 0.017, 0.018, 0.0184, 0.019, 0.02,
+    0.021, 0.022, 0.023, 0.024, 0.025, 0.026, 0.0264, 0.027,
+    0.028, 0.029, 0.03, 0.031, 0.032, 0.033, 0.034, 0.035,
+    0.036, 0.037, 0.038, 0.039, 0.04, 0.041, 0.042, 0.043,
+    0.044, 0.047, 0.048, 0.052, 0.054, 0.055, 0.056, 0.058,
+    0.059, 0.061, 0.062, 0.065, 0.066, 0.067, 0.068, 0.07,
+    0.073, 0.076, 0.082, 0.089, 0.096, 0.098, 0.099, 0.106,
+    0.109, 0.114, 0.126, 0.136, 0.141, 0.151, 0.172, 0.183,
+    0.191, 0.192, 0.197, 0.198, 0.23, 0.494, 0.5,
+    /* column 17 */
+    0.0005, 0.001, 0.002, 0.003, 0.004, 0.005, 0.006, 0.0069,
+    0.007, 0.008, 0.0083, 0.009, 0.0093, 0.0096, 0.01, 0.011,
+    0.012, 0.013, 0.014, 0.015, 0.016, 0.017, 0.0174, 0.018,
+    0.019, 0.02, 0.0201, 0.0206, 0.0208, 0.022, 0.023, 0.024,
+    0.025, 0.026, 0.027, 0.028, 0.029, 0.03, 0.031, 0.032,
+    0.033, 0.034, 0.035, 0.036, 0.037, 0.038, 0.039, 0.04,
+    0.041, 0.0419, 0.043, 0.044, 0.045, 0.0469, 0.048, 0.049,
+    0.05, 0.051, 0.053, 0.054, 0.055, 0.056, 0.057, 0.059,
+    0.061, 0.062, 0.064, 0.066, 0.067, 0.068, 0.071, 0.073,
+    0.076, 0.085, 0.095,
+    /* column 18 */
+    0.0029, 0.003, 0.004, 0.00406, 0.00419, 0.0048, 0.005, 0.0058,
+    0.006, 0.01, 0.012, 0.013, 0.014, 0.015, 0.016, 0.019,
+    0.022, 0.023, 0.024, 0.025, 0.027, 0.028, 0.029, 0.031,
+    0.03121, 0.032, 0.033, 0.03375, 0.034, 0.035, 0.036, 0.037,
+    0.038, 0.039, 0.04, 0.042, 0.043, 0.044, 0.045, 0.046,
+    0.047, 0.048, 0.049, 0.05, 0.051, 0.052, 0.053, 0.054,
+    0.055, 0.056, 0.057, 0.058, 0.059, 0.06, 0.061, 0.062,
+    0.063, 0.064, 0.065, 0.066, 0.067, 0.068, 0.069, 0.07,
+    0.071, 0.072, 0.073, 0.074, 0.075, 0.076, 0.077, 0.078,
+    0.079, 0.08, 0.081, 0.082, 0.083, 0.084, 0.085, 0.086,
+    0.087, 0.088, 0.089, 0.09, 0.091, 0.09159, 0.092, 0.093,
+    0.094, 0.095, 0.096, 0.097, 0.098, 0.099, 0.1, 0.101,
+    0.102, 0.103, 0.104, 0.105, 0.106, 0.107, 0.108, 0.109,
+    0.11, 0.111, 0.11118, 0.112, 0.113, 0.11329, 0.114, 0.115,
+    0.116, 0.117, 0.118, 0.119, 0.12, 0.121, 0.122, 0.123,
+    0.124, 0.125, 0.126, 0.127, 0.128, 0.129, 0.13, 0.131,
+    0.132, 0.133, 0.134, 0.135, 0.136, 0.137, 0.138, 0.139,
+    0.14, 0.141, 0.142, 0.143, 0.144, 0.145, 0.146, 0.147,
+    0.148, 0.149, 0.15, 0.151, 0.152, 0.153, 0.154, 0.155,
+    0.156, 0.157, 0.158, 0.159, 0.16, 0.161, 0.162, 0.163,
+    0.164, 0.165, 0.166, 0.167, 0.168, 0.169, 0.17, 0.171,
+    0.172, 0.173, 0.174, 0.175, 0.176, 0.177, 0.178, 0.179,
+    0.18, 0.181, 0.182, 0.183, 0.184, 0.185, 0.186, 0.187,
+    0.188, 0.189, 0.19, 0.191, 0.192, 0.193, 0.194, 0.195,
+    0.196, 0.197, 0.198, 0.199, 0.2, 0.201, 0.202, 0.203,
+    0.204, 0.205, 0.206, 0.207, 0.208, 0.209, 0.21, 0.212,
+    0.213, 0.214, 0.216, 0.219, 0.221, 0.223, 0.224, 0.23,
+    0.231, 0.233, 0.234, 0.235, 0.236, 0.237, 0.239, 0.244,
+    0.248, 0.25, 0.252, 0.253, 0.255, 0.258, 0.261, 0.272,
+    0.273, 0.28, 0.292, 0.301, 0.43,
+    /* column 19 */
+    0.028, 0.036, 0.037, 0.038, 0.044, 0.045, 0.046, 0.049,
+    0.05, 0.051, 0.052, 0.054, 0.055, 0.056, 0.057, 0.058,
+    0.06, 0.061, 0.062, 0.063, 0.064, 0.065, 0.066, 0.067,
+    0.068, 0.069, 0.07, 0.071, 0.072, 0.073, 0.074, 0.075,
+    0.076, 0.077, 0.078, 0.079, 0.08, 0.081, 0.082, 0.083,
+    0.084, 0.085, 0.086, 0.087, 0.088, 0.089, 0.09, 0.091,
+    0.092, 0.093, 0.094, 0.095, 0.096, 0.097, 0.098, 0.099,
+    0.1, 0.101, 0.102, 0.103, 0.104, 0.107, 0.108, 0.109,
+    0.11, 0.111, 0.112, 0.113, 0.114, 0.115, 0.116, 0.119,
+    0.12, 0.121, 0.122, 0.123, 0.124, 0.125, 0.126, 0.127,
+    0.128, 0.129, 0.13, 0.131, 0.132, 0.133, 0.134, 0.135,
+    0.136, 0.137, 0.138, 0.139, 0.14, 0.141, 0.142, 0.143,
+    0.144, 0.146, 0.147, 0.148, 0.149, 0.15, 0.151, 0.152,
+    0.153, 0.154, 0.155, 0.156, 0.157, 0.158, 0.16, 0.161,
+    0.162, 0.163, 0.164, 0.165, 0.166, 0.167, 0.168, 0.17,
+    0.171, 0.173, 0.174, 0.175, 0.176, 0.177, 0.178, 0.179,
+    0.18, 0.181, 0.183, 0.184, 0.187, 0.188, 0.193, 0.195,
+    0.197, 0.2, 0.201, 0.203, 0.215, 0.216, 0.232, 0.233,
+    /* column 20 */
+    0.0024, 0.0028, 0.003, 0.0031, 0.00384, 0.004, 0.0045, 0.00485,
+    0.005, 0.0054, 0.0055, 0.00558, 0.0076, 0.0087, 0.009, 0.01,
+    0.011, 0.012, 0.013, 0.01347, 0.014, 0.017, 0.019, 0.02,
+    0.02217, 0.023, 0.025, 0.026, 0.027, 0.028, 0.029, 0.03042,
+    0.03249, 0.033, 0.034, 0.035, 0.037, 0.039, 0.041, 0.042,
+    0.043, 0.045, 0.04536, 0.046, 0.047, 0.048, 0.049, 0.05,
+    0.051, 0.052, 0.053, 0.054, 0.055, 0.056, 0.057, 0.05745,
+    0.058, 0.059, 0.05925, 0.06, 0.061, 0.06149, 0.062, 0.063,
+    0.064, 0.06493, 0.065, 0.06548, 0.066, 0.06693, 0.067, 0.06793,
+    0.068, 0.069, 0.06955, 0.07, 0.07068, 0.071, 0.07172, 0.072,
+    0.073, 0.0738, 0.074, 0.07458, 0.07483, 0.07492, 0.075, 0.07587,
+    0.076, 0.07661, 0.07692, 0.077, 0.0774, 0.07762, 0.07792, 0.07796,
+    0.078, 0.079, 0.08, 0.08004, 0.081, 0.08108, 0.082, 0.08266,
+    0.083, 0.08316, 0.08366, 0.084, 0.085, 0.08568, 0.086, 0.08669,
+    0.087, 0.08731, 0.0877, 0.088, 0.0887, 0.089, 0.08939, 0.09,
+    0.09043, 0.091, 0.0915, 0.09173, 0.092, 0.09274, 0.093, 0.09375,
+    0.094, 0.09475, 0.095, 0.096, 0.09623, 0.09667, 0.09677, 0.097,
+    0.09728, 0.09778, 0.098, 0.099, 0.09937, 0.09979, 0.1, 0.1008,
+    0.10083, 0.101, 0.10181, 0.10187, 0.102, 0.10282, 0.10291, 0.103,
+    0.10383, 0.104, 0.10483, 0.10489, 0.105, 0.10584, 0.106, 0.10602,
+    0.10669, 0.10685, 0.107, 0.10706, 0.108, 0.1081, 0.10878, 0.109,
+    0.10914, 0.10987, 0.11, 0.11088, 0.111, 0.112, 0.11207, 0.11226,
+    0.1129, 0.113, 0.1133, 0.114, 0.11434, 0.11491, 0.115, 0.11592,
+    0.116, 0.11642, 0.11693, 0.117, 0.11746, 0.11776, 0.118, 0.11895,
+    0.119, 0.12, 0.12058, 0.121, 0.122, 0.12266, 0.123, 0.1237,
+    0.124, 0.125, 0.12552, 0.12577, 0.126, 0.12681, 0.127, 0.12785,
+    0.128, 0.129, 0.13, 0.13003, 0.131, 0.13103, 0.132, 0.133,
+    0.13305, 0.134, 0.135, 0.136, 0.13608, 0.13617, 0.137, 0.138,
+    0.139, 0.14, 0.14012, 0.141, 0.14112, 0.14137, 0.142, 0.143,
+    0.14314, 0.144, 0.14449, 0.145, 0.14516, 0.146, 0.14616, 0.147,
+    0.1476, 0.148, 0.14864, 0.149, 0.15, 0.15072, 0.151, 0.152,
+    0.1528, 0.153, 0.154, 0.155, 0.156, 0.15696, 0.157, 0.158,
+    0.159, 0.16, 0.161, 0.162, 0.16216, 0.163, 0.164, 0.16424,
+    0.165, 0.166, 0.167, 0.168, 0.169, 0.17, 0.171, 0.172,
+    0.173, 0.17359, 0.174, 0.175, 0.1754, 0.17567, 0.176, 0.177,
+    0.178, 0.179, 0.18, 0.181, 0.182, 0.183, 0.184, 0.185,
+    0.18503, 0.186, 0.187, 0.188, 0.19, 0.19126, 0.193, 0.19334,
+    0.194, 0.195, 0.19542, 0.196, 0.197, 0.198, 0.199, 0.2,
+    0.20062, 0.201, 0.202, 0.203, 0.204, 0.205, 0.206, 0.207,
+    0.21, 0.214, 0.215, 0.21517, 0.216, 0.218, 0.219, 0.221,
+    0.222, 0.223, 0.227, 0.228, 0.231, 0.237, 0.241, 0.242,
+    0.244, 0.245, 0.247, 0.249, 0.251, 0.253, 0.255, 0.258,
+    0.262, 0.274, 0.28, 0.281, 0.288, 0.297, 0.298, 0.321,
+    0.329, 0.334, 0.395, 0.445,
+    /* column 21 */
+    0, 1,
+    /* column 22 */
+    0, 1,
+    /* column 23 */
+    0, 1
+};
+
+const struct fann_compressed_column compressed_columns[24] = {
+    {7, FANN_COLUMN_DICTIONARY, 0, 0, 0}, /* input 0 */
+    {1, FANN_COLUMN_DICTIONARY, 96, 0, 0}, /* input 1 */
+    {1, FANN_COLUMN_DICTIONARY, 98, 0, 0}, /* input 2 */
+    {1, FANN_COLUMN_DICTIONARY, 100, 0, 0}, /* input 3 */
+    {1, FANN_COLUMN_DICTIONARY, 102, 0, 0}, /* input 4 */
+    {1, FANN_COLUMN_DICTIONARY, 104, 0, 0}, /* input 5 */
+    {1, FANN_COLUMN_DICTIONARY, 106, 0, 0}, /* input 6 */
+    {1, FANN_COLUMN_DICTIONARY, 108, 0, 0}, /* input 7 */
+    {1, FANN_COLUMN_DICTIONARY, 110, 0, 0}, /* input 8 */
+    {1, FANN_COLUMN_DICTIONARY, 112, 0, 0}, /* input 9 */
+    {1, FANN_COLUMN_DICTIONARY, 114, 0, 0}, /* input 10 */
+    {1, FANN_COLUMN_DICTIONARY, 116, 0, 0}, /* input 11 */
+    {1, FANN_COLUMN_DICTIONARY, 118, 0, 0}, /* input 12 */
+    {1, FANN_COLUMN_DICTIONARY, 120, 0, 0}, /* input 13 */
+    {0, FANN_COLUMN_DICTIONARY, 122, 0, 0}, /* input 14 */
+    {1, FANN_COLUMN_DICTIONARY, 123, 0, 0}, /* input 15 */
+    {9, FANN_COLUMN_DICTIONARY, 125, 0, 0}, /* input 16 */
+    {7, FANN_COLUMN_DICTIONARY, 396, 0, 0}, /* input 17 */
+    {8, FANN_COLUMN_DICTIONARY, 471, 0, 0}, /* input 18 */
+    {8, FANN_COLUMN_DICTIONARY, 708, 0, 0}, /* input 19 */
+    {9, FANN_COLUMN_DICTIONARY, 852, 0, 0}, /* input 20 */
+    {1, FANN_COLUMN_DICTIONARY, 1200, 0, 0}, /* output 0 */
+    {1, FANN_COLUMN_DICTIONARY, 1202, 0, 0}, /* output 1 */
+    {1, FANN_COLUMN_DICTIONARY, 1204, 0, 0} /* output 2 */
+};
+
+const uint8_t compressed_records[29252] = {
+    0x48, 0x00, 0x60, 0xC0, 0x8D, 0xF7, 0xC7, 0x22, 0x91, 0x01, 0x80, 0x18, 0x4A, 0xDE, 0x8C, 0x35,
+    0x02, 0x05, 0x82, 0x1B, 0x97, 0xA9, 0x91, 0x59, 0xBC, 0x01, 0x00, 0x76, 0x3C, 0x62, 0x3B, 0x91,
+    0xF8, 0x00, 0x00, 0xF6, 0x80, 0xD0, 0x5E, 0x86, 0x91, 0x05, 0x00, 0xCC, 0xF9, 0xC0, 0x91, 0xAC,
+    0xE3, 0x2C, 0x00, 0xD8, 0xA3, 0x31, 0x64, 0x62, 0xC5, 0x18, 0x04, 0x70, 0x44, 0x83, 0x96, 0x12,
+    0x8D, 0x21, 0x00, 0x61, 0x4D, 0x87, 0x8B, 0xC8, 0x0D, 0x2F, 0x10, 0x90, 0x82, 0x8A, 0x55, 0xCB,
+    0x25, 0xB6, 0x00, 0x80, 0x3E, 0x9F, 0x2B, 0x20, 0x36, 0x14, 0x0A, 0x06, 0x8D, 0x22, 0x8D, 0x34,
+    0xF5, 0x58, 0x2A, 0x00, 0xEA, 0x68, 0xE4, 0x36, 0x12, 0x12, 0x07, 0x00, 0x24, 0xE3, 0x04, 0xD6,
+    0x78, 0x93, 0x08, 0x00, 0xF0, 0x93, 0x29, 0x43, 0x71, 0xC6, 0x50, 0x00, 0xE0, 0x62, 0x63, 0x74,
+    0x61, 0x8B, 0x1B, 0x00, 0x80, 0x08, 0x07, 0x6D, 0x06, 0x17, 0x31, 0x00, 0x00, 0x1B, 0x0E, 0x22,
+    0x8F, 0x35, 0x5E, 0x01, 0x00, 0x40, 0x92, 0x34, 0xA7, 0x39, 0x34, 0x02, 0x00, 0x9D, 0x2E, 0x78,
+    0x41, 0xAD, 0xB4, 0x03, 0x00, 0x08, 0x80, 0x3A, 0x4F, 0x52, 0xB2, 0x02, 0x00, 0xB0, 0x91, 0x14,
+    0x9D, 0xE4, 0x61, 0x09, 0x00, 0x48, 0x03, 0x99, 0x41, 0x41, 0x42, 0x4B, 0x00, 0xA0, 0x05, 0xD4,
+    0x55, 0x43, 0x89, 0x36, 0x00, 0x70, 0x4A, 0x04, 0xEC, 0x25, 0x16, 0x97, 0x00, 0xC0, 0x23, 0x8C,
+    0xDD, 0x4C, 0x34, 0xEE, 0x00, 0xA0, 0x02, 0x2B, 0x2C, 0x1D, 0x3E, 0xF4, 0x04, 0x00, 0x7D, 0x3C,
+    0x45, 0x2A, 0x73, 0xF8, 0x01, 0x10, 0xDE, 0x78, 0xD0, 0x72, 0x4E, 0x91, 0x04, 0x00, 0x38, 0xD1,
+    0x50, 0xF1, 0xCC, 0xA1, 0x0E, 0x00, 0xCC, 0x23, 0xA1, 0x4B, 0x19, 0xC7, 0x52, 0x00, 0xA0, 0x86,
+    0xB4, 0xB5, 0x03, 0x88, 0x54, 0x00, 0xC0, 0x1B, 0xA2, 0x25, 0x88, 0x45, 0x70, 0x01, 0x00, 0x1A,
+    0xCA, 0x1C, 0x4F, 0x2C, 0x4E, 0x00, 0x80, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0x04, 0x01, 0x00, 0x6B,
+    0x34, 0x6D, 0x34, 0xBD, 0x48, 0x04, 0x00, 0xD0, 0x7C, 0xD2, 0x5E, 0x88, 0xB1, 0x06, 0x00, 0x08,
+    0xD0, 0xB4, 0xD1, 0xF4, 0x62, 0x10, 0x00, 0x88, 0xB3, 0x58, 0x93, 0x01, 0x46, 0x13, 0x00, 0x20,
+    0x47, 0xA3, 0x24, 0x92, 0x89, 0x48, 0x02, 0xE0, 0xCD, 0xC6, 0x2D, 0x88, 0x12, 0x37, 0x00, 0x80,
+    0x9E, 0x4B, 0xD7, 0x4D, 0x23, 0x96, 0x82, 0x02, 0x41, 0x1B, 0xAB, 0x9F, 0x35, 0x64, 0x01, 0x00,
+    0x76, 0x3C, 0x5D, 0x3C, 0x79, 0xC8, 0x09, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0xD1, 0x08, 0x00,
+    0xC4, 0xE9, 0x04, 0xCE, 0x84, 0xE3, 0x14, 0x00, 0x40, 0x43, 0xF1, 0x6A, 0x69, 0x45, 0x9B, 0x00,
+    0xF0, 0x40, 0xB3, 0xD7, 0x72, 0x8E, 0x38, 0x00, 0x60, 0x80, 0x70, 0xB7, 0x86, 0x25, 0x4D, 0x00,
+    0x80, 0x19, 0xCD, 0x21, 0x8D, 0x3A, 0x72, 0x02, 0x80, 0x3B, 0x12, 0x23, 0x0D, 0x55, 0x04, 0x0A,
+    0x00, 0x6D, 0x34, 0x73, 0x39, 0xC0, 0x58, 0x04, 0x00, 0xE8, 0x68, 0xD2, 0xA8, 0xD6, 0x10, 0x2A,
+    0x00, 0x30, 0xBA, 0xD0, 0xF1, 0xE0, 0x22, 0x10, 0x00, 0x7A, 0xF1, 0xB1, 0xE2, 0x80, 0x46, 0x10,
+    0x00, 0xA0, 0x4F, 0x70, 0xB0, 0xB3, 0x20, 0x1C, 0x00, 0x00, 0x8D, 0x86, 0x4D, 0x28, 0x12, 0x75,
+    0x01, 0x00, 0x05, 0x0E, 0x99, 0x4C, 0x2C, 0xFA, 0x22, 0x00, 0x62, 0x93, 0x31, 0x15, 0x62, 0x0A,
+    0x02, 0x08, 0x20, 0x44, 0x5A, 0x5C, 0x49, 0x48, 0x01, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0xB1,
+    0x85, 0x00, 0xC0, 0xA9, 0x9C, 0xB5, 0x18, 0x63, 0x0D, 0x00, 0x08, 0x41, 0x60, 0x5A, 0xD0, 0x47,
+    0x0C, 0x00, 0x20, 0xA7, 0x93, 0x85, 0x23, 0x88, 0xA5, 0x00, 0x40, 0x8E, 0xC6, 0xF3, 0x68, 0x1B,
+    0x5F, 0x02, 0xC0, 0x96, 0xCD, 0xD0, 0x0A, 0x1B, 0x22, 0x03, 0x00, 0x4A, 0x0E, 0x22, 0x13, 0x3E,
+    0xFC, 0x05, 0x08, 0x7B, 0x34, 0x4B, 0x17, 0xC4, 0x98, 0x05, 0x00, 0xFE, 0x74, 0xC6, 0x64, 0x5A,
+    0x11, 0x04, 0x20, 0x60, 0x10, 0xC5, 0xF9, 0x90, 0x22, 0x04, 0x20, 0x30, 0xB3, 0x79, 0x9C, 0xD1,
+    0xC7, 0x8E, 0x88, 0xC0, 0x62, 0x42, 0x04, 0x43, 0x86, 0x43, 0x00, 0x28, 0x8D, 0x67, 0xEB, 0x67,
+    0x0E, 0x1B, 0x00, 0x00, 0x91, 0x4B, 0x93, 0x8D, 0x1B, 0xE6, 0x00, 0x20, 0x03, 0xB1, 0x6D, 0xA0,
+    0x9C, 0x3C, 0x05, 0x00, 0x6E, 0x46, 0x35, 0x33, 0x3F, 0x38, 0x3B, 0x00, 0xDE, 0x6C, 0xBA, 0x60,
+    0x44, 0x71, 0x19, 0x00, 0xA8, 0x59, 0x60, 0x79, 0x38, 0xA3, 0x2D, 0x00, 0x10, 0xA0, 0x71, 0x4A,
+    0x71, 0xC4, 0x10, 0x80, 0x10, 0x00, 0x43, 0xD8, 0xE3, 0x8C, 0x46, 0x00, 0x40, 0x8C, 0xE6, 0x2E,
+    0x65, 0x1D, 0x7B, 0x00, 0x40, 0xAB, 0x4A, 0x50, 0xCC, 0x16, 0x1D, 0x05, 0x80, 0x36, 0x1E, 0x4B,
+    0x22, 0x6D, 0x2C, 0x06, 0x00, 0x6E, 0x3C, 0x66, 0x3B, 0x9C, 0x18, 0x00, 0x00, 0x44, 0x35, 0x36,
+    0x76, 0x40, 0x44, 0x04, 0x00, 0xA4, 0x61, 0xD1, 0x02, 0x52, 0x22, 0x0B, 0x00, 0xC0, 0xA3, 0xF9,
+    0xE2, 0x39, 0x44, 0x0A, 0x00, 0x60, 0xC7, 0x84, 0x66, 0x92, 0x8D, 0xBB, 0x00, 0xA0, 0x40, 0x46,
+    0x0E, 0x26, 0x1A, 0x67, 0x00, 0xC0, 0x9C, 0x10, 0x59, 0xCD, 0x29, 0x6A, 0x00, 0x00, 0x27, 0xAD,
+    0x5E, 0x43, 0x47, 0xF4, 0x44, 0x00, 0x14, 0x2A, 0x4E, 0x28, 0x91, 0x48, 0x8C, 0x00, 0xCC, 0x5C,
+    0xA4, 0x4E, 0x38, 0x11, 0x04, 0x20, 0xA0, 0x29, 0x65, 0x59, 0x35, 0xA1, 0x0E, 0x00, 0x78, 0xB3,
+    0x51, 0xBB, 0x71, 0x45, 0x08, 0x00, 0x80, 0xE6, 0x33, 0x64, 0xF4, 0x83, 0x0C, 0x00, 0xE0, 0x50,
+    0xC9, 0x0D, 0x67, 0x16, 0x85, 0x00, 0x82, 0x88, 0x4D, 0xD6, 0x8D, 0x20, 0x92, 0x00, 0x80, 0x2D,
+    0x9A, 0x32, 0x9E, 0x48, 0xB4, 0x00, 0x04, 0x6A, 0x3C, 0x42, 0x3F, 0x46, 0xF8, 0x01, 0x00, 0xE8,
+    0x68, 0x8C, 0x4E, 0xFC, 0x30, 0x04, 0x00, 0x50, 0xE0, 0xC0, 0xF1, 0x9C, 0xE2, 0x0D, 0x00, 0xC4,
+    0x83, 0x79, 0xD3, 0x99, 0x45, 0x09, 0x00, 0xF0, 0x66, 0x73, 0xC7, 0xE3, 0x8B, 0x12, 0x00, 0xA0,
+    0x4F, 0xE7, 0x8B, 0x47, 0x10, 0x7B, 0x00, 0x01, 0xC0, 0x48, 0x89, 0x4D, 0x8A, 0xEC, 0x02, 0x80,
+    0x34, 0x1A, 0xA6, 0x92, 0x4B, 0xBC, 0x00, 0x00, 0x6B, 0x34, 0x98, 0x58, 0xB6, 0x88, 0x04, 0x00,
+    0xA0, 0x35, 0x6A, 0x8C, 0x60, 0xE4, 0x04, 0x08, 0x78, 0xF0, 0xA4, 0x9D, 0x64, 0x23, 0x08, 0x00,
+    0x60, 0xA2, 0x79, 0x2D, 0xF9, 0xC9, 0x17, 0x00, 0x30, 0xC7, 0x63, 0x75, 0xD3, 0x87, 0x16, 0x01,
+    0x80, 0x9E, 0x63, 0x2D, 0x47, 0x15, 0x9B, 0x01, 0x40, 0x9A, 0xC2, 0x8B, 0x8A, 0x0F, 0x5A, 0x01,
+    0x80, 0x47, 0x13, 0x21, 0x9A, 0x2B, 0x0C, 0x02, 0x08, 0x69, 0x50, 0x7E, 0x49, 0xA2, 0x48, 0x02,
+    0x40, 0xAC, 0x50, 0xCC, 0x52, 0x9C, 0xD1, 0x08, 0x00, 0xE0, 0xD1, 0x6C, 0x09, 0xC1, 0x61, 0x2D,
+    0x00, 0x70, 0xF3, 0x11, 0x2B, 0x81, 0xC6, 0x23, 0x80, 0xE0, 0xEB, 0x22, 0x75, 0x73, 0x47, 0x2E,
+    0x00, 0x80, 0xC2, 0x45, 0x2C, 0x08, 0x10, 0x55, 0x01, 0x40, 0x1D, 0xCD, 0x9F, 0xCC, 0x37, 0xE6,
+    0x02, 0x00, 0x36, 0x93, 0xAB, 0x1A, 0x41, 0x44, 0x02, 0x04, 0x66, 0x38, 0x62, 0x2F, 0xB3, 0x08,
+    0x02, 0x00, 0x32, 0x50, 0xCA, 0x78, 0x28, 0xF1, 0x02, 0x00, 0xC8, 0xD1, 0x10, 0x96, 0xDD, 0xE1,
+    0x10, 0x00, 0xD0, 0x73, 0x59, 0x7C, 0xF1, 0xC7, 0x4A, 0x00, 0xA0, 0x26, 0x83, 0x69, 0x94, 0x8D,
+    0x9B, 0x00, 0x00, 0x8B, 0x08, 0xB3, 0x29, 0x19, 0x93, 0x80, 0x40, 0x9A, 0x0A, 0xCD, 0x0A, 0x12,
+    0xFE, 0x00, 0x80, 0x58, 0x9C, 0x24, 0x1D, 0x30, 0xEA, 0x00, 0x00, 0x75, 0x34, 0x6D, 0x34, 0xBD,
+    0x68, 0x04, 0x00, 0x00, 0x84, 0x38, 0x59, 0x34, 0xB2, 0x02, 0x00, 0x18, 0x12, 0x01, 0x6E, 0x0D,
+    0xE2, 0x13, 0x00, 0xF0, 0x33, 0xD9, 0x34, 0xDA, 0x46, 0x15, 0x00, 0x30, 0xA5, 0xA2, 0x44, 0xB3,
+    0x86, 0x19, 0x00, 0x40, 0x46, 0xC4, 0x6C, 0xC4, 0x1B, 0x37, 0x00, 0x40, 0x9A, 0x11, 0xA3, 0x91,
+    0x31, 0x82, 0x02, 0x00, 0x40, 0x9A, 0xB1, 0x9C, 0x4C, 0x5C, 0x06, 0x80, 0x72, 0x52, 0x83, 0x3C,
+    0xD1, 0xF8, 0x03, 0x00, 0xF8, 0x68, 0xBE, 0x68, 0x38, 0xD1, 0x08, 0x00, 0xF0, 0x00, 0xA5, 0x35,
+    0xCD, 0x61, 0x05, 0x00, 0xA8, 0xA3, 0x01, 0xA3, 0xF1, 0xC4, 0x0A, 0x40, 0x00, 0x47, 0x33, 0x1A,
+    0x44, 0x8F, 0x13, 0x00, 0xE1, 0x0D, 0xCB, 0x53, 0x4C, 0x15, 0x7F, 0x00, 0x80, 0xC0, 0x48, 0x88,
+    0x0F, 0x89, 0xDC, 0x00, 0x80, 0x3D, 0x93, 0x28, 0x19, 0x40, 0x54, 0x01, 0x80, 0x6E, 0x30, 0x72,
+    0x3D, 0xAA, 0x38, 0x0B, 0x00, 0xD7, 0x68, 0xB8, 0x58, 0x58, 0x11, 0x07, 0x00, 0xCC, 0x80, 0x14,
+    0x79, 0x50, 0x22, 0x0B, 0x00, 0x80, 0x93, 0x21, 0xCB, 0xC9, 0x44, 0x25, 0x04, 0x10, 0x06, 0x53,
+    0xF7, 0xC3, 0x8A, 0xA4, 0x00, 0x40, 0xC1, 0x84, 0x6C, 0x24, 0x1B, 0x71, 0x00, 0x00, 0x03, 0x0D,
+    0x22, 0xCC, 0x3D, 0xFA, 0x02, 0x00, 0x2A, 0x98, 0xA3, 0x94, 0x3C, 0x5C, 0x02, 0x00, 0x31, 0x20,
+    0x51, 0x13, 0xE1, 0x18, 0x00, 0x08, 0x06, 0x6A, 0x5C, 0x42, 0x92, 0x30, 0x02, 0x00, 0xD4, 0xE9,
+    0xB4, 0xD1, 0xF4, 0xA2, 0x13, 0x02, 0x20, 0x42, 0x01, 0x5B, 0x42, 0x43, 0x65, 0x00, 0x90, 0xA7,
+    0xF2, 0x16, 0x94, 0x89, 0x12, 0x00, 0x40, 0x01, 0x06, 0xEB, 0x85, 0x12, 0x95, 0x00, 0x40, 0x1A,
+    0xCD, 0x53, 0x0E, 0x1B, 0x62, 0x82, 0x80, 0x1B, 0x9C, 0xC2, 0x17, 0x7B, 0x3C, 0x01, 0x00, 0x82,
+    0x3C, 0x6E, 0x37, 0xB5, 0xD8, 0x0C, 0x00, 0x0A, 0x65, 0xC6, 0x78, 0x1C, 0x51, 0x04, 0x00, 0xD8,
+    0x31, 0x05, 0xA2, 0xC1, 0xE1, 0x33, 0x00, 0x18, 0xE4, 0x50, 0x32, 0x59, 0x44, 0xDE, 0x00, 0xF0,
+    0x66, 0xA3, 0x76, 0xE3, 0x8A, 0x99, 0x00, 0x40, 0x0D, 0x46, 0x2A, 0x85, 0x13, 0x6F, 0x00, 0x80,
+    0x24, 0x10, 0x96, 0xCD, 0x20, 0xF6, 0x06, 0x80, 0x39, 0x17, 0xA6, 0x8D, 0x5D, 0x5C, 0x45, 0x00,
+    0x72, 0x36, 0x57, 0x46, 0x62, 0xC8, 0x0B, 0x00, 0xEA, 0x68, 0xB0, 0x7E, 0xDC, 0xD0, 0x15, 0x00,
+    0xA8, 0xD1, 0x60, 0x8D, 0x00, 0x63, 0x2F, 0x00, 0x98, 0xA3, 0xC1, 0x52, 0x39, 0x45, 0x1C, 0x00,
+    0x20, 0xA7, 0x82, 0x17, 0xD4, 0x8A, 0xD6, 0x00, 0x40, 0x4E, 0x87, 0xC8, 0x84, 0x0F, 0x95, 0x00,
+    0xC2, 0x04, 0xCC, 0x59, 0x4D, 0x2B, 0xEE, 0x00, 0x84, 0x37, 0x1C, 0x2E, 0x17, 0x52, 0x4C, 0x0A,
+    0x04, 0x78, 0x28, 0x52, 0x32, 0x82, 0x78, 0x03, 0x00, 0xD0, 0x68, 0x70, 0x5A, 0x9A, 0x50, 0x02,
+    0x80, 0x50, 0x28, 0x0D, 0x46, 0x71, 0xA2, 0x10, 0x00, 0xF8, 0x90, 0xB9, 0x2B, 0x12, 0x45, 0x2A,
+    0x00, 0xC0, 0x47, 0x12, 0x06, 0x04, 0x88, 0x47, 0x00, 0x40, 0xD3, 0xA5, 0x8D, 0x26, 0x0C, 0x99,
+    0x02, 0x80, 0xA0, 0x82, 0xCC, 0xCD, 0x0D, 0x16, 0x0B, 0x80, 0x3D, 0x9A, 0xA7, 0x0F, 0x5B, 0xAC,
+    0x01, 0x00, 0x06, 0x30, 0x83, 0x3A, 0xD6, 0xA8, 0x13, 0x08, 0xFC, 0x70, 0x88, 0x78, 0x9E, 0x90,
+    0x02, 0x00, 0xB4, 0xE9, 0x5C, 0xF9, 0xC0, 0x21, 0x06, 0x00, 0x78, 0xB3, 0x51, 0xBB, 0x71, 0x45,
+    0x9F, 0x00, 0x70, 0x20, 0xD3, 0x4C, 0xD3, 0x93, 0xD3, 0x00, 0xA0, 0x49, 0xC4, 0x0C, 0x64, 0x1C,
+    0x75, 0x00, 0x00, 0xB6, 0xCA, 0x93, 0xCE, 0x1A, 0x85, 0x00, 0x82, 0x6D, 0xA1, 0x13, 0x9C, 0x15,
+    0xF1, 0x05, 0x00, 0x66, 0x2A, 0x63, 0x3A, 0x97, 0xC8, 0x0B, 0x00, 0xB1, 0x38, 0x12, 0x75, 0xBE,
+    0x91, 0x07, 0x08, 0x10, 0x33, 0x5D, 0xD1, 0x14, 0x22, 0x0E, 0x02, 0xB0, 0xA3, 0xE1, 0xD9, 0x00,
+    0x44, 0x4D, 0x00, 0x20, 0xC6, 0x54, 0xC6, 0x73, 0x89, 0x1A, 0x00, 0xE8, 0x9B, 0x67, 0x24, 0xC7,
+    0x44, 0x7A, 0x00, 0x81, 0x19, 0x09, 0xDA, 0xCD, 0x2A, 0x8A, 0x00, 0x00, 0x0A, 0x22, 0xBA, 0x1A,
+    0x63, 0xEC, 0x00, 0x00, 0x6A, 0x34, 0x6C, 0x46, 0x83, 0x38, 0x05, 0x00, 0x1E, 0x41, 0x60, 0x3C,
+    0xA4, 0x30, 0x07, 0x00, 0x78, 0x78, 0x78, 0x51, 0xF0, 0x23, 0x10, 0x10, 0x98, 0xE3, 0x61, 0xCB,
+    0x30, 0xC8, 0x12, 0xC0, 0x10, 0xC7, 0x03, 0x66, 0x34, 0x87, 0x2A, 0x08, 0x80, 0x4D, 0x45, 0x0E,
+    0x48, 0x14, 0xAF, 0x00, 0xC0, 0xB1, 0x8A, 0x54, 0xCE, 0x1C, 0xFD, 0x02, 0x00, 0x3C, 0xA0, 0xB3,
+    0x1E, 0x4A, 0x04, 0x01, 0x80, 0x6A, 0x24, 0x6F, 0x2F, 0xCC, 0xF8, 0x03, 0x00, 0xE0, 0x6C, 0xE4,
+    0x74, 0x6C, 0x91, 0x09, 0x00, 0xD5, 0xD1, 0xB4, 0xD1, 0xF4, 0x62, 0x0E, 0x00, 0x70, 0xA3, 0x61,
+    0x02, 0x21, 0xC5, 0x63, 0x00, 0xE0, 0x42, 0xE2, 0x24, 0xB4, 0x85, 0x4E, 0x00, 0xC0, 0x43, 0xA5,
+    0x48, 0x65, 0x0E, 0x93, 0x00, 0xC0, 0x15, 0xCC, 0x64, 0xCD, 0x3E, 0x9A, 0x02, 0x80, 0x02, 0xA0,
+    0xBF, 0x97, 0x74, 0xBC, 0x40, 0x04, 0xB7, 0x2A, 0x37, 0x1F, 0x68, 0x64, 0x84, 0x00, 0xEA, 0x68,
+    0xDA, 0x68, 0x7A, 0xB1, 0x04, 0x20, 0x64, 0x20, 0x11, 0x82, 0x01, 0xE2, 0x52, 0x00, 0x60, 0x43,
+    0x01, 0x93, 0x39, 0x45, 0x12, 0x00, 0x70, 0x25, 0x22, 0xB7, 0xB2, 0x8D, 0x53, 0x00, 0x40, 0xCD,
+    0x26, 0x4B, 0x85, 0x15, 0x5D, 0x00, 0x80, 0x9E, 0xCD, 0x1A, 0xCC, 0x30, 0x92, 0x00, 0x00, 0x54,
+    0x95, 0xAC, 0x19, 0x46, 0xFA, 0x05, 0x00, 0x71, 0x2E, 0x42, 0x14, 0xB3, 0x88, 0x03, 0x00, 0xE4,
+    0x7C, 0x0A, 0x8F, 0x6C, 0x91, 0x04, 0x00, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0x62, 0x0A, 0x00, 0x98,
+    0xB3, 0xE1, 0x4A, 0xB1, 0xC5, 0x4F, 0x00, 0xE0, 0x46, 0x23, 0xDA, 0x07, 0x88, 0x42, 0x00, 0x60,
+    0x0E, 0xC5, 0x28, 0xE5, 0x0E, 0x51, 0x00, 0x40, 0x9C, 0x0D, 0xD8, 0x8E, 0x1F, 0x7E, 0x02, 0x88,
+    0x45, 0x1C, 0xA6, 0x19, 0x38, 0x0C, 0x02, 0x00, 0x75, 0x34, 0x90, 0x29, 0x12, 0x39, 0x0B, 0x00,
+    0x86, 0x85, 0x90, 0x5C, 0xE6, 0x28, 0x0A, 0x00, 0xC0, 0xC1, 0xC8, 0xE9, 0xE0, 0x62, 0x28, 0x00,
+    0xC0, 0x32, 0xD9, 0x4A, 0x99, 0xC5, 0x9B, 0x00, 0xF0, 0x66, 0x63, 0x0A, 0xB4, 0x8F, 0xBE, 0x00,
+    0xC0, 0x8C, 0xE6, 0x89, 0xC6, 0x0E, 0x95, 0x00, 0x80, 0x98, 0xCB, 0x98, 0xCB, 0x2E, 0x26, 0x21,
+    0x00, 0x27, 0x98, 0xBA, 0x1C, 0x60, 0xD4, 0x08, 0x00, 0x1E, 0x36, 0xCD, 0x3E, 0x28, 0x29, 0x04,
+    0x00, 0x16, 0x69, 0xDE, 0x9A, 0xF8, 0x50, 0x08, 0x00, 0x00, 0x12, 0x4D, 0xDD, 0xE4, 0x61, 0x08,
+    0x00, 0x70, 0x53, 0x91, 0x03, 0x12, 0xC5, 0x56, 0x00, 0x48, 0x87, 0x42, 0x14, 0x23, 0x86, 0x20,
+    0x10, 0xC1, 0x80, 0x0B, 0x32, 0xE7, 0x1D, 0x79, 0x02, 0x40, 0x84, 0x4F, 0x28, 0x0E, 0x42, 0x82,
+    0x40, 0x04, 0x03, 0xB5, 0x4C, 0x3B, 0x40, 0xB4, 0x04, 0x08, 0x0F, 0x44, 0x70, 0x26, 0xE7, 0xA8,
+    0x0A, 0x00, 0x0C, 0x50, 0xD8, 0x58, 0xA0, 0x91, 0x17, 0x00, 0x48, 0xDA, 0x44, 0xCD, 0xF0, 0xE1,
+    0x31, 0x00, 0x88, 0x03, 0x2A, 0xC3, 0xE1, 0xC4, 0x08, 0x40, 0xE2, 0xA7, 0x23, 0x77, 0x03, 0x8C,
+    0x54, 0x00, 0x81, 0x40, 0x6C, 0x92, 0xE5, 0x21, 0xB1, 0x00, 0x00, 0x9C, 0x08, 0x9A, 0x49, 0x36,
+    0x4E, 0x00, 0x82, 0x60, 0x92, 0xA5, 0x1B, 0x34, 0xEA, 0x01, 0x00, 0x7F, 0x34, 0x65, 0x3B, 0x99,
+    0xA8, 0x03, 0x00, 0xD2, 0x88, 0xE0, 0x86, 0x2E, 0x91, 0x07, 0x00, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8,
+    0x62, 0x28, 0x00, 0x48, 0x03, 0xD2, 0x1B, 0x6A, 0xC5, 0x4B, 0x00, 0x80, 0x06, 0x74, 0x07, 0xC4,
+    0x8A, 0xBC, 0x00, 0x60, 0x8F, 0x66, 0xC9, 0x83, 0x15, 0x79, 0x01, 0xC0, 0x9D, 0xC8, 0x1C, 0x8B,
+    0x36, 0xEA, 0x00, 0x80, 0x38, 0x15, 0x46, 0x99, 0x7C, 0xCC, 0x00, 0x00, 0x70, 0x3E, 0x6F, 0x44,
+    0x8E, 0x48, 0x04, 0x00, 0xAA, 0x0D, 0x10, 0x48, 0x18, 0x04, 0x12, 0x00, 0x2A, 0xF0, 0x70, 0xA5,
+    0xD8, 0xE2, 0x2B, 0x00, 0xD0, 0x73, 0x09, 0xE3, 0x38, 0xC7, 0x97, 0x00, 0xC0, 0xC0, 0x13, 0x1B,
+    0x64, 0x90, 0x22, 0x00, 0x60, 0x4D, 0xE4, 0xE6, 0x03, 0x0D, 0x7D, 0x00, 0x40, 0x1B, 0x4D, 0x9F,
+    0x4F, 0x30, 0x6E, 0x00, 0x00, 0x3E, 0x9D, 0xA7, 0x9F, 0x30, 0xD4, 0x01, 0x00, 0x3E, 0x34, 0x5C,
+    0x13, 0xFC, 0x18, 0x02, 0x00, 0xAA, 0x8C, 0xD8, 0x8C, 0x06, 0xD1, 0x17, 0x00, 0xA8, 0x71, 0x6D,
+    0xA1, 0xD8, 0x22, 0x13, 0x48, 0x70, 0x03, 0x22, 0xE4, 0x89, 0xC6, 0x98, 0x40, 0x40, 0x8C, 0x54,
+    0x32, 0x54, 0x82, 0x3C, 0x00, 0x00, 0xCB, 0x27, 0x4D, 0x68, 0x11, 0x6D, 0x00, 0xC0, 0x1D, 0x42,
+    0x0C, 0x06, 0x1A, 0xDE, 0x02, 0x00, 0x38, 0x1B, 0x3E, 0x1B, 0x6A, 0xA4, 0x02, 0x00, 0xC7, 0x88,
+    0xE9, 0x29, 0x58, 0xE9, 0x04, 0x08, 0xA8, 0x2D, 0x56, 0x50, 0x76, 0x44, 0x07, 0x21, 0x88, 0xB9,
+    0xAC, 0x71, 0xF0, 0x63, 0x31, 0x00, 0x48, 0xA3, 0x89, 0xCC, 0x3A, 0xC5, 0x20, 0x00, 0x20, 0xE0,
+    0xD4, 0x17, 0xB2, 0x90, 0xC1, 0x00, 0x20, 0x4D, 0x66, 0x0C, 0x0A, 0x0D, 0x63, 0x00, 0x00, 0xA0,
+    0x8E, 0x99, 0xD0, 0x20, 0x2A, 0x01, 0x84, 0x37, 0xB4, 0x53, 0xA3, 0x78, 0x34, 0x02, 0x0C, 0x69,
+    0x2E, 0x58, 0x2A, 0xAA, 0xD8, 0x00, 0x08, 0x00, 0x6D, 0xD6, 0xA4, 0xDC, 0xF0, 0x17, 0x00, 0xA4,
+    0xF9, 0x50, 0x8D, 0xD8, 0xA2, 0x03, 0x00, 0x78, 0xB3, 0x29, 0x8A, 0x31, 0x43, 0x15, 0x00, 0x10,
+    0x28, 0xC4, 0xF6, 0x93, 0x89, 0xA3, 0x00, 0x00, 0x8B, 0xC7, 0x88, 0x64, 0x10, 0x75, 0x01, 0x40,
+    0x81, 0x4F, 0x58, 0x8D, 0x28, 0x32, 0x05, 0x80, 0x09, 0x94, 0xBE, 0x1B, 0x69, 0xFC, 0x00, 0x01,
+    0xB6, 0x32, 0x54, 0x26, 0xAC, 0x48, 0x12, 0x00, 0x4C, 0x6D, 0xFC, 0x6C, 0xAC, 0x91, 0x03, 0x00,
+    0xA8, 0xD1, 0x50, 0xB5, 0x50, 0x62, 0x10, 0x00, 0x78, 0xB3, 0x51, 0xBB, 0x71, 0xC5, 0x23, 0x01,
+    0x80, 0x26, 0x13, 0x76, 0x93, 0x89, 0x3D, 0x00, 0xE4, 0x01, 0x67, 0x6B, 0x47, 0x10, 0x85, 0x82,
+    0x81, 0x1D, 0x8D, 0xAA, 0x11, 0x3D, 0x42, 0x00, 0x80, 0x3A, 0x1A, 0x42, 0x9B, 0x6F, 0x74, 0x01,
+    0x09, 0x46, 0x2A, 0x8C, 0x3E, 0xD7, 0xF8, 0x03, 0x00, 0x50, 0x55, 0x14, 0x9D, 0x62, 0x69, 0x05,
+    0x00, 0x70, 0xF9, 0x24, 0xF1, 0x60, 0x21, 0x2F, 0x01, 0xA0, 0xF0, 0xEA, 0xC1, 0x31, 0xC2, 0x1A,
+    0x00, 0xC0, 0x86, 0x13, 0xF7, 0x23, 0x8A, 0xCC, 0x00, 0xC0, 0x8C, 0xA4, 0x0B, 0x02, 0x21, 0x8D,
+    0x11, 0x80, 0x1A, 0x09, 0x10, 0x49, 0x1D, 0x6E, 0x80, 0x80, 0x69, 0x0D, 0x1C, 0x24, 0x19, 0x21,
+    0x01, 0x80, 0x69, 0x3E, 0x86, 0x46, 0xBE, 0xE8, 0x04, 0x00, 0xF8, 0x14, 0xC4, 0x78, 0x16, 0xF1,
+    0x12, 0x00, 0xB4, 0xC9, 0x4C, 0xA5, 0x78, 0xA2, 0x10, 0x20, 0x10, 0xA5, 0x89, 0xE9, 0xD8, 0xC2,
+    0x62, 0x40, 0xC0, 0xE2, 0xB1, 0x83, 0x43, 0x84, 0x4B, 0x00, 0x20, 0x50, 0x47, 0x2E, 0x67, 0x17,
+    0x95, 0x02, 0xC0, 0xA2, 0x88, 0x19, 0xCD, 0x2B, 0x96, 0x02, 0x84, 0x35, 0x94, 0x9D, 0x22, 0x1B,
+    0x9C, 0x01, 0x00, 0x03, 0x30, 0x4D, 0x17, 0xC9, 0x88, 0x0B, 0x00, 0xCC, 0x54, 0x96, 0x70, 0xC8,
+    0x70, 0x17, 0x00, 0x10, 0x9B, 0x44, 0xD9, 0xDC, 0xD1, 0x0F, 0x00, 0x68, 0x43, 0xE1, 0x62, 0x61,
+    0xC5, 0x15, 0x80, 0x50, 0x47, 0xD3, 0x46, 0xD3, 0x8B, 0x04, 0x01, 0x40, 0x80, 0x46, 0xB9, 0xAB,
+    0x1D, 0x77, 0x00, 0xC0, 0x1F, 0x87, 0x95, 0x0B, 0x25, 0xE2, 0x00, 0x00, 0x01, 0xC6, 0x6A, 0x1C,
+    0xA0, 0x54, 0x05, 0x00, 0x7B, 0x50, 0x4B, 0x2D, 0x7C, 0xB8, 0x0A, 0x00, 0xD8, 0x84, 0xD8, 0x86,
+    0x1C, 0xB1, 0x09, 0x00, 0xBC, 0x09, 0xA9, 0xDD, 0xB8, 0xA2, 0x0B, 0x00, 0xA8, 0xA3, 0xD1, 0x09,
+    0x61, 0xC3, 0x67, 0x02, 0x20, 0xE0, 0xD3, 0xD5, 0xA1, 0x8D, 0x54, 0x01, 0x80, 0xC0, 0x06, 0xFA,
+    0x86, 0x27, 0x9D, 0x00, 0x80, 0x1B, 0x0F, 0x9C, 0x8F, 0x28, 0x0A, 0x05, 0x00, 0x03, 0x18, 0xCD,
+    0x9E, 0x78, 0x44, 0x05, 0x00, 0x66, 0x42, 0x6E, 0x33, 0xC1, 0x58, 0x02, 0x10, 0x02, 0x4C, 0x9A,
+    0x6E, 0xD8, 0x70, 0x29, 0x00, 0x30, 0xE1, 0x84, 0xE2, 0x20, 0xA4, 0x0D, 0x22, 0xA0, 0x52, 0xE1,
+    0xA2, 0xA1, 0xC4, 0xA2, 0x40, 0xB0, 0x40, 0x93, 0xE8, 0xE2, 0x8F, 0xCF, 0x00, 0x60, 0xCD, 0xE4,
+    0xB0, 0xE6, 0x1C, 0x57, 0x01, 0x00, 0x96, 0x90, 0x95, 0x0B, 0x25, 0xA6, 0x06, 0x80, 0x02, 0x1B,
+    0xCE, 0x1D, 0x7E, 0xAC, 0x01, 0x08, 0x03, 0x76, 0x9E, 0x1D, 0x40, 0xE9, 0x04, 0x00, 0x96, 0x60,
+    0xD8, 0x76, 0x54, 0xB1, 0x0A, 0x20, 0x70, 0x6B, 0xC0, 0xB4, 0xF8, 0xC8, 0x2A, 0x00, 0xD0, 0xA3,
+    0x91, 0xAA, 0xE1, 0x43, 0x8C, 0x00, 0x70, 0xE2, 0xF2, 0x38, 0xF2, 0x91, 0x53, 0x00, 0xA0, 0x8D,
+    0xE6, 0xAE, 0xC6, 0x19, 0x79, 0x01, 0x00, 0x20, 0x08, 0x19, 0xD0, 0x20, 0x06, 0x04, 0x00, 0x01,
+    0x9B, 0xC6, 0x98, 0x7D, 0xE4, 0x02, 0x00, 0x44, 0x22, 0x74, 0x28, 0xE7, 0xF8, 0x0C, 0x00, 0xF2,
+    0x2C, 0x9E, 0x52, 0x28, 0xB1, 0x17, 0x00, 0xD8, 0xD2, 0x88, 0x42, 0x49, 0xE3, 0x2C, 0x00, 0x98,
+    0x83, 0x89, 0xE2, 0x61, 0x43, 0x16, 0x00, 0x10, 0x20, 0x73, 0x55, 0x33, 0x88, 0x1A, 0x01, 0xE1,
+    0x80, 0x06, 0x15, 0x2F, 0x12, 0x39, 0x00, 0x02, 0x9E, 0x0E, 0x62, 0x15, 0x27, 0x8E, 0x00, 0x00,
+    0x3B, 0xA2, 0xCB, 0xAF, 0x53, 0xD4, 0x0C, 0x00, 0x0A, 0x34, 0x99, 0x2F, 0x10, 0xC9, 0x08, 0x00,
+    0xF6, 0x98, 0xD6, 0x78, 0x3C, 0xD1, 0x09, 0x20, 0xC0, 0xA9, 0x94, 0xF9, 0x2C, 0x22, 0x0A, 0x20,
+    0x08, 0x98, 0x18, 0xE0, 0x21, 0x90, 0x5B, 0x00, 0xA0, 0x67, 0x61, 0xE7, 0xB2, 0x8D, 0x1D, 0x00,
+    0x48, 0xCD, 0x65, 0x8B, 0x06, 0x12, 0x59, 0x00, 0x46, 0x9B, 0x07, 0xD6, 0xCB, 0x25, 0x66, 0x00,
+    0x80, 0x3F, 0x15, 0xAB, 0x9B, 0x3E, 0x24, 0x02, 0x00, 0x70, 0x34, 0x88, 0x34, 0xED, 0xC8, 0x03,
+    0x00, 0xAE, 0x41, 0x0E, 0x7F, 0xA0, 0xE9, 0x07, 0x00, 0x24, 0xD1, 0x70, 0x71, 0x68, 0x23, 0x13,
+    0x00, 0xB8, 0xE6, 0x19, 0x4C, 0x9B, 0x23, 0x49, 0x00, 0x10, 0xC0, 0x06, 0x71, 0x83, 0x81, 0x15,
+    0x00, 0x20, 0x4D, 0x27, 0xEC, 0x0A, 0x0B, 0x73, 0x01, 0xC0, 0x8A, 0x8D, 0x16, 0xCB, 0x29, 0xE6,
+    0x00, 0x00, 0x37, 0x25, 0x32, 0xA1, 0x41, 0x44, 0x02, 0x00, 0x78, 0x34, 0x12, 0x0D, 0x28, 0xE8,
+    0x00, 0x00, 0x60, 0x68, 0x3A, 0x57, 0x3E, 0x32, 0x04, 0x04, 0x38, 0xC0, 0x08, 0x19, 0xFD, 0x60,
+    0x14, 0x20, 0xA0, 0xC4, 0x01, 0x03, 0xF2, 0x43, 0x22, 0x40, 0xC0, 0x46, 0xA3, 0x45, 0xE3, 0x88,
+    0x28, 0x80, 0xA1, 0x0E, 0xA7, 0x8D, 0xA6, 0x17, 0x1D, 0x02, 0x40, 0x81, 0xD0, 0xD9, 0x8D, 0x2A,
+    0x4A, 0x03, 0x00, 0x34, 0x92, 0x37, 0x8F, 0x7D, 0x64, 0x05, 0x80, 0x66, 0x48, 0x79, 0x3A, 0xC4,
+    0x38, 0x0C, 0x00, 0xE6, 0x8C, 0xBA, 0x2E, 0xE2, 0xF1, 0x17, 0x00, 0xF4, 0xD1, 0xC0, 0xB8, 0xF8,
+    0x20, 0x13, 0x00, 0x40, 0x03, 0x0A, 0x34, 0xB2, 0x45, 0x57, 0x00, 0x10, 0x48, 0x25, 0x7A, 0x65,
+    0x8C, 0xB9, 0x00, 0xC0, 0xC6, 0x23, 0x6B, 0x24, 0x18, 0x77, 0x01, 0x80, 0x19, 0x8D, 0x58, 0x4C,
+    0x2B, 0x32, 0x02, 0x80, 0x48, 0xA3, 0x2B, 0x95, 0x53, 0x34, 0x01, 0x00, 0x66, 0x2E, 0x92, 0x3C,
+    0xEB, 0x18, 0x01, 0x00, 0x0C, 0x91, 0xEC, 0x74, 0x80, 0x31, 0x77, 0x00, 0x34, 0xF8, 0xC0, 0xB5,
+    0x48, 0xA3, 0x0A, 0x00, 0xC0, 0x56, 0x71, 0xCA, 0x59, 0xA3, 0x95, 0x00, 0xC1, 0x47, 0x03, 0xC6,
+    0x82, 0x8B, 0x38, 0x00, 0xE0, 0x5A, 0x65, 0x28, 0x47, 0x8A, 0x54, 0x01, 0x40, 0xB9, 0x49, 0x8A,
+    0x91, 0x89, 0xDC, 0x00, 0x84, 0x01, 0x99, 0xB3, 0x98, 0x5D, 0xC4, 0x05, 0x00, 0x62, 0x3C, 0x61,
+    0x3E, 0x82, 0x78, 0x09, 0x00, 0xF5, 0x84, 0xD2, 0x56, 0x9C, 0x71, 0x14, 0x00, 0x10, 0x83, 0x8C,
+    0xA1, 0x24, 0x13, 0x2A, 0x00, 0xD0, 0x42, 0x91, 0x32, 0x21, 0xC5, 0x19, 0x00, 0xB0, 0x08, 0x62,
+    0xD6, 0x11, 0x8F, 0x98, 0x00, 0x60, 0x4F, 0xA5, 0x0F, 0x08, 0x17, 0x99, 0x01, 0x80, 0x18, 0x4D,
+    0x16, 0xCC, 0x25, 0x9A, 0x02, 0x80, 0x37, 0x1B, 0x1C, 0x96, 0x27, 0x94, 0x06, 0x00, 0x81, 0x34,
+    0x70, 0x1E, 0xFE, 0x98, 0x13, 0x00, 0x0C, 0x68, 0x4E, 0x61, 0x42, 0xD2, 0x17, 0x00, 0x70, 0xD1,
+    0x60, 0xCD, 0x2C, 0xA2, 0x2F, 0x00, 0x08, 0x94, 0xE1, 0xE9, 0xE0, 0xC3, 0x15, 0x00, 0x60, 0x86,
+    0xD2, 0x44, 0x03, 0x87, 0x46, 0x00, 0x40, 0x4D, 0x87, 0xEC, 0x63, 0x1C, 0x5F, 0x03, 0xC0, 0x05,
+    0x8D, 0x1E, 0x0A, 0x3D, 0x3E, 0x01, 0x80, 0x38, 0x1A, 0xBA, 0x20, 0x52, 0x1C, 0x01, 0x02, 0xD4,
+    0x2C, 0x40, 0x3C, 0x48, 0x54, 0x03, 0x00, 0x0A, 0x69, 0x14, 0x8D, 0x86, 0xD1, 0x03, 0x40, 0xB0,
+    0xA9, 0xE4, 0xD1, 0x48, 0x63, 0x07, 0x20, 0xCA, 0xE3, 0x81, 0x32, 0x92, 0x42, 0x0D, 0x00, 0xC0,
+    0xA9, 0x43, 0xC8, 0xA4, 0x4A, 0x4C, 0x00, 0x80, 0xD8, 0x44, 0x6F, 0xE6, 0x9A, 0x5C, 0x00, 0x80,
+    0x87, 0x4F, 0x9C, 0x8E, 0x2D, 0x26, 0x01, 0x80, 0x38, 0x24, 0x38, 0xA3, 0x45, 0x0C, 0x02, 0x00,
+    0x6A, 0x2A, 0x89, 0x45, 0xC6, 0x68, 0x01, 0x00, 0xD4, 0xB4, 0x60, 0xD9, 0x6C, 0x11, 0x28, 0x00,
+    0xA0, 0xD9, 0x48, 0xCD, 0x00, 0x22, 0x4A, 0x00, 0x58, 0xE5, 0xF9, 0x2B, 0x8A, 0x45, 0x4C, 0x20,
+    0xB0, 0xB0, 0x61, 0x30, 0xA3, 0x20, 0xA1, 0x01, 0x40, 0x8E, 0xE6, 0x8D, 0x66, 0x18, 0x9F, 0x00,
+    0x40, 0x21, 0x0D, 0x55, 0x88, 0x2F, 0x2A, 0x03, 0x80, 0x39, 0x91, 0x24, 0x0F, 0x52, 0x64, 0x02,
+    0x00, 0x7D, 0x3E, 0x76, 0x34, 0xCD, 0x08, 0x0C, 0x00, 0x02, 0x5D, 0x82, 0x54, 0xD6, 0xD0, 0x07,
+    0x10, 0x48, 0x98, 0x84, 0xD1, 0x8C, 0x22, 0x09, 0x00, 0x28, 0x01, 0x82, 0x5D, 0x6A, 0x47, 0x57,
+    0x00, 0xF0, 0x66, 0xB3, 0xE6, 0x82, 0x8C, 0x3A, 0x01, 0x80, 0x12, 0x65, 0xEC, 0xA6, 0x13, 0x1B,
+    0x00, 0x00, 0x9E, 0x8F, 0xD7, 0xCD, 0x23, 0x72, 0x00, 0xC0, 0x0C, 0x1A, 0x30, 0x90, 0x6C, 0x64,
+    0x01, 0x00, 0x69, 0x34, 0x42, 0x21, 0x82, 0x88, 0x12, 0x00, 0xE6, 0x54, 0xC6, 0x5E, 0x6C, 0x31,
+    0x25, 0x00, 0x68, 0xF1, 0x5C, 0xA9, 0x90, 0xA2, 0x4E, 0x00, 0xF8, 0xA5, 0x51, 0x92, 0x71, 0xC3,
+    0x26, 0x80, 0xA0, 0x22, 0xC2, 0xE3, 0xE3, 0x83, 0xAF, 0x00, 0x40, 0xC6, 0xE5, 0xC9, 0x84, 0x13,
+    0x7F, 0x00, 0x00, 0x98, 0x8D, 0x1A, 0x87, 0x2F, 0x1A, 0x05, 0x00, 0x05, 0x17, 0xD3, 0x1B, 0x87,
+    0x1C, 0x02, 0x00, 0x66, 0x26, 0x50, 0x2D, 0x8A, 0x08, 0x04, 0x00, 0x10, 0x44, 0xC6, 0x78, 0x22,
+    0x31, 0x25, 0x00, 0x84, 0x92, 0x14, 0x0A, 0x19, 0xA3, 0x0F, 0x00, 0x20, 0xA2, 0xB9, 0x62, 0xF1,
+    0x44, 0x96, 0x00, 0x60, 0x40, 0xD3, 0x79, 0x53, 0x90, 0x17, 0x81, 0x80, 0xC8, 0x66, 0xB6, 0x4B,
+    0x1A, 0x79, 0x00, 0x00, 0x1F, 0x8D, 0x17, 0x88, 0x35, 0x0E, 0x01, 0x01, 0x52, 0x95, 0xA5, 0x97,
+    0x3B, 0x92, 0x02, 0x00, 0x6F, 0x1E, 0x3E, 0x14, 0xA2, 0xC8, 0x03, 0x10, 0xA6, 0x68, 0x80, 0xF3,
+    0x62, 0xF1, 0x06, 0x00, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0xE2, 0x0B, 0x00, 0x88, 0xA3, 0x91, 0x5A,
+    0xA1, 0x44, 0x5B, 0x00, 0xA8, 0x66, 0x52, 0xA6, 0x82, 0x8C, 0x26, 0x00, 0x80, 0x07, 0xA4, 0x47,
+    0xC0, 0x23, 0x75, 0x00, 0xC4, 0x27, 0x8F, 0x13, 0x8F, 0x18, 0x19, 0x01, 0x20, 0x0A, 0x22, 0x24,
+    0x1B, 0x32, 0x2C, 0x01, 0x00, 0x6D, 0x32, 0x47, 0x28, 0x7E, 0xB8, 0x01, 0x90, 0xDE, 0x50, 0x9E,
+    0x44, 0x58, 0x31, 0x25, 0x20, 0x08, 0xC8, 0xCC, 0xF2, 0x48, 0x24, 0x0B, 0x00, 0xB8, 0xB3, 0x39,
+    0x0B, 0x52, 0x44, 0xD3, 0x00, 0xE0, 0x23, 0x23, 0x83, 0xB1, 0x86, 0xC4, 0x00, 0xC0, 0x11, 0xA7,
+    0xEC, 0x86, 0x14, 0x9B, 0x00, 0x52, 0xB5, 0x92, 0x0D, 0x4B, 0x12, 0x1A, 0x03, 0x00, 0x3E, 0x91,
+    0x31, 0x99, 0x56, 0x74, 0x0A, 0x00, 0x7A, 0x34, 0x3D, 0x38, 0x48, 0x08, 0x05, 0x00, 0xCD, 0x5C,
+    0xB0, 0x64, 0x1C, 0x11, 0x24, 0x10, 0xA0, 0xD8, 0x9C, 0xBD, 0x04, 0x23, 0x08, 0x41, 0xB8, 0x36,
+    0x43, 0x57, 0x02, 0xCA, 0x16, 0x00, 0x08, 0xC7, 0x33, 0xD8, 0xC3, 0x8C, 0x1D, 0x00, 0x50, 0xC1,
+    0xE5, 0xEA, 0xE6, 0x0F, 0x3D, 0x01, 0x80, 0x01, 0x12, 0x1C, 0x8D, 0x30, 0xE6, 0x02, 0x00, 0x31,
+    0x8F, 0x9C, 0x0B, 0x41, 0xEC, 0x01, 0x00, 0xAF, 0x2A, 0x45, 0x33, 0x62, 0x74, 0x03, 0x10, 0x02,
+    0xF0, 0xA6, 0x49, 0xA2, 0x52, 0x04, 0x00, 0xA5, 0xE1, 0x28, 0xB9, 0xDC, 0x21, 0x0A, 0x40, 0x08,
+    0x34, 0x61, 0x82, 0xB9, 0x43, 0xD4, 0x80, 0x70, 0x2B, 0x42, 0xE4, 0x41, 0x89, 0x39, 0x01, 0x40,
+    0x8F, 0x06, 0x4D, 0x66, 0x17, 0x23, 0x01, 0x40, 0xB3, 0xCC, 0x18, 0xCE, 0x26, 0xB9, 0x02, 0x00,
+    0x27, 0x90, 0x2D, 0x17, 0x51, 0x84, 0x0D, 0x04, 0xC9, 0x32, 0x40, 0x3E, 0x44, 0x88, 0x02, 0x00,
+    0xEA, 0x80, 0x6A, 0x5E, 0x84, 0x10, 0x08, 0x00, 0x29, 0xD8, 0xB0, 0xBD, 0x24, 0x23, 0x32, 0x00,
+    0xA0, 0x03, 0x31, 0x4A, 0xC9, 0xC3, 0x13, 0x00, 0x80, 0x46, 0xC4, 0xC6, 0x23, 0x8A, 0x1C, 0x00,
+    0x60, 0x12, 0xC7, 0x8A, 0x67, 0x0E, 0x75, 0x00, 0x40, 0x95, 0x08, 0x96, 0x0E, 0x1F, 0x9A, 0x00,
+    0x80, 0x07, 0x15, 0xC0, 0x98, 0x71, 0x24, 0x01, 0x00, 0x6A, 0x34, 0xA6, 0x83, 0x7C, 0x98, 0x03,
+    0x00, 0x08, 0x44, 0xEA, 0x48, 0xEE, 0x51, 0x03, 0x00, 0xA8, 0xD1, 0x8C, 0xC9, 0xB4, 0xE2, 0x2C,
+    0x00, 0x80, 0x33, 0xC2, 0x33, 0xF2, 0xC4, 0xA2, 0x00, 0x14, 0x60, 0xC3, 0x1A, 0xF4, 0x8F, 0x55,
+    0x00, 0xA0, 0x8E, 0x86, 0x2F, 0xC8, 0x16, 0x7B, 0x00, 0x00, 0x02, 0x50, 0x66, 0xCD, 0x40, 0x1E,
+    0x03, 0x00, 0x1B, 0x0F, 0x2A, 0x15, 0x4E, 0xBC, 0x02, 0x00, 0x1E, 0x26, 0x5E, 0x48, 0x68, 0xD8,
+    0x04, 0x00, 0xF6, 0x68, 0xC6, 0x62, 0x62, 0x11, 0x03, 0x00, 0xBA, 0x01, 0x3D, 0x0E, 0x45, 0x63,
+    0x07, 0x00, 0x50, 0xA3, 0x59, 0x23, 0x52, 0xC4, 0x65, 0x00, 0x30, 0x00, 0xC2, 0x75, 0xE2, 0x8B,
+    0xAF, 0x00, 0xC0, 0x0A, 0x04, 0x8D, 0xE4, 0x1B, 0x71, 0x00, 0x40, 0x21, 0x0D, 0x93, 0xCA, 0x21,
+    0xA2, 0x04, 0x80, 0x69, 0x8B, 0x1B, 0x97, 0x24, 0x6C, 0x01, 0x00, 0x3B, 0x24, 0x65, 0x2A, 0xC8,
+    0x18, 0x01, 0x00, 0xEA, 0x68, 0x9A, 0x44, 0x48, 0x31, 0x03, 0x20, 0xC4, 0x01, 0x4D, 0xF1, 0xB0,
+    0x21, 0x25, 0x00, 0x18, 0xC4, 0x61, 0x32, 0x89, 0xC4, 0x5B, 0x00, 0x00, 0xC7, 0x33, 0x55, 0xD2,
+    0x8A, 0x45, 0x00, 0xE0, 0x0D, 0x87, 0x8D, 0x05, 0x1A, 0x7B, 0x00, 0x40, 0x87, 0xC9, 0x9C, 0x8B,
+    0x35, 0x6A, 0x01, 0x80, 0x45, 0x81, 0x8A, 0x91, 0x11, 0xBC, 0x05, 0x00, 0x86, 0x1E, 0x48, 0x1D,
+    0xA4, 0x98, 0x40, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0xD1, 0x07, 0x00, 0x28, 0xD9, 0x8C, 0xA5,
+    0x20, 0x63, 0x12, 0x00, 0x80, 0x33, 0x61, 0xE3, 0xF1, 0xC4, 0x28, 0x80, 0x10, 0x6B, 0xC1, 0xF7,
+    0x32, 0x4E, 0x28, 0x01, 0x82, 0x8E, 0xE7, 0xEA, 0x09, 0x0A, 0x3F, 0x03, 0x04, 0x1B, 0x8D, 0x93,
+    0x0E, 0x1A, 0x66, 0x01, 0x00, 0x22, 0x13, 0x3A, 0x18, 0x69, 0x74, 0x02, 0x00, 0x6A, 0x32, 0x7E,
+    0x31, 0xE0, 0x88, 0x02, 0x10, 0x0C, 0x98, 0x30, 0x65, 0x12, 0x52, 0x03, 0x00, 0xF8, 0x91, 0x64,
+    0xB9, 0x70, 0xA2, 0x0A, 0x00, 0xE8, 0xA2, 0x79, 0xAB, 0xD9, 0xC5, 0x27, 0x00, 0x30, 0xCA, 0xC2,
+    0x18, 0xC5, 0x4A, 0x1E, 0x00, 0x40, 0xCD, 0xC6, 0xAC, 0x08, 0x10, 0x2B, 0x02, 0xC0, 0x10, 0x0D,
+    0xB2, 0xD5, 0x3D, 0xC6, 0x80, 0x80, 0x38, 0x9B, 0xB3, 0x97, 0x60, 0x0C, 0x0A, 0x00, 0x78, 0x28,
+    0x8A, 0x39, 0xE3, 0x28, 0x05, 0x00, 0x3A, 0x4D, 0xBA, 0x5C, 0x54, 0x29, 0x07, 0x04, 0x08, 0xE0,
+    0xF4, 0xD2, 0xC0, 0xA4, 0x31, 0x00, 0x10, 0xE4, 0xA8, 0x61, 0x41, 0xC2, 0x1E, 0x00, 0x00, 0xA7,
+    0x22, 0xE6, 0x82, 0x8B, 0xC0, 0x00, 0x60, 0x0A, 0xC5, 0x6E, 0x44, 0x1F, 0x7B, 0x01, 0x80, 0x9D,
+    0x8F, 0xDF, 0x8C, 0x37, 0x66, 0x02, 0x04, 0x24, 0x19, 0x33, 0x08, 0x8D, 0xD4, 0x04, 0x00, 0x6A,
+    0x3C, 0x74, 0x32, 0xD0, 0xF8, 0x01, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0xD1, 0x06, 0x00, 0x0C,
+    0x49, 0x3D, 0x5E, 0x9D, 0x62, 0x07, 0x00, 0xF0, 0x20, 0x32, 0xE3, 0xB9, 0xC4, 0x65, 0x00, 0xF0,
+    0x66, 0x43, 0x57, 0x83, 0x8C, 0x0D, 0x00, 0xE0, 0xCE, 0x45, 0xA9, 0x25, 0x0F, 0x7B, 0x00, 0xC0,
+    0x1F, 0x0D, 0x5A, 0xD0, 0x22, 0xA2, 0x80, 0x00, 0x02, 0x98, 0xB8, 0x90, 0x7C, 0xBC, 0x00, 0x00,
+    0x4F, 0x46, 0x64, 0x54, 0x64, 0x08, 0x03, 0x10, 0x64, 0x24, 0xEE, 0x8C, 0x38, 0xD1, 0x26, 0x00,
+    0x18, 0xA8, 0x40, 0xCE, 0xEC, 0xA3, 0x13, 0x00, 0x28, 0x90, 0x71, 0x4B, 0xC9, 0xC6, 0x27, 0x00,
+    0xC0, 0xC7, 0x71, 0x48, 0x22, 0x91, 0xA9, 0x00, 0x41, 0x00, 0xC9, 0x8F, 0xA4, 0x20, 0x93, 0x01,
+    0x80, 0x0C, 0x04, 0x5A, 0x8C, 0x2F, 0x3A, 0x03, 0x80, 0x34, 0x1A, 0xA7, 0x0C, 0x63, 0x0C, 0x01,
+    0x00, 0x7C, 0x48, 0x50, 0x40, 0x61, 0x38, 0x84, 0x80, 0xD2, 0x74, 0xC4, 0x60, 0x66, 0x11, 0x06,
+    0x00, 0xD0, 0xC9, 0xEC, 0x0D, 0xC5, 0xA2, 0x14, 0x00, 0x10, 0xF3, 0x39, 0x2C, 0x1A, 0x46, 0x56,
+    0x01, 0x50, 0x47, 0x93, 0x68, 0x73, 0x8E, 0x1A, 0x00, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x6F,
+    0x00, 0xC0, 0x83, 0x0C, 0xD7, 0x05, 0x35, 0x02, 0x02, 0x82, 0x50, 0x95, 0x1E, 0x9C, 0x23, 0xAA,
+    0x00, 0x00, 0x76, 0x22, 0x41, 0x2E, 0x62, 0x48, 0x01, 0x00, 0xD6, 0x68, 0xB8, 0xA0, 0xB6, 0x70,
+    0x3A, 0x00, 0x18, 0xC8, 0xC0, 0x6D, 0x14, 0xE4, 0x4E, 0x20, 0x58, 0xA5, 0x21, 0xEB, 0x71, 0xC4,
+    0x54, 0x00, 0xC0, 0x47, 0x73, 0x95, 0xA1, 0x8D, 0xC8, 0x00, 0xE1, 0x10, 0xC6, 0xE9, 0x86, 0x0D,
+    0x97, 0x00, 0x40, 0xA4, 0xCE, 0x92, 0x08, 0x27, 0x02, 0x01, 0x00, 0x04, 0x95, 0xA1, 0x9E, 0x24,
+    0x0C, 0x01, 0x20, 0x6F, 0x36, 0x52, 0x40, 0x64, 0x48, 0x01, 0x00, 0x64, 0x54, 0x98, 0x54, 0x0E,
+    0x51, 0x28, 0x04, 0x24, 0xE8, 0x08, 0xD7, 0xD0, 0x24, 0x25, 0x00, 0x90, 0xE3, 0x51, 0xCA, 0x11,
+    0x43, 0x98, 0x00, 0x90, 0x67, 0x82, 0x5A, 0x34, 0x8F, 0xD4, 0x00, 0x60, 0x8D, 0xE7, 0xAB, 0x24,
+    0x19, 0x49, 0x00, 0x80, 0x07, 0x50, 0xD4, 0x8C, 0x1F, 0x62, 0x00, 0x00, 0x38, 0x13, 0x28, 0x19,
+    0x3F, 0xFC, 0x04, 0x00, 0x68, 0x3A, 0x72, 0x2D, 0xD6, 0x28, 0x01, 0x00, 0x6C, 0x50, 0xB2, 0x52,
+    0x5A, 0xB1, 0x14, 0x00, 0xB2, 0xB9, 0xB8, 0xD9, 0x04, 0x63, 0x0E, 0x40, 0x78, 0xB3, 0x51, 0xBB,
+    0x71, 0xC5, 0x98, 0x00, 0xB0, 0x80, 0x33, 0xE8, 0x93, 0x8C, 0x17, 0x00, 0xC0, 0x83, 0xA9, 0xEF,
+    0x66, 0x1A, 0x61, 0x00, 0x80, 0x9E, 0x0C, 0x9C, 0x13, 0x1F, 0xFE, 0x00, 0x82, 0x07, 0x9A, 0x54,
+    0x21, 0x7D, 0xAC, 0x01, 0x00, 0x07, 0x25, 0x0C, 0x53, 0x10, 0x62, 0x0C, 0x00, 0xE8, 0x50, 0x9E,
+    0x38, 0x80, 0x31, 0x03, 0x00, 0xA8, 0xC1, 0x40, 0x0E, 0x51, 0xE3, 0x2D, 0x00, 0xA0, 0x70, 0x11,
+    0xD4, 0xA1, 0xC6, 0x08, 0x08, 0xD4, 0xE2, 0xE4, 0x27, 0xD8, 0x84, 0x15, 0x08, 0xE0, 0x10, 0x66,
+    0x27, 0x65, 0x0B, 0xAB, 0x00, 0x00, 0x1F, 0x90, 0xAF, 0x8F, 0x46, 0x86, 0x00, 0x80, 0x3F, 0x24,
+    0x40, 0x1E, 0x64, 0xA4, 0x04, 0x00, 0x66, 0x32, 0x4A, 0x2C, 0x7C, 0x58, 0x04, 0x00, 0x2A, 0x2C,
+    0xAE, 0x56, 0x44, 0x11, 0x06, 0x10, 0xAC, 0xD1, 0x58, 0xAD, 0x78, 0x22, 0x12, 0x00, 0x58, 0x13,
+    0x79, 0x62, 0x59, 0x44, 0x1E, 0x00, 0xA0, 0x66, 0x33, 0x27, 0xE4, 0x89, 0xA9, 0x00, 0x60, 0x8E,
+    0x07, 0x2A, 0x06, 0x10, 0x33, 0x01, 0x02, 0x13, 0x0F, 0x5C, 0x07, 0x40, 0x1E, 0x03, 0x80, 0x3C,
+    0x97, 0xAD, 0x9C, 0x41, 0x9C, 0x00, 0x00, 0x58, 0x2E, 0x4D, 0x1F, 0xB1, 0xB8, 0x03, 0x00, 0x12,
+    0x44, 0x92, 0x74, 0xC2, 0x50, 0x17, 0x80, 0x38, 0xE9, 0x6C, 0x01, 0xCD, 0x21, 0x52, 0x20, 0xA8,
+    0xA3, 0x01, 0xA3, 0xA1, 0xC4, 0x25, 0x00, 0x90, 0xC6, 0xD3, 0x46, 0xD3, 0x8B, 0x30, 0x20, 0x20,
+    0x5F, 0x01, 0x42, 0xC8, 0x02, 0x7B, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x0A, 0x03, 0x80,
+    0x36, 0x08, 0x9F, 0x18, 0x29, 0xD4, 0x00, 0x00, 0x6B, 0x46, 0x71, 0x36, 0xB3, 0x98, 0x01, 0x00,
+    0xB8, 0x90, 0xAC, 0x62, 0x1C, 0x51, 0x03, 0x00, 0x12, 0xC9, 0x98, 0xDC, 0xA8, 0xA0, 0x0F, 0x00,
+    0x80, 0xB3, 0xE9, 0xA1, 0xF0, 0xC4, 0x9D, 0x00, 0x40, 0x61, 0xA4, 0x78, 0x73, 0x8E, 0x22, 0x00,
+    0xC0, 0x90, 0x26, 0xC9, 0x44, 0x11, 0x7F, 0x00, 0xC0, 0x9E, 0x4D, 0x96, 0xCF, 0x1C, 0xEA, 0x00,
+    0xA0, 0x1E, 0x94, 0xB2, 0x18, 0x5B, 0x84, 0x09, 0x00, 0x35, 0x2E, 0x9C, 0x40, 0xED, 0xC8, 0x03,
+    0x00, 0x6C, 0x6C, 0x60, 0x79, 0x1E, 0x12, 0x0B, 0x00, 0xA0, 0xC9, 0xDC, 0x19, 0x89, 0x22, 0x0C,
+    0x00, 0xA0, 0x90, 0xA9, 0xE3, 0xC1, 0x45, 0x60, 0x00, 0x80, 0xA5, 0x62, 0xE4, 0xC2, 0x86, 0x40,
+    0xC1, 0xE0, 0x48, 0x86, 0xB2, 0x88, 0x1A, 0x97, 0x02, 0x01, 0xB7, 0x89, 0x96, 0x8D, 0x22, 0x6E,
+    0x20, 0x80, 0x48, 0x9B, 0x20, 0x92, 0x3B, 0x3C, 0x06, 0x00, 0x08, 0x34, 0x66, 0x24, 0xD9, 0x68,
+    0x0B, 0x00, 0xE8, 0x7C, 0xC8, 0x70, 0x3C, 0xB1, 0x06, 0x00, 0xB0, 0xB9, 0x28, 0x19, 0x2D, 0x61,
+    0x23, 0x00, 0xE0, 0xE3, 0x69, 0xB2, 0x71, 0xC3, 0x49, 0x00, 0x10, 0x6D, 0x52, 0xF6, 0xE2, 0x4B,
+    0x3E, 0x00, 0xC0, 0xD5, 0xE5, 0x6A, 0x06, 0x91, 0x92, 0x00, 0xE0, 0x0D, 0x8D, 0x92, 0xCB, 0x1D,
+    0x36, 0x02, 0x00, 0x40, 0xB4, 0xAD, 0x9B, 0x44, 0x1C, 0x02, 0x04, 0x69, 0x34, 0x71, 0x2D, 0xD4,
+    0x88, 0x21, 0x00, 0x76, 0x59, 0x7E, 0x66, 0xA4, 0x68, 0x04, 0x00, 0xF0, 0xC8, 0x64, 0x9D, 0xD8,
+    0x22, 0x09, 0x00, 0x90, 0xD1, 0x89, 0xA2, 0xE1, 0xC3, 0x10, 0x80, 0xF0, 0x42, 0x32, 0xD2, 0x81,
+    0x83, 0x21, 0x80, 0x80, 0xCE, 0xC7, 0x2F, 0x68, 0x17, 0x7D, 0x00, 0x10, 0x1B, 0x4D, 0x5C, 0xCF,
+    0x29, 0x4E, 0x00, 0x80, 0x48, 0x1B, 0xA8, 0x16, 0x45, 0x34, 0x02, 0x00, 0x6A, 0x2A, 0x5B, 0x23,
+    0xC4, 0xF8, 0x14, 0x00, 0x4C, 0x85, 0x2A, 0x97, 0x90, 0xB1, 0x17, 0x01, 0xE8, 0x70, 0x68, 0xC5,
+    0x64, 0xE2, 0x0F, 0x00, 0xE0, 0xB3, 0x28, 0x9C, 0x49, 0x47, 0x96, 0x00, 0xD0, 0xAB, 0xF0, 0xC1,
+    0x01, 0x23, 0x0B, 0x00, 0x00, 0x92, 0x23, 0x8C, 0xC3, 0x1C, 0x1F, 0x00, 0x00, 0x9B, 0x47, 0x4B,
+    0xC0, 0x3A, 0x0E, 0x03, 0x00, 0x27, 0x1E, 0x31, 0x1E, 0x47, 0xF4, 0x01, 0x04, 0x68, 0x22, 0x67,
+    0x30, 0xBE, 0x28, 0x0C, 0x00, 0xD2, 0x54, 0x9E, 0x5E, 0x00, 0xF1, 0x34, 0x00, 0xBC, 0xD9, 0xA8,
+    0xDD, 0xB8, 0xA2, 0x4E, 0x00, 0x40, 0xA3, 0x59, 0xF5, 0x11, 0x48, 0x24, 0x00, 0x20, 0x42, 0xE2,
+    0x45, 0x82, 0x8C, 0x54, 0x00, 0xC8, 0x4C, 0xE7, 0x6D, 0x66, 0x18, 0x7F, 0x00, 0x40, 0x37, 0x8C,
+    0x8E, 0xCC, 0x12, 0x39, 0x01, 0x02, 0x31, 0x0E, 0xB0, 0x8C, 0x78, 0xEC, 0x08, 0x00, 0x59, 0x34,
+    0x7C, 0x2B, 0xEF, 0x78, 0x12, 0x10, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0x91, 0x19, 0x00, 0x98, 0x29,
+    0x69, 0x95, 0x00, 0x23, 0x0B, 0x00, 0x42, 0xC2, 0xD9, 0xEB, 0x01, 0x46, 0x0E, 0x00, 0xF0, 0x42,
+    0x53, 0x7B, 0x77, 0x8A, 0x3F, 0x00, 0x40, 0x91, 0x47, 0xCE, 0x28, 0x12, 0x17, 0x00, 0x40, 0x21,
+    0x4D, 0x91, 0xCD, 0x16, 0x16, 0x01, 0x80, 0x51, 0x1D, 0x23, 0x1C, 0x2D, 0x52, 0x02, 0x00, 0x81,
+    0x34, 0x8C, 0x2D, 0x03, 0x59, 0x0B, 0x00, 0xD6, 0x68, 0xB4, 0x76, 0xFC, 0x70, 0x17, 0x00, 0xE4,
+    0xE1, 0x3C, 0xC1, 0xF8, 0x21, 0x4E, 0x00, 0x30, 0xA3, 0xA1, 0xDB, 0xC1, 0x45, 0x23, 0x00, 0x20,
+    0x46, 0xD4, 0x09, 0x33, 0x91, 0xDB, 0x00, 0x00, 0xD0, 0x66, 0xED, 0x26, 0x16, 0x7D, 0x10, 0xC0,
+    0x9F, 0x0C, 0x1C, 0x8F, 0x2A, 0xB6, 0x00, 0x02, 0x49, 0x1A, 0x2E, 0x0F, 0x6B, 0xBC, 0x05, 0x00,
+    0x69, 0x36, 0x41, 0x1F, 0x83, 0x58, 0x0B, 0x00, 0xDB, 0x60, 0xD0, 0x3A, 0xE8, 0x31, 0x06, 0x00,
+    0x00, 0xEA, 0x1C, 0xF1, 0x58, 0xA1, 0x08, 0x00, 0x48, 0x43, 0x59, 0x1B, 0x72, 0x44, 0x4C, 0x00,
+    0xC2, 0x46, 0x43, 0xD8, 0x03, 0x8D, 0x3A, 0x20, 0x00, 0x85, 0xC6, 0xA8, 0x44, 0x10, 0x4D, 0x01,
+    0x00, 0xBE, 0x06, 0xC9, 0x8A, 0x8B, 0x74, 0x00, 0x80, 0x67, 0xA0, 0x99, 0x9E, 0x19, 0x49, 0x02,
+    0x08, 0x76, 0x22, 0x24, 0x2E, 0x2D, 0x38, 0x08, 0x02, 0x0C, 0x68, 0xC2, 0x54, 0x82, 0x51, 0x17,
+    0x00, 0xA8, 0x99, 0x70, 0x71, 0x6C, 0xE3, 0x31, 0x00, 0x40, 0xA3, 0xC1, 0x9C, 0x31, 0xC8, 0x1C,
+    0x00, 0x90, 0x29, 0x22, 0x43, 0xA3, 0x83, 0x4F, 0x00, 0x40, 0x0D, 0xA5, 0x6E, 0x48, 0x14, 0x3F,
+    0x00, 0x80, 0x0C, 0x8C, 0x15, 0x4C, 0x24, 0x0A, 0x01, 0x84, 0x02, 0x0F, 0x1F, 0x91, 0x39, 0x5C,
+    0x02, 0x40, 0x04, 0x32, 0x8E, 0x3C, 0xE0, 0xE8, 0x03, 0x00, 0xCC, 0x78, 0xE6, 0x66, 0x92, 0x71,
+    0x07, 0x00, 0x78, 0xD1, 0x6C, 0xC9, 0x5C, 0xA2, 0x06, 0x00, 0x48, 0x23, 0xA1, 0x33, 0x69, 0x47,
+    0x5E, 0x00, 0x80, 0x02, 0x43, 0xC6, 0xE3, 0x88, 0x4E, 0x00, 0xC0, 0x8D, 0xE7, 0x4C, 0x2B, 0x0C,
+    0x2F, 0x00, 0x40, 0x1D, 0x0D, 0xD3, 0x89, 0x23, 0xC6, 0x02, 0x00, 0x0A, 0x19, 0x36, 0x94, 0x6C,
+    0xFC, 0x00, 0x00, 0x78, 0x22, 0x52, 0x2E, 0x8A, 0x88, 0x0C, 0x00, 0xEC, 0x74, 0xB4, 0x62, 0x2E,
+    0xD1, 0x26, 0x00, 0x10, 0xE8, 0x00, 0xC6, 0x98, 0x23, 0x47, 0x00, 0x88, 0x83, 0x29, 0x4B, 0x61,
+    0xC6, 0x0C, 0x09, 0xF0, 0xE6, 0x75, 0x5B, 0xE8, 0x88, 0x3D, 0xA0, 0x40, 0x80, 0x86, 0x2D, 0x86,
+    0x18, 0x73, 0x01, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x2A, 0x01, 0x00, 0x34, 0x9A, 0x3B, 0xA3,
+    0x4C, 0x9C, 0x02, 0x00, 0x78, 0x22, 0x5E, 0x2A, 0xBB, 0x18, 0x2A, 0x00, 0x06, 0x54, 0xDC, 0x6C,
+    0x6C, 0x71, 0x07, 0x00, 0xEC, 0x91, 0x64, 0x05, 0xB9, 0xA1, 0x11, 0x40, 0x02, 0xA0, 0xF2, 0x75,
+    0xD1, 0xC9, 0x5D, 0x00, 0x80, 0x06, 0xF2, 0xB3, 0xB1, 0x88, 0x3C, 0x00, 0x00, 0x11, 0xE5, 0x0B,
+    0x88, 0x0F, 0x91, 0x00, 0x00, 0x9B, 0x4E, 0x99, 0xD0, 0x20, 0x16, 0x03, 0x80, 0x3E, 0x9A, 0x33,
+    0x92, 0x6D, 0x14, 0x06, 0x00, 0x68, 0x0C, 0x47, 0x28, 0x7E, 0xD8, 0x03, 0x08, 0x50, 0x6C, 0xD8,
+    0x78, 0x3C, 0x51, 0x28, 0x00, 0x98, 0xD9, 0xC4, 0xF9, 0x90, 0xE2, 0x2C, 0x00, 0xA8, 0xD3, 0x01,
+    0x12, 0xC9, 0xC3, 0x64, 0x00, 0xD8, 0x66, 0xF5, 0xB6, 0xE4, 0x87, 0x4C, 0x00, 0x00, 0x90, 0x66,
+    0x6B, 0x29, 0x0C, 0x23, 0x01, 0x80, 0x1C, 0xD2, 0x60, 0x89, 0x42, 0x2E, 0x03, 0x02, 0x37, 0x19,
+    0xB0, 0x13, 0x64, 0xDC, 0x00, 0x00, 0x62, 0x20, 0x4D, 0x17, 0xC9, 0xA8, 0x1A, 0x02, 0xA0, 0x6D,
+    0x8A, 0x5C, 0xD6, 0x70, 0x04, 0x00, 0xB8, 0xC1, 0xBC, 0x1D, 0x1D, 0xE2, 0x09, 0x40, 0xA0, 0xD0,
+    0x1A, 0x67, 0xA2, 0xC9, 0x27, 0x00, 0x20, 0x83, 0xC2, 0x77, 0x13, 0x8D, 0x18, 0x00, 0x20, 0xCF,
+    0x48, 0xCB, 0xC4, 0x17, 0x4F, 0x00, 0x00, 0xAA, 0xCA, 0x9E, 0xCB, 0x38, 0xE5, 0x00, 0x00, 0x2A,
+    0x95, 0x2C, 0x9A, 0x45, 0xCC, 0x09, 0x00, 0x14, 0x36, 0x75, 0x23, 0xF9, 0xF8, 0x12, 0x00, 0xD0,
+    0x6C, 0xA0, 0x5E, 0x04, 0x91, 0x07, 0x00, 0x10, 0xD8, 0x1C, 0xF6, 0x44, 0xE3, 0x27, 0x00, 0x48,
+    0xE4, 0xC9, 0x9B, 0xB1, 0x46, 0x14, 0x00, 0x80, 0x06, 0x44, 0x66, 0x43, 0x8A, 0x1A, 0x00, 0x00,
+    0x8F, 0xE6, 0xAD, 0x06, 0x18, 0x2F, 0x00, 0x80, 0x1B, 0x0E, 0x98, 0x50, 0x1E, 0x26, 0x01, 0x84,
+    0x38, 0x14, 0xB8, 0x98, 0x64, 0x4C, 0x02, 0x02, 0x00, 0x36, 0x60, 0x2D, 0xB6, 0xA8, 0x8A, 0x00,
+    0xE2, 0x44, 0x08, 0x65, 0xD6, 0x31, 0x08, 0x00, 0x14, 0x20, 0x19, 0x2A, 0xC5, 0xA2, 0x4D, 0x20,
+    0xC8, 0x11, 0xF2, 0xCA, 0x59, 0x44, 0x1E, 0x00, 0x20, 0xE7, 0xB3, 0x87, 0xE4, 0x89, 0x2E, 0x00,
+    0xE8, 0xD9, 0x68, 0x68, 0x86, 0x8B, 0x86, 0x01, 0x00, 0x1A, 0xC8, 0x9D, 0x8B, 0x37, 0xF2, 0x04,
+    0x80, 0x04, 0x18, 0x45, 0x9B, 0x75, 0xCC, 0x00, 0x00, 0x77, 0x34, 0x65, 0x37, 0xA4, 0xD8, 0x0C,
+    0x00, 0xE0, 0x54, 0xF8, 0x62, 0xBE, 0x31, 0x08, 0x00, 0xC2, 0xD1, 0xB8, 0xB9, 0x38, 0x23, 0x34,
+    0x00, 0x28, 0xC0, 0xA2, 0x8C, 0x31, 0x48, 0x1C, 0x00, 0xE0, 0x0A, 0x22, 0x44, 0x92, 0x47, 0xC8,
+    0x00, 0xA0, 0x4D, 0xE6, 0x48, 0x06, 0x0E, 0x53, 0x00, 0x80, 0x2C, 0x4C, 0x96, 0x11, 0x19, 0xDD,
+    0x02, 0x80, 0x27, 0x20, 0xA5, 0x8E, 0x56, 0xEC, 0x05, 0x00, 0x71, 0x1E, 0x88, 0x2E, 0xFC, 0xB8,
+    0x0B, 0x00, 0x64, 0x70, 0x9E, 0x4A, 0x44, 0x71, 0x04, 0x00, 0x19, 0x03, 0x69, 0x55, 0x41, 0x11,
+    0x0F, 0x00, 0xD0, 0xF1, 0xF9, 0x32, 0x72, 0x43, 0x27, 0x00, 0x80, 0x30, 0x61, 0xB0, 0x73, 0x20,
+    0xCB, 0x00, 0xE0, 0x8B, 0x21, 0x89, 0x43, 0x15, 0x9B, 0x00, 0x80, 0x18, 0x0E, 0xDB, 0x8F, 0x2D,
+    0x82, 0x00, 0x80, 0x3A, 0x9A, 0x36, 0x9A, 0x5E, 0x44, 0x0D, 0x14, 0x50, 0x38, 0x75, 0x21, 0xFE,
+    0x58, 0x05, 0x00, 0xA4, 0x24, 0x3A, 0x6B, 0x12, 0xD2, 0x52, 0x00, 0xD4, 0xC1, 0xF4, 0xEC, 0x10,
+    0xA1, 0x04, 0x00, 0xC0, 0x82, 0xC2, 0xAC, 0xF3, 0x43, 0x0D, 0x02, 0xF0, 0x66, 0xA3, 0x76, 0xE3,
+    0x8A, 0xB6, 0x00, 0x80, 0x8F, 0xA6, 0xCC, 0x67, 0x11, 0x97, 0x00, 0x80, 0x21, 0xCD, 0xD3, 0x4C,
+    0x1E, 0x72, 0x22, 0x80, 0x1D, 0x93, 0xA5, 0xA3, 0x24, 0x34, 0x06, 0x00, 0x6B, 0x22, 0x87, 0x36,
+    0xE6, 0x08, 0x14, 0x00, 0xB4, 0x6C, 0x3C, 0x7B, 0xEE, 0x71, 0x18, 0x00, 0xA8, 0x99, 0x64, 0x89,
+    0x10, 0xE3, 0x2B, 0x00, 0x40, 0x93, 0x49, 0xC2, 0x11, 0x43, 0x10, 0x00, 0xA1, 0x48, 0xB3, 0x77,
+    0x05, 0x88, 0x41, 0x01, 0x00, 0xC5, 0x66, 0x55, 0x88, 0x1F, 0x73, 0x01, 0xC0, 0x17, 0x0D, 0x92,
+    0x87, 0x28, 0x7A, 0x00, 0x00, 0x57, 0x9D, 0xA2, 0x1C, 0x2B, 0x02, 0x06, 0x00, 0x7D, 0x34, 0x5C,
+    0x2E, 0xA7, 0x18, 0x01, 0x00, 0xDB, 0x60, 0xA4, 0x58, 0x28, 0x91, 0x07, 0x00, 0x30, 0x9B, 0xEC,
+    0xE0, 0x10, 0xD1, 0x11, 0x00, 0x28, 0xA0, 0x71, 0x1D, 0xFA, 0x47, 0x29, 0x00, 0x00, 0x47, 0x63,
+    0x27, 0x74, 0x8A, 0x11, 0x00, 0x00, 0x52, 0xE7, 0x4D, 0x67, 0x16, 0x79, 0x00, 0x82, 0x19, 0xD3,
+    0x8D, 0x0C, 0x11, 0x42, 0x03, 0x80, 0x38, 0x90, 0x90, 0x19, 0x13, 0x5C, 0x06, 0x00, 0x44, 0x26,
+    0x6B, 0x2D, 0xCC, 0x38, 0x0D, 0x00, 0xEC, 0x44, 0xBE, 0x54, 0x76, 0xF1, 0x11, 0x00, 0xB0, 0xD1,
+    0x80, 0xC5, 0xA8, 0x22, 0x09, 0x80, 0xD0, 0xA3, 0x71, 0x93, 0x21, 0xC6, 0x1D, 0x40, 0x90, 0x44,
+    0xD3, 0xB7, 0x93, 0x8C, 0x41, 0x00, 0x20, 0x43, 0x47, 0xC9, 0xE5, 0x0E, 0x77, 0x01, 0x40, 0x18,
+    0xCD, 0xCF, 0x45, 0x26, 0x3E, 0x00, 0x00, 0x41, 0x9D, 0xB4, 0x1C, 0x55, 0x14, 0x06, 0x80, 0x83,
+    0x34, 0x63, 0x27, 0xCE, 0x88, 0x0C, 0x10, 0x0C, 0x69, 0x0C, 0xCB, 0xF8, 0x70, 0x06, 0x00, 0x0C,
+    0xE0, 0xCC, 0xEA, 0x64, 0xE4, 0x31, 0x00, 0x80, 0x51, 0xD9, 0xE2, 0xF1, 0x43, 0x5E, 0x00, 0x20,
+    0xE3, 0x73, 0xC5, 0x53, 0x87, 0x4E, 0x00, 0xC0, 0xDD, 0xED, 0x43, 0x84, 0x05, 0x3D, 0x00, 0xC0,
+    0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x96, 0x02, 0x40, 0x3C, 0xA5, 0xBC, 0x21, 0x56, 0x7C, 0x02, 0x00,
+    0x7A, 0x30, 0x66, 0x31, 0xB8, 0x58, 0x02, 0x00, 0x16, 0x55, 0x4E, 0xC3, 0x76, 0xD1, 0x25, 0x10,
+    0x1C, 0xA8, 0x88, 0xD1, 0x94, 0x22, 0x2A, 0x00, 0xA0, 0x80, 0x99, 0xB4, 0xD1, 0xC7, 0x1C, 0x00,
+    0x70, 0x47, 0x93, 0x67, 0x44, 0x8A, 0xC7, 0x00, 0xC0, 0x4C, 0xE1, 0xEA, 0x03, 0x19, 0x45, 0x02,
+    0x00, 0x01, 0x4D, 0xA9, 0xCD, 0x43, 0x1A, 0x07, 0x83, 0x70, 0x11, 0x2C, 0x1C, 0x40, 0x7C, 0x01,
+    0x08, 0x9B, 0x42, 0x7C, 0x4D, 0x94, 0xA8, 0x09, 0x10, 0xEA, 0x68, 0xC4, 0x76, 0x22, 0xF1, 0x07,
+    0x00, 0x04, 0xB9, 0x94, 0xA5, 0x30, 0xE3, 0x0F, 0x00, 0x44, 0xF3, 0x11, 0x84, 0x59, 0x47, 0x10,
+    0x00, 0x10, 0xAC, 0xE2, 0x43, 0xF3, 0x44, 0x4D, 0x00, 0xC0, 0x0C, 0xA7, 0xC9, 0xC5, 0x0F, 0xA5,
+    0x00, 0xC2, 0x96, 0x87, 0x11, 0xCD, 0x18, 0x3A, 0x03, 0x00, 0x3B, 0x11, 0xA8, 0x96, 0x43, 0x7C,
+    0x02, 0x00, 0x76, 0x20, 0x44, 0x0E, 0xD6, 0xB8, 0x0C, 0x00, 0xDC, 0x64, 0x9A, 0x5C, 0xFC, 0x70,
+    0x05, 0x00, 0xB4, 0x01, 0x91, 0xD5, 0xA8, 0x22, 0x08, 0x00, 0xA8, 0xA3, 0x59, 0xF2, 0xC1, 0xC2,
+    0x46, 0x00, 0xF0, 0x07, 0xC4, 0x78, 0x34, 0x8C, 0xBD, 0x01, 0x00, 0x00, 0xC8, 0x2D, 0x86, 0x18,
+    0x23, 0x00, 0x80, 0x9F, 0xD5, 0x21, 0x5A, 0x1E, 0x92, 0x84, 0x00, 0x03, 0x97, 0xC3, 0x1B, 0x71,
+    0x04, 0x12, 0x00, 0x6A, 0x34, 0x5D, 0x30, 0xA4, 0x68, 0x03, 0x00, 0xD8, 0x90, 0xDE, 0x7A, 0x44,
+    0x31, 0x01, 0x20, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0x22, 0x08, 0x00, 0x78, 0xB3, 0x51, 0xBB, 0x71,
+    0x45, 0x24, 0x00, 0xF0, 0x66, 0xA3, 0x76, 0xE3, 0x8A, 0xAA, 0x00, 0x20, 0xC6, 0xE5, 0xCC, 0xE4,
+    0x1A, 0x8D, 0x00, 0x40, 0x20, 0xD0, 0x5D, 0x91, 0x28, 0xDE, 0x00, 0x82, 0x36, 0x19, 0xB3, 0x1A,
+    0x56, 0x34, 0x06, 0x00, 0x58, 0x42, 0x56, 0x2D, 0x97, 0xC8, 0x04, 0x00, 0xE2, 0xB0, 0x14, 0x87,
+    0x98, 0x51, 0x08, 0x04, 0x08, 0xC2, 0x2C, 0x0D, 0x41, 0xE1, 0x2E, 0x00, 0x14, 0x23, 0x61, 0x52,
+    0x19, 0xC4, 0x8A, 0x00, 0x10, 0x40, 0xB3, 0x17, 0xE3, 0x8D, 0x98, 0x00, 0xE0, 0x4A, 0x26, 0x49,
+    0x63, 0x16, 0x87, 0x00, 0x01, 0x0D, 0x49, 0x1F, 0x4D, 0x36, 0x7A, 0x04, 0x80, 0x3A, 0x9E, 0x4C,
+    0x1E, 0x7A, 0xFC, 0x01, 0x00, 0x7F, 0x16, 0x4B, 0x40, 0x56, 0x58, 0x0B, 0x00, 0x06, 0x74, 0x00,
+    0x59, 0xE8, 0xF1, 0x04, 0x00, 0xC6, 0x01, 0x9D, 0xED, 0x70, 0xA2, 0x12, 0x00, 0xD0, 0xF1, 0x29,
+    0x34, 0xC2, 0xC5, 0x58, 0x00, 0xC0, 0x86, 0x93, 0x36, 0xB3, 0x8B, 0x49, 0x00, 0xA0, 0x00, 0xA6,
+    0x88, 0xC5, 0x0D, 0x37, 0x00, 0x80, 0x0C, 0x50, 0x12, 0x4B, 0x1E, 0x5E, 0x00, 0x00, 0x36, 0x3B,
+    0xCA, 0x32, 0x4A, 0x24, 0x06, 0x00, 0x05, 0x04, 0x6F, 0x30, 0xCC, 0xE8, 0x0A, 0x00, 0x9C, 0x38,
+    0x4E, 0x2C, 0x96, 0xF0, 0x16, 0x00, 0xF0, 0xA9, 0x60, 0xA5, 0xB0, 0x22, 0x08, 0x00, 0x20, 0xA0,
+    0xD1, 0x7C, 0x91, 0x48, 0x29, 0x00, 0x60, 0x26, 0xA3, 0xF7, 0x83, 0x8B, 0xB8, 0x00, 0xC0, 0x4F,
+    0x05, 0x6A, 0xC5, 0x11, 0x5B, 0x01, 0x80, 0x1F, 0xCD, 0x1C, 0xCF, 0x2C, 0x0E, 0x03, 0x00, 0x3C,
+    0x84, 0x24, 0x87, 0x70, 0x64, 0x46, 0x00, 0x75, 0x34, 0x5C, 0x42, 0x70, 0xA8, 0x14, 0x00, 0xF8,
+    0x4C, 0xFE, 0x84, 0x76, 0xD1, 0x01, 0x00, 0x28, 0xD0, 0x2C, 0xD2, 0xC8, 0xE3, 0x2D, 0x00, 0xA0,
+    0x03, 0xBA, 0xFA, 0x61, 0xC3, 0x23, 0x00, 0x10, 0x2C, 0xA2, 0xF4, 0x52, 0x47, 0x17, 0x00, 0xC0,
+    0x4C, 0x67, 0xCD, 0xC6, 0x16, 0x67, 0x02, 0xA0, 0x9D, 0x91, 0x5C, 0xCE, 0x2E, 0x76, 0x20, 0x02,
+    0x07, 0x8E, 0x30, 0x0B, 0x7E, 0x44, 0x06, 0x00, 0x05, 0x1E, 0x66, 0x16, 0x08, 0xA9, 0x04, 0x00,
+    0x7E, 0x2C, 0xAC, 0x36, 0xA2, 0xD1, 0x05, 0x00, 0xBC, 0xD9, 0x50, 0xBD, 0x38, 0x22, 0x2F, 0x02,
+    0x48, 0xA3, 0x41, 0x5B, 0x61, 0xC6, 0x1B, 0x00, 0xF0, 0x41, 0xD3, 0xFA, 0x82, 0x92, 0xCE, 0x00,
+    0x80, 0x8C, 0x66, 0x4A, 0xA7, 0x0E, 0x9D, 0x00, 0x40, 0x04, 0x0D, 0x91, 0x0E, 0x14, 0xE2, 0x00,
+    0x00, 0x38, 0x9B, 0x3E, 0x1E, 0x63, 0x24, 0x05, 0x00, 0x71, 0x42, 0x45, 0x29, 0x75, 0x68, 0x01,
+    0x08, 0x0A, 0x69, 0xA6, 0x74, 0xE6, 0x70, 0x07, 0x00, 0x1C, 0x32, 0xA1, 0xF1, 0x64, 0x62, 0x2D,
+    0x00, 0x10, 0x04, 0xBA, 0xC3, 0x31, 0xC6, 0x60, 0x00, 0xC0, 0x46, 0x72, 0x64, 0x32, 0x88, 0xBF,
+    0x01, 0xE0, 0x80, 0xC6, 0x6B, 0xC6, 0x13, 0xA1, 0x01, 0x00, 0xA7, 0x08, 0x13, 0x8B, 0x20, 0xE5,
+    0x02, 0x80, 0x36, 0x9D, 0xA7, 0x0C, 0x66, 0xCC, 0x09, 0x00, 0x74, 0x02, 0x31, 0x22, 0x4F, 0x38,
+    0x0B, 0x00, 0xDE, 0x6C, 0x5A, 0x78, 0x5C, 0x70, 0x14, 0x20, 0x24, 0xC0, 0x98, 0x85, 0x84, 0xE3,
+    0x66, 0x00, 0x08, 0xD1, 0x51, 0x8C, 0xC9, 0xC7, 0x64, 0x00, 0xF0, 0x46, 0x04, 0xD5, 0x43, 0x86,
+    0x91, 0x00, 0x40, 0xCC, 0x87, 0x6C, 0x85, 0x18, 0x7D, 0x00, 0x81, 0x00, 0x4D, 0xA4, 0xCD, 0x3D,
+    0x32, 0x01, 0x02, 0x15, 0x8E, 0xB7, 0xA0, 0x4C, 0xC4, 0x01, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE,
+    0x08, 0x01, 0x00, 0xB0, 0x94, 0x16, 0xA9, 0x48, 0x71, 0x04, 0x00, 0xBA, 0xC9, 0xC8, 0x11, 0x5D,
+    0x62, 0x05, 0x00, 0x48, 0xA1, 0x09, 0xE6, 0x6B, 0x45, 0x11, 0x84, 0xB0, 0x27, 0xA3, 0xF5, 0xE2,
+    0x89, 0x41, 0x00, 0xE0, 0x98, 0x46, 0xE6, 0x24, 0x09, 0x41, 0x02, 0x40, 0x02, 0xA0, 0x2C, 0x0E,
+    0x47, 0x8E, 0x00, 0x80, 0x36, 0x98, 0x2C, 0x9E, 0x3B, 0xBC, 0x00, 0x20, 0x71, 0x3A, 0x77, 0x67,
+    0x64, 0x88, 0x02, 0x08, 0xDA, 0x68, 0xB2, 0x54, 0x54, 0x71, 0x02, 0x00, 0xDC, 0x91, 0x9C, 0x75,
+    0xC4, 0xA3, 0x08, 0x00, 0x30, 0xA3, 0x49, 0x0B, 0x72, 0x44, 0x62, 0x01, 0x50, 0x47, 0x13, 0x56,
+    0xE3, 0x89, 0x3A, 0x00, 0xE0, 0x8E, 0x04, 0x87, 0x66, 0x08, 0x4F, 0x01, 0x40, 0x8E, 0x0D, 0x18,
+    0xCA, 0x30, 0x12, 0x01, 0x00, 0x31, 0x9B, 0xB0, 0x1C, 0x4A, 0xEC, 0x00, 0x80, 0x68, 0x34, 0x76,
+    0x28, 0xEB, 0xA8, 0x14, 0x00, 0xFA, 0xA9, 0x16, 0x5C, 0x28, 0xF0, 0x06, 0x00, 0xB0, 0xA9, 0x14,
+    0x55, 0xE0, 0x22, 0x4A, 0x00, 0x10, 0x10, 0x3A, 0xCE, 0x79, 0x49, 0x1D, 0x00, 0xF0, 0xE7, 0x42,
+    0x36, 0xC3, 0x8A, 0x23, 0x00, 0x40, 0x0D, 0x45, 0x09, 0x48, 0x0A, 0x8D, 0x00, 0x80, 0x11, 0x88,
+    0xCD, 0xCA, 0x12, 0x22, 0x02, 0x80, 0x38, 0x1A, 0xAE, 0x9B, 0x45, 0x4C, 0x02, 0x00, 0x73, 0x28,
+    0x7D, 0x4A, 0x9E, 0xA8, 0x0C, 0x00, 0xD0, 0x2C, 0xBA, 0x6E, 0x1C, 0x51, 0x18, 0x00, 0x84, 0xE8,
+    0x08, 0xCE, 0x8C, 0x23, 0x30, 0x00, 0x50, 0xE0, 0x68, 0xBC, 0x71, 0xC7, 0x10, 0x00, 0x00, 0x47,
+    0xE3, 0xB7, 0xC3, 0x8C, 0xA3, 0x00, 0x02, 0x8E, 0x67, 0x6D, 0x25, 0x1A, 0x7F, 0x01, 0x80, 0x9D,
+    0x07, 0x5E, 0xCA, 0x3A, 0x4E, 0x03, 0x00, 0x13, 0x9C, 0x29, 0x16, 0x4A, 0x4C, 0x01, 0x00, 0x72,
+    0x0C, 0x50, 0x2B, 0x8E, 0x88, 0x84, 0x00, 0x1E, 0x2D, 0xBA, 0x44, 0x9C, 0xD1, 0x18, 0x00, 0xC0,
+    0xD1, 0xAC, 0xCD, 0xF8, 0x22, 0x10, 0x02, 0xB0, 0xA2, 0xC9, 0x5B, 0x59, 0x47, 0x17, 0x00, 0x60,
+    0x06, 0x94, 0x26, 0xC5, 0x86, 0xC3, 0x00, 0x80, 0x0F, 0x25, 0x89, 0x22, 0x19, 0x97, 0x00, 0xC0,
+    0x24, 0x0D, 0xD7, 0x87, 0x34, 0x42, 0x00, 0x80, 0x34, 0x1A, 0x9B, 0x90, 0x30, 0x34, 0x05, 0x00,
+    0x3F, 0x2A, 0x5F, 0x31, 0xA7, 0xC8, 0x84, 0x00, 0xD2, 0x68, 0x98, 0x68, 0xE0, 0x30, 0x18, 0x00,
+    0x50, 0xC0, 0x08, 0xDA, 0x78, 0x63, 0x52, 0x00, 0xA0, 0xC5, 0x11, 0x1B, 0xE2, 0xC3, 0x51, 0x00,
+    0xB0, 0xE3, 0x21, 0x34, 0xE2, 0x87, 0x24, 0x00, 0xE0, 0xCE, 0x44, 0x49, 0x05, 0x10, 0x69, 0x00,
+    0xC0, 0x1A, 0x0D, 0xA0, 0x4E, 0x34, 0x66, 0x02, 0x40, 0x3F, 0x1F, 0x30, 0x16, 0x5C, 0x44, 0x01,
+    0x00, 0x81, 0x1E, 0x35, 0x2E, 0x46, 0xF8, 0x0A, 0x00, 0x7A, 0x3C, 0x6A, 0x28, 0x00, 0xD1, 0x17,
+    0x00, 0xC4, 0x99, 0x64, 0x5D, 0x98, 0xE3, 0x12, 0x00, 0x08, 0x25, 0x79, 0x93, 0x21, 0xA6, 0x1D,
+    0x00, 0xA0, 0x44, 0x53, 0x17, 0x74, 0x8A, 0x4D, 0x80, 0x20, 0x0D, 0xE4, 0xCE, 0x86, 0x19, 0x57,
+    0x01, 0x61, 0x20, 0x4D, 0x99, 0xCD, 0x29, 0x6E, 0x02, 0x40, 0x35, 0xA8, 0x43, 0x1C, 0x70, 0x44,
+    0x02, 0x00, 0x82, 0x24, 0x52, 0x20, 0xBB, 0x68, 0x01, 0x00, 0xA0, 0x80, 0xB6, 0x5E, 0x44, 0x51,
+    0x03, 0x00, 0x04, 0xAB, 0x90, 0xD5, 0xA8, 0x52, 0x30, 0x00, 0x40, 0x64, 0x98, 0xE9, 0x08, 0xC3,
+    0x18, 0x00, 0x40, 0x43, 0x53, 0x18, 0x64, 0x8C, 0x93, 0x00, 0x00, 0x4B, 0xC2, 0x88, 0x66, 0x0C,
+    0x6B, 0x01, 0x80, 0x9A, 0x0E, 0x15, 0x48, 0x30, 0xBA, 0x02, 0x00, 0x1B, 0x1A, 0x25, 0x07, 0x73,
+    0xAC, 0x0D, 0x01, 0x08, 0x36, 0x7B, 0x2E, 0xE3, 0x08, 0x13, 0x00, 0x1E, 0x74, 0x26, 0x5F, 0x12,
+    0x72, 0x14, 0x00, 0xBC, 0xD9, 0x70, 0x9D, 0x00, 0xE3, 0x34, 0x00, 0xA0, 0xA3, 0x09, 0x92, 0xC0,
+    0xC5, 0x92, 0x00, 0x60, 0xE0, 0x03, 0xD9, 0xF3, 0x8D, 0x49, 0x10, 0x60, 0x0E, 0x08, 0x0D, 0x8A,
+    0x0D, 0x93, 0x40, 0x00, 0x1F, 0x0C, 0xD9, 0x4D, 0x28, 0x66, 0x00, 0x80, 0x34, 0x2D, 0x47, 0xAF,
+    0x4B, 0x8C, 0x22, 0x08, 0x68, 0x3C, 0x52, 0x44, 0x60, 0x48, 0x12, 0x00, 0x5E, 0x48, 0xF6, 0x68,
+    0xAC, 0x71, 0x02, 0x20, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0xA2, 0x10, 0x00, 0x68, 0x55, 0x31, 0x02,
+    0x89, 0xA4, 0x19, 0x00, 0x00, 0xA7, 0x52, 0x96, 0xE3, 0x89, 0xD1, 0x00, 0x60, 0x8E, 0xC6, 0x10,
+    0x05, 0x21, 0x87, 0x00, 0x40, 0x9F, 0x89, 0x99, 0x8C, 0x2D, 0x6A, 0x02, 0x80, 0x0C, 0x99, 0x2E,
+    0x12, 0x64, 0x04, 0x05, 0x00, 0x68, 0x38, 0x6F, 0x3C, 0xAC, 0x78, 0x02, 0x00, 0x3D, 0x60, 0xE2,
+    0x7C, 0x48, 0x51, 0x08, 0x00, 0x50, 0xA0, 0x14, 0xCE, 0xA4, 0xE3, 0x53, 0x00, 0x88, 0x94, 0x29,
+    0xE3, 0xC9, 0xC4, 0x5E, 0x00, 0x60, 0xC0, 0x43, 0x19, 0x53, 0x90, 0x9C, 0x00, 0xA0, 0x8E, 0x26,
+    0x49, 0xC5, 0x0F, 0x67, 0x81, 0x00, 0x9A, 0x8A, 0x15, 0xC8, 0x30, 0xF2, 0x00, 0x80, 0x06, 0x11,
+    0xC7, 0x97, 0x80, 0x1C, 0x02, 0x04, 0xE8, 0x1A, 0x17, 0x3C, 0x1E, 0x12, 0x03, 0x02, 0xC4, 0x74,
+    0x7C, 0x78, 0x88, 0x50, 0x28, 0x00, 0x08, 0xA8, 0x48, 0xAE, 0x3C, 0x64, 0x52, 0x00, 0x08, 0x44,
+    0x59, 0xE4, 0xC9, 0x46, 0x4F, 0x00, 0xF8, 0x80, 0x04, 0x48, 0x84, 0x8B, 0xB0, 0x80, 0x20, 0x10,
+    0xA7, 0x15, 0xE7, 0x22, 0x8F, 0x01, 0x40, 0x98, 0x47, 0x1F, 0xC9, 0x40, 0x56, 0x02, 0xC0, 0x34,
+    0x14, 0x24, 0x8B, 0x60, 0xBC, 0x04, 0x00, 0x71, 0x3C, 0x56, 0x24, 0xB3, 0xC8, 0x04, 0x00, 0xE4,
+    0x74, 0xCA, 0x5C, 0x80, 0x51, 0x24, 0x00, 0xC8, 0xF9, 0xBC, 0x62, 0x51, 0xE3, 0x24, 0x00, 0x48,
+    0xA3, 0xB9, 0xEA, 0x70, 0xC6, 0x9B, 0x00, 0x50, 0x20, 0x13, 0xF9, 0xB3, 0x8D, 0x27, 0x00, 0xA0,
+    0xCD, 0x65, 0x50, 0x66, 0x1D, 0x47, 0x00, 0x80, 0x80, 0x8C, 0x5E, 0x4A, 0x3C, 0xE2, 0x00, 0x04,
+    0x02, 0x2D, 0x4F, 0x9E, 0x7D, 0x04, 0x02, 0x00, 0x52, 0x34, 0x58, 0x35, 0x87, 0xE8, 0x0B, 0x00,
+    0xD0, 0x6C, 0xA6, 0x8C, 0xB6, 0xF0, 0x27, 0x00, 0x08, 0xD8, 0x88, 0xD6, 0x34, 0xA4, 0x13, 0x00,
+    0xA8, 0xA3, 0x91, 0xAA, 0xE1, 0x43, 0x62, 0x00, 0x40, 0x48, 0x23, 0xA8, 0x43, 0x8D, 0xAE, 0x00,
+    0xE0, 0x0D, 0x45, 0xED, 0xC6, 0x15, 0x93, 0x00, 0xC2, 0x9D, 0x8C, 0xA0, 0x91, 0x2D, 0x92, 0x00,
+    0x88, 0x35, 0x24, 0x29, 0x9C, 0x3A, 0x6C, 0x06, 0x00, 0x0A, 0x30, 0x5E, 0x36, 0x94, 0xC8, 0x02,
+    0x00, 0x0C, 0x61, 0x7C, 0x6E, 0x94, 0xD0, 0x03, 0x00, 0xF8, 0xA8, 0x80, 0x81, 0x64, 0x63, 0x4A,
+    0x00, 0xF0, 0xC3, 0x41, 0x24, 0x32, 0xC6, 0xD3, 0x00, 0x50, 0x47, 0xD3, 0x46, 0xD3, 0x8B, 0x2E,
+    0x00, 0xC0, 0xCB, 0xA6, 0xEF, 0x6A, 0x10, 0x51, 0x00, 0x81, 0x1A, 0x4F, 0x96, 0xCD, 0x21, 0xAE,
+    0x00, 0x00, 0x33, 0x99, 0x9E, 0x18, 0x28, 0x3C, 0x06, 0x00, 0x80, 0x38, 0x50, 0x2D, 0x8A, 0x18,
+    0x05, 0x00, 0xFA, 0x5C, 0xC6, 0x60, 0x66, 0x91, 0x04, 0x00, 0xB4, 0x11, 0xF9, 0xDD, 0x54, 0x63,
+    0x08, 0x00, 0x88, 0x73, 0x72, 0x44, 0x22, 0xC6, 0xA3, 0x00, 0x30, 0x60, 0xB3, 0xCA, 0xB3, 0x90,
+    0xBC, 0x00, 0x20, 0x0E, 0xC7, 0x6B, 0x86, 0x13, 0x59, 0x11, 0x40, 0x9C, 0x05, 0x98, 0xCC, 0x29,
+    0xA6, 0x80, 0x00, 0x1A, 0x80, 0x13, 0x05, 0x37, 0x84, 0x04, 0x00, 0x6F, 0x36, 0x59, 0x31, 0x94,
+    0xA8, 0x04, 0x00, 0x3E, 0x2D, 0xC0, 0x6A, 0x3C, 0xA9, 0x05, 0x00, 0xB4, 0xD1, 0x1C, 0xD1, 0x90,
+    0x61, 0x15, 0x00, 0xA0, 0x10, 0x49, 0x93, 0xF1, 0x45, 0x5F, 0x00, 0x60, 0xC6, 0xE3, 0xC7, 0xC4,
+    0x89, 0xAA, 0x00, 0x20, 0x58, 0xE2, 0xC9, 0x42, 0x9A, 0x36, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D,
+    0x2B, 0xDE, 0x00, 0x80, 0x00, 0x17, 0x58, 0x13, 0x9F, 0xDC, 0x41, 0x00, 0x6F, 0x36, 0x6A, 0x37,
+    0xAE, 0xD8, 0x03, 0x00, 0x8C, 0x4C, 0x26, 0x69, 0xFA, 0x91, 0x08, 0x00, 0x28, 0xD0, 0x3C, 0xD6,
+    0xDC, 0xE3, 0x2A, 0x00, 0x30, 0x43, 0xB9, 0xD3, 0x09, 0xC6, 0x5E, 0x00, 0x20, 0x07, 0x72, 0x26,
+    0x12, 0x8E, 0x42, 0x01, 0xE0, 0xC0, 0x46, 0x4E, 0x86, 0x19, 0x5B, 0x00, 0x12, 0x80, 0x52, 0xE3,
+    0xD2, 0x2E, 0xEA, 0x00, 0x00, 0x33, 0x9A, 0x1A, 0x93, 0x27, 0xDC, 0x04, 0x80, 0x5D, 0x32, 0x84,
+    0x39, 0xD9, 0x48, 0x02, 0x18, 0xCC, 0x5C, 0x94, 0x56, 0xFC, 0x10, 0x1A, 0x00, 0xB0, 0x89, 0xB4,
+    0xD1, 0xF4, 0xA2, 0x0E, 0x00, 0x48, 0x54, 0x1A, 0xBB, 0xF1, 0xC4, 0x43, 0x00, 0xD0, 0xE6, 0x94,
+    0x97, 0xF2, 0x8E, 0x35, 0x00, 0xE0, 0xCD, 0xA7, 0x6B, 0x68, 0x0E, 0xA9, 0x00, 0x40, 0x9B, 0xCB,
+    0x12, 0x4C, 0x1D, 0x7A, 0x80, 0x00, 0x37, 0x9D, 0xAF, 0xA1, 0x3B, 0x94, 0x00, 0x08, 0x71, 0x4C,
+    0x83, 0x46, 0xB6, 0xA8, 0x14, 0x28, 0xCC, 0x60, 0xC8, 0x8C, 0xF2, 0x30, 0x04, 0x00, 0xBC, 0xD9,
+    0xA8, 0xDD, 0xB8, 0x62, 0x12, 0x00, 0x80, 0xD3, 0x11, 0x34, 0x9A, 0x45, 0x17, 0x00, 0x20, 0x06,
+    0x95, 0x09, 0x65, 0x8C, 0x42, 0x00, 0x00, 0x8E, 0xE1, 0x69, 0xC5, 0x11, 0x8D, 0x01, 0x00, 0x85,
+    0xCC, 0x9C, 0xCA, 0x37, 0x16, 0x03, 0x80, 0x37, 0x1B, 0xB9, 0x20, 0x51, 0xFC, 0x05, 0x00, 0x71,
+    0x34, 0x50, 0x1D, 0xC0, 0x38, 0x04, 0x00, 0xCC, 0x40, 0xA6, 0x4C, 0x54, 0xF1, 0x05, 0x08, 0x6C,
+    0xB8, 0x70, 0xF9, 0xE4, 0xA1, 0x09, 0x00, 0xE8, 0xA1, 0x19, 0xBA, 0xB1, 0x42, 0x11, 0x00, 0x50,
+    0x8B, 0xF5, 0x37, 0x17, 0x46, 0x31, 0x00, 0x48, 0x8D, 0xC7, 0x0E, 0x88, 0x15, 0x53, 0x01, 0x40,
+    0x1D, 0xC9, 0x8E, 0x08, 0x1B, 0xDE, 0x04, 0x80, 0x00, 0x1D, 0x54, 0x20, 0x7F, 0x5C, 0x02, 0x00,
+    0x72, 0x22, 0x4D, 0x13, 0xD7, 0xD8, 0x0B, 0x00, 0xD0, 0x64, 0xEA, 0x5A, 0xB6, 0xD1, 0x04, 0x00,
+    0xD8, 0xE1, 0xAC, 0x35, 0xDD, 0x21, 0x05, 0x40, 0x60, 0xA3, 0x41, 0xDB, 0xF1, 0x44, 0x13, 0x00,
+    0xF0, 0x66, 0x23, 0x88, 0xD4, 0x8A, 0x9A, 0x00, 0xE0, 0xCF, 0xE5, 0xEC, 0x05, 0x18, 0x7B, 0x00,
+    0x82, 0x01, 0x9D, 0xF3, 0x8A, 0x51, 0xBA, 0x00, 0x80, 0x3A, 0x9A, 0x65, 0xBA, 0x64, 0x3C, 0x02,
+    0x00, 0x84, 0x2A, 0x56, 0x3B, 0x77, 0x08, 0x0C, 0x00, 0xDC, 0x70, 0xA6, 0x5A, 0x22, 0xF1, 0x07,
+    0x40, 0xE8, 0xC9, 0x5C, 0xF1, 0xD4, 0xE1, 0x0D, 0x00, 0xA0, 0x50, 0xC9, 0x1A, 0x19, 0x46, 0x0D,
+    0x02, 0x30, 0x68, 0xE4, 0x75, 0xF3, 0x88, 0x9E, 0x00, 0xC0, 0x8C, 0x66, 0x6A, 0x64, 0x16, 0x3F,
+    0x00, 0x80, 0x17, 0x4D, 0x96, 0x09, 0x2E, 0x1A, 0x01, 0x80, 0x3C, 0x0E, 0x1E, 0x9A, 0x25, 0xCC,
+    0x05, 0x00, 0x74, 0x36, 0x69, 0x40, 0x91, 0x28, 0x02, 0x10, 0x10, 0xD0, 0x84, 0x8B, 0x1E, 0xD2,
+    0x18, 0x00, 0xB8, 0x98, 0xC8, 0x7D, 0xF8, 0xA3, 0x2A, 0x80, 0xE0, 0x23, 0x09, 0x63, 0xF1, 0x45,
+    0x9B, 0x00, 0x60, 0x28, 0x83, 0x76, 0xC3, 0x8A, 0x2B, 0x00, 0x80, 0x0F, 0xA7, 0x4E, 0xC7, 0x17,
+    0x7B, 0x10, 0x00, 0x85, 0x96, 0xF8, 0x10, 0x50, 0x2A, 0x01, 0x00, 0x37, 0x95, 0x32, 0x14, 0x67,
+    0xEC, 0x01, 0x20, 0x61, 0x26, 0x38, 0x0D, 0xB1, 0x58, 0x05, 0x00, 0xD2, 0x2C, 0xD2, 0x78, 0x44,
+    0x91, 0x18, 0x00, 0xAE, 0xC9, 0x7C, 0xB1, 0xD8, 0x62, 0x12, 0x00, 0x20, 0xA4, 0x11, 0xBB, 0xF1,
+    0xC4, 0x24, 0x00, 0x34, 0x85, 0x73, 0x45, 0x53, 0x88, 0x45, 0x01, 0xE0, 0xD1, 0x06, 0x0E, 0x88,
+    0x13, 0x95, 0x00, 0x40, 0x1A, 0x0F, 0x1B, 0x8D, 0x2F, 0x2A, 0x03, 0x80, 0x1D, 0x8B, 0xB7, 0x8F,
+    0x7C, 0xA4, 0x02, 0x00, 0xCB, 0x1A, 0x1D, 0x27, 0x27, 0xC2, 0x0C, 0x00, 0xD2, 0x7C, 0x08, 0x7B,
+    0x9C, 0xF1, 0x21, 0x00, 0x80, 0xA1, 0x18, 0xA2, 0x18, 0x24, 0xAE, 0x00, 0xB0, 0xA3, 0xF9, 0x1A,
+    0x81, 0x46, 0x5F, 0x00, 0xA0, 0x26, 0xF3, 0x35, 0x34, 0x87, 0x3C, 0x00, 0xE0, 0xDA, 0x45, 0xE7,
+    0x86, 0x88, 0x9C, 0x00, 0x80, 0x9F, 0x87, 0x5E, 0x8B, 0x39, 0x86, 0x00, 0x80, 0x07, 0xB9, 0x51,
+    0x9C, 0x85, 0x6C, 0x06, 0x00, 0x25, 0x2A, 0x88, 0x21, 0x1C, 0xB9, 0x02, 0x00, 0x55, 0x60, 0xCE,
+    0x42, 0xBE, 0x91, 0x13, 0x00, 0xEC, 0xE1, 0xC0, 0x5D, 0x40, 0x64, 0x2F, 0x00, 0xB0, 0xA3, 0x81,
+    0x22, 0x39, 0x45, 0x06, 0x00, 0xC0, 0x46, 0xE3, 0xB6, 0xC3, 0x8A, 0x2D, 0x00, 0x40, 0x11, 0xC5,
+    0x2B, 0x67, 0x11, 0x77, 0x00, 0x00, 0x0A, 0x0A, 0xDB, 0xCD, 0x2C, 0x6A, 0x04, 0x80, 0x36, 0x1B,
+    0xC3, 0x24, 0x5B, 0xBC, 0x01, 0x08, 0x71, 0x2A, 0x6F, 0x3C, 0x9C, 0x78, 0x14, 0x00, 0xA2, 0x94,
+    0x2C, 0x89, 0xB4, 0xB1, 0x02, 0x00, 0x64, 0x08, 0x1D, 0xBA, 0xE4, 0xE3, 0x46, 0x00, 0x00, 0xC2,
+    0x39, 0x23, 0x1A, 0xC4, 0x16, 0x80, 0x80, 0x86, 0xE3, 0x77, 0x43, 0x8D, 0xAC, 0x00, 0x40, 0xC7,
+    0x86, 0x4B, 0x26, 0x13, 0x4D, 0x01, 0x80, 0x9B, 0x4C, 0xD4, 0x0D, 0x1D, 0x86, 0x00, 0x00, 0x39,
+    0x1D, 0xB2, 0x97, 0x5D, 0x9C, 0x08, 0x80, 0x68, 0x28, 0x5D, 0x2B, 0xB3, 0x18, 0x13, 0x00, 0xD6,
+    0x68, 0xB2, 0x42, 0x8C, 0xD1, 0x06, 0x20, 0x1C, 0x30, 0x61, 0x96, 0x98, 0xE4, 0x06, 0x00, 0x60,
+    0xB3, 0x41, 0xEC, 0x5A, 0x44, 0x0F, 0x00, 0x60, 0x67, 0x43, 0x83, 0x00, 0x8C, 0x40, 0x00, 0x20,
+    0x96, 0x64, 0x2F, 0x68, 0x96, 0x5C, 0x00, 0x40, 0x9A, 0x09, 0x9E, 0x8F, 0x2D, 0x2A, 0x01, 0x00,
+    0x33, 0x15, 0x30, 0x9B, 0x4C, 0xAC, 0x00, 0x00, 0x7B, 0x3C, 0xBC, 0x62, 0xD2, 0xF8, 0x13, 0x00,
+    0x14, 0x6C, 0xE2, 0x6C, 0x82, 0xF1, 0x26, 0x00, 0xD8, 0xF1, 0x2C, 0xCE, 0xD8, 0x23, 0x12, 0x00,
+    0xB0, 0x73, 0x59, 0x42, 0x59, 0xC4, 0x24, 0x00, 0x24, 0x60, 0xB6, 0x0D, 0xE3, 0x94, 0xBC, 0x00,
+    0x80, 0x58, 0x85, 0x67, 0x65, 0x8B, 0xA2, 0x01, 0x40, 0x9A, 0x48, 0x59, 0x0A, 0x33, 0xE2, 0x00,
+    0x00, 0x35, 0x9F, 0x3E, 0x19, 0x6F, 0x5C, 0x05, 0x00, 0x19, 0x24, 0x4F, 0x1F, 0xB3, 0x38, 0x04,
+    0x00, 0xD6, 0x41, 0x74, 0x60, 0x9A, 0xC8, 0x14, 0x00, 0x64, 0x31, 0x81, 0x7D, 0x6C, 0x63, 0x14,
+    0x00, 0xE8, 0x54, 0xE1, 0x42, 0xD9, 0xA5, 0x88, 0x00, 0x20, 0x41, 0x63, 0x6D, 0xA5, 0x90, 0xA8,
+    0x00, 0xC0, 0x8E, 0xA6, 0x2B, 0x65, 0x17, 0x23, 0x00, 0x00, 0x1E, 0x8D, 0xD5, 0x09, 0x2B, 0xDE,
+    0x02, 0x80, 0x39, 0x94, 0xA6, 0x17, 0x3E, 0xCC, 0x00, 0x00, 0x22, 0x10, 0x3B, 0x46, 0x35, 0x58,
+    0x13, 0x02, 0x06, 0x6C, 0x5A, 0x7E, 0xC2, 0xD1, 0x08, 0x00, 0x1C, 0xCA, 0xE4, 0xD5, 0x40, 0xA3,
+    0x0F, 0x20, 0x98, 0xA3, 0xE9, 0xDA, 0x11, 0xC4, 0x0F, 0x00, 0xF2, 0x66, 0xA3, 0x76, 0xE3, 0x8A,
+    0x3E, 0x00, 0xC0, 0x87, 0x04, 0x4D, 0xC4, 0x1C, 0xA3, 0x01, 0x80, 0x9A, 0xCC, 0x16, 0x12, 0x19,
+    0xFE, 0x20, 0x80, 0x3A, 0x1A, 0xA7, 0x8F, 0x58, 0x84, 0x02, 0x00, 0x06, 0x1B, 0x16, 0x28, 0x23,
+    0xB2, 0x0A, 0x00, 0x93, 0x78, 0xE6, 0x64, 0x98, 0xF1, 0x18, 0x00, 0xBC, 0xB2, 0xEC, 0x58, 0x38,
+    0xD2, 0x29, 0x20, 0x40, 0xB1, 0xA1, 0xA2, 0x11, 0xC4, 0x0F, 0x00, 0xF0, 0x66, 0xA3, 0x76, 0xE3,
+    0x8A, 0x9A, 0x00, 0x40, 0x88, 0x46, 0x8E, 0xA6, 0x18, 0x9D, 0x03, 0x40, 0xAC, 0x8D, 0xDA, 0x8D,
+    0x2B, 0x16, 0x01, 0x80, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0x94, 0x00, 0x00, 0x6A, 0x34, 0x75, 0x51,
+    0x80, 0x58, 0x05, 0x00, 0x36, 0x65, 0xC2, 0x6E, 0x30, 0x91, 0x17, 0x00, 0xA8, 0x79, 0x58, 0xA1,
+    0xA8, 0xE2, 0x12, 0x10, 0xC8, 0x90, 0x9A, 0x1C, 0xCA, 0x46, 0x1F, 0x00, 0xB0, 0x86, 0xE2, 0x63,
+    0x82, 0x86, 0x2C, 0x00, 0x60, 0xD0, 0xC8, 0x4A, 0xC9, 0x0A, 0x71, 0x01, 0x00, 0x8D, 0x8F, 0xA6,
+    0x51, 0x36, 0xBA, 0x00, 0x80, 0x1F, 0x1A, 0xAE, 0x92, 0x61, 0xEC, 0x01, 0x00, 0x7C, 0x3E, 0x51,
+    0x12, 0xE6, 0x58, 0x01, 0x00, 0xCC, 0x68, 0xB8, 0x5A, 0x54, 0x71, 0x09, 0x00, 0xD0, 0xA1, 0xA4,
+    0x85, 0xAC, 0xA3, 0x29, 0x00, 0x48, 0xE3, 0x81, 0xA2, 0xB9, 0x43, 0x22, 0x00, 0x00, 0x29, 0xC2,
+    0x86, 0xA2, 0x8D, 0x09, 0x00, 0x80, 0x8F, 0xA8, 0x0B, 0x67, 0x11, 0x9B, 0x00, 0x00, 0x1A, 0xCD,
+    0x97, 0x4B, 0x2B, 0xEE, 0x00, 0x04, 0x05, 0x20, 0x2F, 0x9B, 0x4B, 0xBC, 0x09, 0x00, 0x7E, 0x2A,
+    0x7A, 0x4C, 0x91, 0xB8, 0x00, 0x00, 0x0C, 0x69, 0xC0, 0x48, 0xA0, 0x11, 0x03, 0x00, 0xBC, 0xC1,
+    0x58, 0xE1, 0xF0, 0xE1, 0x2F, 0x80, 0xF0, 0x53, 0x81, 0xFA, 0xC0, 0x45, 0x5B, 0x00, 0x40, 0x24,
+    0xF3, 0xF5, 0xC3, 0x87, 0x3E, 0x02, 0xA0, 0x8E, 0xC6, 0x67, 0x25, 0x0C, 0x7B, 0x01, 0xC0, 0x9B,
+    0x8D, 0xDA, 0x8D, 0x2B, 0x02, 0x01, 0x80, 0x5F, 0x89, 0xAE, 0x1A, 0x4A, 0xE2, 0x2C, 0x00, 0x61,
+    0x30, 0x73, 0x27, 0xE7, 0xB8, 0x01, 0x00, 0xC4, 0x68, 0xBE, 0x60, 0x54, 0x71, 0x07, 0x00, 0xD4,
+    0xD1, 0xCC, 0xBA, 0xCD, 0xE2, 0x0B, 0x40, 0x82, 0xA3, 0xB1, 0x13, 0xE1, 0x47, 0x0C, 0x00, 0x50,
+    0x47, 0xD3, 0x46, 0xD3, 0x8B, 0x12, 0x80, 0xA0, 0x86, 0x86, 0x68, 0xC3, 0x13, 0x75, 0x00, 0x80,
+    0x93, 0x0D, 0x97, 0xCE, 0x20, 0xBE, 0x04, 0x80, 0x41, 0x19, 0xAA, 0x14, 0x51, 0xCC, 0x00, 0x80,
+    0x6E, 0x3A, 0x54, 0x29, 0xA2, 0xD8, 0x04, 0x00, 0xD2, 0x4C, 0xF2, 0x78, 0x7C, 0xF1, 0x08, 0x00,
+    0xA0, 0x41, 0x55, 0x1E, 0x45, 0x63, 0x03, 0x00, 0x78, 0x33, 0x19, 0xBC, 0xE1, 0xC6, 0x21, 0x00,
+    0x30, 0x27, 0xD3, 0x45, 0x73, 0x89, 0x1A, 0x00, 0x20, 0x8D, 0x86, 0x08, 0x43, 0x15, 0x4F, 0x00,
+    0x60, 0x1A, 0x0D, 0x9E, 0x4A, 0x3A, 0xEE, 0x02, 0x00, 0x3B, 0x98, 0xC0, 0x9B, 0x6C, 0xB4, 0x04,
+    0x80, 0x79, 0x3E, 0x87, 0x36, 0xE6, 0xA8, 0x04, 0x10, 0x04, 0x65, 0x9A, 0x44, 0x48, 0x71, 0x08,
+    0x00, 0xD0, 0xD1, 0x28, 0xA9, 0x00, 0xA2, 0x06, 0x00, 0xA8, 0xA3, 0x69, 0xA3, 0xE9, 0xC5, 0x91,
+    0x00, 0xB0, 0x83, 0x02, 0xF7, 0xE2, 0x8C, 0x4C, 0x00, 0x80, 0x0E, 0x25, 0x6F, 0xC6, 0x1A, 0x3F,
+    0x02, 0x00, 0x81, 0xCD, 0xDA, 0x49, 0x36, 0x22, 0x01, 0x00, 0x3A, 0xA1, 0x34, 0x1E, 0x4E, 0x3C,
+    0x02, 0x00, 0x75, 0x34, 0x6D, 0x34, 0xBD, 0xC8, 0x04, 0x18, 0xC6, 0x59, 0x98, 0x8C, 0x96, 0xE8,
+    0x25, 0x10, 0xD8, 0x1B, 0xF4, 0xB0, 0x6C, 0x21, 0x2F, 0x00, 0xEC, 0x84, 0x80, 0x79, 0x18, 0xA4,
+    0x1E, 0x00, 0x80, 0x66, 0xB1, 0x15, 0x93, 0x89, 0x4D, 0x00, 0x80, 0xD9, 0xA0, 0xA4, 0x61, 0x8B,
+    0x5E, 0x00, 0x80, 0x8E, 0x88, 0x51, 0x85, 0x2F, 0x46, 0x00, 0x00, 0x3E, 0x9C, 0xA4, 0x96, 0x3C,
+    0xDC, 0x00, 0x08, 0x1B, 0x38, 0x56, 0x3C, 0x73, 0x88, 0x83, 0x80, 0x28, 0x80, 0x0C, 0x8B, 0x80,
+    0x91, 0x22, 0x00, 0x78, 0xD0, 0x6C, 0xF2, 0xE4, 0x23, 0x27, 0x00, 0xF8, 0x52, 0x61, 0x69, 0xC8,
+    0xC3, 0xDF, 0x00, 0x02, 0x20, 0xA2, 0x05, 0x93, 0x89, 0xB9, 0x08, 0x40, 0x0C, 0x45, 0xA8, 0xC6,
+    0x0A, 0x59, 0x01, 0x00, 0x9A, 0x51, 0xAC, 0x53, 0x3A, 0x1A, 0x03, 0x40, 0x38, 0x17, 0x37, 0x9D,
+    0x56, 0x7C, 0x01, 0x01, 0x83, 0x32, 0x2E, 0x1B, 0x56, 0x18, 0x0D, 0x00, 0xCC, 0x68, 0xB6, 0x68,
+    0x20, 0x51, 0x09, 0x00, 0x40, 0xF2, 0x2C, 0xE9, 0x88, 0xA1, 0x2B, 0x00, 0x80, 0xE3, 0xA8, 0xF1,
+    0x20, 0xC3, 0x0A, 0x00, 0xB4, 0x46, 0x23, 0xE9, 0x06, 0x88, 0x50, 0x00, 0xE0, 0x4E, 0x87, 0xCD,
+    0xE8, 0x10, 0xA3, 0x00, 0x80, 0xB1, 0x07, 0x1A, 0x0A, 0x35, 0xE9, 0x04, 0x80, 0x28, 0x9C, 0xBD,
+    0x1C, 0x66, 0x5C, 0x00, 0x00, 0x6F, 0x36, 0x58, 0x2F, 0x97, 0x48, 0x0A, 0x00, 0xF8, 0x54, 0x9A,
+    0x6E, 0xD8, 0xB0, 0x08, 0x00, 0xD8, 0xE1, 0x5C, 0xF1, 0xCC, 0x21, 0x4B, 0x70, 0x98, 0x44, 0xB9,
+    0x7A, 0xA1, 0x44, 0x14, 0x40, 0xE0, 0x48, 0x23, 0x43, 0xD2, 0x84, 0x21, 0x00, 0x10, 0x41, 0xC7,
+    0xEF, 0xE5, 0x1C, 0x67, 0x00, 0x41, 0x0F, 0x4D, 0xDA, 0x4D, 0x2C, 0x5A, 0x00, 0x82, 0x3B, 0xA6,
+    0xB9, 0xA5, 0x43, 0xDC, 0x05, 0x00, 0x0A, 0x32, 0x60, 0x26, 0xC9, 0x88, 0x03, 0x00, 0x3C, 0x50,
+    0xFE, 0x66, 0xBE, 0x31, 0x19, 0x01, 0x14, 0x5A, 0xDC, 0x2C, 0xD8, 0xE2, 0x22, 0x00, 0x78, 0xC3,
+    0x59, 0x62, 0xF1, 0x43, 0x0B, 0x00, 0xD8, 0xE6, 0xA3, 0x07, 0xB3, 0x8D, 0x4D, 0x00, 0x60, 0x8E,
+    0xE6, 0x88, 0xC1, 0x1C, 0x83, 0x00, 0x40, 0xB0, 0x8A, 0x90, 0x08, 0x20, 0x45, 0x00, 0x80, 0x3A,
+    0x9A, 0x36, 0x9A, 0x5E, 0xDC, 0x41, 0x00, 0x6E, 0x40, 0x60, 0x40, 0x7E, 0xC8, 0x0B, 0x00, 0x00,
+    0x18, 0x69, 0x77, 0x2E, 0x72, 0x14, 0x00, 0xE0, 0xE9, 0x24, 0xF5, 0x58, 0xA1, 0x06, 0x00, 0x90,
+    0xA3, 0x71, 0xEA, 0xC0, 0x45, 0x1E, 0x00, 0x00, 0x8B, 0x23, 0xC7, 0xD3, 0x4A, 0x9B, 0x00, 0x50,
+    0x4D, 0x6B, 0x8F, 0xA8, 0x15, 0x95, 0x00, 0x42, 0x22, 0x08, 0xC5, 0xCE, 0x06, 0xDA, 0x06, 0x82,
+    0x40, 0x15, 0x36, 0x1A, 0x5E, 0xB4, 0x41, 0x00, 0x28, 0x36, 0x35, 0x2B, 0x49, 0x68, 0x04, 0x00,
+    0xB0, 0x5C, 0xB0, 0x4C, 0x6C, 0xB1, 0x06, 0x10, 0x64, 0xE0, 0x34, 0xEE, 0x8C, 0xE3, 0x0F, 0x20,
+    0xA0, 0xE3, 0x49, 0xE3, 0xE1, 0x44, 0x4B, 0x00, 0xB8, 0x64, 0x84, 0xF6, 0x32, 0x8C, 0x9B, 0x00,
+    0x20, 0x8F, 0x46, 0xCA, 0x63, 0x18, 0x9F, 0x02, 0x02, 0x9C, 0x4C, 0x2E, 0x8F, 0x46, 0xCE, 0x00,
+    0x84, 0x07, 0xA2, 0x40, 0x1E, 0x67, 0x74, 0x02, 0x00, 0x62, 0x32, 0x74, 0x34, 0xC9, 0xE8, 0x04,
+    0x00, 0xEC, 0x68, 0xCC, 0x7E, 0x16, 0x11, 0x09, 0x00, 0xBC, 0xD9, 0x74, 0xBA, 0x68, 0x24, 0x2F,
+    0x00, 0x30, 0xD3, 0x29, 0x9B, 0x89, 0xC5, 0x56, 0x00, 0x20, 0x46, 0x33, 0xF4, 0x90, 0x8C, 0x25,
+    0x80, 0x81, 0x42, 0x87, 0xEC, 0x63, 0x1C, 0x99, 0x02, 0x00, 0x23, 0x8D, 0xCE, 0x4B, 0x13, 0x56,
+    0x02, 0x80, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0xDC, 0x00, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE, 0xA8,
+    0x0C, 0x00, 0xD8, 0x70, 0xE8, 0x6C, 0x88, 0x71, 0x08, 0x01, 0x10, 0xD1, 0x74, 0xC9, 0x70, 0x62,
+    0x31, 0x00, 0xD0, 0xD3, 0x61, 0x22, 0xC9, 0x44, 0x1B, 0x00, 0x30, 0x40, 0xD3, 0x46, 0xD3, 0x8B,
+    0xB5, 0x80, 0x80, 0xC8, 0xE6, 0x64, 0x25, 0x06, 0x5B, 0x03, 0x80, 0x8D, 0x8B, 0x60, 0xCD, 0x37,
+    0xEE, 0x00, 0x80, 0x37, 0x1D, 0xB5, 0x1B, 0x57, 0xD4, 0x05, 0x00, 0x7D, 0x30, 0x81, 0x37, 0xD9,
+    0x38, 0x02, 0x80, 0xDA, 0x5C, 0x82, 0x32, 0x32, 0xB1, 0x04, 0x20, 0xE8, 0xC8, 0xB8, 0xE1, 0xCC,
+    0x22, 0x15, 0x02, 0x48, 0xF1, 0x80, 0xFC, 0xD9, 0x46, 0x8C, 0x40, 0x40, 0x80, 0xB2, 0x85, 0x23,
+    0x88, 0x43, 0x01, 0xC0, 0x11, 0x84, 0x0F, 0x06, 0x1C, 0x3D, 0x00, 0xC0, 0x03, 0x0D, 0x18, 0x8D,
+    0x27, 0xFE, 0x08, 0x20, 0x04, 0x18, 0x5B, 0x9A, 0x93, 0x24, 0x0A, 0x00, 0x6B, 0x16, 0x45, 0x13,
+    0xC3, 0x38, 0x0C, 0x00, 0x2A, 0x75, 0xCA, 0x54, 0x90, 0xB1, 0x07, 0x01, 0x88, 0x91, 0xC8, 0xE9,
+    0xE0, 0xE2, 0x4C, 0x00, 0x40, 0x07, 0xDA, 0x51, 0x9A, 0x11, 0x23, 0x00, 0xF0, 0x66, 0xA3, 0x76,
+    0xE3, 0x8A, 0x1E, 0x00, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x81, 0x00, 0xC0, 0xB4, 0x87, 0x97,
+    0x09, 0x31, 0x6D, 0x00, 0x00, 0x40, 0x1C, 0x50, 0xAC, 0x61, 0x8C, 0x05, 0x00, 0xDE, 0x2A, 0x77,
+    0x3D, 0xB6, 0x94, 0x01, 0x00, 0x04, 0x69, 0xD0, 0x78, 0x3C, 0xD1, 0x06, 0x00, 0xE1, 0xD1, 0x30,
+    0xF5, 0x80, 0xE1, 0x31, 0x00, 0xF0, 0x24, 0xD9, 0xA1, 0xB8, 0x24, 0x10, 0x00, 0x40, 0x01, 0x24,
+    0x86, 0xE4, 0x86, 0xA5, 0x00, 0x80, 0x40, 0xE4, 0x49, 0x67, 0x0D, 0x85, 0x00, 0x80, 0x1E, 0xCF,
+    0x9C, 0x8B, 0x35, 0x82, 0x00, 0x80, 0x3F, 0x14, 0x26, 0x0D, 0x5F, 0x44, 0x02, 0x00, 0x6C, 0x34,
+    0x89, 0x35, 0xEB, 0xA8, 0x0B, 0x00, 0xF3, 0x78, 0xA8, 0x6E, 0xF8, 0x10, 0x02, 0x00, 0x94, 0xB3,
+    0xC8, 0x0D, 0x71, 0x92, 0x30, 0x00, 0x88, 0x83, 0xA1, 0xA2, 0x11, 0xC4, 0x54, 0x01, 0x60, 0x83,
+    0xC4, 0xB7, 0x12, 0x8F, 0xCC, 0x00, 0xE0, 0x8B, 0x06, 0x87, 0xE5, 0x09, 0x53, 0x00, 0x40, 0x9C,
+    0x4B, 0x9D, 0x4C, 0x34, 0xEE, 0x06, 0x00, 0x01, 0xA2, 0x38, 0x0F, 0x7F, 0x2C, 0x16, 0x00, 0x6A,
+    0x02, 0x2F, 0x1B, 0x58, 0x48, 0x02, 0x80, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0x51, 0x07, 0x00, 0x50,
+    0xC0, 0x5C, 0xA1, 0xB0, 0x62, 0x09, 0x40, 0x78, 0x33, 0x04, 0x6F, 0x91, 0x4A, 0x0C, 0x40, 0x00,
+    0xCA, 0xF3, 0x45, 0x54, 0x47, 0x42, 0x00, 0xE0, 0x0E, 0x45, 0x88, 0x84, 0x0F, 0x97, 0x00, 0x80,
+    0x07, 0x4E, 0xDC, 0x8C, 0x31, 0x06, 0x03, 0x80, 0x34, 0x13, 0x34, 0x12, 0x6F, 0xD4, 0x01, 0x08,
+    0x66, 0x3C, 0x35, 0x2D, 0x48, 0x38, 0x01, 0x00, 0x78, 0x71, 0x10, 0xC9, 0x00, 0xA9, 0x17, 0x00,
+    0x68, 0xD1, 0xF0, 0xE9, 0x24, 0x63, 0x24, 0x00, 0xA0, 0xE3, 0x59, 0x62, 0xE1, 0x43, 0x2A, 0x40,
+    0x60, 0xE8, 0x73, 0x47, 0xF3, 0x8C, 0x45, 0x00, 0xA0, 0x8E, 0x66, 0xEA, 0x65, 0x11, 0x63, 0x03,
+    0x40, 0x1A, 0x50, 0xDC, 0xC9, 0x38, 0x1A, 0x01, 0x00, 0x27, 0x97, 0xA5, 0x10, 0x51, 0x2C, 0x01,
+    0x00, 0x6B, 0x30, 0x60, 0x2B, 0xBE, 0x08, 0x19, 0x1C, 0xA8, 0x3D, 0x08, 0x69, 0xCE, 0xD1, 0x04,
+    0x00, 0xC8, 0x31, 0x20, 0xBD, 0xC0, 0xA1, 0x4B, 0x00, 0x80, 0x73, 0x78, 0x23, 0x49, 0xC7, 0x20,
+    0x00, 0xA0, 0x06, 0x04, 0xDB, 0x94, 0x8E, 0x2B, 0x01, 0x00, 0xD7, 0xA8, 0xDB, 0x68, 0x26, 0x4F,
+    0x00, 0x40, 0x1D, 0x4D, 0x1B, 0x4D, 0x2F, 0xBA, 0x00, 0x00, 0x24, 0x24, 0x2F, 0x1E, 0x41, 0x9C,
+    0x05, 0x00, 0x79, 0x32, 0x4C, 0x13, 0xD6, 0xF8, 0x01, 0x00, 0xE6, 0x54, 0xB0, 0x70, 0x00, 0xF1,
+    0x04, 0x00, 0x2E, 0xD2, 0x6C, 0xA5, 0xCC, 0x22, 0x03, 0x00, 0x80, 0x53, 0xE2, 0x0B, 0xC2, 0x45,
+    0x17, 0x80, 0x10, 0x6A, 0x92, 0xA6, 0x12, 0x4D, 0x29, 0x00, 0xE0, 0x4A, 0x06, 0xEB, 0x26, 0x10,
+    0x2B, 0x00, 0xC0, 0x84, 0x88, 0x57, 0x8A, 0x2F, 0x0E, 0x03, 0x00, 0x0A, 0x98, 0xB3, 0x1D, 0x4F,
+    0x94, 0x02, 0x00, 0x4A, 0x3C, 0x57, 0x39, 0x7C, 0x58, 0x12, 0x00, 0x32, 0x60, 0xB0, 0x62, 0x22,
+    0xB1, 0x04, 0x00, 0x50, 0x18, 0x08, 0x89, 0x00, 0x22, 0x32, 0x00, 0xA0, 0x93, 0x21, 0xCB, 0xE1,
+    0xC4, 0x16, 0x00, 0x10, 0x8C, 0x93, 0xD5, 0x53, 0x47, 0x47, 0x00, 0x80, 0x19, 0x66, 0x2B, 0x26,
+    0x93, 0x5C, 0x00, 0x00, 0x3E, 0x0F, 0x94, 0x10, 0x18, 0xE9, 0x02, 0x00, 0x2C, 0x1E, 0x30, 0x1C,
+    0x4A, 0x44, 0x02, 0x02, 0x6C, 0x38, 0x6E, 0x44, 0x8E, 0x28, 0x04, 0x10, 0x9E, 0x68, 0xF4, 0x68,
+    0xA8, 0x91, 0x07, 0x00, 0xD8, 0xE1, 0x5C, 0xD1, 0x1C, 0xE2, 0x29, 0x80, 0x98, 0x55, 0xC1, 0x42,
+    0x69, 0xA5, 0xA8, 0x40, 0xA0, 0xC3, 0x70, 0xF7, 0xA2, 0x8D, 0x3C, 0x00, 0x00, 0xD6, 0x85, 0x86,
+    0x86, 0x47, 0xA0, 0x08, 0xC0, 0xA4, 0xCC, 0x93, 0x0E, 0x1A, 0xE6, 0x0A, 0x80, 0x3A, 0x9A, 0x31,
+    0x19, 0x56, 0x64, 0x46, 0x00, 0x07, 0x38, 0x58, 0x38, 0x80, 0xC8, 0x02, 0x00, 0x02, 0x65, 0xC8,
+    0x5C, 0x7C, 0x91, 0x22, 0x20, 0x24, 0xE8, 0xE4, 0xEA, 0x7C, 0x24, 0x09, 0x00, 0x41, 0xB3, 0x79,
+    0xAB, 0x99, 0xC5, 0x12, 0x00, 0x50, 0x47, 0xD3, 0x46, 0xD3, 0x8B, 0xA8, 0x00, 0x40, 0x4D, 0x05,
+    0xEF, 0xA0, 0x29, 0x15, 0x03, 0x80, 0x82, 0x12, 0x6B, 0x0B, 0x4B, 0x7A, 0x44, 0x04, 0x01, 0xAC,
+    0x43, 0xAB, 0x4C, 0x4C, 0x06, 0x00, 0x6D, 0x2E, 0x4B, 0x31, 0x73, 0x58, 0x04, 0x00, 0xAA, 0x65,
+    0xA4, 0xCA, 0x72, 0x04, 0x05, 0x22, 0x08, 0x78, 0x11, 0xAF, 0x41, 0x23, 0x08, 0x80, 0xCC, 0xF4,
+    0x40, 0xB9, 0x69, 0xC1, 0x1F, 0x00, 0x60, 0xA9, 0xD3, 0xA5, 0x73, 0x88, 0x2A, 0x00, 0x40, 0x01,
+    0x29, 0x54, 0xE8, 0x1D, 0x6D, 0x08, 0x80, 0x1B, 0x8F, 0x91, 0x8B, 0x1B, 0xC2, 0x00, 0x80, 0x02,
+    0x95, 0x5A, 0x12, 0xA2, 0x44, 0x01, 0x00, 0x7F, 0x2A, 0x31, 0x2E, 0x3E, 0xA8, 0x02, 0x00, 0xDA,
+    0x44, 0xAE, 0x56, 0x44, 0x11, 0x03, 0x00, 0xA4, 0xD1, 0x4C, 0xB9, 0x38, 0xE2, 0x28, 0x00, 0x20,
+    0x12, 0xE2, 0x9A, 0xB9, 0x44, 0x0B, 0x00, 0x54, 0x06, 0x04, 0xD7, 0x42, 0x8D, 0x21, 0x00, 0x00,
+    0x1B, 0xA8, 0x0A, 0x47, 0x8F, 0x8A, 0x02, 0xC0, 0x9F, 0x89, 0x9F, 0x8A, 0x3D, 0x46, 0x00, 0x80,
+    0x37, 0x9B, 0xA9, 0x96, 0x48, 0x84, 0x02, 0x00, 0x66, 0x22, 0x72, 0x42, 0x9C, 0x08, 0x01, 0x02,
+    0xCC, 0x68, 0x80, 0x22, 0x70, 0x31, 0x19, 0x00, 0xE4, 0xA1, 0x6C, 0x89, 0x24, 0x23, 0x0A, 0x60,
+    0xA8, 0x83, 0x69, 0xA3, 0xE9, 0xC5, 0x57, 0x00, 0xF0, 0x66, 0x03, 0x85, 0x04, 0x85, 0x3A, 0x00,
+    0xC0, 0x49, 0x47, 0x4B, 0x85, 0x15, 0x5B, 0x01, 0x80, 0x07, 0x4E, 0x57, 0xCA, 0x2E, 0xAE, 0x00,
+    0x00, 0x01, 0x12, 0xC6, 0x1B, 0x76, 0x5C, 0x05, 0x00, 0x72, 0x34, 0x71, 0x37, 0xBE, 0xF8, 0x02,
+    0x00, 0xEA, 0x68, 0xE4, 0x58, 0xB2, 0xB1, 0x15, 0x20, 0xC4, 0xA8, 0x7C, 0x7D, 0x64, 0xE3, 0x26,
+    0x00, 0x70, 0xE1, 0xD1, 0xAA, 0x88, 0x47, 0x23, 0x40, 0x20, 0xE9, 0xB1, 0x26, 0x72, 0x8E, 0x4A,
+    0x00, 0xA0, 0x84, 0x26, 0x54, 0x2E, 0x12, 0x57, 0x03, 0x80, 0x19, 0x0D, 0x19, 0x8D, 0x2A, 0xF2,
+    0x02, 0x80, 0x39, 0x1A, 0xA3, 0x09, 0x62, 0x34, 0x02, 0x00, 0x04, 0x34, 0x9B, 0x3C, 0xF9, 0x68,
+    0x04, 0x00, 0x74, 0x80, 0xB8, 0x78, 0xF8, 0x90, 0x15, 0x10, 0xB8, 0xD1, 0xC0, 0xC9, 0x18, 0x63,
+    0x31, 0x00, 0x30, 0x43, 0xE9, 0x82, 0x21, 0xC5, 0x22, 0x00, 0x20, 0x47, 0x23, 0x7A, 0x65, 0x8C,
+    0x39, 0x00, 0x01, 0x0F, 0xE2, 0xED, 0xE6, 0x16, 0x1D, 0x02, 0x50, 0x36, 0xCC, 0xCC, 0x4E, 0x8D,
+    0xD4, 0x00, 0xA0, 0x37, 0x23, 0xB5, 0x1B, 0x57, 0xDC, 0x00, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE,
+    0x78, 0x05, 0x00, 0x7E, 0x09, 0x48, 0x26, 0x90, 0x50, 0x27, 0x04, 0xC8, 0xF0, 0xBC, 0xE1, 0xD8,
+    0x22, 0x86, 0x04, 0x40, 0xF3, 0x22, 0x65, 0xF3, 0x44, 0x13, 0x08, 0xF0, 0xA0, 0xE4, 0x3C, 0x66,
+    0x8E, 0x50, 0x00, 0x80, 0x40, 0x26, 0x91, 0x27, 0x1B, 0x7F, 0x01, 0x40, 0x9E, 0x0E, 0xD3, 0x8D,
+    0x1A, 0xEA, 0x02, 0x80, 0x3A, 0x1A, 0xA3, 0x16, 0x38, 0x44, 0x02, 0x00, 0x00, 0x38, 0x5C, 0x2E,
+    0xA7, 0xE8, 0x03, 0x08, 0x82, 0x68, 0xCC, 0x6E, 0x4E, 0x91, 0x02, 0x00, 0xBC, 0xD9, 0xA8, 0xDD,
+    0xB8, 0x22, 0x34, 0x00, 0xC8, 0x82, 0xE8, 0x92, 0xE1, 0x44, 0xA6, 0x10, 0x30, 0x42, 0x72, 0x08,
+    0x63, 0x8F, 0x1A, 0x00, 0x40, 0x0C, 0x48, 0x70, 0x08, 0x18, 0x51, 0x02, 0xC1, 0x81, 0x8E, 0x61,
+    0xCA, 0x40, 0x46, 0x00, 0x00, 0x36, 0x14, 0x2C, 0x9E, 0x3A, 0x5C, 0x05, 0x00, 0x6E, 0x30, 0x63,
+    0x2E, 0xBB, 0xD8, 0x04, 0x08, 0x88, 0x59, 0x8C, 0x78, 0xA0, 0xA8, 0x09, 0x00, 0x50, 0xA0, 0x34,
+    0xAD, 0x1C, 0xE2, 0x07, 0x00, 0x41, 0xB0, 0xD1, 0xC3, 0x61, 0x46, 0x60, 0x04, 0x90, 0xE5, 0x61,
+    0x4A, 0x63, 0x91, 0x2F, 0x00, 0xC0, 0x4C, 0xC4, 0xEC, 0x44, 0x1A, 0x73, 0x00, 0x80, 0x20, 0x4A,
+    0x97, 0x0C, 0x27, 0xFE, 0x04, 0x00, 0x01, 0x14, 0xBC, 0x16, 0x70, 0x6C, 0x01, 0x08, 0x04, 0x32,
+    0x62, 0x2B, 0xC1, 0xF8, 0x13, 0x00, 0x42, 0x75, 0xC2, 0x54, 0x82, 0x31, 0x19, 0x00, 0xC4, 0xC1,
+    0x74, 0x9D, 0x00, 0x63, 0x05, 0x00, 0x40, 0x43, 0x19, 0x5B, 0x09, 0xC6, 0x4C, 0x00, 0xA8, 0xC6,
+    0x03, 0x28, 0x13, 0x8E, 0x5D, 0x00, 0xA0, 0x8E, 0xA6, 0x90, 0x87, 0x1A, 0x4B, 0x00, 0x00, 0x1C,
+    0x8D, 0xD5, 0x4E, 0x1D, 0xEE, 0x00, 0x00, 0x3D, 0x95, 0xAD, 0x17, 0x51, 0xEC, 0x01, 0x80, 0x73,
+    0x2E, 0x77, 0x3C, 0xBE, 0x18, 0x04, 0x08, 0x24, 0x69, 0xC2, 0xC2, 0x9A, 0xB0, 0x0A, 0x10, 0xA0,
+    0xFA, 0xEC, 0xFC, 0xF0, 0xA0, 0x0D, 0x00, 0x80, 0x93, 0x89, 0x9A, 0xE1, 0xC3, 0x15, 0x00, 0x80,
+    0xE3, 0xC2, 0x47, 0xD4, 0x8A, 0xAE, 0x00, 0x60, 0x0E, 0x07, 0x26, 0x45, 0x08, 0x95, 0x80, 0x00,
+    0x03, 0x0F, 0x19, 0x8C, 0x2D, 0xF2, 0x20, 0x80, 0x36, 0x95, 0x33, 0x14, 0x69, 0x04, 0x01, 0x00,
+    0x8B, 0x34, 0x43, 0x58, 0x33, 0xC8, 0x02, 0x00, 0xD2, 0x68, 0xF0, 0x72, 0x88, 0xB1, 0x1A, 0x00,
+    0xB0, 0xD1, 0xB8, 0x45, 0x88, 0xA4, 0x07, 0x00, 0xD0, 0x04, 0x71, 0x19, 0x31, 0xC2, 0x49, 0x00,
+    0x60, 0x46, 0xF3, 0xB6, 0x31, 0x90, 0x3C, 0x00, 0x60, 0x8D, 0x26, 0x93, 0x27, 0x1E, 0x93, 0x01,
+    0x80, 0x9A, 0x0D, 0x14, 0x8C, 0x20, 0x4A, 0x00, 0x00, 0x3B, 0xA6, 0xC1, 0x1B, 0x6E, 0xDC, 0x05,
+    0x04, 0x95, 0x10, 0x46, 0x1E, 0x99, 0x98, 0x08, 0x00, 0xE4, 0x8C, 0xAC, 0x6A, 0x04, 0x71, 0x19,
+    0x00, 0xA4, 0xB9, 0x1C, 0x55, 0x0C, 0x23, 0x4E, 0x00, 0xA8, 0xA3, 0x19, 0x4D, 0x23, 0x45, 0x22,
+    0x00, 0x20, 0xA6, 0x78, 0x46, 0x13, 0x8B, 0x39, 0x00, 0xA0, 0x81, 0x26, 0xB8, 0xE5, 0x27, 0x63,
+    0x01, 0xC0, 0x3F, 0x42, 0x42, 0x50, 0x83, 0x30, 0x03, 0x00, 0x03, 0x2E, 0x5B, 0x99, 0x96, 0xA4,
+    0x04, 0x00, 0x7A, 0x32, 0x44, 0x34, 0x5F, 0x58, 0x04, 0x00, 0x00, 0x54, 0xE0, 0x6E, 0x74, 0xB1,
+    0x09, 0x00, 0x1C, 0x58, 0xD8, 0xDC, 0xF0, 0xE0, 0x04, 0x00, 0xA0, 0x45, 0x59, 0x7B, 0x31, 0x26,
+    0x25, 0x04, 0x40, 0x49, 0x72, 0x76, 0x42, 0x8D, 0x4A, 0x00, 0xC0, 0x53, 0xC5, 0x51, 0x09, 0x98,
+    0x7A, 0x02, 0x00, 0x9E, 0x0D, 0x9B, 0xC9, 0x37, 0xFA, 0x00, 0x02, 0x41, 0x97, 0xC3, 0xA0, 0x64,
+    0x9C, 0x00, 0x00, 0x6F, 0x36, 0x65, 0x3D, 0x8E, 0x58, 0x2B, 0x00, 0xEA, 0x70, 0x88, 0x54, 0xE0,
+    0xD0, 0x04, 0x00, 0xD4, 0xD1, 0x00, 0xE5, 0x2C, 0xA1, 0x51, 0x00, 0x78, 0xB0, 0xF1, 0x14, 0x6A,
+    0xC7, 0x11, 0x00, 0xE0, 0x46, 0x23, 0xC7, 0x72, 0x8D, 0x24, 0x00, 0xC0, 0x55, 0xED, 0x0E, 0x60,
+    0x2B, 0x8F, 0x00, 0x41, 0x9C, 0xD2, 0x16, 0x11, 0x1B, 0xBE, 0x20, 0x02, 0x6E, 0x9C, 0xA5, 0x8E,
+    0x56, 0xD2, 0x01, 0x00, 0x1E, 0x4C, 0x93, 0x5C, 0xA4, 0x58, 0x82, 0x00, 0x4C, 0x55, 0xC8, 0x64,
+    0x66, 0xE9, 0x05, 0x00, 0x0C, 0xE0, 0xCC, 0xEA, 0x64, 0x64, 0x29, 0x40, 0x00, 0x30, 0x82, 0xFC,
+    0xD9, 0x46, 0x5F, 0x00, 0x20, 0x87, 0x03, 0x15, 0x03, 0x88, 0x44, 0x00, 0x00, 0xC0, 0x45, 0x91,
+    0x47, 0x1B, 0x93, 0x01, 0x00, 0x0A, 0x0F, 0x96, 0x0B, 0x27, 0xEE, 0x02, 0x80, 0x07, 0xA3, 0xA6,
+    0x1B, 0x37, 0x9C, 0x01, 0x40, 0x48, 0x5C, 0x90, 0x68, 0x87, 0x98, 0x0A, 0x00, 0xDE, 0x6C, 0x74,
+    0x62, 0x96, 0xB0, 0x09, 0x00, 0x6C, 0xD8, 0xA8, 0xDD, 0xB8, 0xA2, 0x32, 0x20, 0x50, 0xF4, 0x79,
+    0x23, 0x8A, 0x44, 0xDC, 0x80, 0x40, 0x40, 0x23, 0x68, 0x41, 0x93, 0xBD, 0x81, 0x00, 0x8D, 0x47,
+    0x8B, 0xE3, 0x1A, 0x41, 0x00, 0x40, 0x14, 0xCD, 0x5D, 0x91, 0x28, 0xE6, 0x06, 0x82, 0x68, 0x9F,
+    0x35, 0x9A, 0x5C, 0x74, 0x02, 0x08, 0x38, 0x34, 0x86, 0x20, 0x1C, 0xA9, 0x02, 0x18, 0x14, 0x61,
+    0x96, 0x5C, 0xEE, 0x10, 0x07, 0x00, 0x1C, 0xF0, 0xE0, 0x99, 0xD8, 0x23, 0x07, 0x04, 0x90, 0xD1,
+    0xC1, 0x9B, 0x12, 0x44, 0x9C, 0x00, 0xA0, 0x46, 0x93, 0x16, 0x03, 0x8C, 0x1F, 0x00, 0xC0, 0x03,
+    0x67, 0xED, 0x06, 0x16, 0x2F, 0x00, 0x00, 0x9C, 0xCA, 0x68, 0x92, 0x37, 0x6E, 0x00, 0x80, 0x36,
+    0x9A, 0x3C, 0x1F, 0x5B, 0x1C, 0x05, 0x80, 0x66, 0x3E, 0x64, 0x35, 0xA7, 0x88, 0x02, 0x00, 0x8C,
+    0x61, 0x6C, 0x4C, 0xA4, 0xA8, 0x08, 0x00, 0x34, 0xA9, 0xC8, 0xDD, 0x00, 0xA3, 0x05, 0x00, 0x48,
+    0xA4, 0x49, 0xCC, 0x23, 0x43, 0x1F, 0x08, 0xC0, 0x43, 0x63, 0xB9, 0x37, 0x87, 0x36, 0x01, 0xA0,
+    0xD4, 0x26, 0xCB, 0x46, 0x11, 0x39, 0x00, 0x80, 0x92, 0x54, 0x1F, 0xDA, 0x1A, 0x4A, 0x02, 0x80,
+    0x46, 0xA5, 0x33, 0x9E, 0x4B, 0xE4, 0x04, 0x00, 0x7E, 0x36, 0x5B, 0x19, 0xE3, 0x18, 0x03, 0x00,
+    0xDC, 0x60, 0xB6, 0x70, 0x0E, 0xD1, 0x08, 0x11, 0xC8, 0xA9, 0xFC, 0xE1, 0x48, 0xE3, 0x2D, 0x40,
+    0xB0, 0xC1, 0x21, 0xCA, 0x91, 0x42, 0x61, 0x00, 0x60, 0xCA, 0x33, 0x65, 0xC3, 0x47, 0x38, 0x00,
+    0xA0, 0x0A, 0x06, 0xEE, 0x46, 0x17, 0x63, 0x01, 0x40, 0x0E, 0xCA, 0xDB, 0xCD, 0x2D, 0x1A, 0x06,
+    0x00, 0x5D, 0x1F, 0x3D, 0x1A, 0x6A, 0xC4, 0x06, 0x00, 0x74, 0x3A, 0x5F, 0x38, 0x91, 0x58, 0x02,
+    0x00, 0xE6, 0x9C, 0xCC, 0x7A, 0x1C, 0x51, 0x08, 0x00, 0x10, 0xC2, 0xCC, 0xE1, 0x00, 0xA3, 0x0A,
+    0x00, 0x79, 0xB3, 0x51, 0xBB, 0x71, 0xC5, 0x1E, 0x00, 0x20, 0x49, 0xA3, 0xD3, 0xC3, 0x83, 0x31,
+    0x01, 0xA0, 0x8E, 0x66, 0x4E, 0xC6, 0x19, 0x5B, 0x02, 0x80, 0x07, 0x0D, 0xDB, 0x4B, 0x32, 0x66,
+    0x00, 0x80, 0x01, 0x9D, 0x28, 0x17, 0x45, 0x04, 0x05, 0x00, 0x6D, 0x3E, 0x58, 0x46, 0x64, 0x08,
+    0x03, 0x08, 0xFE, 0x60, 0xDA, 0x8C, 0x38, 0x11, 0x47, 0x00, 0xD4, 0xD1, 0x9C, 0xB5, 0x10, 0x23,
+    0x12, 0x20, 0x48, 0xD8, 0xC0, 0xD0, 0xF9, 0x90, 0x08, 0x00, 0xA0, 0x06, 0x93, 0xE6, 0x43, 0x89,
+    0x40, 0x00, 0x22, 0x8D, 0x26, 0x4F, 0xE6, 0x1A, 0x81, 0x10, 0x40, 0x1D, 0x8D, 0xD7, 0x8B, 0x2A,
+    0x76, 0x00, 0x80, 0x35, 0x1A, 0xA2, 0x0F, 0x47, 0x94, 0x02, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE,
+    0x38, 0x12, 0x00, 0x14, 0x60, 0x30, 0x69, 0x08, 0x92, 0x14, 0x00, 0xA0, 0xC8, 0x50, 0x89, 0xEC,
+    0x62, 0x10, 0x00, 0x18, 0xA0, 0x81, 0xDC, 0x49, 0x47, 0x1E, 0xC0, 0x20, 0x40, 0x32, 0x55, 0xC2,
+    0x8A, 0xC6, 0x00, 0x40, 0x50, 0x07, 0xAB, 0x04, 0x17, 0x79, 0x01, 0x40, 0x16, 0x07, 0xD8, 0x4B,
+    0x2B, 0xDA, 0x00, 0x00, 0x4A, 0x13, 0x30, 0x1A, 0x4F, 0x44, 0x01, 0x00, 0x06, 0x3C, 0x7E, 0x3B,
+    0xCC, 0xA8, 0x0B, 0x00, 0xDE, 0x50, 0xD4, 0x6E, 0x5C, 0x51, 0x09, 0x01, 0xF0, 0x81, 0x68, 0xC5,
+    0x5C, 0x62, 0x51, 0x00, 0x60, 0xA4, 0x81, 0x0D, 0x33, 0xC6, 0xE5, 0x80, 0x50, 0xA2, 0xF2, 0x15,
+    0x42, 0x8D, 0xAC, 0x00, 0xD0, 0x8D, 0xE6, 0xEE, 0x06, 0x19, 0x71, 0x00, 0xC0, 0x1B, 0x0E, 0x9B,
+    0x4C, 0x30, 0xB2, 0x00, 0x00, 0x35, 0x11, 0x31, 0x9E, 0x45, 0x64, 0x06, 0x80, 0x78, 0x3A, 0x9E,
+    0x3C, 0xFC, 0xB8, 0x0A, 0x20, 0xEF, 0x68, 0xCC, 0x6C, 0x54, 0x71, 0x66, 0x00, 0xD4, 0xD1, 0x8C,
+    0x9D, 0x38, 0xE3, 0x2E, 0x00, 0xA0, 0x93, 0x19, 0xCA, 0x10, 0xC5, 0x0E, 0x00, 0xF0, 0x66, 0xB3,
+    0x56, 0x83, 0x8B, 0x4B, 0x00, 0x40, 0xC7, 0xA5, 0x6B, 0x67, 0x10, 0x3F, 0x01, 0x82, 0x1C, 0xD7,
+    0x1B, 0x8F, 0x2A, 0x1E, 0x01, 0x02, 0x69, 0x17, 0x28, 0x9A, 0x3C, 0x12, 0x06, 0x00, 0xAA, 0x2A,
+    0x7B, 0x35, 0xD4, 0x54, 0x0B, 0x00, 0x3C, 0x40, 0xC6, 0x5E, 0x6C, 0x31, 0x25, 0x00, 0xD4, 0xD1,
+    0xB4, 0xD1, 0xF4, 0x22, 0x2E, 0x00, 0xA8, 0xA3, 0x61, 0x8B, 0x21, 0x46, 0x10, 0x00, 0xF0, 0x66,
+    0xE3, 0x8A, 0x83, 0x91, 0x2D, 0x00, 0xC0, 0x4F, 0x4C, 0x0F, 0xC8, 0x16, 0x5F, 0x01, 0x40, 0x9B,
+    0x52, 0x1E, 0x53, 0x24, 0x02, 0x01, 0x80, 0x43, 0x9A, 0xA4, 0x18, 0x37, 0x1C, 0x01, 0x00, 0x6A,
+    0x32, 0x5D, 0x3A, 0x87, 0x08, 0x03, 0x00, 0xB0, 0x09, 0x34, 0x34, 0x58, 0xA4, 0x02, 0x00, 0xC0,
+    0xA1, 0x44, 0xB5, 0x38, 0x22, 0x0A, 0x00, 0x00, 0xA0, 0x71, 0xDD, 0x60, 0xCA, 0x4E, 0x00, 0xB0,
+    0x47, 0xC3, 0x06, 0x32, 0x8F, 0x2C, 0x00, 0x50, 0x0D, 0xE5, 0xC9, 0x83, 0x15, 0x2D, 0x05, 0x40,
+    0x1D, 0x8D, 0xD1, 0x0C, 0x19, 0xE2, 0x00, 0x82, 0x35, 0x9B, 0xB0, 0x9E, 0x43, 0x24, 0x41, 0x00,
+    0x73, 0x36, 0x57, 0x45, 0x64, 0x58, 0x04, 0x00, 0xD0, 0x78, 0xC4, 0x6E, 0x34, 0x11, 0x12, 0x00,
+    0xD0, 0xE1, 0x20, 0x01, 0x3D, 0xA1, 0x13, 0x00, 0x28, 0x10, 0xF9, 0xBA, 0x91, 0x44, 0x89, 0x00,
+    0x20, 0x40, 0x23, 0xFB, 0xE5, 0x8C, 0x3E, 0x00, 0x40, 0x8D, 0x46, 0x0E, 0xC7, 0x17, 0x7F, 0x00,
+    0x01, 0x92, 0xCD, 0x50, 0xC8, 0x21, 0x1E, 0x01, 0x00, 0x3E, 0x9A, 0xAB, 0x90, 0x61, 0x34, 0x02,
+    0x00, 0x04, 0x34, 0x27, 0x0F, 0x61, 0x48, 0x02, 0x00, 0x12, 0x55, 0x8A, 0x6E, 0xB2, 0x90, 0x09,
+    0x00, 0x19, 0xD1, 0xFC, 0xBD, 0x9C, 0xA3, 0x05, 0x00, 0x70, 0xF3, 0xB1, 0x4A, 0x21, 0x45, 0x20,
+    0x40, 0x20, 0x0E, 0x52, 0xB3, 0x83, 0x23, 0x1C, 0x81, 0x00, 0xC3, 0x05, 0x97, 0x46, 0x25, 0x55,
+    0x01, 0x00, 0x9F, 0xCC, 0x1B, 0x50, 0x26, 0xDE, 0x00, 0x00, 0x37, 0x9B, 0xA6, 0x99, 0x39, 0xE4,
+    0x01, 0x04, 0xB1, 0x2A, 0x3A, 0x34, 0x48, 0x44, 0x04, 0x00, 0xD2, 0x7C, 0x96, 0x5E, 0xEE, 0x90,
+    0x0A, 0x00, 0xD4, 0xD1, 0xB4, 0xD1, 0xF4, 0xE2, 0x12, 0x00, 0x40, 0x33, 0xE1, 0x6B, 0x49, 0xC7,
+    0x92, 0x00, 0x40, 0x8A, 0x92, 0xA7, 0x63, 0x8C, 0xA1, 0x00, 0x50, 0xC1, 0xC8, 0x70, 0x88, 0x18,
+    0x75, 0x00, 0x40, 0x81, 0x10, 0xE0, 0x0E, 0x34, 0xC6, 0x00, 0x80, 0x7F, 0x06, 0x83, 0x16, 0x05,
+    0xF9, 0x00, 0x04, 0xCA, 0x2A, 0x44, 0x38, 0x55, 0xA4, 0x02, 0x00, 0x52, 0x24, 0xC6, 0x4C, 0x9C,
+    0x51, 0x82, 0x00, 0x08, 0x08, 0x91, 0xBD, 0xE0, 0xE2, 0x0B, 0x00, 0x50, 0x82, 0xE9, 0x3A, 0x42,
+    0x43, 0x52, 0x00, 0x50, 0xA3, 0xC2, 0x26, 0x13, 0x8C, 0x2C, 0x00, 0x40, 0x01, 0xC2, 0x27, 0xA4,
+    0x0E, 0x7F, 0x03, 0x80, 0x82, 0x4D, 0x12, 0x8A, 0x20, 0x02, 0x01, 0x80, 0x3F, 0x13, 0xB0, 0x19,
+    0x52, 0x8C, 0x02, 0x00, 0x77, 0x2E, 0x45, 0x3A, 0x56, 0x48, 0x04, 0x00, 0xE8, 0x35, 0x2A, 0x7A,
+    0x36, 0xA4, 0x07, 0x00, 0xEC, 0xA0, 0x84, 0xC5, 0xB0, 0x22, 0x09, 0x00, 0x90, 0x51, 0x43, 0x15,
+    0x04, 0xC4, 0x9A, 0x00, 0x90, 0x47, 0x13, 0x37, 0x63, 0x8C, 0xB6, 0x00, 0x30, 0x8F, 0xE6, 0xD0,
+    0x27, 0x1A, 0x63, 0x00, 0x40, 0x1D, 0x4D, 0x1B, 0x4D, 0x2F, 0x42, 0x01, 0x00, 0x2E, 0x8F, 0xC0,
+    0x93, 0x80, 0xAC, 0x00, 0x90, 0x6A, 0x46, 0x50, 0x44, 0x70, 0x38, 0x0A, 0x00, 0x75, 0x70, 0x20,
+    0x8F, 0x90, 0x51, 0x0A, 0x00, 0xAC, 0xD1, 0x3C, 0x91, 0x90, 0x22, 0x26, 0x00, 0x60, 0xE3, 0x79,
+    0x4B, 0xD9, 0xC6, 0x24, 0x00, 0xE0, 0x86, 0x82, 0x66, 0xD3, 0x8A, 0x25, 0x00, 0x60, 0x1A, 0x46,
+    0x07, 0x27, 0x88, 0x4E, 0x01, 0x40, 0x1D, 0x4D, 0x1B, 0x4D, 0x2F, 0x2A, 0x05, 0x00, 0x0E, 0x11,
+    0xC3, 0x93, 0x84, 0xB4, 0x05, 0x00, 0x46, 0x34, 0x74, 0x35, 0xC6, 0xE8, 0x0A, 0x00, 0xDC, 0x78,
+    0xA4, 0x4E, 0x44, 0x71, 0x04, 0x00, 0x88, 0xF1, 0x48, 0xC9, 0x08, 0xE2, 0x13, 0x00, 0xC8, 0x46,
+    0x41, 0xA9, 0x69, 0x91, 0x17, 0x01, 0xA0, 0x40, 0x94, 0x68, 0x14, 0x8C, 0xC0, 0x01, 0x60, 0x80,
+    0x46, 0xC7, 0x44, 0x0C, 0x8B, 0x00, 0xC0, 0x1A, 0x47, 0x29, 0x4D, 0x45, 0xDA, 0x00, 0x00, 0x37,
+    0x9A, 0x37, 0x9B, 0x5D, 0x94, 0x04, 0x14, 0x28, 0x3C, 0x80, 0x27, 0x00, 0xF9, 0x03, 0x00, 0x26,
+    0x65, 0x14, 0x8B, 0x8C, 0x51, 0x28, 0x00, 0x78, 0xA0, 0xD0, 0xBD, 0x58, 0x23, 0x06, 0x00, 0x78,
+    0xB3, 0x51, 0xBB, 0x71, 0xC5, 0x56, 0x00, 0xF0, 0x66, 0xA3, 0x76, 0xE3, 0x8A, 0x39, 0x00, 0xC0,
+    0x43, 0x87, 0x2B, 0xC4, 0x19, 0x91, 0x02, 0xC0, 0x1A, 0x0D, 0x12, 0x8D, 0x19, 0x3A, 0x01, 0x00,
+    0x19, 0x18, 0xA5, 0x13, 0x45, 0x04, 0x02, 0x00, 0x62, 0x3A, 0x5D, 0x3D, 0x7C, 0x88, 0x01, 0x00,
+    0x28, 0xE4, 0x6E, 0x8D, 0x02, 0xF2, 0x08, 0x00, 0xB0, 0xC9, 0x28, 0x81, 0x78, 0x22, 0x13, 0x01,
+    0xE8, 0xF6, 0xC9, 0x31, 0xA2, 0x11, 0x21, 0xA2, 0x90, 0x20, 0x55, 0xF9, 0x48, 0x84, 0x2F, 0x01,
+    0x40, 0x87, 0x87, 0x4D, 0x87, 0x15, 0x3D, 0x01, 0xC0, 0x9E, 0x4C, 0x14, 0x0A, 0x27, 0x7E, 0x04,
+    0x80, 0x00, 0x9F, 0x43, 0x9A, 0x75, 0x7C, 0x00, 0x00, 0x66, 0x36, 0x96, 0x56, 0xB6, 0x48, 0x01,
+    0x00, 0x3C, 0x94, 0x3A, 0xF5, 0xFC, 0x50, 0x05, 0x00, 0x00, 0xA2, 0x94, 0x15, 0xF9, 0xA1, 0x10,
+    0x00, 0x98, 0x93, 0x99, 0x72, 0x71, 0xC4, 0x69, 0x00, 0x60, 0x07, 0xD2, 0xC5, 0xD2, 0x8A, 0x29,
+    0x01, 0xA0, 0x8E, 0xA6, 0x46, 0xE9, 0x05, 0x49, 0x00, 0x50, 0x11, 0x59, 0x1F, 0x5C, 0x18, 0x6E,
+    0x04, 0x80, 0x64, 0x1B, 0xB6, 0x21, 0x47, 0xFC, 0x01, 0x84, 0x14, 0x1E, 0xB7, 0x33, 0x2C, 0x19,
+    0x02, 0x00, 0xD6, 0x64, 0xAE, 0x72, 0xFC, 0x30, 0x07, 0x00, 0xC0, 0xD9, 0x38, 0x8D, 0x90, 0xE2,
+    0x45, 0x08, 0x30, 0x13, 0x7A, 0xDE, 0x1B, 0xC6, 0x20, 0x00, 0xD0, 0x88, 0x12, 0x94, 0xC2, 0x86,
+    0x31, 0x00, 0x40, 0x0C, 0x86, 0x6A, 0xA7, 0x0E, 0x7D, 0x01, 0x40, 0x91, 0x0E, 0x95, 0xCC, 0x20,
+    0x1A, 0x01, 0x80, 0x21, 0x98, 0x3E, 0x1D, 0x66, 0xEC, 0x01, 0x00, 0x82, 0x36, 0x7D, 0x44, 0xB3,
+    0x18, 0x0C, 0x00, 0x00, 0x61, 0xAE, 0x6A, 0x06, 0x11, 0x18, 0x00, 0xE0, 0xA9, 0x38, 0xDD, 0xB4,
+    0xE1, 0x2D, 0x00, 0xF0, 0xA3, 0x49, 0xD3, 0x39, 0xC5, 0x4E, 0x00, 0x00, 0x47, 0x63, 0x26, 0x63,
+    0x8B, 0xC1, 0x08, 0x40, 0x5A, 0xE5, 0x08, 0x86, 0x8D, 0x2C, 0x00, 0x80, 0x1B, 0x0E, 0x55, 0x8C,
+    0x22, 0xCE, 0x04, 0x00, 0x3B, 0x9A, 0x3A, 0x96, 0x6F, 0x3C, 0x0A, 0x08, 0x32, 0x36, 0x7A, 0x3A,
+    0xC8, 0xF8, 0x04, 0x00, 0xD6, 0x74, 0xC0, 0x5C, 0x62, 0x71, 0x0A, 0x00, 0xDC, 0x99, 0x50, 0x95,
+    0xC4, 0x22, 0x4E, 0x41, 0xD8, 0xA4, 0x41, 0xDB, 0x11, 0xC5, 0x0C, 0x00, 0x20, 0x40, 0x77, 0x5E,
+    0x33, 0x95, 0xAC, 0x00, 0x10, 0x0B, 0x64, 0xEB, 0x45, 0x14, 0xBD, 0x00, 0x00, 0xA0, 0x05, 0x19,
+    0x91, 0x1F, 0xDA, 0x00, 0x00, 0x35, 0x1A, 0x30, 0x20, 0x3F, 0x7C, 0x04, 0x00, 0x4E, 0x34, 0x46,
+    0x2F, 0x6C, 0x18, 0x09, 0x00, 0x04, 0x55, 0x8A, 0x44, 0x14, 0xD1, 0x09, 0x00, 0xDC, 0x99, 0xF0,
+    0xD1, 0x60, 0xE3, 0x51, 0x00, 0xA0, 0x40, 0xB1, 0x2B, 0xB9, 0xC7, 0x97, 0x40, 0x20, 0x47, 0xE3,
+    0x96, 0xA2, 0x8D, 0xA1, 0x00, 0x00, 0x0F, 0xA8, 0xD3, 0x09, 0x1A, 0x6B, 0x00, 0x40, 0x9F, 0x0F,
+    0x94, 0x8C, 0x1F, 0x42, 0x01, 0x00, 0x39, 0x92, 0xB4, 0x1A, 0x5B, 0xD4, 0x09, 0x00, 0x31, 0x36,
+    0xA8, 0x45, 0xF4, 0x88, 0x14, 0x00, 0xD8, 0x74, 0xF8, 0x84, 0x66, 0x51, 0x18, 0x00, 0xDC, 0x09,
+    0x7C, 0x28, 0x34, 0x61, 0x0A, 0x00, 0x78, 0xB3, 0x51, 0xBB, 0x71, 0xC5, 0x53, 0x00, 0x10, 0x67,
+    0x84, 0x46, 0x74, 0x88, 0xBA, 0x00, 0x40, 0x46, 0x8A, 0xAA, 0x06, 0x10, 0xBF, 0x00, 0x00, 0x1B,
+    0x0D, 0xD7, 0x0B, 0x29, 0x4A, 0x00, 0x80, 0x35, 0x9F, 0xC2, 0xAB, 0x48, 0xBC, 0x04, 0x00, 0xB6,
+    0x3A, 0x67, 0x35, 0xB1, 0x14, 0x01, 0x00, 0x04, 0x55, 0xC0, 0x68, 0x3E, 0x91, 0x17, 0x00, 0xB0,
+    0xA8, 0xBC, 0xAD, 0x5C, 0x63, 0x30, 0x00, 0xC8, 0xE3, 0xF1, 0x0A, 0xBA, 0xC3, 0x67, 0x00, 0x60,
+    0x06, 0x01, 0x97, 0xE2, 0x8D, 0x36, 0x00, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x9D, 0x00, 0x00,
+    0x9B, 0x05, 0xD8, 0x46, 0x3A, 0xDE, 0x00, 0x80, 0x27, 0x03, 0x9B, 0x85, 0x58, 0xA4, 0x00, 0x00,
+    0x6A, 0x5A, 0xAD, 0x7B, 0x91, 0xF8, 0x11, 0xC0, 0xD0, 0x74, 0xE2, 0x64, 0x98, 0x11, 0x02, 0x00,
+    0xD4, 0xD1, 0xEC, 0x88, 0xB0, 0x61, 0x0A, 0x00, 0xB8, 0x13, 0xCA, 0xE2, 0xB9, 0x43, 0xA0, 0x00,
+    0x30, 0x47, 0x93, 0x56, 0x33, 0x8B, 0xC7, 0x00, 0xC0, 0xCF, 0xE5, 0xA9, 0xC4, 0x13, 0x9D, 0x82,
+    0x01, 0x1A, 0xC8, 0x52, 0x0E, 0x19, 0xC6, 0x00, 0x80, 0x0E, 0x1B, 0xAE, 0x1D, 0x41, 0x3C, 0x06,
+    0x00, 0x73, 0x20, 0x7B, 0x2D, 0xE7, 0x28, 0x0C, 0x00, 0xE2, 0x70, 0xCC, 0x68, 0x5A, 0x51, 0x19,
+    0x00, 0x98, 0xA9, 0x24, 0xCD, 0xAC, 0xE1, 0x6D, 0x00, 0x38, 0xA0, 0xB1, 0x7A, 0xF0, 0xC7, 0xA2,
+    0x20, 0x90, 0xA6, 0x02, 0x37, 0x43, 0x8C, 0x29, 0x00, 0x20, 0x0A, 0x8A, 0xD1, 0x88, 0x18, 0x37,
+    0x02, 0x40, 0xA9, 0x0D, 0x57, 0xCA, 0x2C, 0x02, 0x03, 0xC0, 0x34, 0x9F, 0xB4, 0xA2, 0x43, 0xC4,
+    0x11, 0x40, 0x92, 0x36, 0x85, 0x50, 0xA2, 0xB8, 0x11, 0x00, 0x64, 0x84, 0x32, 0xA7, 0x82, 0x31,
+    0x09, 0x00, 0x2C, 0x32, 0x9D, 0xFD, 0x38, 0x22, 0x2A, 0x40, 0x20, 0x60, 0x9A, 0x23, 0x99, 0x47,
+    0x12, 0x00, 0x60, 0x00, 0x95, 0xF5, 0x92, 0x89, 0x4C, 0x00, 0x40, 0x48, 0xA6, 0xAC, 0x46, 0x15,
+    0x61, 0x02, 0xC0, 0x00, 0x4D, 0xA8, 0x0B, 0x47, 0xE2, 0x02, 0x00, 0x25, 0x9E, 0x29, 0x99, 0x41,
+    0xBC, 0x01, 0x00, 0x1C, 0x38, 0x70, 0x44, 0x94, 0x38, 0x02, 0x00, 0xD0, 0x64, 0xC2, 0x7E, 0x04,
+    0x51, 0x14, 0x20, 0x0C, 0x78, 0xB9, 0x12, 0xF1, 0xE3, 0x32, 0x00, 0x80, 0x23, 0x41, 0x1A, 0x89,
+    0xC4, 0x13, 0x00, 0x80, 0x46, 0x83, 0x86, 0xA3, 0x8A, 0x11, 0x00, 0xE0, 0x8E, 0xA8, 0x90, 0x28,
+    0x18, 0x99, 0x00, 0x00, 0x81, 0x85, 0x57, 0x8E, 0x23, 0x3E, 0x21, 0x80, 0x3D, 0x89, 0x21, 0x8E,
+    0x4B, 0x74, 0x0A, 0x00, 0x9E, 0x22, 0x74, 0x41, 0xA7, 0xD8, 0x12, 0x00, 0x32, 0x7C, 0x24, 0x81,
+    0xB6, 0x51, 0x25, 0x00, 0x0C, 0xD0, 0xE4, 0xE2, 0x90, 0xE4, 0x0B, 0x00, 0x80, 0x73, 0x51, 0x7A,
+    0x99, 0xC3, 0x46, 0x00, 0x50, 0x47, 0x23, 0x07, 0xE5, 0x87, 0x10, 0x81, 0x00, 0x89, 0x67, 0xB1,
+    0x08, 0x19, 0xA7, 0x00, 0x41, 0x9E, 0x88, 0xD7, 0xC9, 0x30, 0x56, 0x00, 0x80, 0x3A, 0x1D, 0x3D,
+    0xA3, 0x53, 0x04, 0x02, 0x00, 0x25, 0x42, 0x66, 0x3D, 0x91, 0x88, 0x0C, 0x00, 0xE4, 0x68, 0xA6,
+    0x5A, 0x28, 0x11, 0x04, 0x20, 0x00, 0xC8, 0xBC, 0xD0, 0x85, 0x20, 0x4F, 0x00, 0x90, 0xC0, 0x01,
+    0x04, 0x0A, 0x46, 0x56, 0x00, 0xE0, 0x84, 0x63, 0xF6, 0x02, 0x8C, 0x45, 0x01, 0x00, 0x81, 0xC6,
+    0xAD, 0xA0, 0x29, 0x35, 0x00, 0x80, 0x9B, 0x0A, 0xDD, 0x8B, 0x35, 0x2E, 0x03, 0x00, 0x35, 0x9C,
+    0xB7, 0x1A, 0x60, 0x94, 0x20, 0x08, 0x03, 0x32, 0x56, 0x3B, 0x75, 0xA8, 0x0A, 0x90, 0xEA, 0x68,
+    0xDA, 0x68, 0x7A, 0x71, 0x03, 0x00, 0xBC, 0x91, 0x14, 0x39, 0x58, 0x63, 0x14, 0x00, 0x68, 0x58,
+    0x50, 0xD8, 0x72, 0x90, 0x21, 0x00, 0x40, 0x47, 0x82, 0xA7, 0x92, 0x8E, 0x1F, 0x00, 0x81, 0xC2,
+    0x24, 0xF3, 0xE5, 0x21, 0x47, 0x00, 0x00, 0xA2, 0x8E, 0x22, 0x0D, 0x3C, 0xA2, 0x02, 0x84, 0x03,
+    0x99, 0x2E, 0x15, 0x5B, 0xCC, 0x01, 0x00, 0x00, 0x56, 0x8C, 0x28, 0x0E, 0x89, 0x8C, 0x00, 0xDC,
+    0x54, 0xDC, 0x76, 0x58, 0x51, 0x19, 0x01, 0xA0, 0xD1, 0x24, 0xCD, 0xAC, 0x61, 0x4A, 0x00, 0x08,
+    0xB0, 0x39, 0xB5, 0x91, 0xC8, 0x88, 0x00, 0x10, 0xEA, 0x62, 0x67, 0x94, 0x89, 0xA3, 0x00, 0x60,
+    0x4D, 0xC9, 0x2D, 0x86, 0x18, 0x13, 0x00, 0xC0, 0x9B, 0x8D, 0x54, 0x8B, 0x23, 0x86, 0x00, 0x00,
+    0x48, 0x9A, 0xAB, 0x1B, 0x3F, 0xDC, 0x01, 0x00, 0xA3, 0x30, 0x53, 0x36, 0x7C, 0xB4, 0x04, 0x00,
+    0xF0, 0x68, 0x5C, 0x16, 0x14, 0xB1, 0x16, 0x00, 0xC0, 0x09, 0xC9, 0x01, 0x89, 0x62, 0x31, 0x00,
+    0x78, 0xB3, 0x39, 0xDB, 0xF1, 0x44, 0x1F, 0x40, 0xA0, 0xAA, 0xA2, 0xB4, 0x13, 0x46, 0xB7, 0x00,
+    0x40, 0xCD, 0x25, 0xAC, 0xC5, 0x16, 0x8B, 0x00, 0x80, 0x9B, 0x0F, 0x60, 0xD2, 0x29, 0xAE, 0x00,
+    0x40, 0x2E, 0x19, 0x30, 0x15, 0x60, 0xEC, 0x01, 0x00, 0x04, 0x12, 0x43, 0x1F, 0x8B, 0x68, 0x02,
+    0x00, 0xF4, 0x50, 0x88, 0x40, 0x16, 0xD1, 0x05, 0x00, 0x1C, 0xE8, 0xA9, 0xDB, 0x58, 0xE5, 0x2B,
+    0x00, 0x78, 0x84, 0x58, 0x1A, 0xC9, 0xC4, 0x26, 0x00, 0xE0, 0xE6, 0xF1, 0xC7, 0xC3, 0x8C, 0x3B,
+    0x00, 0xE0, 0xCD, 0x26, 0x08, 0x06, 0x0C, 0xA5, 0x00, 0xC0, 0x1A, 0x0D, 0x1C, 0x0C, 0x33, 0xDA,
+    0x02, 0xC0, 0x2C, 0x97, 0x3C, 0x0F, 0x86, 0xF4, 0x09, 0x00, 0x28, 0x40, 0x7D, 0x3C, 0xC8, 0x98,
+    0x01, 0x00, 0xD6, 0x74, 0x64, 0xB3, 0xAE, 0x91, 0x05, 0x00, 0x18, 0xD0, 0xC4, 0xA9, 0x6C, 0x23,
+    0x54, 0x00, 0x98, 0xA3, 0x49, 0x63, 0x71, 0x46, 0x0C, 0x08, 0x94, 0x42, 0xD3, 0x4A, 0x06, 0x8C,
+    0x30, 0x00, 0x60, 0x55, 0x85, 0xCF, 0xC7, 0x97, 0x7E, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B,
+    0x72, 0x00, 0x80, 0x02, 0x9A, 0x5B, 0x0E, 0xA8, 0xBC, 0x14, 0x08, 0x19, 0x52, 0x5F, 0x37, 0x92,
+    0x88, 0x12, 0x00, 0x0A, 0x64, 0xFA, 0x74, 0x98, 0x71, 0x06, 0x00, 0xC0, 0xD1, 0x88, 0x91, 0x48,
+    0x63, 0x09, 0x00, 0x7A, 0xB3, 0x51, 0xBB, 0x71, 0xC5, 0x1C, 0x00, 0xD0, 0x06, 0x03, 0x25, 0x04,
+    0x86, 0xC2, 0x00, 0xE0, 0xCE, 0xC4, 0x88, 0x66, 0x0C, 0x3D, 0x00, 0x82, 0x02, 0x8C, 0x1E, 0x48,
+    0x41, 0x66, 0x01, 0x80, 0x0C, 0x90, 0x1F, 0x1E, 0x22, 0x1C, 0x06, 0x04, 0x6D, 0x36, 0x4B, 0x2D,
+    0x7C, 0x18, 0x02, 0x10, 0x18, 0x4E, 0x3C, 0xAC, 0x38, 0x84, 0x03, 0x10, 0xE0, 0xA9, 0x2C, 0xED,
+    0x84, 0xA1, 0x31, 0x00, 0x50, 0xC3, 0xA1, 0xBA, 0xE1, 0x43, 0x24, 0x00, 0x00, 0x69, 0xF3, 0xC5,
+    0x62, 0x8B, 0xB6, 0x00, 0x40, 0x4E, 0xC6, 0x0A, 0x87, 0x0F, 0x3D, 0x01, 0x40, 0x18, 0xD0, 0x97,
+    0xCD, 0x25, 0x52, 0x00, 0x80, 0x36, 0x15, 0x27, 0x18, 0x3E, 0xDC, 0x05, 0x00, 0x44, 0x46, 0x50,
+    0x38, 0x70, 0x88, 0x0B, 0x00, 0xDE, 0x74, 0x86, 0x54, 0xDC, 0x10, 0x17, 0x00, 0x08, 0xC8, 0x1C,
+    0x9A, 0x34, 0x64, 0x0B, 0x00, 0x80, 0xF3, 0x01, 0x9B, 0x02, 0x43, 0xA1, 0x00, 0x40, 0x01, 0xA4,
+    0xD8, 0x14, 0x8B, 0x1A, 0x00, 0x00, 0xCE, 0x04, 0x8C, 0x04, 0x1A, 0x95, 0x00, 0x40, 0x08, 0x4F,
+    0x97, 0x4D, 0x24, 0x86, 0x00, 0x82, 0x41, 0x23, 0x5D, 0xAE, 0x6D, 0x9C, 0x05, 0x00, 0x84, 0x26,
+    0x69, 0x1D, 0xF7, 0x38, 0x02, 0x00, 0xAE, 0x68, 0xE4, 0x5E, 0xA4, 0xD1, 0x47, 0x00, 0xA4, 0xD1,
+    0x00, 0x71, 0x2C, 0xE2, 0x09, 0x00, 0x54, 0xA3, 0xF9, 0xCA, 0x71, 0x44, 0x5D, 0x00, 0xF0, 0xA3,
+    0x64, 0x35, 0xC3, 0x87, 0x30, 0x01, 0x40, 0x81, 0xE6, 0xB3, 0x85, 0x23, 0x6D, 0x07, 0x40, 0x1D,
+    0x4D, 0xD4, 0x8A, 0x23, 0x46, 0x01, 0x02, 0x3A, 0x9F, 0xCB, 0x21, 0x6F, 0xF4, 0x00, 0x01, 0x87,
+    0x36, 0x71, 0x66, 0x60, 0x68, 0x03, 0x00, 0xFA, 0xB4, 0x32, 0xCF, 0x2E, 0x11, 0x16, 0x00, 0xEC,
+    0xD1, 0xB4, 0xD1, 0xF4, 0x62, 0x05, 0x00, 0xC8, 0x20, 0x61, 0xA3, 0xE1, 0xC5, 0x09, 0x00, 0xC0,
+    0x86, 0xA3, 0x95, 0xD2, 0x8A, 0x53, 0x08, 0x61, 0x8D, 0x66, 0xD3, 0x66, 0x20, 0x5B, 0x00, 0x40,
+    0x9C, 0x8D, 0x5B, 0x4B, 0x34, 0x4A, 0x02, 0x40, 0x31, 0x9F, 0xD0, 0x9A, 0x86, 0x4C, 0x02, 0x40,
+    0x00, 0x56, 0x73, 0x2E, 0xD7, 0xD8, 0x04, 0x00, 0xE8, 0x54, 0xAC, 0x68, 0x06, 0xD1, 0x16, 0x00,
+    0xD8, 0xE9, 0xC0, 0xED, 0xB4, 0xA2, 0x30, 0x00, 0x20, 0x55, 0xC9, 0xE2, 0xB9, 0x23, 0x0D, 0x00,
+    0xC0, 0x8E, 0xB3, 0x02, 0xB4, 0x22, 0xBA, 0x00, 0xA0, 0x8B, 0x86, 0xCE, 0x47, 0x15, 0x45, 0x01,
+    0x04, 0x1D, 0x4D, 0xD6, 0x4B, 0x26, 0xF6, 0x04, 0x80, 0x60, 0x1F, 0x1A, 0x16, 0x23, 0x1C, 0x09,
+    0x04, 0xD3, 0x28, 0x59, 0x2A, 0xAA, 0x08, 0x05, 0x00, 0xBE, 0x54, 0x98, 0x6A, 0xDC, 0xB0, 0x26,
+    0x10, 0x14, 0xDA, 0xB8, 0x19, 0x1D, 0x22, 0x08, 0x44, 0x18, 0x10, 0x13, 0x9C, 0x23, 0xC3, 0x5D,
+    0x00, 0xB0, 0x86, 0x63, 0xC4, 0x21, 0x8A, 0x27, 0x00, 0xD2, 0x8C, 0x26, 0xEC, 0x26, 0x13, 0x39,
+    0x00, 0xC0, 0x10, 0x0D, 0x16, 0x90, 0x1B, 0x22, 0x00, 0x80, 0x3B, 0x1A, 0xA6, 0x98, 0x3A, 0xDC,
+    0x09, 0x40, 0x1C, 0x34, 0x6E, 0x32, 0xC3, 0x58, 0x09, 0x00, 0x81, 0x78, 0xDC, 0x58, 0xA2, 0x11,
+    0x07, 0x00, 0xC4, 0x71, 0xBC, 0x88, 0x2C, 0xA1, 0x70, 0x20, 0x80, 0x94, 0x21, 0xE3, 0x89, 0x44,
+    0xA0, 0x00, 0xB0, 0x4C, 0x73, 0x96, 0x43, 0x8A, 0x3F, 0x00, 0xE0, 0x11, 0x66, 0xCA, 0x86, 0x0F,
+    0x2B, 0x00, 0x80, 0x80, 0x14, 0x15, 0x10, 0x1A, 0x22, 0x01, 0x80, 0x16, 0x20, 0x3D, 0x9F, 0x5D,
+    0x3C, 0x06, 0x00, 0x74, 0x10, 0x66, 0x19, 0xFC, 0x68, 0x03, 0x08, 0xCC, 0x68, 0x1C, 0x7D, 0xB6,
+    0xB1, 0x13, 0x00, 0xA2, 0x11, 0x75, 0xB1, 0xC4, 0x62, 0x05, 0x00, 0x30, 0xA3, 0x81, 0xAA, 0xB9,
+    0xC3, 0x1B, 0x00, 0xB2, 0x42, 0x53, 0x66, 0x73, 0x8A, 0x3F, 0x00, 0xE0, 0xC0, 0xA3, 0x71, 0x45,
+    0x21, 0x9B, 0x00, 0xC0, 0x9E, 0x90, 0xDC, 0xD1, 0x22, 0xDA, 0x00, 0x02, 0x50, 0x98, 0x28, 0x1D,
+    0x37, 0x7A, 0x05, 0x01, 0x7C, 0x3A, 0x54, 0x2A, 0x9C, 0xF8, 0x1B, 0x08, 0x60, 0x6D, 0x96, 0x32,
+    0x80, 0xD1, 0x05, 0x00, 0xB0, 0xA1, 0x20, 0xE6, 0x7C, 0x23, 0x28, 0x00, 0x40, 0x00, 0x7B, 0xA3,
+    0x09, 0xC6, 0x18, 0x00, 0xB0, 0x67, 0x82, 0xC7, 0x32, 0x8E, 0x57, 0x00, 0x81, 0x42, 0x0A, 0xD4,
+    0xE4, 0x25, 0x37, 0x00, 0x00, 0x00, 0x8D, 0x2B, 0xDB, 0x2C, 0xAA, 0x00, 0x00, 0x4D, 0x1F, 0x9B,
+    0x9B, 0x1E, 0x94, 0x02, 0x80, 0xF8, 0x1C, 0x13, 0x37, 0x1A, 0xC2, 0x11, 0x00, 0xD4, 0x68, 0x16,
+    0x6B, 0xDE, 0xD1, 0x04, 0x01, 0xA4, 0xD1, 0x50, 0x96, 0x51, 0x62, 0x0D, 0x20, 0x08, 0xB0, 0x61,
+    0xD5, 0x71, 0x48, 0x57, 0x00, 0x88, 0xE6, 0x63, 0xC7, 0xB3, 0x8B, 0x1B, 0x00, 0x22, 0x11, 0x0B,
+    0x2F, 0x8C, 0x0D, 0x4F, 0x01, 0x80, 0x9B, 0xC9, 0x1D, 0xCD, 0x33, 0xFE, 0x06, 0x80, 0x3B, 0x17,
+    0x2C, 0x16, 0x51, 0x94, 0x00, 0x00, 0x7A, 0x34, 0xB8, 0x81, 0x99, 0xB8, 0x02, 0x00, 0x0A, 0x69,
+    0x92, 0x3E, 0x44, 0x11, 0x14, 0x00, 0xCE, 0xF1, 0x74, 0x8D, 0x24, 0x23, 0x32, 0x00, 0x98, 0xE4,
+    0xD8, 0xAA, 0xA0, 0x47, 0x5B, 0x00, 0xF0, 0x67, 0xF3, 0xD8, 0xF3, 0x8D, 0x3C, 0x03, 0xE0, 0x4D,
+    0x85, 0x68, 0xE7, 0x09, 0x97, 0x00, 0xC2, 0x91, 0x0E, 0x99, 0xC7, 0x39, 0x22, 0x01, 0x80, 0x35,
+    0x9F, 0x35, 0x1D, 0x55, 0x64, 0x06, 0x00, 0x79, 0x2E, 0x5D, 0x24, 0xC8, 0x38, 0x0B, 0x00, 0xE2,
+    0x5C, 0x9E, 0x54, 0x22, 0xD1, 0x16, 0x00, 0xA0, 0xC1, 0x48, 0xA5, 0x64, 0xE2, 0x48, 0x00, 0xA8,
+    0x01, 0x32, 0xE5, 0x1A, 0xC6, 0x11, 0x00, 0x00, 0x47, 0x63, 0x16, 0x83, 0x8B, 0x9A, 0x00, 0x40,
+    0xC0, 0x6F, 0xD6, 0x24, 0x28, 0x3B, 0x00, 0xD0, 0x9B, 0x15, 0xEB, 0x97, 0x31, 0xE6, 0x00, 0x80,
+    0x3A, 0x1A, 0x4E, 0x9E, 0x7B, 0x4C, 0x01, 0x0A, 0x81, 0x2A, 0x5D, 0x44, 0x70, 0x58, 0x05, 0x00,
+    0x14, 0x36, 0x18, 0x24, 0x32, 0x64, 0x17, 0x00, 0xE8, 0xB9, 0x7C, 0xF5, 0x00, 0xE2, 0x0B, 0x40,
+    0x10, 0xC0, 0x72, 0xA5, 0x01, 0xC9, 0x5F, 0x00, 0xE0, 0x21, 0x31, 0x94, 0x02, 0x87, 0x56, 0x00,
+    0xC0, 0x98, 0x05, 0x0A, 0x06, 0x90, 0x84, 0x00, 0x40, 0x9C, 0x4C, 0xAB, 0x11, 0x3D, 0x92, 0x00,
+    0x00, 0x3C, 0x99, 0x27, 0x15, 0x47, 0xE4, 0x01, 0x00, 0x66, 0x36, 0x53, 0x3D, 0x6B, 0x98, 0x04,
+    0x10, 0x50, 0x71, 0x0E, 0x8B, 0x86, 0x69, 0x04, 0x00, 0xA8, 0xA9, 0x00, 0x71, 0x2C, 0xA2, 0x0E,
+    0x00, 0x82, 0x87, 0x01, 0x19, 0x12, 0x91, 0x9D, 0x00, 0x28, 0x87, 0x53, 0x16, 0x63, 0x8B, 0x1D,
+    0x00, 0x80, 0x0F, 0xE7, 0xE9, 0xC6, 0x0D, 0x9F, 0x00, 0x40, 0x1E, 0x0D, 0x13, 0xCA, 0x22, 0xF2,
+    0x02, 0x81, 0x1F, 0x1A, 0xB7, 0x99, 0x60, 0xFC, 0x04, 0x20, 0x37, 0x3E, 0x5B, 0x34, 0x90, 0x78,
+    0x03, 0x10, 0x06, 0xCC, 0x7E, 0x4D, 0x8A, 0xD2, 0x07, 0x00, 0xC8, 0xD1, 0x4C, 0xAD, 0x5C, 0xA2,
+    0x2F, 0x00, 0xA8, 0xF3, 0xD0, 0x92, 0xA1, 0x44, 0x5D, 0x00, 0x90, 0xC6, 0x63, 0x74, 0xD3, 0x85,
+    0x25, 0x00, 0xA0, 0x8E, 0x46, 0xCA, 0x08, 0x0B, 0x91, 0x01, 0x80, 0x99, 0x8B, 0x5E, 0x09, 0x3F,
+    0x16, 0x01, 0x00, 0x11, 0x0B, 0x49, 0x17, 0x85, 0x0C, 0x02, 0x08, 0x71, 0x44, 0x75, 0x35, 0xC9,
+    0xF8, 0x0A, 0x00, 0xF8, 0x11, 0x00, 0x90, 0x00, 0xA4, 0x18, 0x01, 0xA8, 0xC1, 0x10, 0xA6, 0x00,
+    0x64, 0x07, 0x00, 0xA8, 0xA3, 0x51, 0x4A, 0x11, 0xC4, 0xD8, 0x00, 0x00, 0x60, 0x04, 0x38, 0x03,
+    0x8E, 0x4D, 0x00, 0x60, 0x8E, 0x26, 0xE8, 0x63, 0x10, 0x6D, 0x01, 0x40, 0x1D, 0x4D, 0x1B, 0x4D,
+    0x2F, 0xEE, 0x04, 0x80, 0x01, 0x19, 0x50, 0x18, 0x8C, 0xEC, 0x05, 0x00, 0x73, 0x2A, 0x48, 0x22,
+    0x91, 0xA8, 0x03, 0x08, 0xD2, 0x60, 0x76, 0x68, 0x90, 0xD0, 0x18, 0x20, 0xF8, 0x71, 0x38, 0x3D,
+    0xA4, 0xE3, 0x43, 0x00, 0x48, 0x76, 0x01, 0x6C, 0x89, 0x47, 0x4D, 0x00, 0xD8, 0x47, 0xE4, 0x15,
+    0x43, 0x8A, 0x50, 0x00, 0x60, 0x8E, 0x21, 0x49, 0xC3, 0x16, 0x8B, 0x00, 0xC0, 0x9B, 0x89, 0xDA,
+    0x8D, 0x2B, 0xF6, 0x06, 0x80, 0x0C, 0xA0, 0x2F, 0x9C, 0x48, 0xCC, 0x01, 0x00, 0x86, 0x34, 0x6B,
+    0x55, 0x6B, 0xB8, 0x01, 0x00, 0xD8, 0x88, 0xA0, 0x52, 0x28, 0xB1, 0x05, 0x00, 0xE8, 0xC8, 0x28,
+    0xE2, 0x98, 0x23, 0x0B, 0x00, 0xD8, 0x03, 0xF9, 0xEA, 0x01, 0x44, 0x54, 0x00, 0x20, 0xE6, 0xC3,
+    0x17, 0x64, 0x8B, 0xA8, 0x00, 0xC1, 0x40, 0x06, 0xA9, 0x44, 0x11, 0x97, 0x02, 0x40, 0x06, 0x0E,
+    0x6A, 0x8E, 0x43, 0xFA, 0x00, 0x00, 0x33, 0x18, 0x36, 0xA2, 0x45, 0xC4, 0x05, 0x00, 0x6F, 0x36,
+    0x6A, 0x37, 0xAE, 0x98, 0x01, 0x00, 0xD8, 0x7C, 0xEA, 0x96, 0x14, 0xB1, 0x03, 0x00, 0xC0, 0x11,
+    0x75, 0xE1, 0x2C, 0x62, 0x2A, 0x00, 0x40, 0xA4, 0xB9, 0xA2, 0x68, 0x47, 0x51, 0x00, 0x51, 0xA4,
+    0x72, 0xC5, 0xE2, 0x89, 0x9B, 0x00, 0x41, 0x80, 0x0F, 0x55, 0xE5, 0x25, 0x87, 0x00, 0x00, 0x05,
+    0xCA, 0x54, 0x8D, 0x1F, 0x8A, 0x00, 0x80, 0x2F, 0x9A, 0xAF, 0x10, 0x6A, 0xEC, 0x00, 0x00, 0xAD,
+    0x32, 0x9B, 0x66, 0x9C, 0x08, 0x01, 0x00, 0x88, 0x59, 0x14, 0xB3, 0x32, 0xA9, 0x14, 0x00, 0x6E,
+    0xD2, 0x0C, 0xD2, 0x8C, 0x63, 0x2E, 0x00, 0x64, 0x93, 0x81, 0x8A, 0x38, 0xC7, 0x66, 0x00, 0x10,
+    0x47, 0xB3, 0x35, 0x62, 0x8C, 0x3B, 0x00, 0x00, 0x49, 0x27, 0x0B, 0x25, 0x16, 0x7F, 0x00, 0x01,
+    0x28, 0xC4, 0x13, 0x47, 0x30, 0x29, 0x01, 0x00, 0x47, 0x15, 0x3F, 0x1D, 0x68, 0x6C, 0x04, 0x08,
+    0x6F, 0x36, 0x6A, 0x37, 0xAE, 0x88, 0x03, 0x00, 0x28, 0x74, 0xCC, 0x58, 0x88, 0xB1, 0x04, 0x00,
+    0xB4, 0xD1, 0x88, 0x25, 0xC1, 0x61, 0x30, 0x00, 0x48, 0xF2, 0x38, 0xDA, 0x50, 0x45, 0x1B, 0x14,
+    0x00, 0xC7, 0xD3, 0xC9, 0xB3, 0x8F, 0x9E, 0x00, 0xA0, 0x0F, 0x27, 0x4A, 0x23, 0x19, 0x4F, 0x00,
+    0x80, 0x19, 0x0D, 0x58, 0x8F, 0x20, 0xF2, 0x00, 0x00, 0x3D, 0x1A, 0x20, 0x10, 0x3F, 0x1C, 0x42,
+    0x00, 0x6D, 0x10, 0x48, 0x21, 0x94, 0x28, 0x05, 0x00, 0x64, 0x18, 0x0E, 0x55, 0x04, 0x92, 0x17,
+    0x00, 0x6C, 0xF3, 0x70, 0xEB, 0x10, 0x25, 0x2B, 0x00, 0xC8, 0x90, 0x59, 0xCB, 0x61, 0xC5, 0x24,
+    0x00, 0x00, 0x47, 0x33, 0xE7, 0x62, 0x8D, 0x1C, 0x00, 0x20, 0x51, 0x66, 0xE9, 0xE6, 0x0C, 0x37,
+    0x00, 0x80, 0x90, 0x8C, 0x22, 0x8F, 0x36, 0xC2, 0x04, 0x00, 0x20, 0x9B, 0xBD, 0x1A, 0x6A, 0x7C,
+    0x01, 0x00, 0x69, 0x28, 0x7A, 0x2B, 0xEB, 0xC8, 0x0B, 0x00, 0xD0, 0x18, 0xC2, 0x72, 0x28, 0xF1,
+    0x06, 0x40, 0x9C, 0xAA, 0x90, 0x9D, 0x40, 0xD3, 0x27, 0x00, 0x4C, 0xD3, 0xA1, 0xA3, 0x61, 0xC6,
+    0x08, 0x00, 0x8C, 0xE2, 0x13, 0xF6, 0x32, 0x8B, 0x4A, 0x00, 0x40, 0xD7, 0x27, 0xAE, 0x87, 0x94,
+    0x82, 0x01, 0x20, 0x9B, 0xCB, 0x11, 0x0C, 0x1B, 0x7E, 0x00, 0x02, 0x60, 0x99, 0x9E, 0xA2, 0x1C,
+    0x11, 0x02, 0x04, 0xCF, 0x1A, 0x23, 0x36, 0x28, 0xC2, 0x0B, 0x00, 0x3C, 0x5C, 0xDC, 0x70, 0x66,
+    0x91, 0x17, 0x00, 0x64, 0xBA, 0x70, 0xAD, 0xB4, 0x62, 0x07, 0x00, 0x30, 0x93, 0xE1, 0x42, 0xD9,
+    0xC5, 0x91, 0x00, 0xE0, 0x86, 0x43, 0xDB, 0x25, 0x8D, 0x4D, 0x00, 0xC0, 0x89, 0x04, 0x0F, 0xE9,
+    0x12, 0x79, 0x10, 0xC0, 0x13, 0x4A, 0x17, 0x8D, 0x25, 0x26, 0x01, 0x80, 0x69, 0x9A, 0xEF, 0xC6,
+    0x58, 0xF4, 0x80, 0x00, 0x19, 0x40, 0x63, 0x3C, 0x8E, 0xD8, 0x02, 0x00, 0xF2, 0x68, 0x96, 0x72,
+    0xCC, 0xB0, 0x03, 0x00, 0xA0, 0xE9, 0x84, 0xC1, 0xB4, 0xE2, 0x10, 0x00, 0x90, 0x73, 0xE1, 0xA2,
+    0x99, 0x44, 0x5C, 0x40, 0x90, 0x47, 0x93, 0xC7, 0x03, 0x8C, 0x1E, 0x00, 0x41, 0x4F, 0xE4, 0xA9,
+    0x65, 0x10, 0x3D, 0x22, 0x82, 0x87, 0xD2, 0x17, 0x51, 0x1D, 0x5A, 0x02, 0x80, 0x34, 0x15, 0x32,
+    0x1C, 0x4F, 0x2C, 0x05, 0x00, 0x62, 0x3E, 0x5C, 0x3E, 0x79, 0xB8, 0x84, 0x10, 0x88, 0x68, 0x1C,
+    0x69, 0xEE, 0x71, 0x07, 0x10, 0xE8, 0xD9, 0x08, 0xF2, 0x40, 0xA3, 0x6F, 0x00, 0x80, 0xC0, 0x31,
+    0x72, 0x71, 0xC3, 0x5A, 0x00, 0xF0, 0x67, 0x12, 0x92, 0xB2, 0x82, 0x28, 0x00, 0x00, 0x8E, 0x26,
+    0x4F, 0x24, 0x20, 0x4B, 0x00, 0x60, 0x13, 0x4C, 0xD9, 0x0D, 0x29, 0x82, 0x40, 0x84, 0x01, 0xA0,
+    0x39, 0x35, 0x2C, 0xBC, 0x01, 0x00, 0x05, 0x8A, 0xA5, 0x28, 0x31, 0x39, 0x01, 0x81, 0xEC, 0xA8,
+    0x4E, 0xC9, 0x6C, 0x71, 0x15, 0x11, 0xFE, 0x1A, 0xF0, 0xE0, 0x14, 0x11, 0x08, 0x04, 0x20, 0x40,
+    0x62, 0x6C, 0xCB, 0x43, 0x51, 0x00, 0x90, 0x06, 0x73, 0x13, 0x42, 0x86, 0xB8, 0x00, 0x80, 0x98,
+    0x84, 0x67, 0x03, 0x90, 0x8C, 0x00, 0x41, 0x1B, 0xC7, 0x9A, 0x8E, 0x2A, 0x22, 0x21, 0x80, 0x37,
+    0x1B, 0xB5, 0x1B, 0x57, 0xCC, 0x05, 0x00, 0x49, 0x16, 0x4B, 0x12, 0xD7, 0x08, 0x0C, 0x00, 0xB2,
+    0x68, 0x02, 0x79, 0x92, 0x71, 0x03, 0x00, 0x94, 0xB2, 0xAC, 0xF9, 0x5C, 0x92, 0x08, 0x00, 0x80,
+    0xE3, 0x30, 0x52, 0xB9, 0xC3, 0x90, 0x00, 0xB0, 0x47, 0xE3, 0x65, 0x43, 0x89, 0x9B, 0x81, 0x61,
+    0x42, 0xE5, 0x91, 0x06, 0x1F, 0x55, 0x01, 0x80, 0x1E, 0x4F, 0x1F, 0xD3, 0x25, 0x8E, 0x02, 0x00,
+    0x39, 0x9A, 0xA7, 0x90, 0x56, 0x14, 0x02, 0x00, 0x6B, 0x34, 0x47, 0x1A, 0xAC, 0x08, 0x03, 0x00,
+    0xFA, 0x60, 0x8C, 0x48, 0x0E, 0x71, 0x13, 0x10, 0xD0, 0xC1, 0x78, 0xC5, 0x88, 0xE2, 0x11, 0x00,
+    0x40, 0xA4, 0x59, 0x6B, 0x61, 0xC6, 0x0D, 0x00, 0x60, 0xA6, 0xD5, 0xA9, 0xE7, 0x87, 0xCA, 0x00,
+    0xE0, 0xCF, 0x85, 0xEB, 0xC4, 0x17, 0x37, 0x00, 0x00, 0x05, 0x51, 0xD8, 0x0D, 0x26, 0xDA, 0x00,
+    0x80, 0x0C, 0xA4, 0x2F, 0x1C, 0x47, 0x1C, 0x05, 0x08, 0x3F, 0x22, 0x84, 0x47, 0xB6, 0x78, 0x12,
+    0x00, 0x92, 0x55, 0xE6, 0x6E, 0x82, 0x91, 0x18, 0x00, 0xB4, 0x33, 0x34, 0xB4, 0x54, 0x88, 0x23,
+    0x00, 0x78, 0x03, 0x02, 0x22, 0x99, 0x43, 0x52, 0x40, 0x50, 0xA8, 0x63, 0x03, 0x22, 0x86, 0x30,
+    0x80, 0xC0, 0x91, 0x81, 0x8B, 0x84, 0x18, 0x5B, 0x01, 0x40, 0x9A, 0x0D, 0x17, 0x91, 0x1B, 0x22,
+    0x01, 0x00, 0x1D, 0x19, 0x32, 0x9E, 0x48, 0x1C, 0x02, 0x00, 0x87, 0x30, 0x62, 0x35, 0xA2, 0x08,
+    0x0A, 0x00, 0xA3, 0x7C, 0xDC, 0x74, 0x5A, 0x91, 0x09, 0x10, 0xC0, 0x91, 0xF0, 0x54, 0x5C, 0x62,
+    0x06, 0x00, 0xA0, 0xE1, 0x01, 0x93, 0x39, 0xC5, 0x64, 0x04, 0xE0, 0x67, 0xE2, 0x43, 0xE2, 0x86,
+    0xCA, 0x00, 0x60, 0xCD, 0x45, 0xEB, 0xC5, 0x13, 0x6F, 0x02, 0x80, 0x01, 0xCD, 0x64, 0xC7, 0x4D,
+    0x6A, 0x00, 0x80, 0x19, 0x9A, 0xE3, 0xC3, 0x4C, 0x8C, 0x02, 0x00, 0x09, 0x0C, 0x94, 0x1F, 0x33,
+    0xB9, 0x01, 0x00, 0xCC, 0x84, 0xBA, 0x62, 0x3C, 0xF1, 0x02, 0x08, 0x78, 0x6B, 0x30, 0xEC, 0x48,
+    0x88, 0x27, 0x00, 0x58, 0x33, 0x0A, 0x6C, 0x99, 0x47, 0x58, 0x00, 0x50, 0xD0, 0x91, 0x61, 0xD4,
+    0x21, 0x39, 0x01, 0x40, 0x41, 0x47, 0x32, 0x67, 0x1E, 0x85, 0x00, 0x80, 0x1F, 0x8A, 0x9E, 0x8E,
+    0x31, 0x0A, 0x01, 0x00, 0x39, 0x23, 0x48, 0xB2, 0x45, 0xEC, 0x01, 0x08, 0x9F, 0x3E, 0x89, 0x4E,
+    0xAD, 0x34, 0x04, 0x00, 0xE0, 0x80, 0xC0, 0x62, 0x54, 0x31, 0x15, 0x00, 0x16, 0x9A, 0xCC, 0x3C,
+    0x2C, 0x22, 0x15, 0x00, 0x88, 0xA3, 0x21, 0xFC, 0xD8, 0xC8, 0x22, 0x00, 0x60, 0xE1, 0xD3, 0x47,
+    0x14, 0x8B, 0x21, 0x00, 0x81, 0x46, 0x88, 0xAA, 0x06, 0x10, 0x81, 0x08, 0x00, 0x82, 0xC9, 0x9F,
+    0xCF, 0x30, 0x3A, 0x02, 0x00, 0x37, 0x1A, 0x27, 0x1C, 0x36, 0x0C, 0x02, 0x00, 0x85, 0x28, 0x61,
+    0x43, 0x79, 0x58, 0x0B, 0x00, 0x04, 0x80, 0x04, 0x59, 0xEE, 0x31, 0x1A, 0x01, 0x98, 0x89, 0xAC,
+    0x91, 0x84, 0x63, 0x30, 0x00, 0x70, 0xE3, 0x99, 0xE3, 0x99, 0xC5, 0x53, 0x00, 0xA0, 0x47, 0x03,
+    0x26, 0x73, 0x8A, 0x1B, 0x08, 0x80, 0xC2, 0xE2, 0x05, 0xE4, 0x09, 0x99, 0x00, 0x40, 0x30, 0xC8,
+    0x53, 0x4A, 0x24, 0x75, 0x00, 0x80, 0x38, 0x1A, 0x53, 0x3A, 0x4A, 0x44, 0x02, 0x08, 0x66, 0x3A,
+    0x70, 0x3B, 0xAD, 0xD8, 0x13, 0x00, 0x08, 0x68, 0xDE, 0x4E, 0xBE, 0x71, 0x06, 0x00, 0x54, 0xCA,
+    0x64, 0xF9, 0xCC, 0x61, 0x04, 0x00, 0x18, 0x54, 0xEA, 0x49, 0x11, 0xC3, 0x59, 0x00, 0x20, 0xE6,
+    0x02, 0x56, 0xE3, 0x89, 0x1D, 0x00, 0xA0, 0x80, 0x89, 0xB2, 0xC8, 0x1A, 0x97, 0x00, 0x80, 0x13,
+    0x50, 0x22, 0x94, 0x2A, 0x96, 0x0A, 0x80, 0x37, 0x1B, 0x9C, 0x95, 0x27, 0x64, 0x06, 0x04, 0x3F,
+    0x26, 0x69, 0x34, 0xB8, 0x48, 0x0C, 0x00, 0x64, 0x78, 0x94, 0x60, 0xE6, 0x50, 0x18, 0x40, 0x6E,
+    0xCA, 0x50, 0xF5, 0xB0, 0xA1, 0x0B, 0x02, 0x90, 0xA3, 0xE9, 0x83, 0x8A, 0xC4, 0x26, 0x00, 0x40,
+    0x10, 0x10, 0xC0, 0x23, 0x20, 0xA8, 0x00, 0x20, 0x4F, 0x65, 0x94, 0x26, 0x22, 0x75, 0x00, 0xC0,
+    0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0xF6, 0x02, 0x48, 0x03, 0x21, 0x34, 0x1A, 0x5A, 0xB4, 0x00, 0x00,
+    0xBF, 0x40, 0x68, 0x46, 0x80, 0xF4, 0x01, 0x00, 0xBC, 0x8C, 0xE4, 0x8C, 0x22, 0xF1, 0x13, 0x01,
+    0x74, 0xD2, 0xB0, 0x58, 0x80, 0xA1, 0x07, 0x00, 0x50, 0x46, 0xB9, 0x61, 0x69, 0x22, 0x18, 0x00,
+    0xC0, 0xE6, 0x93, 0x86, 0xC3, 0x8A, 0xD5, 0x00, 0x20, 0xC3, 0x03, 0x30, 0x45, 0x1F, 0x77, 0x00,
+    0x80, 0x9A, 0x47, 0x5D, 0xD0, 0x29, 0x72, 0x06, 0x80, 0x06, 0x9A, 0xB0, 0x11, 0x69, 0xFC, 0x00,
+    0x80, 0x6E, 0x32, 0x87, 0x3A, 0xDE, 0xF8, 0x0A, 0x04, 0x9E, 0x35, 0x0C, 0x70, 0x10, 0xA4, 0x12,
+    0x00, 0xD6, 0xD1, 0xD0, 0x84, 0x6C, 0xE1, 0x08, 0x00, 0x68, 0x03, 0x3A, 0x14, 0x42, 0x46, 0x24,
+    0x02, 0x00, 0x20, 0xB4, 0xD4, 0xE2, 0x87, 0xBE, 0x00, 0x40, 0x4E, 0x45, 0xEB, 0xC6, 0x10, 0x9D,
+    0x01, 0x00, 0x1D, 0xCE, 0x5A, 0x50, 0x24, 0x12, 0x03, 0x00, 0x05, 0x97, 0xA4, 0x90, 0x4C, 0x7C,
+    0x40, 0x00, 0x68, 0x34, 0x95, 0x53, 0xB8, 0xF8, 0x03, 0x00, 0xEE, 0x35, 0x70, 0x8E, 0x64, 0xC4,
+    0x08, 0x00, 0x88, 0xA9, 0xEC, 0xC1, 0x7C, 0xE3, 0x4E, 0x00, 0xD0, 0xF6, 0x30, 0x79, 0x71, 0x91,
+    0x53, 0x00, 0xC0, 0x40, 0x42, 0x2B, 0x51, 0x95, 0x41, 0x00, 0x60, 0xC0, 0x86, 0x2D, 0xE5, 0x1A,
+    0x43, 0x00, 0x44, 0xA1, 0x0D, 0x53, 0xCA, 0x21, 0x62, 0x00, 0x00, 0x34, 0x1A, 0xBF, 0x97, 0x73,
+    0x74, 0x0A, 0x00, 0xA7, 0x24, 0x7F, 0x3F, 0xC3, 0x58, 0x05, 0x00, 0xC4, 0x38, 0xAC, 0x1A, 0x0C,
+    0x72, 0x14, 0x00, 0xBC, 0x91, 0xDD, 0xD2, 0xA0, 0xE4, 0x13, 0x00, 0x30, 0xA4, 0x01, 0x23, 0x81,
+    0x46, 0x06, 0x04, 0xC0, 0xA4, 0x73, 0xC4, 0x52, 0x87, 0x45, 0x00, 0x20, 0x90, 0xC6, 0xAF, 0x87,
+    0x18, 0x3D, 0x00, 0x00, 0x9B, 0xC8, 0x9C, 0xCB, 0x35, 0x7E, 0x10, 0x00, 0x3A, 0x94, 0x05, 0x18,
+    0x0A, 0xA4, 0x02, 0x00, 0x7F, 0x3A, 0x67, 0x3D, 0x91, 0x48, 0x0C, 0x00, 0xD4, 0x60, 0xB8, 0x4C,
+    0x7C, 0x71, 0x08, 0x00, 0xA4, 0x91, 0xB0, 0xA5, 0x58, 0x23, 0x07, 0x00, 0xA0, 0x10, 0x4A, 0x42,
+    0x11, 0xC4, 0x24, 0x20, 0x70, 0x41, 0x93, 0x65, 0x44, 0x86, 0x51, 0x00, 0x80, 0x43, 0x84, 0x4A,
+    0xA7, 0x0E, 0x3D, 0x00, 0x40, 0x1D, 0xCD, 0xD2, 0xCB, 0x1D, 0x22, 0x01, 0x00, 0x31, 0x95, 0x2B,
+    0x11, 0x60, 0xC4, 0x01, 0x00, 0x72, 0x3A, 0x54, 0x28, 0xA4, 0xB8, 0x0C, 0x00, 0xE2, 0x54, 0xEE,
+    0x3E, 0x0C, 0x32, 0x04, 0x00, 0xA2, 0xC1, 0x64, 0x01, 0xC1, 0xA1, 0x25, 0x00, 0x88, 0xA3, 0x81,
+    0x62, 0x59, 0xC4, 0x5C, 0x01, 0x20, 0x46, 0x83, 0x54, 0xA2, 0x88, 0x1F, 0x00, 0x48, 0x54, 0x65,
+    0x4A, 0x67, 0x8E, 0x7A, 0x01, 0x80, 0x9B, 0x41, 0x44, 0x42, 0x0A, 0x4A, 0x00, 0x80, 0x34, 0x15,
+    0x31, 0x1A, 0x52, 0x04, 0xA1, 0x00, 0x02, 0x58, 0xB2, 0x7B, 0x99, 0x78, 0x04, 0x00, 0x96, 0x70,
+    0xEE, 0x5E, 0xB4, 0x11, 0x08, 0x08, 0xB8, 0xE1, 0x6C, 0xF1, 0xF8, 0x61, 0x2F, 0x00, 0x10, 0x30,
+    0xC9, 0x0B, 0x29, 0xC8, 0x27, 0x00, 0x50, 0x2C, 0x85, 0x05, 0x43, 0x89, 0xB5, 0x00, 0x90, 0x4E,
+    0x06, 0x67, 0x86, 0x08, 0x5F, 0x01, 0x80, 0x80, 0xCD, 0xDF, 0xC9, 0x3F, 0xF6, 0x02, 0x80, 0x67,
+    0x15, 0xB1, 0x19, 0x53, 0x6A, 0x0A, 0x00, 0xBE, 0x36, 0x75, 0x3A, 0xBE, 0x18, 0x04, 0x00, 0xD8,
+    0x60, 0xBA, 0x76, 0x0E, 0xB1, 0x09, 0x20, 0x10, 0xAB, 0xDC, 0xED, 0x04, 0xD3, 0x08, 0x00, 0xA8,
+    0xA3, 0x31, 0xDB, 0xB8, 0x47, 0x1F, 0x00, 0x90, 0x07, 0xF4, 0x67, 0xA4, 0x8A, 0x2E, 0x00, 0x60,
+    0x0D, 0x46, 0x0A, 0x66, 0x10, 0x97, 0x02, 0x80, 0x02, 0x0C, 0x65, 0xC9, 0x48, 0x66, 0x00, 0x80,
+    0x07, 0xA3, 0xE1, 0x30, 0x6F, 0xDC, 0x10, 0x04, 0xCF, 0x2A, 0x48, 0x46, 0x48, 0xF4, 0x02, 0x80,
+    0x74, 0x6C, 0xA0, 0x70, 0xE6, 0xD0, 0x29, 0x10, 0x04, 0xE0, 0x44, 0xAF, 0x24, 0xA5, 0x0D, 0x00,
+    0xD0, 0xF3, 0x11, 0xF3, 0x18, 0x47, 0xDF, 0x00, 0xF0, 0x26, 0xA4, 0x78, 0x83, 0x8E, 0x1D, 0x00,
+    0x00, 0xD0, 0x06, 0x69, 0x06, 0x0D, 0xA3, 0x00, 0x40, 0xA4, 0x0A, 0x17, 0xCD, 0x24, 0x82, 0x02,
+    0x40, 0x35, 0x1A, 0x38, 0x16, 0x6B, 0xC4, 0x08, 0x20, 0x75, 0x4A, 0xB9, 0x49, 0xFC, 0x18, 0x1A,
+    0x00, 0x58, 0x5C, 0xB0, 0x54, 0x54, 0x51, 0x08, 0x00, 0xB0, 0xA9, 0x9C, 0x99, 0x5C, 0x63, 0x10,
+    0x00, 0x68, 0x87, 0x68, 0xF0, 0xA1, 0x90, 0x13, 0x00, 0x20, 0x66, 0xE2, 0xA5, 0x82, 0x8B, 0x36,
+    0x00, 0x60, 0x80, 0x84, 0x92, 0x67, 0x1D, 0x7B, 0x00, 0x00, 0x9A, 0x4B, 0xD4, 0x0D, 0x1D, 0x56,
+    0x03, 0x40, 0x33, 0x9A, 0x26, 0x12, 0x4E, 0x84, 0x00, 0x00, 0x8D, 0x46, 0x83, 0x48, 0xB1, 0xB8,
+    0x13, 0x00, 0xCC, 0x6C, 0x12, 0x8D, 0x82, 0x51, 0x07, 0x00, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0xE2,
+    0x09, 0x00, 0xEC, 0x03, 0x8A, 0xFC, 0xF1, 0x46, 0x5C, 0x00, 0xD0, 0x65, 0x01, 0x57, 0xF0, 0x94,
+    0xC8, 0x00, 0x80, 0x95, 0x66, 0xC5, 0x02, 0x0B, 0xA5, 0x00, 0x00, 0x1C, 0x12, 0x1C, 0xD2, 0x21,
+    0x5A, 0x01, 0x80, 0x35, 0x9C, 0x1C, 0x8D, 0x3C, 0x2C, 0x01, 0x00, 0x5A, 0x34, 0x6F, 0x3E, 0x9E,
+    0x78, 0x0A, 0x00, 0x32, 0x98, 0x04, 0x71, 0xB2, 0x71, 0x07, 0x10, 0x60, 0x59, 0xAD, 0x19, 0x0D,
+    0x62, 0x4F, 0x30, 0x48, 0x05, 0x79, 0xA2, 0xB9, 0xC3, 0x1B, 0x01, 0x80, 0xE6, 0x93, 0xC5, 0x73,
+    0x87, 0x49, 0x00, 0x00, 0x10, 0xC5, 0x8B, 0x25, 0x16, 0x7F, 0x00, 0x40, 0x8F, 0x8C, 0x99, 0x0B,
+    0x30, 0x1E, 0x01, 0x00, 0x0F, 0x1E, 0x3A, 0x92, 0x79, 0x14, 0x02, 0x00, 0x70, 0x3A, 0x83, 0x3D,
+    0xCC, 0x68, 0x04, 0x00, 0xE2, 0x74, 0x0C, 0x99, 0x58, 0x71, 0x1A, 0x00, 0x30, 0x49, 0x80, 0x91,
+    0x40, 0xE3, 0x08, 0x08, 0xB8, 0x56, 0x81, 0xBA, 0x91, 0x43, 0x22, 0x00, 0xA0, 0x83, 0xF2, 0x24,
+    0xC3, 0x87, 0x3C, 0x20, 0xA0, 0x4D, 0x88, 0xCD, 0x85, 0x19, 0xAF, 0x00, 0x40, 0x1F, 0x4D, 0x12,
+    0x4B, 0x1E, 0x96, 0x00, 0x80, 0x3C, 0x9A, 0x33, 0x9C, 0x53, 0x5C, 0x02, 0x02, 0x6B, 0x20, 0x54,
+    0x35, 0x80, 0xA8, 0x04, 0x08, 0xD2, 0x40, 0xA4, 0x64, 0x04, 0x31, 0x17, 0x00, 0xC4, 0xC9, 0x50,
+    0xCE, 0x04, 0xE4, 0x2B, 0x00, 0x40, 0x20, 0xA0, 0x19, 0x91, 0xC2, 0x0F, 0x00, 0x50, 0x47, 0xD3,
+    0x46, 0xD3, 0x8B, 0x51, 0x01, 0xA0, 0x0D, 0x65, 0xED, 0xC5, 0x18, 0x8F, 0x01, 0x80, 0x95, 0x0E,
+    0xA4, 0xD2, 0x30, 0x1A, 0x05, 0x03, 0x05, 0x1C, 0xBD, 0x93, 0x7B, 0xEC, 0x0D, 0x00, 0x84, 0x22,
+    0x57, 0x28, 0xAC, 0x98, 0x0C, 0x00, 0xE2, 0x40, 0xCC, 0x64, 0x6C, 0xF1, 0x03, 0x00, 0xC0, 0xC1,
+    0x30, 0xED, 0x90, 0xE1, 0x25, 0x20, 0x5C, 0x23, 0xA2, 0x9B, 0xCA, 0x43, 0x66, 0x00, 0xE0, 0x27,
+    0xF1, 0x75, 0x73, 0x89, 0x5D, 0x00, 0xC0, 0x92, 0x86, 0x69, 0x45, 0x10, 0x71, 0x42, 0x80, 0x99,
+    0x4E, 0x98, 0xCB, 0x2C, 0x52, 0x02, 0x00, 0x36, 0xA2, 0xB4, 0x17, 0x62, 0x0C, 0x05, 0x00, 0x6D,
+    0x3A, 0x6E, 0x31, 0xC6, 0xB8, 0x05, 0x00, 0xFA, 0x40, 0x9A, 0x5E, 0xF8, 0x90, 0x18, 0x40, 0x88,
+    0xD1, 0x48, 0xA1, 0x78, 0x22, 0x52, 0x00, 0xD8, 0x03, 0x51, 0xBD, 0xA1, 0x48, 0x0E, 0x00, 0x90,
+    0xA6, 0x72, 0x45, 0xA3, 0x88, 0x9E, 0x00, 0x00, 0xA0, 0x20, 0x40, 0x47, 0x40, 0x4A, 0x01, 0x60,
+    0x01, 0x4F, 0x56, 0x8B, 0x27, 0xB6, 0x02, 0x88, 0x11, 0x21, 0x1C, 0x98, 0x24, 0x5C, 0x09, 0x01,
+    0x2C, 0x46, 0x95, 0x2F, 0x0B, 0x89, 0x09, 0x00, 0xC4, 0x68, 0x92, 0x3E, 0x44, 0xD1, 0x08, 0x00,
+    0xF4, 0xD1, 0xE0, 0x01, 0xC5, 0xA2, 0x33, 0x00, 0x58, 0x72, 0x39, 0x83, 0xF1, 0x45, 0x0B, 0x00,
+    0x98, 0xE6, 0x92, 0x65, 0x82, 0x8B, 0x2A, 0x00, 0x80, 0x92, 0x86, 0xC8, 0x24, 0x0F, 0x37, 0x01,
+    0x00, 0x1E, 0xCA, 0xA0, 0x8A, 0x3F, 0x82, 0x02, 0x00, 0x35, 0x9A, 0x22, 0x10, 0x47, 0xD4, 0x01,
+    0x80, 0x69, 0x4A, 0x84, 0x38, 0xDA, 0x58, 0x02, 0x00, 0x64, 0x74, 0xEA, 0x72, 0x86, 0x11, 0x09,
+    0x00, 0x00, 0x80, 0x1D, 0x6E, 0xAC, 0xA4, 0x15, 0x00, 0x88, 0xA3, 0xD9, 0xF3, 0xF1, 0xC5, 0x24,
+    0x80, 0x40, 0x01, 0x44, 0xD8, 0x92, 0x8F, 0x3A, 0x00, 0xC0, 0x0E, 0x64, 0x8E, 0xE6, 0x18, 0x2F,
+    0x00, 0x00, 0xA3, 0x8F, 0x8D, 0x89, 0x15, 0x8E, 0x00, 0xC0, 0x0C, 0x19, 0x37, 0x17, 0x68, 0x6C,
+    0x05, 0x00, 0x4B, 0x34, 0x49, 0x34, 0x69, 0x18, 0x0B, 0x00, 0x1E, 0x69, 0xBC, 0x4A, 0x88, 0x31,
+    0x09, 0x00, 0x11, 0x68, 0xA9, 0xBF, 0x5C, 0x25, 0x0E, 0x00, 0x40, 0x43, 0x71, 0xE3, 0xF8, 0x47,
+    0x52, 0x00, 0x78, 0xC7, 0x33, 0xF5, 0xB2, 0x88, 0x40, 0x01, 0x40, 0xC1, 0xE6, 0xCE, 0x23, 0x21,
+    0xA7, 0x00, 0xC1, 0x9C, 0x85, 0x8F, 0x87, 0x1F, 0xE2, 0x04, 0x00, 0x01, 0x18, 0xAE, 0x0A, 0x7B,
+    0xBC, 0x00, 0x01, 0x8F, 0x36, 0x43, 0x30, 0x62, 0xC8, 0x09, 0x00, 0xC2, 0x68, 0xD2, 0x40, 0xDA,
+    0x91, 0x11, 0x00, 0xD8, 0xD1, 0x48, 0x79, 0x0C, 0xA3, 0x11, 0x00, 0xA0, 0x73, 0xB1, 0x4B, 0x49,
+    0x47, 0x94, 0x00, 0x80, 0x62, 0x53, 0x4E, 0x24, 0x94, 0x23, 0x00, 0xC0, 0x8C, 0x86, 0xE9, 0x83,
+    0x15, 0xA7, 0x00, 0x00, 0x9C, 0xD0, 0x9C, 0xD2, 0x21, 0xB2, 0x00, 0x80, 0x28, 0x9A, 0x24, 0x96,
+    0x3C, 0xD4, 0x0D, 0x00, 0x03, 0x38, 0x7E, 0x2B, 0xF3, 0x78, 0x02, 0x00, 0x76, 0x25, 0x92, 0xAE,
+    0x72, 0xB0, 0x08, 0x00, 0xC8, 0xC1, 0x4C, 0xAD, 0x64, 0xA2, 0x0A, 0x00, 0xE0, 0xA0, 0x79, 0x1D,
+    0x11, 0xCA, 0x46, 0x00, 0xB0, 0x46, 0xD3, 0xC5, 0x03, 0x88, 0x1D, 0x81, 0x00, 0xD2, 0x26, 0xF1,
+    0x47, 0x1A, 0x33, 0x24, 0x40, 0x1D, 0x0D, 0x1A, 0x90, 0x23, 0x4E, 0x01, 0x80, 0x3D, 0x92, 0xAC,
+    0x12, 0x5F, 0xC4, 0x01, 0x00, 0x76, 0x2A, 0x4F, 0x2F, 0x82, 0x58, 0x02, 0x18, 0xD6, 0x8C, 0xBA,
+    0x66, 0x32, 0xD1, 0x15, 0x00, 0x98, 0xD1, 0x44, 0x46, 0xE1, 0xE2, 0x32, 0x00, 0x58, 0x53, 0x70,
+    0x69, 0x3A, 0xC1, 0x0E, 0x00, 0xD4, 0x25, 0x44, 0xC9, 0xA5, 0x8A, 0x3C, 0x00, 0x60, 0xC0, 0x00,
+    0x2A, 0x83, 0x19, 0xA3, 0x00, 0x00, 0x21, 0x0E, 0x14, 0x0F, 0x1A, 0x26, 0x01, 0x80, 0x3A, 0x9A,
+    0x36, 0x9A, 0x5E, 0xFC, 0x09, 0x00, 0x00, 0x52, 0xCE, 0x41, 0x23, 0xE9, 0x02, 0x00, 0xFA, 0x80,
+    0xA6, 0x76, 0xE6, 0x30, 0x07, 0x00, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0xE2, 0x14, 0x00, 0x62, 0xB1,
+    0x69, 0xF4, 0xD1, 0xC6, 0x10, 0x00, 0xF0, 0x66, 0x23, 0xF4, 0x42, 0x86, 0xAD, 0x01, 0x20, 0x4F,
+    0x06, 0x4D, 0x87, 0x14, 0x6D, 0x01, 0xC0, 0x1B, 0x4A, 0x4D, 0x05, 0x1F, 0x46, 0x00, 0x80, 0x37,
+    0x1B, 0xB5, 0x1B, 0x57, 0xE4, 0x05, 0x00, 0x34, 0x42, 0x73, 0x3C, 0xB3, 0xF8, 0x01, 0x01, 0x78,
+    0x68, 0x00, 0x09, 0x9B, 0x10, 0x09, 0x00, 0x1E, 0x8A, 0x7C, 0x89, 0x48, 0x63, 0x03, 0x00, 0x22,
+    0x50, 0xEA, 0xAB, 0xB9, 0x46, 0x0C, 0x00, 0x60, 0x46, 0xA3, 0xD5, 0x42, 0x8A, 0x1F, 0x00, 0xB0,
+    0x0D, 0xE8, 0x4D, 0xE8, 0x12, 0x39, 0x00, 0x00, 0x9F, 0x8D, 0x96, 0x89, 0x2F, 0xEA, 0x06, 0x80,
+    0x37, 0x9B, 0x21, 0x93, 0x3B, 0xEC, 0x01, 0x40, 0x75, 0x16, 0x38, 0x15, 0x87, 0x08, 0x02, 0x00,
+    0x32, 0x78, 0xC2, 0x78, 0x14, 0x31, 0x07, 0x20, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0x22, 0x08, 0x08,
+    0x70, 0xA5, 0x89, 0x3A, 0xF1, 0x44, 0x25, 0x00, 0x90, 0x2B, 0x13, 0xE4, 0x22, 0x46, 0xCB, 0x00,
+    0x00, 0x8F, 0x06, 0x2B, 0xC4, 0x18, 0x9D, 0x00, 0x81, 0x22, 0x0D, 0x1D, 0xC8, 0x3F, 0x0E, 0x11,
+    0x85, 0x01, 0x9F, 0xC2, 0x14, 0x81, 0x7C, 0x02, 0x00, 0x69, 0x2A, 0x60, 0x2E, 0xB1, 0xC8, 0x01,
+    0x00, 0xDC, 0x70, 0xE0, 0x78, 0x54, 0x71, 0x09, 0x00, 0x98, 0xD1, 0x60, 0xB1, 0x88, 0xE2, 0x32,
+    0x02, 0x00, 0xA4, 0xA1, 0x42, 0x21, 0x45, 0x4C, 0x00, 0x80, 0x27, 0x93, 0x46, 0xF2, 0x8D, 0xC0,
+    0x00, 0x20, 0x8E, 0x06, 0x2E, 0xC7, 0x16, 0xA9, 0x00, 0x40, 0x86, 0x8C, 0xE0, 0x48, 0x43, 0x92,
+    0x04, 0x82, 0x44, 0x13, 0xC5, 0x9A, 0x76, 0x84, 0x02, 0x80, 0x9B, 0x28, 0x5D, 0x33, 0x99, 0xB8,
+    0x03, 0x00, 0x88, 0x50, 0xFA, 0x7A, 0x86, 0x31, 0x1A, 0x00, 0xF0, 0x41, 0xF8, 0xD0, 0x38, 0x61,
+    0x12, 0x00, 0xB0, 0x84, 0x79, 0xB3, 0xF1, 0x45, 0x5B, 0x00, 0xB0, 0x67, 0x12, 0x48, 0x03, 0x8E,
+    0x3D, 0x02, 0xE0, 0xCD, 0xC6, 0x46, 0x84, 0x0C, 0x77, 0x00, 0x41, 0x30, 0x0A, 0xDD, 0x8C, 0x32,
+    0xC5, 0x00, 0x80, 0x43, 0x1B, 0x27, 0x18, 0x3E, 0x5C, 0x45, 0x00, 0x75, 0x34, 0x7F, 0x3C, 0xCC,
+    0x78, 0x81, 0x00, 0xD4, 0x50, 0x8E, 0x58, 0xEA, 0xB0, 0x06, 0x00, 0xB0, 0xD1, 0xD0, 0xD1, 0x24,
+    0x63, 0x2D, 0x00, 0x90, 0x94, 0x89, 0xE2, 0x61, 0xC3, 0x66, 0x00, 0xC0, 0xE6, 0x43, 0x64, 0xB3,
+    0x85, 0x02, 0x00, 0xA0, 0x8E, 0xAB, 0x8D, 0xA6, 0x17, 0x8F, 0x01, 0x80, 0x9E, 0x4C, 0x9E, 0x50,
+    0x2B, 0xB2, 0x02, 0x00, 0x3F, 0x10, 0x3B, 0x19, 0x6A, 0xBC, 0x04, 0x00, 0x7B, 0x36, 0x51, 0x2B,
+    0x8E, 0x18, 0x01, 0x00, 0x1C, 0x16, 0x0C, 0x8E, 0x0A, 0xC4, 0x09, 0x00, 0x5E, 0xB9, 0x84, 0xD9,
+    0x70, 0xE2, 0x12, 0x00, 0x98, 0x43, 0x01, 0xBA, 0x79, 0x42, 0xDE, 0x00, 0x30, 0x82, 0xC2, 0xF5,
+    0x41, 0x8D, 0x51, 0x00, 0xC0, 0x90, 0x66, 0x0B, 0xC6, 0x13, 0x7B, 0x00, 0x80, 0x23, 0xCD, 0x55,
+    0xCA, 0x29, 0x62, 0x04, 0x20, 0x04, 0x15, 0xD5, 0x25, 0x73, 0x14, 0x02, 0x00, 0x55, 0x2E, 0x68,
+    0x2D, 0xC8, 0xE8, 0x00, 0x10, 0xD6, 0x60, 0xC8, 0x78, 0x32, 0x71, 0x19, 0x00, 0xC0, 0xF1, 0x84,
+    0xCD, 0x90, 0xE2, 0x06, 0x04, 0x50, 0x60, 0x52, 0xEC, 0x13, 0xC3, 0x55, 0x00, 0xA0, 0xA6, 0x93,
+    0x68, 0x93, 0x8E, 0x28, 0x00, 0x80, 0x4F, 0x82, 0xE9, 0x66, 0x0D, 0x21, 0x00, 0x80, 0x1C, 0xCD,
+    0x22, 0x8D, 0x3C, 0x1E, 0x01, 0x00, 0x31, 0x15, 0xA4, 0x19, 0x34, 0x24, 0x02, 0x04, 0x74, 0x26,
+    0x6B, 0x37, 0xB3, 0xE8, 0x04, 0x00, 0xD2, 0x78, 0xE8, 0x8C, 0x2E, 0xB1, 0x13, 0x00, 0xA8, 0xF1,
+    0x48, 0x7A, 0x79, 0x22, 0x0B, 0x00, 0x40, 0x23, 0x41, 0x74, 0xE1, 0xC7, 0x24, 0x00, 0x80, 0xC6,
+    0x33, 0x74, 0x33, 0x85, 0x2C, 0x00, 0xE2, 0xCE, 0xC4, 0xC7, 0x65, 0x0B, 0x51, 0x20, 0x20, 0x21,
+    0xCF, 0x5E, 0x0D, 0x35, 0x8A, 0x40, 0x20, 0x02, 0x9B, 0xC8, 0xB9, 0x3B, 0x6C, 0x01, 0x00, 0x66,
+    0x3C, 0x6C, 0x40, 0x97, 0x68, 0x03, 0x80, 0x88, 0x64, 0xB2, 0x6E, 0x06, 0xF1, 0x08, 0x11, 0xB0,
+    0xB9, 0x10, 0x1A, 0xED, 0x62, 0x12, 0x00, 0x10, 0xA0, 0x59, 0xC4, 0x39, 0x47, 0x11, 0x00, 0x10,
+    0x4D, 0x20, 0x90, 0x53, 0x20, 0x37, 0x80, 0x30, 0xC7, 0x46, 0x6E, 0x67, 0x16, 0xBB, 0x10, 0x00,
+    0x9F, 0x85, 0x55, 0x49, 0x2B, 0x6A, 0x08, 0x80, 0x36, 0xA4, 0xB9, 0xAE, 0x35, 0xBC, 0x01, 0x00,
+    0x14, 0x56, 0xEB, 0x7B, 0x0F, 0xD9, 0x1C, 0x0C, 0xB6, 0x60, 0xEA, 0xB0, 0xEA, 0x70, 0x23, 0x00,
+    0x1C, 0x9B, 0x64, 0xB9, 0x78, 0x22, 0x09, 0x00, 0x60, 0x73, 0x12, 0xB4, 0xF1, 0x46, 0x92, 0x00,
+    0x60, 0xA3, 0xD3, 0x98, 0x93, 0x8E, 0xA0, 0x00, 0x00, 0x0C, 0x26, 0x10, 0xE7, 0x1A, 0xAB, 0x00,
+    0x40, 0x0E, 0x0C, 0x22, 0xCD, 0x3A, 0x0E, 0x05, 0x80, 0x29, 0x19, 0x44, 0xAC, 0x4B, 0x9C, 0x05,
+    0x00, 0x66, 0x44, 0x9B, 0x47, 0xD9, 0x68, 0x04, 0x00, 0x44, 0x80, 0x3E, 0x83, 0xE2, 0xB1, 0x29,
+    0x00, 0x04, 0xDA, 0xB8, 0xE1, 0xD8, 0xE2, 0x08, 0x00, 0x88, 0x26, 0x01, 0xAA, 0x81, 0x22, 0x57,
+    0x00, 0x70, 0x48, 0xB3, 0x65, 0xB3, 0x88, 0x1B, 0x00, 0xE0, 0x91, 0xC6, 0x91, 0x8A, 0x15, 0xA7,
+    0x00, 0x80, 0x0E, 0x48, 0xD6, 0xC9, 0x2C, 0xFE, 0x20, 0x80, 0x68, 0x95, 0x28, 0x20, 0x31, 0xCA,
+    0x01, 0x80, 0xC1, 0x38, 0x44, 0x39, 0x52, 0xA4, 0x02, 0x00, 0xCC, 0x68, 0xD6, 0x72, 0x58, 0x11,
+    0x13, 0x00, 0xC0, 0x21, 0x61, 0x15, 0x99, 0xE1, 0x0C, 0x00, 0x18, 0xB0, 0xF9, 0x9C, 0x79, 0x48,
+    0x92, 0x00, 0x20, 0x46, 0x13, 0x07, 0xE3, 0x8C, 0x2B, 0x00, 0x80, 0x0E, 0x28, 0x74, 0x47, 0x20,
+    0x3F, 0x00, 0x02, 0x80, 0x53, 0xED, 0x8B, 0x4D, 0x42, 0x03, 0x80, 0x07, 0x1D, 0xBC, 0x92, 0x7B,
+    0xC4, 0x01, 0x04, 0x68, 0x34, 0x70, 0x3B, 0xB1, 0x68, 0x11, 0x00, 0x12, 0x6C, 0xF4, 0x54, 0xDA,
+    0xF1, 0x24, 0x10, 0xE8, 0xD9, 0x44, 0xE2, 0xC4, 0x63, 0x2F, 0x02, 0x30, 0xD3, 0x61, 0x3A, 0x89,
+    0x44, 0xA0, 0x00, 0x20, 0x66, 0xA2, 0xA7, 0xF2, 0x8E, 0x22, 0x00, 0x40, 0x15, 0xEC, 0x70, 0x6E,
+    0x8D, 0x34, 0x00, 0x00, 0x1C, 0xCD, 0xD0, 0x13, 0x0E, 0xFA, 0x02, 0x80, 0x12, 0x10, 0xAA, 0x99,
+    0x41, 0x2C, 0x02, 0x04, 0x08, 0x3E, 0x80, 0x33, 0xE0, 0x58, 0x0A, 0x00, 0xD7, 0x6C, 0xAE, 0x3E,
+    0x92, 0xB1, 0x07, 0x00, 0x9C, 0xD0, 0x1C, 0x8A, 0x64, 0x64, 0x12, 0x00, 0x68, 0x83, 0x58, 0x9A,
+    0x71, 0xC3, 0xA5, 0x00, 0x00, 0x8D, 0x82, 0xF7, 0x33, 0x8B, 0xC9, 0x00, 0xA0, 0x10, 0x86, 0x8A,
+    0x64, 0x16, 0x83, 0x01, 0x00, 0x1C, 0xCD, 0x93, 0x8A, 0x23, 0x12, 0x03, 0x20, 0x2B, 0xA4, 0x1E,
+    0x1A, 0x26, 0x6C, 0x05, 0x00, 0x6B, 0x24, 0x53, 0x35, 0x7C, 0xE8, 0x01, 0x00, 0xB0, 0x78, 0xFA,
+    0xA2, 0x1C, 0x51, 0x02, 0x00, 0xA1, 0xD1, 0x8C, 0xD9, 0x88, 0xE2, 0x12, 0x02, 0x48, 0x51, 0x11,
+    0x44, 0x09, 0xC8, 0x56, 0x00, 0xF0, 0xE7, 0x42, 0x05, 0xB3, 0x88, 0x3D, 0x01, 0x00, 0x10, 0x45,
+    0x8E, 0x87, 0x15, 0x2D, 0x00, 0x80, 0x9F, 0x11, 0xD5, 0xCD, 0x1E, 0x2E, 0x21, 0x04, 0x33, 0x95,
+    0xB0, 0x90, 0x6C, 0x3C, 0x05, 0x00, 0x74, 0x34, 0x5B, 0x34, 0x91, 0x78, 0x0C, 0x00, 0x7A, 0x44,
+    0x40, 0x71, 0x0C, 0xF2, 0x15, 0x04, 0x04, 0xD8, 0xE8, 0x9D, 0xDC, 0xA3, 0x26, 0x00, 0x68, 0xC3,
+    0x51, 0xEC, 0xB9, 0x46, 0x28, 0x00, 0xD0, 0x26, 0xF1, 0x55, 0x92, 0x8C, 0xB0, 0x01, 0xA0, 0xC0,
+    0xE5, 0x2C, 0x64, 0x1C, 0x45, 0x00, 0x40, 0x1D, 0x4D, 0x1B, 0x4D, 0x2F, 0x2A, 0x01, 0x80, 0x48,
+    0x9A, 0xAB, 0x90, 0x61, 0x3C, 0x0A, 0x00, 0x32, 0x3A, 0xC2, 0x4B, 0x01, 0xC9, 0x11, 0x00, 0xFE,
+    0x68, 0x58, 0xD9, 0x5A, 0xB1, 0x44, 0x00, 0x5C, 0xD2, 0x7C, 0x2E, 0x5D, 0xA3, 0x11, 0x00, 0x10,
+    0x83, 0xF1, 0x82, 0x39, 0x45, 0x12, 0x00, 0x80, 0x26, 0xF3, 0x95, 0xE3, 0x88, 0xC8, 0x00, 0xC0,
+    0x8C, 0xC4, 0x8B, 0xC4, 0x18, 0x79, 0x01, 0x00, 0x8A, 0x0C, 0xDB, 0x8E, 0x2A, 0x72, 0x00, 0x00,
+    0x5A, 0x1C, 0x2A, 0xA3, 0x30, 0x7A, 0x05, 0x01, 0x01, 0x36, 0x85, 0x24, 0x0D, 0xF9, 0x00, 0x08,
+    0xB0, 0x48, 0xD2, 0x74, 0x4E, 0xF1, 0x07, 0x00, 0xA8, 0xC1, 0xC8, 0xDD, 0xFC, 0x22, 0x29, 0x00,
+    0xB8, 0xB3, 0x51, 0x52, 0x01, 0x44, 0x5B, 0x00, 0x80, 0xEC, 0xC1, 0x82, 0x61, 0x45, 0x4D, 0x81,
+    0x40, 0xD0, 0x45, 0x50, 0x87, 0x1A, 0x5D, 0x80, 0x81, 0x82, 0xCD, 0xDC, 0x0B, 0x35, 0x12, 0x01,
+    0x00, 0x2D, 0x1B, 0xAE, 0x91, 0x64, 0x14, 0x01, 0x80, 0x6B, 0x34, 0x7F, 0x39, 0xD2, 0x08, 0x14,
+    0x00, 0x0E, 0x60, 0xD6, 0x64, 0x80, 0x31, 0x09, 0x00, 0x14, 0x00, 0x19, 0xE3, 0xC8, 0xE4, 0x0A,
+    0x00, 0x58, 0xA0, 0x79, 0x34, 0x72, 0xC6, 0x22, 0x00, 0x80, 0xC6, 0x83, 0x26, 0xA4, 0x88, 0x28,
+    0x01, 0x80, 0x8D, 0xE6, 0xEE, 0x45, 0x1B, 0x4D, 0x03, 0x40, 0x1D, 0x8D, 0xE1, 0xCC, 0x3A, 0x16,
+    0x03, 0xA0, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0xEC, 0x01, 0x00, 0x23, 0x24, 0x66, 0x3A, 0x9C, 0x68,
+    0x0A, 0x00, 0xF1, 0x7C, 0xC6, 0x6E, 0x3C, 0x51, 0x18, 0x00, 0xA8, 0xD1, 0xEC, 0xC4, 0x34, 0xA1,
+    0x2A, 0x00, 0x0A, 0xB0, 0x19, 0x34, 0x49, 0x48, 0x11, 0x00, 0x54, 0x41, 0x23, 0x36, 0xA3, 0x8A,
+    0x2C, 0x00, 0xC0, 0x4C, 0x4A, 0x4F, 0xE9, 0x12, 0x5F, 0x01, 0xC0, 0xAF, 0x4A, 0x5A, 0x0A, 0x35,
+    0xA5, 0x00, 0x00, 0x41, 0x9A, 0xA8, 0x9B, 0x3A, 0x9C, 0x01, 0x00, 0x81, 0x34, 0x43, 0x27, 0x75,
+    0xD8, 0x0A, 0x00, 0x74, 0x90, 0xD8, 0x86, 0x1C, 0x91, 0x12, 0x00, 0x50, 0x20, 0x95, 0xE5, 0x78,
+    0x22, 0x4A, 0x00, 0x60, 0xB0, 0x89, 0xE4, 0x39, 0x47, 0x62, 0x00, 0x80, 0x06, 0xD2, 0x24, 0x22,
+    0x8A, 0xA0, 0x00, 0xC0, 0x4A, 0xC9, 0xE7, 0x82, 0x12, 0x83, 0x00, 0xC0, 0x1C, 0xCC, 0xD7, 0x0D,
+    0x25, 0xCE, 0x02, 0x00, 0x31, 0x98, 0x28, 0x12, 0x55, 0xD4, 0x05, 0x00, 0x58, 0x26, 0x51, 0x28,
+    0x9C, 0x98, 0x0A, 0x00, 0x84, 0x64, 0x5E, 0x62, 0x70, 0xB0, 0x03, 0x04, 0x34, 0x0A, 0x09, 0xD5,
+    0x58, 0x61, 0x0B, 0x00, 0x10, 0x72, 0x11, 0x6B, 0xD9, 0x45, 0x61, 0x00, 0x80, 0x47, 0xE3, 0xA4,
+    0x31, 0x8C, 0x50, 0x00, 0x80, 0x53, 0x05, 0x4E, 0xC6, 0x98, 0x90, 0x00, 0x00, 0x20, 0x4E, 0x14,
+    0x0D, 0x1F, 0x2A, 0x01, 0x80, 0x3D, 0x9A, 0xB0, 0x9B, 0x4C, 0x74, 0x06, 0x80, 0x7B, 0x30, 0x53,
+    0x35, 0x7E, 0x68, 0x04, 0x00, 0xE6, 0x4C, 0xCC, 0x7A, 0x22, 0x91, 0x28, 0x28, 0xE0, 0xC9, 0x50,
+    0x76, 0x91, 0xE2, 0x15, 0x00, 0xE0, 0x43, 0x01, 0xE2, 0x31, 0xC2, 0x0B, 0x00, 0x10, 0x0C, 0x61,
+    0x37, 0x44, 0x4A, 0x2C, 0x00, 0xE0, 0x41, 0xA9, 0x33, 0x46, 0x22, 0x4F, 0x00, 0xC0, 0x00, 0xCE,
+    0x6D, 0x0B, 0x4E, 0x06, 0x01, 0x80, 0x44, 0x9B, 0x28, 0x0E, 0x62, 0x34, 0x01, 0x00, 0x05, 0x26,
+    0x83, 0x3C, 0xCE, 0x08, 0x03, 0x00, 0xCC, 0x74, 0x94, 0x64, 0xDC, 0x10, 0x29, 0x20, 0x10, 0x38,
+    0x79, 0x9F, 0x50, 0xE5, 0x53, 0x00, 0x08, 0xA6, 0xD9, 0x8B, 0xF1, 0xC6, 0x14, 0x00, 0x60, 0xA7,
+    0x62, 0xA8, 0xB3, 0x8D, 0xC9, 0x00, 0xE0, 0x86, 0xE6, 0x2C, 0x87, 0x14, 0x59, 0x00, 0xC2, 0x37,
+    0x88, 0x83, 0x8A, 0x85, 0xF4, 0x02, 0x08, 0x3E, 0x10, 0x9F, 0x9B, 0x25, 0x14, 0x01, 0x00, 0x70,
+    0x36, 0x77, 0x46, 0xA2, 0xB8, 0x09, 0x00, 0xC4, 0x3C, 0xAC, 0x4A, 0x66, 0xF1, 0x57, 0x00, 0xBC,
+    0xD9, 0xB4, 0xA4, 0xF0, 0xA0, 0x0A, 0x08, 0x50, 0xA5, 0x79, 0xF2, 0xE2, 0xC1, 0x17, 0x02, 0x30,
+    0xE0, 0x03, 0xDB, 0x94, 0x8E, 0x3B, 0x01, 0x20, 0x40, 0x86, 0x4D, 0x85, 0x1A, 0x5F, 0x01, 0x00,
+    0x1B, 0x8D, 0x5E, 0x4D, 0x34, 0x6E, 0x03, 0x80, 0x31, 0x1A, 0xB1, 0x96, 0x5D, 0x5C, 0x09, 0x00,
+    0x0B, 0x34, 0x7D, 0x29, 0xF7, 0xE8, 0x03, 0x08, 0xE6, 0x70, 0xB4, 0x54, 0x5A, 0x91, 0x19, 0x01,
+    0x68, 0x08, 0x70, 0x44, 0xD4, 0x60, 0x05, 0x00, 0xB8, 0x93, 0x0A, 0x3D, 0x23, 0xC5, 0x60, 0x00,
+    0xF0, 0x43, 0x43, 0x26, 0x13, 0x8B, 0x40, 0x09, 0x00, 0x83, 0x44, 0x27, 0x65, 0x0B, 0x39, 0x00,
+    0x90, 0x9A, 0x8E, 0x1D, 0x10, 0x2B, 0x26, 0x01, 0x00, 0x35, 0x1A, 0xA3, 0x1B, 0x30, 0x74, 0x00,
+    0x08, 0x05, 0x82, 0xE4, 0x3C, 0x48, 0x49, 0x04, 0x00, 0xEE, 0xA8, 0xD4, 0x6E, 0x5C, 0xF1, 0x18,
+    0x08, 0xE8, 0xD1, 0x90, 0xB1, 0x04, 0xA3, 0x0E, 0x20, 0x60, 0xC6, 0xE9, 0xF1, 0xF9, 0x11, 0x18,
+    0x00, 0x00, 0xE7, 0x42, 0x97, 0x03, 0x8C, 0x31, 0x01, 0x40, 0xCD, 0x66, 0x92, 0xC7, 0x1C, 0x91,
+    0x01, 0x80, 0x07, 0x03, 0x1D, 0x4F, 0x2C, 0x26, 0x03, 0x00, 0x05, 0x13, 0xA3, 0x91, 0x43, 0xF4,
+    0x09, 0x00, 0x31, 0x34, 0x69, 0x2E, 0xC8, 0x98, 0x21, 0x01, 0xE6, 0xC0, 0x32, 0x15, 0xC1, 0x30,
+    0x0A, 0x00, 0x18, 0x38, 0x19, 0xFA, 0x40, 0xA3, 0x2D, 0x00, 0xF2, 0xD3, 0x29, 0xC3, 0x11, 0xC5,
+    0x0F, 0x00, 0x18, 0xC6, 0xE3, 0x97, 0x13, 0x8D, 0x2A, 0x00, 0x80, 0x08, 0xC6, 0x8C, 0xE7, 0x12,
+    0x3F, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0xA2, 0x00, 0x00, 0x02, 0x23, 0x45, 0x1E, 0x6D,
+    0xAC, 0x00, 0x00, 0x83, 0x3C, 0x92, 0x4D, 0xC1, 0x48, 0x0A, 0x00, 0xEE, 0x68, 0xB2, 0x6E, 0x06,
+    0xB1, 0x1A, 0x00, 0x64, 0xF0, 0xF0, 0xF1, 0x0C, 0x63, 0x06, 0x00, 0x30, 0x66, 0x81, 0x4A, 0xB9,
+    0x24, 0x1F, 0x00, 0xF0, 0x46, 0xA2, 0x76, 0xE3, 0x8A, 0x46, 0x00, 0x40, 0x10, 0xC6, 0xED, 0xA6,
+    0x16, 0x39, 0x20, 0x40, 0x9E, 0x4D, 0xDE, 0x17, 0x1C, 0xEA, 0x06, 0x80, 0x01, 0x9B, 0xC2, 0x17,
+    0x7B, 0xB4, 0x01, 0x00, 0x0B, 0x34, 0x94, 0x24, 0x24, 0x99, 0x04, 0x00, 0xBA, 0x80, 0xE6, 0x78,
+    0x66, 0x91, 0x07, 0x20, 0xF8, 0x4B, 0x28, 0x3C, 0x3D, 0x48, 0x47, 0x00, 0x10, 0xC0, 0x79, 0x36,
+    0xDA, 0xC8, 0x25, 0x00, 0x50, 0x47, 0x53, 0x96, 0xE3, 0x89, 0xB0, 0x00, 0x40, 0x4C, 0xE6, 0x4B,
+    0x86, 0x14, 0x63, 0x00, 0x80, 0x00, 0x14, 0x31, 0xCE, 0x4B, 0x06, 0x04, 0x82, 0x43, 0x9A, 0x4B,
+    0x9E, 0x79, 0x24, 0x01, 0x00, 0x7A, 0x3E, 0x5A, 0x36, 0x8B, 0xD8, 0x03, 0x00, 0x1A, 0x3D, 0xA4,
+    0x3E, 0x7C, 0xB1, 0x37, 0x00, 0x84, 0xEA, 0x8C, 0xB1, 0x00, 0x23, 0x26, 0x00, 0x70, 0xA3, 0xF9,
+    0x72, 0x69, 0x45, 0x0A, 0x00, 0x90, 0x66, 0x83, 0x26, 0xB3, 0x8B, 0x4B, 0x80, 0x80, 0x4E, 0x24,
+    0x2A, 0xE5, 0x12, 0x31, 0x01, 0x40, 0x1E, 0x90, 0x9F, 0xCF, 0x30, 0x0E, 0x01, 0x00, 0x3D, 0x9D,
+    0xB1, 0x17, 0x5B, 0xDC, 0x49, 0x40, 0x14, 0x64, 0x88, 0x76, 0x68, 0x58, 0x04, 0x00, 0xFA, 0x68,
+    0xB6, 0x74, 0x04, 0x71, 0x24, 0x00, 0x64, 0x00, 0xA5, 0xD5, 0xCC, 0x62, 0x12, 0x00, 0x50, 0x43,
+    0x99, 0x83, 0x91, 0xC6, 0x28, 0x00, 0xE8, 0xE6, 0x02, 0x79, 0x94, 0x8C, 0x39, 0x00, 0xA0, 0x8F,
+    0x83, 0xAF, 0x07, 0x18, 0x61, 0x05, 0x80, 0x07, 0x4D, 0x26, 0x12, 0x35, 0x52, 0x02, 0x00, 0x3C,
+    0x8F, 0x39, 0x16, 0x6D, 0x9C, 0x09, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE, 0x78, 0x05, 0x00, 0xDE,
+    0x6C, 0xD4, 0x6E, 0x5C, 0x11, 0x26, 0x00, 0x08, 0xF9, 0xC8, 0xE5, 0xEC, 0x62, 0x45, 0x20, 0xF8,
+    0x50, 0x79, 0xE4, 0x19, 0xC7, 0x97, 0x00, 0x80, 0x42, 0x03, 0x69, 0x63, 0x8F, 0x94, 0x00, 0x00,
+    0x0D, 0x88, 0xEC, 0x26, 0x14, 0x59, 0x00, 0xC0, 0x1B, 0x92, 0xE6, 0x8E, 0x3E, 0x12, 0x03, 0x80,
+    0x38, 0x13, 0xB4, 0x16, 0x64, 0xAC, 0x02, 0x00, 0x3F, 0x38, 0x9C, 0x36, 0x05, 0x39, 0x01, 0x01,
+    0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0xB1, 0x17, 0x00, 0xA0, 0xA1, 0x5C, 0x95, 0xCC, 0xE2, 0x10, 0x00,
+    0x80, 0x43, 0x0A, 0x34, 0x8A, 0xC5, 0x29, 0x04, 0x70, 0x67, 0x23, 0x57, 0x33, 0x8C, 0x48, 0x01,
+    0xE8, 0xCD, 0x49, 0xED, 0xC6, 0x15, 0x8D, 0x00, 0x00, 0x21, 0x13, 0x9A, 0x0F, 0x25, 0xEE, 0x02,
+    0xC0, 0x36, 0x13, 0x3A, 0x90, 0x7F, 0xDC, 0x80, 0x00, 0x0F, 0x56, 0x8C, 0x7C, 0x66, 0xE8, 0x02,
+    0x00, 0x0C, 0xA4, 0x02, 0x15, 0x98, 0x12, 0x38, 0x00, 0xB8, 0x91, 0xC4, 0xD5, 0x0C, 0xA3, 0x43,
+    0x20, 0xA8, 0xF0, 0xD1, 0x8B, 0xD1, 0x46, 0xC9, 0x40, 0x40, 0x4C, 0x54, 0x47, 0xB3, 0x8C, 0xA0,
+    0x00, 0x20, 0x48, 0x24, 0xE8, 0x63, 0x10, 0x51, 0x00, 0x80, 0x24, 0xC9, 0xCC, 0x49, 0x12, 0xEE,
+    0x00, 0x00, 0x56, 0x97, 0xB4, 0x9E, 0x4C, 0x52, 0x05, 0x00, 0x14, 0x26, 0x65, 0x23, 0xDA, 0xC8,
+    0x04, 0x00, 0xF4, 0x68, 0xBA, 0x6E, 0x16, 0x51, 0x07, 0x00, 0x3C, 0x00, 0x41, 0x8D, 0x9C, 0xE2,
+    0x0D, 0x00, 0x08, 0x36, 0x61, 0x64, 0xC2, 0xA5, 0x53, 0x00, 0x60, 0x69, 0x73, 0x85, 0xA2, 0x8A,
+    0x1B, 0x00, 0xE1, 0x01, 0xAF, 0xF3, 0xCD, 0x11, 0x8F, 0x00, 0xA0, 0x99, 0x8F, 0x9D, 0xD0, 0x29,
+    0xC6, 0x00, 0xA0, 0x4C, 0x1B, 0x73, 0xC7, 0x58, 0xBC, 0x00, 0x00, 0x72, 0x36, 0x65, 0x45, 0x7C,
+    0x88, 0x0B, 0x00, 0x9C, 0x5C, 0x8A, 0x48, 0x04, 0xD1, 0x09, 0x00, 0xB8, 0x89, 0x70, 0xED, 0x08,
+    0x62, 0x10, 0x00, 0x70, 0x13, 0xAA, 0xE3, 0xB1, 0x45, 0x28, 0x00, 0x40, 0x49, 0x23, 0x86, 0x91,
+    0x8F, 0x25, 0x00, 0x30, 0xCE, 0x47, 0xCB, 0x46, 0x11, 0xB3, 0x00, 0xC0, 0x9D, 0xCB, 0x13, 0x0F,
+    0x1A, 0xDA, 0x00, 0x81, 0x03, 0x38, 0x69, 0x15, 0xA6, 0x74, 0x05, 0x00, 0x6C, 0x38, 0x49, 0x36,
+    0x66, 0xC8, 0x09, 0x00, 0x9B, 0x5C, 0x94, 0x54, 0x00, 0x71, 0x57, 0x00, 0xDC, 0x11, 0x0D, 0x09,
+    0x11, 0xA1, 0x2A, 0x20, 0x20, 0xB0, 0x49, 0xDC, 0xF1, 0x46, 0x62, 0x00, 0x52, 0x47, 0x03, 0xC6,
+    0x33, 0x88, 0x25, 0x01, 0xE0, 0xC0, 0xE7, 0xA3, 0x24, 0x05, 0x17, 0x01, 0x00, 0x89, 0x4E, 0x27,
+    0x93, 0x34, 0x6A, 0x40, 0x04, 0x01, 0x1A, 0xB2, 0x25, 0x37, 0x6C, 0x05, 0x00, 0x76, 0x3A, 0x8B,
+    0x30, 0xFA, 0x88, 0x12, 0x08, 0x1A, 0x70, 0x9A, 0x3E, 0x5A, 0xB1, 0x18, 0x00, 0xD0, 0x91, 0x44,
+    0xA9, 0x50, 0xE2, 0x43, 0x20, 0xC0, 0x96, 0x79, 0xBA, 0x81, 0xC3, 0x60, 0x00, 0x20, 0x46, 0xF3,
+    0x75, 0x42, 0x8C, 0x4C, 0x00, 0xC0, 0x8D, 0x06, 0xED, 0x86, 0x15, 0xA5, 0x00, 0x00, 0x1B, 0x85,
+    0x58, 0x88, 0x36, 0xF6, 0x02, 0x00, 0x1E, 0x19, 0xB1, 0x99, 0x53, 0x8C, 0x04, 0x00, 0xEF, 0x2C,
+    0x43, 0x2E, 0x66, 0xE4, 0x01, 0x00, 0x14, 0x68, 0x2A, 0x2F, 0x86, 0x72, 0x28, 0x00, 0xC0, 0xD9,
+    0x8C, 0x7E, 0xED, 0x22, 0x11, 0x00, 0x40, 0xB3, 0xC9, 0xD2, 0xF1, 0xC3, 0x1F, 0x00, 0xB0, 0x68,
+    0x72, 0xB5, 0x22, 0x8A, 0x42, 0x00, 0x60, 0x82, 0x64, 0x6B, 0x85, 0x15, 0x6F, 0x00, 0x41, 0x1B,
+    0x0C, 0x60, 0xD1, 0x2C, 0x22, 0x02, 0x80, 0x3D, 0xAF, 0xA9, 0x20, 0x32, 0x2C, 0x02, 0x04, 0x03,
+    0x24, 0x9A, 0x34, 0x07, 0xB9, 0x0B, 0x00, 0x98, 0x64, 0x7E, 0x40, 0xF8, 0xB0, 0x07, 0x00, 0x24,
+    0xBA, 0xE0, 0xDD, 0x24, 0x63, 0x10, 0x00, 0x68, 0x01, 0x09, 0x94, 0x31, 0xC7, 0x0D, 0x00, 0x50,
+    0xC8, 0xA1, 0xE7, 0xB3, 0x8B, 0xBF, 0x00, 0x00, 0xCF, 0xA6, 0xC9, 0xC5, 0x0F, 0x85, 0x01, 0xC0,
+    0x93, 0xC7, 0xE2, 0x8B, 0x3F, 0x0E, 0x01, 0x81, 0x25, 0x9A, 0x2C, 0x1D, 0x3F, 0x0C, 0x01, 0x00,
+    0x6D, 0x3C, 0x4B, 0x2C, 0x7E, 0xD8, 0x0B, 0x00, 0xDA, 0x74, 0xA8, 0x78, 0xE6, 0xB0, 0x06, 0x20,
+    0x08, 0x90, 0x85, 0xE7, 0x28, 0xA5, 0x32, 0x00, 0xD8, 0x43, 0x99, 0x1A, 0x99, 0x45, 0x13, 0x00,
+    0xC0, 0xA9, 0x72, 0x78, 0x75, 0x49, 0xA2, 0x08, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x91, 0x04,
+    0xC0, 0x9B, 0x0D, 0x51, 0x8E, 0x14, 0x9E, 0x00, 0x80, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0x2C, 0x09,
+    0x00, 0x19, 0x48, 0x79, 0x34, 0xD2, 0x18, 0x04, 0x00, 0x04, 0x68, 0x3A, 0x75, 0xFE, 0x91, 0x17,
+    0x11, 0xE4, 0xD9, 0x44, 0xF5, 0x98, 0x21, 0x09, 0x40, 0xE8, 0xA3, 0x11, 0xEC, 0x49, 0x46, 0x64,
+    0x80, 0xF4, 0x66, 0x44, 0x67, 0x44, 0x89, 0x38, 0x02, 0xA0, 0x8E, 0x86, 0x90, 0x65, 0x1F, 0x45,
+    0x00, 0x00, 0xA0, 0x1A, 0xEA, 0x4A, 0x4B, 0x06, 0x01, 0x00, 0x44, 0x9A, 0xAE, 0x16, 0x56, 0x64,
+    0x02, 0x00, 0x62, 0x48, 0x5E, 0x3A, 0x8A, 0xC8, 0x01, 0x00, 0xB0, 0x60, 0x8A, 0x4E, 0xF8, 0x70,
+    0x15, 0x00, 0xD8, 0xB9, 0xC4, 0xE1, 0xEC, 0xA2, 0x06, 0x00, 0x00, 0x84, 0x79, 0xBA, 0x79, 0xC3,
+    0x12, 0x80, 0xC0, 0x66, 0x15, 0x08, 0xE6, 0x87, 0x41, 0x08, 0x40, 0x8F, 0x68, 0xCC, 0x28, 0x0F,
+    0x71, 0x00, 0x84, 0x1B, 0xC7, 0x9A, 0x4D, 0x2C, 0xC2, 0x02, 0x40, 0x28, 0x1C, 0xBC, 0x9D, 0x61,
+    0x5C, 0x02, 0x00, 0xA2, 0x38, 0x9C, 0x49, 0xD6, 0x58, 0x05, 0x00, 0x72, 0x54, 0xCA, 0x52, 0x98,
+    0x11, 0x17, 0x00, 0xD0, 0xD1, 0xF4, 0xE1, 0x44, 0xA3, 0x25, 0x00, 0x20, 0x80, 0x29, 0x4B, 0x61,
+    0xC6, 0x0C, 0x00, 0xE0, 0x06, 0x35, 0x37, 0x75, 0x87, 0xAF, 0x02, 0x40, 0x41, 0x64, 0x09, 0xC7,
+    0x0C, 0x41, 0x00, 0x40, 0x9F, 0x0B, 0xD6, 0x4D, 0x20, 0x8A, 0x00, 0x40, 0x37, 0x18, 0xC3, 0x97,
+    0x7D, 0x2C, 0x06, 0x10, 0x81, 0x22, 0x3F, 0x30, 0x58, 0xA8, 0x09, 0x00, 0xC2, 0x84, 0x28, 0x87,
+    0xB4, 0x31, 0x02, 0x00, 0xE0, 0xB2, 0x64, 0xAD, 0xA8, 0x12, 0x0B, 0x00, 0x58, 0x43, 0xC9, 0xE3,
+    0xF1, 0xC5, 0x59, 0x00, 0x10, 0x40, 0x64, 0x77, 0xF2, 0x8E, 0xBE, 0x01, 0xC0, 0x4E, 0x26, 0x6C,
+    0xE6, 0x14, 0x77, 0x00, 0xC0, 0x9B, 0x89, 0xDA, 0x8D, 0x2B, 0x2A, 0x01, 0x80, 0x4A, 0x1A, 0x3D,
+    0xA3, 0x53, 0xF4, 0x01, 0x00, 0x6F, 0x36, 0x54, 0x39, 0x77, 0xC8, 0x0B, 0x00, 0xB0, 0x4C, 0x9E,
+    0x2A, 0xAC, 0x51, 0x17, 0x00, 0xAC, 0x01, 0x75, 0x3E, 0x39, 0x23, 0x08, 0x40, 0x48, 0xC0, 0x2A,
+    0xAE, 0xB9, 0xC9, 0x0F, 0x00, 0xE0, 0xE6, 0x62, 0x85, 0xA2, 0x8A, 0x25, 0x04, 0x20, 0xD1, 0x67,
+    0xD0, 0xAC, 0x0E, 0x89, 0x03, 0x40, 0x9A, 0xC9, 0x10, 0xC7, 0x25, 0xD6, 0x00, 0x80, 0x3D, 0x8B,
+    0x15, 0x09, 0x32, 0xE4, 0x05, 0x00, 0x0F, 0x90, 0x74, 0x3C, 0xB8, 0xD8, 0x04, 0x08, 0xC0, 0x59,
+    0x96, 0x74, 0xC8, 0x88, 0x18, 0x10, 0x78, 0xD9, 0x88, 0xE1, 0x64, 0x22, 0x48, 0x00, 0xA8, 0x03,
+    0xB2, 0xAD, 0x0A, 0x47, 0xDB, 0x00, 0xD0, 0x68, 0x43, 0x97, 0xE3, 0x8B, 0x28, 0x14, 0x01, 0x80,
+    0x2B, 0xF9, 0x6E, 0x18, 0x95, 0x02, 0x80, 0x8C, 0xC4, 0x64, 0x0E, 0x3D, 0x5A, 0x01, 0x80, 0x02,
+    0x19, 0x24, 0x09, 0x66, 0x7C, 0x00, 0x0C, 0x1E, 0x26, 0x5F, 0x25, 0xC9, 0x28, 0x02, 0x00, 0xF6,
+    0x48, 0xAC, 0x60, 0x22, 0x91, 0x18, 0x00, 0xA0, 0xE8, 0xC4, 0xA9, 0x6C, 0x63, 0x09, 0x02, 0x68,
+    0xA3, 0x31, 0xAA, 0xF0, 0x45, 0x13, 0x00, 0x60, 0x4E, 0x50, 0xE0, 0x92, 0x20, 0x97, 0x00, 0x30,
+    0xCD, 0x44, 0x8B, 0x64, 0x18, 0x7F, 0x01, 0x80, 0x15, 0xCD, 0xE1, 0x4C, 0x3B, 0x16, 0x05, 0x00,
+    0x01, 0x1A, 0xB0, 0x90, 0x6B, 0x54, 0x02, 0x40, 0x02, 0x3A, 0x66, 0x29, 0xCC, 0x18, 0x04, 0x00,
+    0xE0, 0x5C, 0x9A, 0x5E, 0xFC, 0x30, 0x07, 0x00, 0xE4, 0xB2, 0x7C, 0x09, 0xDD, 0x11, 0x08, 0x00,
+    0xDC, 0x93, 0xE9, 0x61, 0xD9, 0x42, 0x9F, 0x01, 0x20, 0xA0, 0x33, 0xBB, 0x83, 0x91, 0x4B, 0x10,
+    0xC0, 0x05, 0xE9, 0x10, 0x2D, 0x0F, 0x63, 0x00, 0x80, 0xA1, 0xCA, 0x8F, 0x0B, 0x18, 0x2A, 0x01,
+    0x48, 0x34, 0x91, 0x2C, 0x1D, 0x3F, 0xCC, 0x04, 0x00, 0x6E, 0x40, 0x5B, 0x38, 0x6C, 0x38, 0x01,
+    0x00, 0xEA, 0x68, 0xDA, 0x68, 0x7A, 0xB1, 0x05, 0x00, 0x10, 0xD2, 0x24, 0xBD, 0xCC, 0x61, 0x44,
+    0x00, 0xD0, 0xA3, 0x11, 0x14, 0x3A, 0xC5, 0x27, 0x01, 0xD0, 0x66, 0x60, 0x45, 0x60, 0x93, 0x33,
+    0x00, 0xA0, 0x0D, 0x27, 0x6C, 0xC7, 0x11, 0x2D, 0x00, 0x00, 0x8A, 0x8D, 0x22, 0x92, 0x2F, 0xC6,
+    0x00, 0x04, 0x34, 0x1A, 0x27, 0x9A, 0x3A, 0x8C, 0x01, 0x08, 0x6F, 0x42, 0x6A, 0x37, 0xAE, 0x38,
+    0x01, 0x00, 0xDC, 0x84, 0xE8, 0x90, 0x1C, 0x51, 0x09, 0x10, 0x44, 0xCB, 0x48, 0x01, 0x91, 0xD1,
+    0x09, 0x00, 0x78, 0x93, 0xE9, 0xA2, 0xC9, 0xC4, 0x50, 0x00, 0xA0, 0xC1, 0x21, 0xD3, 0x02, 0x84,
+    0x3D, 0x88, 0x20, 0xCE, 0xC6, 0x09, 0x87, 0x0D, 0xAD, 0x00, 0xC0, 0x26, 0xC4, 0xCC, 0x05, 0x1C,
+    0x2A, 0x05, 0x82, 0x3D, 0x13, 0x2D, 0x94, 0x59, 0xDC, 0x04, 0x00, 0x75, 0x34, 0x6D, 0x34, 0xBD,
+    0x58, 0x03, 0x10, 0x08, 0x74, 0xDE, 0x62, 0x90, 0xD1, 0x07, 0x04, 0xAC, 0xE8, 0xD8, 0x19, 0x65,
+    0xA2, 0x2B, 0x00, 0xA0, 0x00, 0xA2, 0x32, 0x02, 0xC3, 0x4D, 0x04, 0x90, 0x66, 0x31, 0xB4, 0x91,
+    0x89, 0x29, 0x00, 0xA4, 0x8E, 0x46, 0x6B, 0xC6, 0x11, 0x45, 0x00, 0x48, 0x06, 0x4F, 0xD7, 0x4C,
+    0x26, 0x86, 0x02, 0x80, 0x2F, 0x1F, 0xA5, 0x8F, 0x53, 0x2C, 0x01, 0x80, 0x70, 0x3E, 0x59, 0x49,
+    0x60, 0xC8, 0x01, 0x00, 0xE8, 0x68, 0xF2, 0x7E, 0x66, 0xF1, 0x35, 0x00, 0xBC, 0xD9, 0x28, 0x11,
+    0x35, 0x21, 0x52, 0x00, 0x08, 0x44, 0x31, 0x3B, 0x91, 0x46, 0x16, 0x80, 0xF0, 0x40, 0x97, 0x0D,
+    0xD3, 0x94, 0x8D, 0x00, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x75, 0x01, 0x80, 0x1A, 0x50, 0x57,
+    0x91, 0x1B, 0x8E, 0x00, 0x00, 0x35, 0x11, 0xB0, 0x18, 0x55, 0x6C, 0x01, 0x00, 0x7C, 0x24, 0x9B,
+    0x33, 0x09, 0x99, 0x14, 0x04, 0x74, 0x4C, 0xE8, 0x4C, 0xDA, 0x31, 0x04, 0x00, 0x4E, 0xB9, 0xD8,
+    0x59, 0x7C, 0xA4, 0x0F, 0x00, 0x40, 0xC3, 0x11, 0xE4, 0x71, 0xC6, 0xA5, 0x80, 0xE0, 0x06, 0x43,
+    0x4B, 0x53, 0x92, 0xA3, 0x00, 0x21, 0x43, 0x86, 0x89, 0xE8, 0x09, 0x89, 0x00, 0xC0, 0x20, 0x0C,
+    0xCF, 0xCC, 0x13, 0x62, 0x02, 0xC0, 0x0C, 0x17, 0xBA, 0x94, 0x70, 0x34, 0x02, 0x00, 0x6E, 0x2E,
+    0x4E, 0x30, 0x7C, 0x68, 0x2B, 0x00, 0xEA, 0x68, 0x9C, 0x5A, 0x06, 0x91, 0x18, 0x00, 0x19, 0x7A,
+    0xBC, 0xB9, 0x40, 0xE3, 0xAC, 0x00, 0x78, 0xB3, 0xE1, 0xDA, 0xF8, 0x46, 0x13, 0x00, 0x70, 0x24,
+    0x53, 0xA7, 0xE3, 0x8B, 0x4F, 0x00, 0x01, 0xD1, 0xE3, 0xA8, 0x86, 0x0C, 0x81, 0x02, 0x80, 0xA8,
+    0x0C, 0x9A, 0x11, 0x20, 0x5E, 0x01, 0x80, 0x38, 0x11, 0xAE, 0x17, 0x52, 0xDC, 0x42, 0x00, 0xC1,
+    0x2A, 0x4B, 0x2C, 0x7E, 0x24, 0x84, 0x08, 0xC4, 0x64, 0xA8, 0x66, 0x04, 0xD1, 0x13, 0x00, 0xC8,
+    0xD1, 0x50, 0x95, 0xB4, 0x62, 0x07, 0x00, 0x00, 0xB4, 0x11, 0x93, 0x69, 0x45, 0x29, 0x00, 0x70,
+    0xE7, 0xB1, 0x86, 0x81, 0x90, 0xB3, 0x00, 0x00, 0x8F, 0x86, 0xCA, 0x25, 0x12, 0x3B, 0x01, 0x20,
+    0x1B, 0x0D, 0x28, 0xCF, 0x3F, 0x7E, 0x06, 0xC0, 0x3C, 0xA7, 0x45, 0x94, 0x86, 0x74, 0x04, 0x00,
+    0x6E, 0x32, 0x61, 0x3B, 0x8E, 0xE8, 0x14, 0x08, 0xF0, 0x0C, 0xA0, 0x66, 0xF2, 0x10, 0x19, 0x01,
+    0xD4, 0xD1, 0x34, 0xC9, 0xD4, 0x61, 0x08, 0x00, 0xD8, 0x56, 0xE1, 0x81, 0x81, 0x22, 0x17, 0x00,
+    0x92, 0xC7, 0x83, 0x25, 0xE3, 0x88, 0x40, 0x00, 0xA0, 0x90, 0x86, 0x2C, 0x66, 0x16, 0x7B, 0x00,
+    0xC0, 0x13, 0x4F, 0x98, 0x8E, 0x23, 0x42, 0x11, 0x80, 0x39, 0x15, 0xA6, 0x20, 0x2C, 0x64, 0x05,
+    0x00, 0x7E, 0x1E, 0x77, 0x32, 0xD4, 0x88, 0x84, 0x00, 0x32, 0x49, 0xCA, 0x7A, 0x1C, 0x91, 0x27,
+    0x00, 0x0C, 0xD0, 0x74, 0xEE, 0xF8, 0xA3, 0x09, 0x00, 0x88, 0x73, 0xF1, 0x5B, 0x99, 0xC7, 0x5C,
+    0x00, 0x21, 0x08, 0x54, 0x23, 0x03, 0x84, 0x42, 0x00, 0x01, 0x4F, 0xE7, 0x8C, 0x46, 0x16, 0x7B,
+    0x01, 0x80, 0x2B, 0x12, 0x9C, 0xCE, 0x2C, 0x35, 0x01, 0x80, 0x43, 0x1C, 0x2E, 0x21, 0x38, 0xD4,
+    0x09, 0x00, 0x1D, 0x34, 0x7F, 0x37, 0xD6, 0x08, 0x93, 0x00, 0x40, 0x4C, 0x0C, 0x79, 0xA8, 0xD1,
+    0x05, 0x00, 0x3C, 0xC8, 0xE0, 0xD1, 0x48, 0xE3, 0x71, 0x00, 0x68, 0x25, 0x49, 0xA3, 0xC1, 0xC5,
+    0xE2, 0x41, 0x90, 0x40, 0xF3, 0xA7, 0x11, 0x92, 0xBE, 0x00, 0xA0, 0xD6, 0xA3, 0xC9, 0x63, 0x96,
+    0x7C, 0x01, 0x60, 0x30, 0xC7, 0xD7, 0x08, 0x34, 0xA9, 0x00, 0x00, 0x36, 0x9A, 0xAD, 0x92, 0x60,
+    0xCC, 0x05, 0x00, 0x66, 0x34, 0x74, 0x38, 0xC1, 0x18, 0x02, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C,
+    0xB1, 0x08, 0x00, 0xC8, 0x48, 0x40, 0xB5, 0x28, 0x62, 0x0F, 0x00, 0xF8, 0x37, 0x30, 0x08, 0x32,
+    0x10, 0x18, 0x00, 0x50, 0x47, 0xD3, 0x46, 0xD3, 0x8B, 0x1A, 0x10, 0x41, 0x81, 0x72, 0x4A, 0x48,
+    0x0C, 0x51, 0x00, 0x80, 0x82, 0x09, 0x14, 0xC9, 0x29, 0x32, 0x01, 0x80, 0x2D, 0x1C, 0xC5, 0x9F,
+    0x68, 0xA4, 0x02, 0x00, 0x81, 0x36, 0x46, 0x1E, 0x99, 0xC8, 0x03, 0x00, 0xD8, 0x70, 0xD6, 0x6C,
+    0x66, 0x31, 0x24, 0x00, 0xA5, 0xA1, 0x40, 0xD1, 0xE0, 0xE1, 0x06, 0x00, 0xC8, 0xA3, 0x11, 0x8B,
+    0x69, 0x45, 0xDE, 0x00, 0x00, 0x40, 0x73, 0x29, 0xE2, 0x92, 0x10, 0x00, 0x60, 0x4D, 0xE8, 0xE9,
+    0x05, 0x10, 0x71, 0x01, 0xC0, 0x9C, 0xCE, 0x14, 0x8A, 0x28, 0xDE, 0x00, 0x20, 0x2C, 0x9E, 0xB8,
+    0x19, 0x63, 0x2C, 0x02, 0x00, 0x7B, 0x24, 0x83, 0x47, 0xB1, 0x58, 0x04, 0x00, 0xDC, 0x64, 0x8E,
+    0x68, 0xCA, 0xF0, 0x13, 0x40, 0x10, 0x9B, 0x3C, 0xE1, 0xB8, 0x11, 0x73, 0x20, 0x08, 0xE5, 0xA0,
+    0xE2, 0x99, 0xC3, 0x5A, 0x00, 0xF0, 0x83, 0x03, 0x75, 0xC2, 0x89, 0x41, 0x00, 0x80, 0xC2, 0xA7,
+    0xCF, 0x86, 0x1A, 0x35, 0x01, 0x40, 0x1A, 0x4D, 0x52, 0x48, 0x26, 0xF2, 0x04, 0x00, 0x0A, 0x9B,
+    0xCD, 0x9E, 0x79, 0x74, 0x06, 0x00, 0x45, 0x0A, 0x63, 0x26, 0xD1, 0xB8, 0x04, 0x00, 0xB6, 0x68,
+    0xF6, 0x64, 0xB4, 0x91, 0x27, 0x00, 0x00, 0x82, 0x9C, 0xA9, 0x38, 0x63, 0x31, 0x00, 0xC8, 0x01,
+    0x91, 0x72, 0x59, 0xC4, 0x23, 0x00, 0x70, 0xC3, 0xA0, 0xB2, 0x70, 0x87, 0x17, 0x81, 0xC0, 0x4E,
+    0x87, 0x12, 0xAB, 0x15, 0x59, 0x02, 0x80, 0x8C, 0x0A, 0xA0, 0x8E, 0x34, 0x96, 0x02, 0x00, 0x35,
+    0x9F, 0xB5, 0x9D, 0x53, 0x2C, 0x02, 0x00, 0x32, 0x1C, 0x69, 0x29, 0xD4, 0xE8, 0x8B, 0x08, 0x8D,
+    0x25, 0x98, 0x4A, 0x2E, 0x09, 0x17, 0x00, 0x38, 0xA9, 0x5C, 0x75, 0x38, 0xE3, 0x0A, 0x20, 0x00,
+    0xB0, 0x01, 0x74, 0x79, 0xC7, 0x24, 0x00, 0x20, 0xC0, 0x63, 0xA7, 0x62, 0x8E, 0x3C, 0x00, 0xE0,
+    0x0D, 0x04, 0x8A, 0x63, 0x18, 0x71, 0x00, 0x00, 0x24, 0x0D, 0x57, 0xCE, 0x21, 0x2A, 0x05, 0x80,
+    0x41, 0x9D, 0x2E, 0x9E, 0x41, 0xF4, 0x01, 0x00, 0x69, 0x26, 0x5A, 0x2C, 0xA7, 0x78, 0x04, 0x00,
+    0xD6, 0x64, 0xB4, 0x78, 0xF8, 0xD0, 0x08, 0x00, 0x44, 0x12, 0xD0, 0x74, 0x98, 0xA1, 0x26, 0x00,
+    0x3C, 0x13, 0xB2, 0x9B, 0x71, 0x46, 0x9B, 0x00, 0xD0, 0x07, 0xC3, 0x95, 0x73, 0x88, 0xC1, 0x01,
+    0x80, 0x18, 0x44, 0xCE, 0x45, 0x1A, 0x89, 0x02, 0x80, 0x87, 0x0A, 0x23, 0x0D, 0x3D, 0xE6, 0x00,
+    0x00, 0x63, 0x10, 0x33, 0x97, 0x60, 0x02, 0x0A, 0x00, 0x68, 0x3C, 0xAD, 0x66, 0xBB, 0x38, 0x09,
+    0x00, 0xD9, 0x54, 0x90, 0x42, 0x28, 0xD1, 0x09, 0x00, 0xD0, 0xD9, 0x24, 0xA9, 0xF8, 0x61, 0x73,
+    0x30, 0x80, 0x43, 0x71, 0xBB, 0x99, 0xC5, 0x29, 0x00, 0xB0, 0xA6, 0xB3, 0x56, 0x63, 0x8B, 0x3E,
+    0x20, 0x00, 0xD4, 0x65, 0x2B, 0x0A, 0x0B, 0x31, 0x01, 0xA0, 0x8C, 0x4B, 0xDA, 0x49, 0x36, 0x72,
+    0x00, 0xA0, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0x34, 0x01, 0x00, 0x7D, 0x3A, 0x61, 0x40, 0x7E, 0x78,
+    0x09, 0x00, 0xEA, 0x68, 0xDA, 0x68, 0x7A, 0xD1, 0x0A, 0x00, 0xB4, 0xA1, 0xE0, 0xE5, 0x10, 0x63,
+    0x32, 0x00, 0x90, 0x12, 0xD9, 0x31, 0xAA, 0x41, 0x23, 0x00, 0x30, 0x47, 0xB3, 0xD6, 0x91, 0x8F,
+    0x2E, 0x00, 0x80, 0xCE, 0x62, 0x2C, 0x02, 0x22, 0x69, 0x01, 0x80, 0x89, 0x0C, 0x9B, 0x4F, 0x26,
+    0xF2, 0x02, 0x00, 0x4C, 0x97, 0x33, 0x9E, 0x4C, 0x74, 0x00, 0x00, 0x82, 0x42, 0x58, 0x32, 0x8E,
+    0xB8, 0x8C, 0x08, 0x24, 0x69, 0xB4, 0x5A, 0x48, 0x51, 0x05, 0x00, 0xA8, 0x21, 0x79, 0xD5, 0x5C,
+    0x22, 0x11, 0x00, 0x50, 0xF3, 0x89, 0x34, 0x62, 0xC6, 0x12, 0x00, 0xD0, 0xA6, 0x60, 0x04, 0xB4,
+    0x84, 0xC6, 0x00, 0xC0, 0x8C, 0x86, 0xE7, 0x84, 0x0C, 0xA5, 0x10, 0x00, 0x05, 0x09, 0x5B, 0x8A,
+    0x35, 0x82, 0x00, 0x02, 0x34, 0x9A, 0xB1, 0x9E, 0x45, 0x24, 0x02, 0x04, 0x72, 0x34, 0x5E, 0x3C,
+    0x83, 0xB8, 0x04, 0x00, 0xD4, 0x68, 0x8C, 0x36, 0x4E, 0xD1, 0x16, 0x20, 0x10, 0x30, 0x61, 0xD3,
+    0x18, 0xA5, 0x87, 0x00, 0xA8, 0xA3, 0x31, 0xEA, 0xE0, 0xC4, 0x16, 0x00, 0xE0, 0x81, 0xE3, 0xE6,
+    0xC2, 0x8C, 0x39, 0x01, 0x00, 0x80, 0x07, 0xFA, 0x27, 0x25, 0x73, 0x00, 0x04, 0x1C, 0x0E, 0x5B,
+    0x4E, 0x2B, 0xE6, 0x02, 0x80, 0x34, 0x9A, 0x40, 0x9C, 0x6B, 0x3C, 0x01, 0x08, 0x0F, 0x8E, 0xEC,
+    0x3F, 0x5A, 0x79, 0x0B, 0x00, 0x00, 0x79, 0x9E, 0x7C, 0xC4, 0x30, 0x04, 0x00, 0xB4, 0xD1, 0x4C,
+    0xA1, 0x88, 0xA2, 0x08, 0x40, 0x90, 0x53, 0x61, 0x7A, 0x38, 0xC7, 0x1A, 0x00, 0x50, 0x40, 0x46,
+    0x7B, 0xB4, 0x8F, 0x9E, 0x00, 0x40, 0x09, 0x67, 0x49, 0x45, 0x10, 0x49, 0x01, 0x60, 0x1C, 0xCC,
+    0x21, 0xCD, 0x3A, 0x16, 0x03, 0x00, 0x37, 0x1A, 0xA3, 0x94, 0x3C, 0x5C, 0x09, 0x20, 0x69, 0x22,
+    0x42, 0x3C, 0x4B, 0x18, 0x04, 0x00, 0xDA, 0x7C, 0x84, 0x5A, 0xCC, 0xD0, 0x04, 0x00, 0x74, 0x3B,
+    0xB5, 0xD1, 0xF4, 0xA2, 0x10, 0x00, 0x88, 0xE2, 0x61, 0x43, 0xC9, 0x46, 0x27, 0x00, 0xA0, 0xA7,
+    0x33, 0x96, 0xC3, 0x89, 0xB7, 0x00, 0xE8, 0x17, 0x47, 0x07, 0x27, 0x88, 0x9C, 0x01, 0xC0, 0x80,
+    0x8B, 0x5D, 0xCF, 0x2C, 0x4E, 0x03, 0x00, 0x38, 0x05, 0xC1, 0x8E, 0x8E, 0x74, 0x00, 0x04, 0x9D,
+    0x2C, 0x66, 0x44, 0x80, 0x24, 0x14, 0x00, 0x04, 0x7C, 0xEC, 0x60, 0xAE, 0xF1, 0x09, 0x01, 0x14,
+    0x5A, 0x4C, 0x49, 0xAC, 0xE3, 0x2F, 0x00, 0x54, 0xA4, 0x21, 0xC4, 0xD9, 0xC6, 0x5C, 0x00, 0x20,
+    0x80, 0xB3, 0xC5, 0xA1, 0x8D, 0xA8, 0x00, 0x81, 0x00, 0x27, 0xAD, 0x25, 0x19, 0x3D, 0x00, 0x40,
+    0x9C, 0x8A, 0x55, 0x4E, 0x1E, 0xFE, 0x02, 0x00, 0x35, 0x19, 0x42, 0x22, 0x60, 0x1C, 0x01, 0x04,
+    0x73, 0x36, 0x5E, 0x44, 0x70, 0x98, 0x04, 0x00, 0xEC, 0x64, 0xE6, 0x60, 0xA2, 0xD1, 0x18, 0x00,
+    0xD8, 0xD9, 0xFC, 0xB8, 0x80, 0xA1, 0x06, 0x41, 0xB0, 0xC3, 0xC9, 0xBB, 0x61, 0xC6, 0x0B, 0x10,
+    0x70, 0x6C, 0xA3, 0xE4, 0x72, 0x87, 0xBE, 0x00, 0x00, 0x51, 0x47, 0x2C, 0xC8, 0x0F, 0x89, 0x00,
+    0xC0, 0xB9, 0x01, 0xC3, 0xCE, 0x84, 0xD4, 0x02, 0x02, 0x23, 0x1A, 0x3A, 0x16, 0x70, 0x3C, 0x0A,
+    0x00, 0x78, 0x22, 0x57, 0x25, 0xB6, 0xB8, 0x09, 0x00, 0xDB, 0x78, 0x06, 0x6B, 0xC2, 0xF1, 0x16,
+    0x00, 0x08, 0xE8, 0x00, 0xE1, 0x34, 0xA1, 0x14, 0x00, 0x90, 0xB1, 0xC9, 0x43, 0x99, 0x47, 0x1C,
+    0x00, 0x20, 0xC3, 0xE3, 0x54, 0xC2, 0x89, 0x3A, 0x08, 0xA0, 0x8E, 0x86, 0x6C, 0x08, 0x10, 0x4F,
+    0x20, 0x02, 0x85, 0x0D, 0xFB, 0x8F, 0x56, 0x9E, 0x02, 0x40, 0x36, 0x26, 0x9B, 0x18, 0x22, 0x44,
+    0x02, 0x00, 0x05, 0x24, 0x52, 0x43, 0x61, 0x48, 0x0C, 0x00, 0x92, 0x65, 0x94, 0x72, 0xC8, 0x68,
+    0x16, 0x00, 0x78, 0x80, 0x7C, 0xB9, 0xB4, 0xA2, 0x12, 0x00, 0x30, 0x23, 0x81, 0x2B, 0x39, 0xC7,
+    0x93, 0x00, 0x60, 0x49, 0xE2, 0x67, 0xD4, 0x8A, 0x4E, 0x00, 0x00, 0xCE, 0xE7, 0xEC, 0x26, 0x15,
+    0xA9, 0x02, 0x80, 0x87, 0x8D, 0x65, 0x0D, 0x40, 0xB2, 0x00, 0x02, 0x3C, 0x89, 0xAD, 0x96, 0x53,
+    0x74, 0x09, 0x10, 0x68, 0x34, 0x63, 0x1C, 0xED, 0x68, 0x04, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C,
+    0x31, 0x0A, 0x00, 0xA4, 0xA1, 0x60, 0x91, 0x00, 0x23, 0x07, 0x00, 0xD0, 0x71, 0xBA, 0x8B, 0x1A,
+    0xC4, 0xA3, 0x00, 0x00, 0x82, 0x02, 0x1A, 0x14, 0x8F, 0x20, 0x00, 0x04, 0x0E, 0x47, 0x0E, 0x49,
+    0x11, 0x77, 0x10, 0xC0, 0x28, 0x44, 0x93, 0x88, 0x28, 0x05, 0x01, 0x04, 0x01, 0x26, 0xB7, 0x17,
+    0x66, 0xC4, 0x05, 0x00, 0x6C, 0x24, 0x53, 0x24, 0xB1, 0xD8, 0x04, 0x04, 0xC6, 0x41, 0x52, 0x88,
+    0x4E, 0xB0, 0x02, 0x00, 0x08, 0xD2, 0x20, 0x96, 0xF9, 0x61, 0x0A, 0x00, 0x20, 0x02, 0xEA, 0x12,
+    0xAA, 0x43, 0x0D, 0x00, 0x60, 0xAA, 0xA2, 0xD5, 0x42, 0x4A, 0xB8, 0x01, 0x60, 0x80, 0xE8, 0xB9,
+    0xC8, 0x23, 0x93, 0x01, 0x80, 0x19, 0x8A, 0x94, 0x07, 0x30, 0x82, 0x10, 0x00, 0x0A, 0x23, 0x4E,
+    0x33, 0x4F, 0xAC, 0x45, 0x00, 0x3C, 0x2A, 0x70, 0x38, 0xB8, 0xA8, 0x09, 0x00, 0x65, 0x74, 0xA4,
+    0x78, 0xD6, 0x90, 0x07, 0x00, 0xF6, 0xB9, 0x64, 0xBD, 0x64, 0x22, 0x0E, 0x00, 0x70, 0xA4, 0x61,
+    0x42, 0x59, 0x44, 0x14, 0x00, 0x50, 0x47, 0xE3, 0xE6, 0xE2, 0x8C, 0xA0, 0x00, 0xE2, 0x57, 0xE7,
+    0xE9, 0x45, 0x90, 0x1A, 0x01, 0x00, 0x16, 0xD2, 0x17, 0x8D, 0x27, 0x82, 0x02, 0x00, 0x39, 0x15,
+    0xC3, 0x9D, 0x6C, 0x54, 0x01, 0x00, 0x6C, 0x34, 0x47, 0x24, 0x8A, 0x78, 0x01, 0x80, 0xC4, 0x9C,
+    0xE2, 0x82, 0x38, 0xD1, 0x08, 0x10, 0x00, 0xA8, 0x00, 0xF9, 0x10, 0xE1, 0x0E, 0x10, 0xC8, 0xF0,
+    0x39, 0xAB, 0x89, 0x45, 0x0A, 0x00, 0x80, 0x05, 0x84, 0x86, 0xA3, 0x8A, 0x0D, 0x00, 0xC0, 0x8C,
+    0x46, 0xCF, 0xE8, 0x14, 0x75, 0x00, 0x80, 0x83, 0xCC, 0x2A, 0x0F, 0x42, 0x22, 0x15, 0x00, 0x14,
+    0x1B, 0x5B, 0x26, 0x7A, 0x24, 0x01, 0x00, 0xCE, 0x20, 0x60, 0x33, 0xA0, 0x24, 0x04, 0x00, 0x74,
+    0x7C, 0xBC, 0x70, 0x1C, 0x51, 0x14, 0x00, 0xC8, 0x10, 0x7D, 0xF2, 0xF0, 0xE3, 0x12, 0x00, 0xC0,
+    0xA1, 0x19, 0x64, 0xC9, 0xC7, 0x9E, 0xA0, 0x00, 0x0E, 0x72, 0xC6, 0x73, 0x89, 0x36, 0x00, 0x48,
+    0x0D, 0x28, 0xC6, 0xC5, 0x07, 0x95, 0x00, 0x80, 0x1B, 0x8F, 0x1B, 0x50, 0x26, 0x12, 0x01, 0x02,
+    0x67, 0x96, 0x2B, 0xA4, 0x2D, 0x12, 0x02, 0x00, 0x27, 0x3C, 0x60, 0x37, 0x95, 0xB8, 0x02, 0x00,
+    0xE0, 0x78, 0xAC, 0x78, 0xE6, 0x70, 0x07, 0x00, 0x78, 0xE0, 0x2C, 0xB1, 0xF8, 0xE1, 0x14, 0x00,
+    0xD8, 0xB3, 0x71, 0xAA, 0xA0, 0xC6, 0x5C, 0x00, 0xA0, 0x27, 0x91, 0xA2, 0x91, 0x84, 0x27, 0x00,
+    0x60, 0x0D, 0x27, 0xAB, 0x46, 0x11, 0x3D, 0x00, 0x40, 0x1A, 0x4C, 0x93, 0x88, 0x28, 0x3A, 0x21,
+    0x80, 0x37, 0x1B, 0xB5, 0x1B, 0x57, 0x6C, 0x02, 0x00, 0x2B, 0x34, 0x57, 0x31, 0x8E, 0x88, 0x02,
+    0x10, 0x3A, 0x55, 0x82, 0x5A, 0xC8, 0x28, 0x08, 0x00, 0x7C, 0x18, 0x24, 0x71, 0xB0, 0x22, 0x09,
+    0x80, 0xC8, 0xE1, 0xE9, 0xA2, 0xB9, 0x44, 0x4A, 0x00, 0x00, 0x87, 0x53, 0x34, 0x32, 0x88, 0x25,
+    0x00, 0x40, 0xCE, 0x46, 0xED, 0xC6, 0x15, 0x89, 0x00, 0x00, 0x9C, 0x8C, 0x17, 0xCC, 0x29, 0xC2,
+    0x02, 0x00, 0x0A, 0x17, 0x3F, 0x21, 0x5C, 0xEC, 0x01, 0x08, 0x77, 0x32, 0x5F, 0x29, 0xC0, 0x58,
+    0x09, 0x00, 0x93, 0x74, 0xC8, 0x58, 0x82, 0x51, 0x09, 0x10, 0xD4, 0x21, 0xB4, 0xD1, 0xF4, 0x22,
+    0x50, 0x00, 0x78, 0xB3, 0x51, 0xBB, 0x71, 0x45, 0x24, 0x00, 0xD0, 0xEB, 0x61, 0x34, 0x72, 0x48,
+    0x45, 0x00, 0x60, 0x8F, 0x06, 0x6D, 0x47, 0x14, 0x8F, 0x00, 0x40, 0x14, 0x8D, 0xD8, 0x4A, 0x30,
+    0xE6, 0x02, 0x00, 0x27, 0x98, 0x33, 0x11, 0x70, 0xFC, 0x05, 0x80, 0x6B, 0x38, 0x7D, 0x3E, 0xC1,
+    0xC8, 0x0A, 0x00, 0xDA, 0x48, 0xAE, 0x42, 0x86, 0xB1, 0x13, 0x01, 0x18, 0xD0, 0xDC, 0xD1, 0x3C,
+    0xA3, 0x11, 0x00, 0x18, 0x31, 0x28, 0x19, 0xF0, 0x45, 0x28, 0x80, 0x60, 0x83, 0x30, 0xB5, 0xE1,
+    0x8C, 0x0D, 0x08, 0xA0, 0x8F, 0x26, 0xCA, 0x03, 0x18, 0x7F, 0x01, 0xC0, 0x0C, 0xCD, 0xD0, 0x04,
+    0x2E, 0x7E, 0x00, 0x82, 0x72, 0x95, 0x2C, 0x1D, 0x3F, 0x52, 0x06, 0x00, 0x62, 0x38, 0x46, 0x2F,
+    0x6B, 0xC8, 0x09, 0x00, 0xCC, 0x98, 0xE6, 0x7C, 0x4E, 0x91, 0x1A, 0x01, 0x04, 0x59, 0xFC, 0x88,
+    0xDC, 0xA1, 0x2A, 0x00, 0xC8, 0xB0, 0x21, 0xD3, 0xE1, 0xC4, 0x09, 0x02, 0x90, 0xE6, 0x92, 0x45,
+    0xB3, 0x88, 0x3F, 0x01, 0xC1, 0x8F, 0x86, 0xD3, 0x66, 0x20, 0x5D, 0x00, 0xC2, 0x9E, 0x0A, 0x51,
+    0xCD, 0x16, 0x86, 0x00, 0x00, 0x33, 0x9A, 0xA9, 0x90, 0x5D, 0x2C, 0x06, 0x04, 0xD3, 0x2A, 0x44,
+    0x28, 0x75, 0x84, 0x23, 0x00, 0xD0, 0x68, 0xE8, 0x6C, 0x88, 0x31, 0x1A, 0x00, 0xFC, 0x88, 0x50,
+    0xAD, 0x64, 0xA2, 0x0C, 0x00, 0x30, 0x93, 0x91, 0x1B, 0xCA, 0x44, 0x20, 0x00, 0x80, 0x47, 0xA3,
+    0x88, 0xE4, 0x8B, 0xBE, 0x00, 0x60, 0x4D, 0x04, 0x88, 0x26, 0x0A, 0x5D, 0x01, 0xC0, 0x9B, 0x8F,
+    0x1F, 0x13, 0x27, 0x86, 0x00, 0x00, 0x39, 0x1A, 0x40, 0x21, 0x5F, 0x5C, 0x01, 0x00, 0x6F, 0x36,
+    0x32, 0x29, 0x42, 0x08, 0x14, 0x00, 0x28, 0x6C, 0xB8, 0x38, 0xB6, 0x71, 0x18, 0x00, 0x2C, 0xD1,
+    0x0C, 0x1A, 0xE1, 0x62, 0x2F, 0x00, 0x60, 0xB1, 0x21, 0x82, 0x40, 0xC6, 0x5E, 0x00, 0xF0, 0x66,
+    0xA3, 0x76, 0xE3, 0x8A, 0x35, 0x01, 0x00, 0x83, 0xA6, 0x72, 0x46, 0x20, 0x77, 0x01, 0xC0, 0x9C,
+    0xC8, 0x11, 0xC8, 0x25, 0xEA, 0x02, 0x00, 0x39, 0x9F, 0xAC, 0x19, 0x47, 0xAC, 0x05, 0x00, 0x28,
+    0x36, 0x6F, 0x2E, 0xD0, 0x78, 0x13, 0x00, 0x00, 0x60, 0xCA, 0x3C, 0xD2, 0x11, 0x13, 0x00, 0x98,
+    0xC9, 0x04, 0x65, 0x64, 0xA2, 0x10, 0x00, 0x50, 0x70, 0x31, 0xDB, 0xB0, 0xC7, 0x5F, 0x40, 0x20,
+    0x6A, 0xF2, 0x55, 0xB1, 0x4F, 0x52, 0x08, 0x40, 0x4E, 0xA5, 0xEB, 0x85, 0x14, 0x63, 0x02, 0x40,
+    0x06, 0xCC, 0x97, 0x0F, 0x20, 0xA2, 0x00, 0x00, 0x1D, 0xA0, 0x3C, 0x25, 0x4A, 0xEC, 0x09, 0x00,
+    0xB0, 0x20, 0x56, 0x34, 0x83, 0xD8, 0x04, 0x00, 0x10, 0x80, 0x98, 0x55, 0x8E, 0xD2, 0x16, 0x00,
+    0x00, 0xD2, 0x04, 0xD1, 0x50, 0x61, 0x11, 0x00, 0x00, 0xA2, 0x29, 0x53, 0x41, 0xC6, 0x55, 0x00,
+    0xF0, 0x27, 0x73, 0x65, 0x23, 0x88, 0x3F, 0x00, 0x00, 0xC0, 0x66, 0x0F, 0xE6, 0x1B, 0x79, 0x00,
+    0x80, 0x98, 0x09, 0xD8, 0x4D, 0x25, 0xC6, 0x00, 0x80, 0x3A, 0x9A, 0x36, 0x9A, 0x5E, 0x44, 0x02,
+    0x00, 0x62, 0x34, 0x5A, 0x2E, 0xA2, 0x98, 0x03, 0x00, 0x00, 0x69, 0x88, 0x66, 0xC2, 0x90, 0x04,
+    0x00, 0xA0, 0xF8, 0x80, 0x09, 0xF1, 0xE1, 0x08, 0x00, 0x34, 0x93, 0xD9, 0xBA, 0x51, 0x44, 0x1F,
+    0x00, 0xF0, 0x66, 0xA3, 0x76, 0xE3, 0x8A, 0x24, 0x00, 0xEC, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x95,
+    0x00, 0x00, 0x1B, 0x8F, 0x5C, 0x4D, 0x30, 0x52, 0x01, 0x00, 0x62, 0x96, 0x2F, 0x1F, 0x40, 0xD2,
+    0x40, 0x00, 0x77, 0x10, 0x50, 0x3E, 0x64, 0x88, 0x1A, 0x00, 0xDA, 0x69, 0x8C, 0x6A, 0xC4, 0x70,
+    0x0B, 0x00, 0x34, 0x92, 0x7C, 0xB1, 0xD8, 0xE2, 0x24, 0x00, 0x18, 0xB1, 0xE8, 0xA1, 0x61, 0x42,
+    0x15, 0x00, 0x80, 0xE5, 0x32, 0x67, 0x13, 0x8C, 0x9B, 0x00, 0x00, 0xCE, 0xE5, 0x2A, 0x43, 0x1B,
+    0x77, 0x01, 0x80, 0x39, 0x01, 0x83, 0x51, 0x84, 0x10, 0x01, 0x84, 0x67, 0xA0, 0x34, 0xB6, 0x26,
+    0x62, 0x01, 0x00, 0x3A, 0x3C, 0x5F, 0x37, 0x94, 0x38, 0x0A, 0x00, 0xF0, 0x78, 0x7A, 0x64, 0x9E,
+    0x70, 0x04, 0x00, 0xE4, 0x51, 0x2D, 0xD3, 0xEC, 0xA4, 0x0F, 0x00, 0x60, 0x83, 0xD9, 0xD9, 0xF0,
+    0xC3, 0x25, 0x00, 0x60, 0x27, 0x64, 0xC6, 0x43, 0x89, 0x42, 0x00, 0xA0, 0x48, 0x05, 0x4C, 0x88,
+    0x0F, 0x43, 0x00, 0xC0, 0x1D, 0x08, 0x9E, 0x10, 0x2B, 0xE6, 0x02, 0x84, 0x37, 0x17, 0x20, 0x8E,
+    0x45, 0x44, 0x06, 0x00, 0x41, 0x2E, 0x5D, 0x36, 0x91, 0xE8, 0x01, 0x00, 0x12, 0x78, 0x9E, 0xAD,
+    0xFE, 0x51, 0x08, 0x10, 0xA8, 0x2B, 0x10, 0x60, 0x0D, 0x08, 0x13, 0x00, 0x68, 0xA2, 0xD1, 0xBA,
+    0x39, 0xC4, 0x45, 0x00, 0xA0, 0x46, 0xB3, 0x34, 0xE3, 0x86, 0x1E, 0x00, 0x84, 0x4D, 0x05, 0xAC,
+    0xC5, 0x16, 0x53, 0x00, 0x82, 0x19, 0x0F, 0x22, 0x12, 0x2E, 0x22, 0x01, 0x00, 0x3D, 0x1A, 0xB7,
+    0x99, 0x60, 0xBC, 0x02, 0x04, 0x14, 0x26, 0x80, 0x2A, 0xF9, 0x48, 0x04, 0x00, 0xE6, 0x7C, 0xE2,
+    0x78, 0x62, 0xF1, 0x17, 0x00, 0x98, 0xF1, 0x4C, 0xB1, 0x50, 0xA2, 0x14, 0x00, 0x88, 0x70, 0x99,
+    0x7B, 0x91, 0x46, 0xA5, 0x40, 0x80, 0x6D, 0x33, 0xB4, 0xF3, 0x84, 0x46, 0x00, 0x40, 0xCD, 0x25,
+    0x8A, 0x08, 0x0B, 0x79, 0x00, 0x83, 0x1C, 0x0A, 0x21, 0x4D, 0x39, 0xC2, 0x00, 0x00, 0x37, 0x20,
+    0xB7, 0xA0, 0x4B, 0xC4, 0x09, 0x00, 0x00, 0x36, 0xA6, 0x34, 0x17, 0x09, 0x52, 0x00, 0xAA, 0xB1,
+    0xCA, 0x92, 0xE6, 0xB0, 0x02, 0x00, 0x9C, 0x52, 0xE9, 0x69, 0xF1, 0x91, 0x06, 0x00, 0x90, 0x01,
+    0x6A, 0xE2, 0x09, 0xC3, 0x21, 0x44, 0x40, 0x47, 0x84, 0x97, 0x63, 0x8C, 0x2C, 0x00, 0xA0, 0x4A,
+    0xA8, 0xCF, 0x2B, 0x0F, 0x2D, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x32, 0x01, 0x00, 0x24,
+    0x1A, 0x41, 0x1D, 0x6A, 0x0C, 0x42, 0x00, 0x69, 0x24, 0x8C, 0x52, 0xAA, 0x58, 0x04, 0x00, 0x0E,
+    0x88, 0xEE, 0xA2, 0x04, 0x11, 0x09, 0x00, 0xF8, 0xD1, 0x6C, 0xCD, 0x50, 0xE2, 0x0F, 0x00, 0x78,
+    0xB3, 0x51, 0xBB, 0x71, 0x45, 0x55, 0x04, 0x90, 0x66, 0x92, 0x93, 0xF3, 0x83, 0x17, 0x00, 0x88,
+    0xC6, 0xA5, 0x2C, 0xC6, 0x16, 0x83, 0x02, 0x40, 0x81, 0x94, 0x33, 0x8F, 0x4B, 0xF2, 0x02, 0x80,
+    0x52, 0x15, 0xAD, 0x98, 0x4B, 0xA2, 0x02, 0x00, 0x73, 0x06, 0x42, 0x29, 0x6E, 0xE8, 0x0A, 0x00,
+    0xEC, 0x88, 0xD0, 0x7E, 0x22, 0xB1, 0x13, 0x00, 0xB4, 0x91, 0xDC, 0x50, 0x28, 0xE2, 0x14, 0x00,
+    0x48, 0xA0, 0x01, 0x8B, 0x51, 0xC5, 0x47, 0x00, 0xC0, 0x06, 0xD5, 0x44, 0x13, 0x87, 0x18, 0x10,
+    0xC0, 0xC3, 0x66, 0x12, 0x11, 0x0B, 0x63, 0x01, 0xA0, 0x15, 0x4E, 0x54, 0x4A, 0x26, 0x9E, 0x02,
+    0x04, 0x00, 0x13, 0xAF, 0x9C, 0x45, 0xEC, 0x45, 0x00, 0x6E, 0x3C, 0x52, 0x29, 0x9C, 0xD8, 0x03,
+    0x00, 0xAC, 0x0C, 0x4E, 0x1E, 0xC2, 0xB0, 0x78, 0x00, 0x10, 0x90, 0x7C, 0x9A, 0xB8, 0x64, 0x0E,
+    0x00, 0xB8, 0xA0, 0x71, 0x02, 0x61, 0xC5, 0x17, 0x00, 0xA0, 0x60, 0x90, 0xA1, 0xB0, 0x83, 0x50,
+    0x00, 0x40, 0x56, 0xE5, 0x4D, 0x25, 0x9B, 0x42, 0x02, 0x40, 0x86, 0x4C, 0x5D, 0x49, 0x3C, 0x66,
+    0x02, 0x80, 0x39, 0x15, 0x29, 0x95, 0x4C, 0x04, 0x06, 0x00, 0xBA, 0x40, 0x56, 0x33, 0x84, 0xF4,
+    0x03, 0x00, 0x32, 0x45, 0xAC, 0x64, 0x14, 0x51, 0x04, 0x00, 0xA0, 0xD1, 0xC4, 0xFD, 0x88, 0x22,
+    0x4B, 0x00, 0x88, 0xA3, 0x39, 0x8A, 0x59, 0xC3, 0x9E, 0x00, 0xA0, 0xA7, 0xA2, 0x75, 0x82, 0x8B,
+    0x1C, 0x00, 0x40, 0xCE, 0xE5, 0x6B, 0x47, 0x11, 0x29, 0x20, 0x02, 0x1C, 0x8D, 0xEC, 0xA1, 0x1F,
+    0x56, 0x02, 0x80, 0x36, 0x8E, 0x37, 0x98, 0x64, 0x3C, 0x02, 0x00, 0x31, 0x32, 0x77, 0x34, 0xCF,
+    0xC8, 0x13, 0x00, 0x68, 0x48, 0xFE, 0x6C, 0xAE, 0xB1, 0x02, 0x00, 0xE4, 0xD1, 0xE4, 0x90, 0x88,
+    0x61, 0x4B, 0x00, 0xA8, 0xA3, 0x69, 0xA3, 0xE9, 0x45, 0x1D, 0x00, 0x90, 0xE6, 0x92, 0x06, 0x13,
+    0x8C, 0x18, 0x00, 0x00, 0xD0, 0x46, 0x4C, 0x88, 0x0F, 0x3B, 0x00, 0xC0, 0x1C, 0x90, 0x53, 0x09,
+    0x27, 0x2A, 0x01, 0x01, 0x19, 0x1F, 0xAF, 0x1E, 0x3F, 0xA4, 0x0C, 0x80, 0x40, 0x3A, 0x74, 0x4A,
+    0x8A, 0x18, 0x04, 0x00, 0xD8, 0x60, 0xFE, 0x66, 0xBE, 0x71, 0x02, 0x80, 0xBC, 0xD9, 0x00, 0xAE,
+    0xDC, 0xE3, 0x37, 0x00, 0x50, 0x44, 0x78, 0x91, 0x80, 0xC3, 0x27, 0x00, 0x00, 0x27, 0x22, 0x04,
+    0x32, 0x88, 0xC5, 0x00, 0x30, 0x85, 0x26, 0x8E, 0xE8, 0x12, 0x77, 0x00, 0x80, 0xB1, 0x4A, 0x4E,
+    0x0D, 0x11, 0xFD, 0x00, 0x80, 0x39, 0x1A, 0x38, 0x1B, 0x5F, 0xBC, 0x05, 0x00, 0x6E, 0x18, 0x52,
+    0x16, 0xDA, 0x48, 0x02, 0x80, 0xD4, 0x68, 0xAE, 0x4E, 0x5A, 0x31, 0x87, 0x00, 0xFC, 0x01, 0xED,
+    0xBC, 0x40, 0xA1, 0x0E, 0x02, 0xA8, 0xA3, 0x69, 0xA3, 0xE9, 0xC5, 0x18, 0x00, 0x80, 0x60, 0x74,
+    0xE6, 0x32, 0x8C, 0x3E, 0x40, 0x00, 0x54, 0x05, 0xAD, 0x0B, 0x8C, 0x52, 0x00, 0x40, 0x9C, 0x10,
+    0xD4, 0x10, 0x18, 0x06, 0x05, 0x80, 0x35, 0x15, 0xB8, 0x1E, 0x52, 0x5C, 0x05, 0x10, 0x74, 0x3A,
+    0x5C, 0x31, 0x9C, 0xA8, 0x03, 0x00, 0x2A, 0x64, 0x14, 0x77, 0xBE, 0x91, 0x33, 0x20, 0x14, 0xC0,
+    0xAC, 0x85, 0xAC, 0x63, 0x0B, 0x00, 0xEA, 0x11, 0xE2, 0x44, 0xCA, 0x46, 0x24, 0x00, 0x40, 0x20,
+    0x14, 0x7D, 0xC3, 0x93, 0x44, 0x80, 0x20, 0xC7, 0x46, 0x72, 0xA7, 0x1D, 0x77, 0x10, 0x40, 0xA2,
+    0xC7, 0x0F, 0xCE, 0x12, 0x26, 0x01, 0x80, 0x00, 0x97, 0x54, 0x1C, 0x88, 0xBC, 0x00, 0x00, 0xD6,
+    0x3C, 0x42, 0x3F, 0x46, 0x24, 0x0A, 0x00, 0xD6, 0xA0, 0x00, 0x93, 0x54, 0xD1, 0x07, 0x00, 0x38,
+    0x89, 0xA0, 0x09, 0x29, 0xE2, 0x0E, 0x20, 0xF8, 0xB1, 0xD1, 0x9B, 0x1A, 0xC4, 0x63, 0x40, 0x20,
+    0x8E, 0xF0, 0xE1, 0xF1, 0x22, 0xB9, 0x00, 0x42, 0x0D, 0xE8, 0x6B, 0x67, 0x10, 0x31, 0x00, 0x80,
+    0x9A, 0x0E, 0x1C, 0x11, 0x25, 0x52, 0x00, 0x00, 0x34, 0x9E, 0x36, 0x9A, 0x5E, 0xDC, 0x00, 0x00,
+    0x6A, 0x38, 0x8E, 0x48, 0xC3, 0x78, 0x09, 0x00, 0xD2, 0x68, 0x8C, 0x56, 0xE6, 0xB0, 0x05, 0x00,
+    0xC0, 0xA9, 0x70, 0xF9, 0xDC, 0x61, 0x11, 0x00, 0x58, 0x73, 0x51, 0x1C, 0x4A, 0x46, 0x53, 0x00,
+    0x48, 0xA7, 0x73, 0xF7, 0x13, 0x8B, 0x4E, 0x00, 0xC0, 0x53, 0x83, 0xC6, 0x66, 0x47, 0x96, 0x00,
+    0x40, 0x1A, 0x8D, 0xDC, 0x8B, 0x34, 0x22, 0x03, 0x80, 0x29, 0x15, 0xA5, 0x96, 0x3C, 0x0C, 0x06,
+    0x00, 0x4F, 0x34, 0x60, 0x28, 0xC4, 0xD8, 0x09, 0x00, 0x22, 0x6D, 0xAE, 0x6A, 0x04, 0xD1, 0x02,
+    0x00, 0xBC, 0xD9, 0x84, 0xFD, 0x08, 0x62, 0x31, 0x40, 0x98, 0xA3, 0x81, 0x22, 0x39, 0x45, 0x11,
+    0x00, 0x28, 0x28, 0x52, 0x89, 0x73, 0x8F, 0x1C, 0x00, 0x00, 0x11, 0xC8, 0xCD, 0xE8, 0x10, 0x89,
+    0x41, 0x10, 0x8C, 0xD2, 0x16, 0x0F, 0x1F, 0x0E, 0x03, 0x84, 0x3E, 0x1A, 0xB9, 0x9C, 0x5D, 0x3C,
+    0x42, 0x00, 0x6B, 0x32, 0x89, 0x3B, 0xDE, 0xF8, 0x01, 0x00, 0xDA, 0x68, 0xC2, 0x8A, 0xEE, 0xB0,
+    0x06, 0x00, 0xAC, 0xB9, 0x8C, 0xDD, 0x74, 0x62, 0x12, 0x00, 0xB8, 0xA3, 0x29, 0x0B, 0x1A, 0xC4,
+    0xE3, 0x40, 0x40, 0x6D, 0x70, 0x81, 0xB1, 0x22, 0xD0, 0x00, 0x40, 0x4D, 0x62, 0x8C, 0x25, 0x18,
+    0x37, 0x00, 0x40, 0x9D, 0x42, 0x1B, 0x4D, 0x2F, 0x8E, 0x00, 0x80, 0x41, 0x19, 0x94, 0x8F, 0x1F,
+    0x2C, 0x05, 0x80, 0x6D, 0x34, 0x53, 0x18, 0xD6, 0x88, 0x02, 0x10, 0xDE, 0x3C, 0xAE, 0x44, 0x80,
+    0x91, 0x09, 0x00, 0x98, 0x91, 0x0C, 0x75, 0x44, 0x62, 0x50, 0x00, 0x78, 0x91, 0xB0, 0xFC, 0xA0,
+    0xC9, 0x1B, 0x80, 0x20, 0x60, 0x34, 0x46, 0x83, 0x8A, 0x50, 0x00, 0xA0, 0x9B, 0x46, 0x9B, 0xF1,
+    0x14, 0x55, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x7E, 0x01, 0x00, 0x2F, 0x89, 0xB0, 0x16,
+    0x5C, 0xE4, 0x05, 0x00, 0x68, 0x28, 0x5E, 0x2A, 0xBB, 0x68, 0x03, 0x00, 0xFF, 0x20, 0x8A, 0x38,
+    0x38, 0x11, 0x09, 0x00, 0xA0, 0x88, 0x50, 0xE9, 0xD4, 0xE1, 0x06, 0x00, 0x60, 0x44, 0xD9, 0x12,
+    0x82, 0xC3, 0x0E, 0x00, 0x88, 0xA6, 0xF2, 0xA5, 0xB2, 0x8B, 0x9C, 0x00, 0xF0, 0x03, 0x69, 0x71,
+    0xEB, 0x12, 0x9D, 0x10, 0x80, 0x18, 0x8F, 0x16, 0x0F, 0x1F, 0x9A, 0x00, 0x00, 0x28, 0x1A, 0x44,
+    0x1E, 0x6B, 0x54, 0x02, 0x00, 0x39, 0x1C, 0x53, 0x21, 0xBB, 0x88, 0x0B, 0x00, 0xEA, 0x5C, 0xFC,
+    0x5E, 0xCE, 0xF1, 0x17, 0x00, 0xE0, 0xD1, 0xA4, 0x30, 0xC0, 0x21, 0x13, 0x00, 0xD0, 0x55, 0x29,
+    0x1B, 0x12, 0xA4, 0x1B, 0x00, 0x70, 0x47, 0xC3, 0x55, 0x12, 0x8C, 0x13, 0x00, 0x20, 0x8D, 0xA6,
+    0x72, 0x4D, 0x11, 0x6D, 0x00, 0xC0, 0xA1, 0x84, 0x91, 0x89, 0x1F, 0x8E, 0x20, 0x00, 0x35, 0x1A,
+    0x2F, 0x95, 0x5D, 0x24, 0x02, 0x00, 0x5D, 0x32, 0x67, 0x45, 0x80, 0x88, 0x04, 0x00, 0xE8, 0x64,
+    0xFC, 0x6E, 0xAA, 0x71, 0x19, 0x00, 0xD0, 0x09, 0x4D, 0xDD, 0xE4, 0xE1, 0x07, 0x00, 0x78, 0x83,
+    0x51, 0xBB, 0x71, 0xC5, 0x24, 0x00, 0x10, 0xC5, 0x84, 0x07, 0x14, 0x8B, 0x35, 0x00, 0x40, 0x12,
+    0xC2, 0xC6, 0xE0, 0x1A, 0x3B, 0x00, 0xC0, 0x24, 0x49, 0x0C, 0x0B, 0x10, 0x52, 0x00, 0x80, 0x3E,
+    0x22, 0xC2, 0x27, 0x51, 0xAC, 0x05, 0x00, 0x6A, 0x30, 0x62, 0x31, 0xAD, 0x48, 0x0C, 0x00, 0x76,
+    0x35, 0x38, 0x26, 0x66, 0xE4, 0x18, 0x00, 0xDA, 0x01, 0x5D, 0xF5, 0xC0, 0xA1, 0x09, 0x00, 0x68,
+    0xB3, 0x89, 0x4B, 0x3A, 0x44, 0x1B, 0x40, 0xF0, 0xAB, 0xA3, 0xF4, 0x23, 0x45, 0xC2, 0x01, 0x40,
+    0xD3, 0xC4, 0xAC, 0x65, 0x18, 0x37, 0x00, 0x01, 0x9B, 0x0E, 0xD4, 0x0C, 0x1F, 0x1A, 0x03, 0x01,
+    0x3A, 0xA3, 0x29, 0x20, 0x33, 0x34, 0x02, 0x04, 0xC2, 0x1C, 0x7C, 0x34, 0xD7, 0x04, 0x13, 0x00,
+    0x06, 0x6C, 0xF0, 0x6E, 0xA4, 0x71, 0x08, 0x00, 0x24, 0xA0, 0xF0, 0x1A, 0x19, 0xE4, 0x52, 0x00,
+    0x28, 0xE5, 0xC9, 0x02, 0x72, 0xC3, 0x20, 0x40, 0x50, 0x40, 0xF3, 0x48, 0x14, 0x8D, 0x9D, 0x00,
+    0xA0, 0xCE, 0x85, 0xA7, 0xE5, 0x09, 0x77, 0x00, 0x40, 0xBA, 0xC6, 0x83, 0xCC, 0x85, 0xF0, 0x00,
+    0x00, 0x36, 0x95, 0x4A, 0x9E, 0x74, 0xD4, 0x09, 0x00, 0x06, 0x52, 0x7D, 0x33, 0xDB, 0x08, 0x14,
+    0x00, 0xD6, 0x4C, 0xA4, 0x6A, 0xF8, 0x50, 0x18, 0x00, 0x38, 0xB9, 0xB8, 0xC1, 0x20, 0x23, 0x0E,
+    0x10, 0xC8, 0x33, 0x09, 0x9B, 0x39, 0xC5, 0x55, 0x80, 0x40, 0x81, 0xF3, 0x85, 0x32, 0x8C, 0xC5,
+    0x41, 0xC1, 0x43, 0x48, 0x0A, 0x88, 0x0C, 0x8D, 0x82, 0x81, 0xA1, 0xCB, 0x99, 0xC9, 0x35, 0x62,
+    0x00, 0x80, 0x3A, 0x9A, 0x3B, 0x1E, 0x5C, 0x6C, 0x05, 0x00, 0x3A, 0x2A, 0x58, 0x37, 0x81, 0xA8,
+    0x5C, 0x18, 0x24, 0x6D, 0xD4, 0x6E, 0x5C, 0x91, 0x09, 0x30, 0xDC, 0xD9, 0xC8, 0xE1, 0xF8, 0xE2,
+    0x09, 0x00, 0x84, 0x22, 0xE9, 0x63, 0x79, 0xC7, 0x12, 0x00, 0xE4, 0xA4, 0x43, 0x35, 0x62, 0x8B,
+    0x48, 0x00, 0x00, 0x8B, 0xA6, 0xF2, 0x66, 0x1F, 0x87, 0x00, 0x00, 0x9C, 0x0D, 0xE5, 0x90, 0x36,
+    0xE6, 0x00, 0x80, 0x02, 0x15, 0xA2, 0x12, 0x3F, 0x04, 0x02, 0x00, 0x84, 0x2E, 0x5B, 0x29, 0xB3,
+    0x98, 0x09, 0x00, 0xDE, 0x6C, 0x90, 0x46, 0x1C, 0x51, 0x15, 0x00, 0xBC, 0xD9, 0xC8, 0xCD, 0x20,
+    0x23, 0x2C, 0x00, 0xE0, 0xD3, 0xA1, 0x0A, 0x32, 0xC3, 0x22, 0x00, 0xC0, 0x06, 0x33, 0x75, 0x93,
+    0x87, 0x1D, 0x81, 0x80, 0x80, 0xE8, 0x53, 0xE6, 0x21, 0x6D, 0x00, 0x40, 0x9F, 0x8D, 0x98, 0x0B,
+    0x2E, 0x3A, 0x01, 0x00, 0x2C, 0x17, 0xAF, 0x17, 0x55, 0x9C, 0x06, 0x00, 0x76, 0x2E, 0x5D, 0x20,
+    0xD2, 0xA8, 0x03, 0x00, 0xD8, 0x64, 0xE6, 0x82, 0x44, 0x31, 0x0A, 0x00, 0xC8, 0xD1, 0x14, 0x16,
+    0x01, 0xA3, 0x30, 0x00, 0x00, 0x81, 0x80, 0x7A, 0x19, 0xC4, 0x42, 0x00, 0xC0, 0x25, 0x73, 0x85,
+    0xA2, 0x8A, 0x27, 0x40, 0xC0, 0x4F, 0xE4, 0xA8, 0x46, 0x0C, 0x91, 0x00, 0x80, 0x1A, 0xC9, 0x5B,
+    0x8D, 0x2F, 0xC6, 0x04, 0x00, 0x03, 0x1A, 0xF0, 0x2F, 0x88, 0x6C, 0x45, 0x00, 0x66, 0x36, 0x58,
+    0x35, 0x87, 0x28, 0x4A, 0x00, 0xEA, 0x94, 0x80, 0x52, 0xD6, 0x50, 0x13, 0x00, 0x14, 0xA0, 0x50,
+    0xB1, 0x5C, 0x62, 0x13, 0x00, 0x28, 0xF0, 0x71, 0x84, 0x01, 0xC8, 0x21, 0x00, 0xF0, 0x80, 0xD4,
+    0x45, 0x34, 0x87, 0x48, 0x00, 0xA0, 0x10, 0x08, 0x2A, 0x08, 0x0C, 0x25, 0x00, 0x02, 0x96, 0xCF,
+    0xDD, 0x4D, 0x32, 0x46, 0x00, 0x80, 0x36, 0x18, 0x2F, 0x1E, 0x3F, 0xFC, 0x00, 0x00, 0x40, 0x34,
+    0x9C, 0x7E, 0x77, 0xB8, 0x09, 0x00, 0x32, 0x3C, 0x4E, 0x6E, 0x32, 0xF1, 0x09, 0x00, 0xC8, 0xE9,
+    0x6C, 0xE5, 0x1C, 0xE2, 0x0D, 0x00, 0x10, 0x33, 0xB2, 0x13, 0x3A, 0xC5, 0x26, 0x00, 0x40, 0xA4,
+    0x13, 0x64, 0xE4, 0x83, 0x4E, 0x00, 0x20, 0x0D, 0x46, 0xCF, 0x65, 0x1C, 0x4F, 0x01, 0xA0, 0xA0,
+    0x54, 0x57, 0x8F, 0x1F, 0xAE, 0x00, 0x00, 0x5D, 0x13, 0x99, 0x0C, 0x34, 0xD2, 0x0D, 0x00, 0x78,
+    0x36, 0xA0, 0x40, 0xF3, 0xA8, 0x0B, 0x00, 0xDA, 0x3C, 0xC6, 0x56, 0x86, 0x11, 0x19, 0x00, 0x78,
+    0xC0, 0x88, 0xE5, 0x64, 0xA2, 0x11, 0x00, 0x68, 0xA3, 0xD9, 0x1A, 0x72, 0xC3, 0x13, 0x00, 0x20,
+    0x45, 0xE3, 0xC7, 0x63, 0x8C, 0x40, 0x00, 0x20, 0x4D, 0x46, 0x4C, 0x86, 0x15, 0x63, 0x01, 0x40,
+    0x9B, 0x08, 0xE7, 0xCD, 0x40, 0x46, 0x00, 0x80, 0x34, 0xA0, 0xC9, 0xA4, 0x64, 0x14, 0x02, 0x02,
+    0x79, 0x1C, 0x3C, 0x27, 0x62, 0x58, 0x04, 0x00, 0x3E, 0x6C, 0xE4, 0x4E, 0xCC, 0x31, 0x29, 0x00,
+    0xC8, 0xD1, 0x60, 0xDE, 0xFC, 0xE3, 0x09, 0x00, 0x38, 0x94, 0xD9, 0xE3, 0x21, 0x46, 0x1E, 0x00,
+    0x44, 0xAC, 0x03, 0xC4, 0x05, 0x23, 0x37, 0x00, 0xE0, 0x51, 0x66, 0x6B, 0xA5, 0x15, 0x91, 0x00,
+    0x00, 0x9D, 0x05, 0xE2, 0x0D, 0x39, 0xEA, 0x00, 0x00, 0x55, 0x94, 0x25, 0x9F, 0x2D, 0x92, 0x04,
+    0x00, 0x68, 0x26, 0x61, 0x40, 0x7E, 0x28, 0x04, 0x80, 0x74, 0x74, 0xEE, 0x62, 0xAC, 0xD1, 0x03,
+    0x00, 0x0E, 0xE2, 0xE0, 0xCD, 0x50, 0x63, 0x13, 0x00, 0x98, 0x23, 0x48, 0x22, 0x59, 0xC4, 0x4C,
+    0x00, 0x58, 0xE5, 0xC2, 0x85, 0xA3, 0x88, 0xBB, 0x00, 0x60, 0x8D, 0x86, 0x0D, 0xC6, 0x18, 0x55,
+    0x00, 0x50, 0x1D, 0x4D, 0x1B, 0x4D, 0x2F, 0xFE, 0x00, 0xA4, 0x04, 0x37, 0xEA, 0x98, 0xA2, 0x74,
+    0x04, 0x00, 0x69, 0x40, 0x61, 0x2A, 0xC1, 0x88, 0x04, 0x00, 0xD4, 0x6C, 0xD8, 0x6A, 0x76, 0x11,
+    0x04, 0x20, 0xD4, 0xD1, 0xB4, 0xD1, 0xF4, 0x62, 0x24, 0x00, 0x90, 0x92, 0xE1, 0x62, 0x69, 0xC5,
+    0x18, 0x01, 0x50, 0x47, 0x53, 0x88, 0x52, 0x90, 0x49, 0x00, 0x40, 0x45, 0x89, 0xAA, 0x28, 0x0C,
+    0x81, 0x00, 0x40, 0xA2, 0x8D, 0x1B, 0x0F, 0x29, 0x96, 0x02, 0x00, 0x1B, 0x1B, 0x26, 0x1E, 0x31,
+    0x04, 0x25, 0x00, 0x04, 0x46, 0x97, 0x38, 0xFB, 0x48, 0x01, 0x00, 0xD2, 0x78, 0x98, 0x6A, 0xD8,
+    0x90, 0x15, 0x00, 0xCC, 0xD1, 0xC0, 0xE1, 0xEC, 0x62, 0x05, 0x00, 0xC0, 0x93, 0x11, 0xE3, 0x51,
+    0xC4, 0x0D, 0x00, 0xF0, 0x66, 0x33, 0x85, 0x73, 0x87, 0x2C, 0x00, 0xA0, 0x11, 0x46, 0x4B, 0x88,
+    0x0D, 0x41, 0x00, 0x82, 0x85, 0x51, 0x16, 0x90, 0x1B, 0x06, 0x03, 0x00, 0x34, 0x06, 0x9B, 0x07,
+    0x4E, 0x5C, 0x05, 0x80, 0x69, 0x2A, 0x53, 0x0E, 0xFF, 0x78, 0x0C, 0x00, 0x86, 0x68, 0x06, 0x75,
+    0xAE, 0x91, 0x15, 0x00, 0xF2, 0xF1, 0x38, 0xB9, 0x00, 0x62, 0x2D, 0x00, 0x10, 0xD3, 0x31, 0x6B,
+    0x19, 0x46, 0x50, 0x00, 0x40, 0x28, 0x03, 0x55, 0x84, 0x85, 0x4B, 0x20, 0x20, 0x0A, 0x06, 0xEE,
+    0x66, 0x17, 0x8D, 0x00, 0x80, 0x9D, 0xCD, 0x97, 0x4B, 0x2C, 0xF6, 0x00, 0x80, 0x3B, 0x1A, 0x36,
+    0x99, 0x60, 0x8C, 0x01, 0x00, 0x04, 0x58, 0xA5, 0x44, 0xF1, 0xA8, 0x04, 0x04, 0x48, 0x59, 0xB6,
+    0x56, 0x5A, 0xE9, 0x27, 0x10, 0x0C, 0x98, 0x3C, 0xC6, 0xFC, 0x23, 0x0C, 0x00, 0x74, 0xF3, 0x81,
+    0xAB, 0x09, 0xC6, 0x12, 0x00, 0xA0, 0xE0, 0x32, 0xB5, 0xC1, 0x8C, 0x18, 0x00, 0x20, 0xCE, 0xA6,
+    0x30, 0x6E, 0x0D, 0x9B, 0x03, 0x00, 0x96, 0xCD, 0x9F, 0x87, 0x45, 0x16, 0x01, 0x80, 0x28, 0x9F,
+    0x3B, 0x22, 0x52, 0x9C, 0x02, 0x00, 0xA5, 0x34, 0x90, 0x2B, 0x0D, 0x49, 0x02, 0x20, 0x22, 0x51,
+    0xA8, 0x7C, 0xD8, 0xF0, 0x01, 0x20, 0xBC, 0xD9, 0xA8, 0xDD, 0xB8, 0xA2, 0x2E, 0x00, 0xF0, 0xE1,
+    0x08, 0xBB, 0xC1, 0xC4, 0x66, 0x00, 0xF0, 0x24, 0x93, 0x44, 0x93, 0x86, 0xA7, 0x04, 0x01, 0x40,
+    0x27, 0x47, 0x26, 0x09, 0x73, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x66, 0x01, 0x80, 0x3B,
+    0x14, 0x33, 0x18, 0x5F, 0x6C, 0x01, 0x00, 0x6B, 0x34, 0x5B, 0x27, 0xBB, 0xA8, 0x11, 0x00, 0x0E,
+    0x60, 0x56, 0x97, 0xCE, 0x91, 0x02, 0x00, 0xC0, 0xD1, 0x48, 0xF2, 0x98, 0x63, 0x29, 0x00, 0x08,
+    0xA0, 0xE1, 0xFA, 0xA0, 0x46, 0x1C, 0x01, 0xC0, 0xA6, 0x24, 0x56, 0x74, 0x87, 0x41, 0x00, 0xE0,
+    0x57, 0xE6, 0x08, 0xC7, 0x8B, 0x92, 0x00, 0xC0, 0x8D, 0x48, 0x9A, 0x0A, 0x34, 0x16, 0x03, 0x82,
+    0x34, 0x98, 0xAF, 0x1B, 0x49, 0x9C, 0x05, 0x00, 0x7F, 0x26, 0x69, 0x36, 0xB3, 0x88, 0x0B, 0x08,
+    0xD2, 0x5C, 0xC4, 0x6E, 0x34, 0xD1, 0x07, 0x00, 0xD4, 0xD1, 0xFC, 0x0D, 0xE1, 0x22, 0x0C, 0x00,
+    0xA8, 0xA3, 0x69, 0xA3, 0xE9, 0xC5, 0x97, 0x00, 0x90, 0x61, 0x43, 0xAB, 0x92, 0x93, 0xD7, 0x00,
+    0x40, 0x0C, 0x24, 0x6C, 0xC5, 0x17, 0x71, 0x02, 0x80, 0x80, 0x89, 0x9B, 0x46, 0x41, 0xC2, 0x00,
+    0x80, 0x7D, 0x82, 0x84, 0x21, 0x07, 0x01, 0x81, 0x08, 0x00, 0x54, 0xC2, 0x7F, 0xAC, 0x68, 0x13,
+    0x00, 0x32, 0x6C, 0x30, 0x97, 0x98, 0xB1, 0x18, 0x00, 0x64, 0xA0, 0x3C, 0x69, 0x18, 0xA3, 0x49,
+    0x40, 0x78, 0xB3, 0x51, 0xBB, 0x71, 0x45, 0x25, 0x00, 0x68, 0x07, 0x92, 0x45, 0x02, 0x8C, 0x1F,
+    0x80, 0xA0, 0x8D, 0xC6, 0x47, 0x41, 0x1A, 0x63, 0x05, 0xC0, 0x9B, 0x8D, 0x51, 0xC8, 0x22, 0x46,
+    0x02, 0x40, 0x33, 0x95, 0xB4, 0x93, 0x6C, 0x04, 0x02, 0x00, 0x75, 0x34, 0x6D, 0x27, 0xB3, 0x78,
+    0x8B, 0x00, 0xC0, 0x6C, 0xCA, 0x6E, 0x44, 0x71, 0x07, 0x00, 0x04, 0x98, 0x20, 0xB2, 0x04, 0xA4,
+    0x0F, 0x00, 0x1A, 0x10, 0xE2, 0xDB, 0x41, 0xC6, 0x57, 0x00, 0xD0, 0xC6, 0x73, 0x57, 0xE4, 0x89,
+    0x12, 0x01, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x61, 0x10, 0x80, 0x9A, 0x8B, 0x5E, 0xCF, 0x2E,
+    0x42, 0x01, 0x00, 0x3C, 0x9D, 0x2D, 0x1E, 0x40, 0x1C, 0x01, 0x00, 0x68, 0x34, 0x9B, 0x80, 0x73,
+    0xD8, 0x14, 0x00, 0xEA, 0x68, 0xDA, 0x68, 0x7A, 0x91, 0x82, 0x00, 0xD8, 0xA9, 0x84, 0xE1, 0x5C,
+    0xE2, 0x28, 0x00, 0x30, 0x83, 0x89, 0xC3, 0xF1, 0xC5, 0xA1, 0x00, 0x20, 0x60, 0x53, 0x47, 0xE3,
+    0x8C, 0x13, 0x08, 0xE0, 0xCD, 0x46, 0xED, 0xC6, 0x15, 0x4B, 0x00, 0xC0, 0x9B, 0x8D, 0xDA, 0x8D,
+    0x2B, 0x1A, 0x01, 0x80, 0x07, 0x8F, 0xD3, 0x1F, 0x7F, 0xE4, 0x0D, 0x00, 0xC6, 0x24, 0x32, 0x12,
+    0x7C, 0x98, 0x03, 0x00, 0x04, 0xA4, 0x08, 0x3B, 0x3E, 0x72, 0x02, 0x00, 0xAC, 0xC9, 0x14, 0xED,
+    0x40, 0x61, 0x0C, 0x00, 0x90, 0xD3, 0x51, 0xBB, 0x11, 0xC4, 0x0D, 0x00, 0xB0, 0x06, 0xE4, 0x15,
+    0x23, 0x8A, 0xB9, 0x00, 0x40, 0xCD, 0x66, 0xA9, 0x67, 0x0B, 0x2D, 0x00, 0x90, 0x9A, 0x12, 0xE0,
+    0x95, 0x22, 0x56, 0x00, 0x02, 0x1D, 0x9B, 0xA3, 0x1E, 0x28, 0xDC, 0x00, 0x08, 0x66, 0x26, 0x57,
+    0x1F, 0xC8, 0xA8, 0x41, 0x00, 0x3C, 0x90, 0x4E, 0x91, 0xCE, 0xD1, 0x09, 0x00, 0xDC, 0x79, 0xFC,
+    0xC0, 0x60, 0x61, 0x07, 0x04, 0x7A, 0x43, 0xDA, 0xFC, 0x62, 0x45, 0x26, 0x00, 0x60, 0xC9, 0xB1,
+    0x78, 0x02, 0x91, 0x9E, 0x00, 0xA0, 0x8E, 0xA6, 0x8D, 0xA6, 0x17, 0x3B, 0x10, 0x40, 0x9F, 0x0B,
+    0x9D, 0xD2, 0x22, 0x82, 0x00, 0xC0, 0x36, 0x18, 0xB1, 0x21, 0x3E, 0x74, 0x09, 0x00, 0x06, 0x24,
+    0x7D, 0x2E, 0xE7, 0xB8, 0x04, 0x00, 0x24, 0x38, 0x26, 0x35, 0x78, 0x12, 0x05, 0x10, 0xC4, 0xB9,
+    0xE8, 0xBD, 0x7C, 0xA3, 0x0E, 0x00, 0x28, 0x02, 0xC2, 0x92, 0x71, 0xC4, 0x94, 0x00, 0x40, 0x61,
+    0x23, 0xB8, 0x43, 0x8D, 0x30, 0x81, 0xA0, 0x1E, 0x22, 0xA9, 0x47, 0x0A, 0xB9, 0x02, 0x90, 0x87,
+    0x8D, 0xDA, 0x8D, 0x2B, 0xE6, 0x08, 0x80, 0x03, 0x1A, 0xC5, 0x95, 0x82, 0x1C, 0x02, 0x04, 0x74,
+    0x34, 0x4A, 0x2F, 0x75, 0x98, 0x05, 0x00, 0xDE, 0x6C, 0xD4, 0x6E, 0x5C, 0x51, 0x09, 0x00, 0xB8,
+    0xD1, 0x88, 0xE5, 0x5C, 0x62, 0x28, 0x40, 0x78, 0xD3, 0x51, 0xA2, 0x59, 0xC3, 0x55, 0x00, 0x00,
+    0x07, 0xE4, 0x96, 0x13, 0x8B, 0x1A, 0x00, 0xE0, 0x45, 0xA7, 0x93, 0x27, 0x1F, 0x57, 0x00, 0x80,
+    0x9B, 0x8A, 0xD8, 0x8D, 0x26, 0xBA, 0x04, 0x00, 0x51, 0x9A, 0x4E, 0xB8, 0x45, 0x2C, 0x02, 0x00,
+    0x68, 0x3C, 0x83, 0x3D, 0xCE, 0xF8, 0x02, 0x00, 0xEC, 0x80, 0xB0, 0x8A, 0xCC, 0x30, 0x04, 0x00,
+    0xB8, 0xC1, 0xA0, 0xC5, 0xF8, 0x22, 0x08, 0x44, 0xCA, 0xE0, 0x3A, 0x7C, 0x52, 0x45, 0x52, 0x00,
+    0xF0, 0x85, 0x32, 0xA6, 0x42, 0x8C, 0x17, 0x01, 0x80, 0x4D, 0xE5, 0x8E, 0x07, 0x17, 0x6F, 0x11,
+    0x41, 0xAD, 0x81, 0x10, 0xC8, 0x20, 0x51, 0x01, 0x84, 0x37, 0x9B, 0xA8, 0x15, 0x47, 0xCC, 0x00,
+    0x00, 0x05, 0x92, 0xDF, 0x36, 0x4B, 0x69, 0x0A, 0x00, 0xEB, 0x70, 0xBC, 0x68, 0x32, 0x71, 0x06,
+    0x00, 0xCC, 0xD0, 0x8C, 0xF1, 0x44, 0x22, 0x0A, 0x00, 0xD8, 0x96, 0x58, 0x38, 0x82, 0x10, 0x10,
+    0x00, 0xF0, 0x40, 0xA4, 0xC5, 0x93, 0x87, 0x15, 0x00, 0x20, 0x8F, 0xA6, 0x6C, 0x48, 0x10, 0x71,
+    0x01, 0x00, 0xA5, 0x8A, 0x58, 0xCE, 0x25, 0x4A, 0x03, 0x00, 0x10, 0x14, 0xAE, 0x16, 0x55, 0x1C,
+    0x0A, 0x04, 0x71, 0x40, 0x81, 0x47, 0xAD, 0x78, 0x03, 0x00, 0x74, 0x61, 0x9C, 0x7A, 0xC4, 0x48,
+    0x03, 0x00, 0x60, 0xA1, 0x21, 0x2F, 0x3A, 0xA2, 0x0E, 0x00, 0x08, 0xA6, 0x72, 0x04, 0xBA, 0x46,
+    0x13, 0x80, 0xB0, 0x29, 0x93, 0xC7, 0x13, 0x8C, 0xC9, 0x00, 0xD0, 0x0D, 0x27, 0x0C, 0xA6, 0x15,
+    0x75, 0x00, 0x00, 0x22, 0x0E, 0xD3, 0x51, 0x12, 0xB6, 0x00, 0x04, 0x13, 0x29, 0x46, 0xA7, 0x59,
+    0x04, 0x05, 0x00, 0x79, 0x4C, 0x5B, 0x40, 0x6E, 0xB8, 0x01, 0x00, 0x14, 0x55, 0xB0, 0x6A, 0x0E,
+    0x91, 0x2A, 0x00, 0x54, 0xDB, 0x08, 0xED, 0x3C, 0xE1, 0x05, 0x40, 0x82, 0xC3, 0xC9, 0x92, 0x89,
+    0xC4, 0x06, 0x00, 0x90, 0x46, 0x83, 0xA9, 0x73, 0x8F, 0x54, 0x00, 0x40, 0x8E, 0x26, 0x6B, 0xC2,
+    0x1E, 0x93, 0x01, 0x00, 0x1B, 0x08, 0xD9, 0x92, 0x1B, 0x1E, 0x03, 0x00, 0x05, 0x12, 0xBA, 0x95,
+    0x6F, 0x1C, 0x02, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE, 0x88, 0x14, 0x02, 0xC4, 0x48, 0xE8, 0x64,
+    0xA0, 0xB1, 0x27, 0x10, 0x2C, 0xEB, 0xFC, 0x29, 0x91, 0x62, 0x24, 0x00, 0xB8, 0xA1, 0x59, 0x7A,
+    0x00, 0x47, 0xA3, 0x01, 0x70, 0x60, 0x21, 0x76, 0x82, 0x8C, 0xA2, 0x00, 0x20, 0x03, 0x08, 0x8C,
+    0xC6, 0x13, 0x8D, 0x10, 0x00, 0x13, 0x0C, 0xA1, 0xCB, 0x3D, 0x36, 0x04, 0x00, 0x05, 0x9E, 0xD9,
+    0x96, 0x9A, 0x7C, 0x04, 0x00, 0x69, 0x34, 0x43, 0x21, 0x83, 0x48, 0x12, 0x00, 0x08, 0x50, 0x22,
+    0x6B, 0xF4, 0x31, 0x0A, 0x00, 0xF8, 0xD1, 0x10, 0xE1, 0x58, 0x61, 0x06, 0x00, 0x20, 0xE0, 0x11,
+    0x45, 0x69, 0x49, 0x5F, 0x00, 0x90, 0x06, 0x44, 0xA5, 0x73, 0x87, 0x3B, 0x00, 0xF0, 0x0E, 0x07,
+    0xE9, 0x46, 0x0C, 0x7F, 0x00, 0x40, 0xA1, 0x4B, 0x18, 0x0A, 0x32, 0x12, 0x0B, 0x80, 0x3A, 0x9A,
+    0xA7, 0x18, 0x3E, 0x2C, 0x0A, 0x00, 0x8F, 0x36, 0x42, 0x31, 0x61, 0x68, 0x04, 0x00, 0xCC, 0x84,
+    0xE2, 0x78, 0x58, 0x11, 0x26, 0x08, 0xC4, 0x6B, 0x2C, 0x18, 0x41, 0x88, 0x11, 0x00, 0x68, 0xA3,
+    0x49, 0x33, 0xF1, 0xC6, 0x61, 0x00, 0x60, 0x49, 0xE3, 0x24, 0x73, 0x87, 0x4A, 0x00, 0x40, 0x4F,
+    0xA6, 0x6B, 0x47, 0x10, 0x31, 0x00, 0x00, 0x1C, 0x10, 0x98, 0x11, 0x1C, 0x46, 0x00, 0x00, 0x43,
+    0x9D, 0x29, 0x23, 0x30, 0xA4, 0x04, 0x00, 0x74, 0x2E, 0x8D, 0x30, 0xFF, 0x28, 0x05, 0x00, 0xD8,
+    0x14, 0xBC, 0x68, 0x32, 0xF1, 0x13, 0x00, 0xA0, 0xE8, 0x4C, 0xD9, 0xE4, 0xE1, 0x08, 0x00, 0x38,
+    0x04, 0x92, 0xBB, 0xF9, 0xC5, 0x0A, 0x00, 0xC4, 0x68, 0x93, 0x89, 0xC7, 0x87, 0x1E, 0x00, 0x20,
+    0x99, 0xE6, 0x73, 0x2D, 0x13, 0x63, 0x02, 0x80, 0x81, 0x0E, 0xE8, 0x8F, 0x3D, 0xA6, 0x00, 0x80,
+    0x7B, 0x05, 0x00, 0x9E, 0x00, 0x29, 0x01, 0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE, 0x18, 0x15, 0x10,
+    0x0A, 0x49, 0xC0, 0x74, 0x1C, 0x11, 0x27, 0x00, 0xF0, 0xDA, 0xBC, 0x4D, 0xCD, 0xE1, 0x0B, 0x00,
+    0x80, 0xA3, 0x11, 0x84, 0xE2, 0xC4, 0x91, 0x00, 0x50, 0x60, 0x13, 0x9B, 0x44, 0x8F, 0x19, 0x00,
+    0x20, 0x11, 0x68, 0x2C, 0xE7, 0x12, 0x9F, 0x01, 0x81, 0x9D, 0x8D, 0xDA, 0x8D, 0x2B, 0x32, 0x03,
+    0x00, 0x33, 0x97, 0x3D, 0xA8, 0x45, 0xE4, 0x05, 0x00, 0x73, 0x28, 0x77, 0x3F, 0xB1, 0x88, 0x03,
+    0x10, 0xE6, 0x35, 0x54, 0x66, 0x62, 0xA4, 0x03, 0x00, 0x38, 0x0A, 0x5D, 0x19, 0x85, 0x61, 0x11,
+    0x00, 0x08, 0xF0, 0xD9, 0x43, 0xB9, 0xC7, 0x0F, 0x00, 0xE0, 0xC4, 0xE3, 0xC6, 0xA3, 0x8A, 0xD4,
+    0x08, 0x00, 0x0E, 0xA8, 0x10, 0x28, 0x19, 0x97, 0x08, 0x02, 0x85, 0x54, 0x18, 0x15, 0x18, 0x46,
+    0x01, 0x80, 0x5F, 0x00, 0xAA, 0x1A, 0x3F, 0xB2, 0x00, 0x40, 0x3D, 0x3E, 0x58, 0x31, 0x91, 0xD8,
+    0x84, 0x08, 0x02, 0x25, 0x7A, 0x6A, 0x96, 0x10, 0x08, 0x00, 0xBC, 0x31, 0x11, 0xF6, 0x38, 0x23,
+    0x04, 0x00, 0xD0, 0xC4, 0xB9, 0xA2, 0x39, 0x44, 0x10, 0x00, 0x70, 0x4A, 0xA3, 0xAD, 0x91, 0x95,
+    0x4E, 0x00, 0x60, 0x8E, 0x09, 0x90, 0x27, 0x19, 0x57, 0x00, 0x00, 0x85, 0x0C, 0xD4, 0x8D, 0x1C,
+    0x06, 0x01, 0x00, 0x34, 0x1A, 0x2C, 0x12, 0x5F, 0x64, 0x01, 0x00, 0x68, 0x3C, 0x5C, 0x31, 0x9C,
+    0xB8, 0x01, 0x81, 0xD4, 0xA4, 0x1E, 0xC9, 0x16, 0x11, 0x06, 0x10, 0xC8, 0x5B, 0x40, 0xC9, 0xF0,
+    0x91, 0x0E, 0x00, 0x78, 0xD6, 0x08, 0xC1, 0x29, 0x91, 0x0F, 0x00, 0xF0, 0x66, 0x43, 0x67, 0x43,
+    0x8C, 0xD1, 0x00, 0xE0, 0x4D, 0x05, 0x08, 0x66, 0x0B, 0x79, 0x04, 0x40, 0x1D, 0x4D, 0xD7, 0xCE,
+    0x20, 0xF2, 0x00, 0x84, 0x3C, 0x91, 0xB1, 0x9C, 0x4C, 0x0C, 0x02, 0x00, 0x57, 0x42, 0x59, 0x39,
+    0x82, 0x48, 0x05, 0x00, 0x18, 0x4D, 0x98, 0x44, 0x3C, 0xD1, 0x14, 0x00, 0x68, 0xD8, 0xD0, 0xF1,
+    0xCC, 0xA2, 0x02, 0x00, 0xA8, 0xA3, 0x69, 0xA3, 0xE9, 0xC5, 0x1D, 0x00, 0x20, 0x80, 0x82, 0x38,
+    0x13, 0x8F, 0x38, 0x00, 0x40, 0xC7, 0x47, 0x51, 0xC8, 0x19, 0x85, 0x01, 0x00, 0x16, 0x4C, 0x10,
+    0x8A, 0x1B, 0x32, 0x07, 0x02, 0x34, 0x1C, 0x25, 0x19, 0x37, 0xEC, 0x0C, 0x01, 0x6C, 0x36, 0x69,
+    0x38, 0xAC, 0x38, 0x14, 0x00, 0xDA, 0x5C, 0x16, 0x57, 0x0C, 0x32, 0x28, 0x20, 0x04, 0xC0, 0x44,
+    0x95, 0x9C, 0x22, 0x30, 0x00, 0x60, 0x34, 0x09, 0xF4, 0x41, 0x46, 0x5D, 0x00, 0x40, 0xC7, 0x23,
+    0xE6, 0x33, 0x88, 0xAA, 0x00, 0xE4, 0xCA, 0x46, 0x84, 0xE6, 0x04, 0x51, 0x00, 0xC0, 0x11, 0xCD,
+    0x1E, 0xCF, 0x30, 0xEE, 0x00, 0x00, 0x37, 0xA4, 0xBB, 0x29, 0x40, 0xCC, 0x05, 0x00, 0x62, 0x3A,
+    0x48, 0x1A, 0xB3, 0x48, 0x0A, 0x00, 0x8F, 0x7C, 0x06, 0x79, 0xA2, 0xD1, 0x05, 0x00, 0xA8, 0xF8,
+    0x08, 0x12, 0xED, 0xA2, 0x2F, 0x00, 0x40, 0x23, 0x61, 0xDB, 0x51, 0x45, 0x15, 0x00, 0x60, 0x64,
+    0xA1, 0xF5, 0xE1, 0x8C, 0x23, 0x00, 0xC2, 0x07, 0xC7, 0xEA, 0xC6, 0x0F, 0x2F, 0x00, 0xC0, 0x9B,
+    0xCD, 0x91, 0x0B, 0x1C, 0x4E, 0x00, 0x00, 0x14, 0x9C, 0x25, 0x10, 0x52, 0x4C, 0x05, 0x00, 0x84,
+    0x3A, 0x7E, 0x35, 0xD9, 0xA8, 0x14, 0x08, 0x4E, 0x45, 0xB4, 0x6E, 0x0E, 0xB1, 0x07, 0x00, 0xBC,
+    0xD9, 0x50, 0x6D, 0x40, 0x63, 0x2E, 0x00, 0x50, 0x03, 0xAA, 0xD3, 0x01, 0x46, 0xA4, 0x40, 0xB0,
+    0x48, 0x03, 0x26, 0x43, 0x8A, 0x3E, 0x00, 0xC1, 0xCC, 0x47, 0xA9, 0x66, 0x0D, 0x79, 0x01, 0xC0,
+    0x9B, 0x8D, 0xDA, 0x8D, 0x2B, 0x16, 0x01, 0x00, 0x38, 0x13, 0x3D, 0x1A, 0x6A, 0x8C, 0x01, 0x00,
+    0x6B, 0x3E, 0x61, 0x44, 0x77, 0xA8, 0x02, 0x80, 0xD0, 0x68, 0x82, 0x50, 0xDC, 0xB0, 0x0A, 0x00,
+    0x38, 0xE1, 0x78, 0xF1, 0x08, 0x62, 0x29, 0x00, 0x30, 0x11, 0x69, 0x7A, 0x39, 0xC4, 0x50, 0x00,
+    0x60, 0x40, 0xD3, 0x46, 0x73, 0x8E, 0x33, 0x00, 0x00, 0x0F, 0x25, 0x0C, 0x86, 0x15, 0xA1, 0x01,
+    0x02, 0x85, 0x4B, 0x5A, 0xCD, 0x2C, 0x02, 0x01, 0x00, 0x34, 0x1A, 0xC3, 0x98, 0x78, 0xAC, 0x01,
+    0x00, 0x6F, 0x36, 0x6A, 0x37, 0xAE, 0x58, 0x04, 0x00, 0xD4, 0x6C, 0xEE, 0x5E, 0xB6, 0x91, 0x07,
+    0x00, 0xD8, 0xD9, 0xA8, 0xDD, 0xB8, 0xE2, 0x13, 0x00, 0x70, 0x02, 0x61, 0xCB, 0x61, 0x45, 0x0A,
+    0x00, 0x50, 0x47, 0x33, 0x27, 0x24, 0x8A, 0xC6, 0x02, 0xA0, 0x84, 0xE1, 0xAD, 0xE3, 0x1F, 0x35,
+    0x01, 0x00, 0xA3, 0x89, 0x95, 0xCE, 0x1D, 0x16, 0x01, 0x80, 0x38, 0x95, 0xB3, 0x98, 0x5D, 0x0C,
+    0x02, 0x00, 0x62, 0x24, 0x7D, 0x38, 0xD1, 0x98, 0x04, 0x00, 0xE4, 0x6C, 0xA2, 0x62, 0x04, 0xD1,
+    0x01, 0x00, 0x98, 0xE9, 0x4C, 0xD9, 0xF0, 0xA1, 0x12, 0x00, 0x88, 0x06, 0x01, 0x0A, 0x02, 0x12,
+    0x5B, 0x00, 0xA8, 0x00, 0x03, 0x16, 0xA3, 0x8A, 0x48, 0x00, 0x61, 0xCD, 0x65, 0x0B, 0xE7, 0x10,
+    0x49, 0x00, 0xC0, 0x9E, 0xCB, 0xD5, 0x8C, 0x22, 0x32, 0x01, 0x02, 0x2C, 0x9D, 0xB1, 0x9F, 0x41,
+    0x54, 0x02, 0x00, 0x6C, 0x34, 0x99, 0x4C, 0xCE, 0xA8, 0x02, 0x00, 0xD4, 0x68, 0xB0, 0x5C, 0x38,
+    0x91, 0x13, 0x00, 0xC8, 0xA9, 0xA4, 0x99, 0x68, 0xE3, 0x6F, 0x00, 0xC8, 0xB0, 0xE9, 0xEC, 0xB1,
+    0xC7, 0x15, 0x40, 0x80, 0x40, 0x73, 0xCA, 0x82, 0x92, 0x38, 0x00, 0x00, 0xC5, 0x46, 0xED, 0xC6,
+    0x15, 0x73, 0x00, 0x81, 0x9C, 0x4D, 0x11, 0x8E, 0x15, 0x3A, 0x01, 0x00, 0x33, 0xA0, 0xBF, 0x20,
+    0x5F, 0x7C, 0x00, 0x00, 0x6F, 0x36, 0x4C, 0x37, 0x6B, 0x88, 0x0C, 0x00, 0xE0, 0x68, 0x9E, 0x7E,
+    0xC2, 0x90, 0x02, 0x00, 0xA2, 0xC1, 0x58, 0xAD, 0x70, 0x62, 0x2F, 0x00, 0x58, 0xE3, 0x11, 0x83,
+    0x89, 0xC5, 0x1C, 0x80, 0xB0, 0x0D, 0x76, 0x9D, 0x68, 0x8B, 0x3C, 0x20, 0xA0, 0x8E, 0x08, 0x28,
+    0x65, 0x0D, 0x71, 0x00, 0x00, 0xA4, 0x4A, 0x4D, 0x08, 0x18, 0xC6, 0x00, 0x00, 0x36, 0x18, 0x2D,
+    0x9C, 0x41, 0xEC, 0x01, 0x00, 0x26, 0x34, 0x68, 0x39, 0xA7, 0x98, 0x01, 0x00, 0xDE, 0x6C, 0xC2,
+    0x88, 0xF2, 0x30, 0x18, 0x00, 0xF6, 0x11, 0xFD, 0xED, 0x30, 0xA3, 0x2F, 0x00, 0x50, 0x80, 0x00,
+    0xF2, 0x18, 0xC4, 0x5D, 0x04, 0xE0, 0xE1, 0xF3, 0xE4, 0x32, 0x88, 0x0E, 0x01, 0x20, 0x0F, 0x66,
+    0xCD, 0xA9, 0x0E, 0x51, 0x02, 0x40, 0x1C, 0x8F, 0x20, 0x4E, 0x36, 0x72, 0x02, 0x80, 0x44, 0x19,
+    0x4B, 0x1C, 0x7D, 0x3C, 0x02, 0x00, 0x1E, 0x38, 0x73, 0x3B, 0xB8, 0xD8, 0x13, 0x00, 0x10, 0x78,
+    0x24, 0x91, 0x92, 0xF1, 0x12, 0x40, 0xC8, 0xD9, 0x7C, 0xE1, 0x44, 0xA2, 0x0D, 0x40, 0x18, 0x20,
+    0x5A, 0xC3, 0x69, 0x45, 0x1B, 0x00, 0xE0, 0xAC, 0xC3, 0xB4, 0x43, 0x46, 0x43, 0x08, 0x80, 0xC2,
+    0x82, 0xA8, 0x83, 0x12, 0x77, 0x02, 0x40, 0x0E, 0x0D, 0x5D, 0x4C, 0x34, 0x56, 0x01, 0x00, 0x31,
+    0x0F, 0x34, 0x1F, 0x4A, 0x4C, 0x02, 0x04, 0x9F, 0x2A, 0x5B, 0x2B, 0xAD, 0xF4, 0x01, 0x00, 0xBC,
+    0x9C, 0x2C, 0xA9, 0x76, 0x51, 0x13, 0x00, 0xCC, 0xE9, 0x2C, 0xC9, 0xC0, 0x21, 0x27, 0x00, 0x50,
+    0x24, 0xFA, 0xBB, 0xB1, 0x46, 0x1B, 0x40, 0x40, 0x0E, 0x93, 0x32, 0xC2, 0x23, 0x46, 0x40, 0x00,
+    0xCB, 0xE6, 0x87, 0x04, 0x0E, 0x31, 0x00, 0x40, 0xA4, 0x4C, 0x52, 0x48, 0x26, 0x32, 0x00, 0x00,
+    0x41, 0x90, 0x30, 0x16, 0x5F, 0xD4, 0x05, 0x00, 0x68, 0x34, 0x5C, 0x31, 0x9C, 0xC8, 0x03, 0x00,
+    0xDE, 0x6C, 0xE0, 0x78, 0x4E, 0x51, 0x13, 0x00, 0x10, 0x08, 0x2D, 0xF6, 0x64, 0xE3, 0x12, 0x00,
+    0x70, 0x02, 0x20, 0x23, 0xF2, 0x43, 0x64, 0x00, 0xC4, 0x61, 0x81, 0xA4, 0xD1, 0x8A, 0xB8, 0x00,
+    0x20, 0x12, 0x29, 0x10, 0xE7, 0x1A, 0x7D, 0x00, 0x00, 0x34, 0x49, 0x54, 0x88, 0x2D, 0x09, 0x01,
+    0x00, 0x38, 0x1D, 0xB4, 0xA4, 0x3C, 0x74, 0x05, 0x00, 0x72, 0x28, 0x5A, 0x23, 0xC4, 0xA8, 0x1C,
+    0x00, 0x08, 0x70, 0x44, 0x5B, 0x42, 0xB2, 0x15, 0x00, 0x7A, 0x91, 0x90, 0xB9, 0xF8, 0x22, 0x32,
+    0x00, 0xB8, 0xA1, 0xC1, 0x8A, 0xD0, 0xC7, 0xA0, 0x00, 0xA0, 0x06, 0x73, 0x06, 0xE3, 0x8B, 0x4C,
+    0x01, 0xE0, 0x40, 0x28, 0xF3, 0x27, 0x1D, 0x9D, 0x00, 0x00, 0x91, 0x49, 0xD4, 0x4A, 0x24, 0x4A,
+    0x00, 0x80, 0x34, 0x21, 0xA8, 0x1B, 0x39, 0x1C, 0x06, 0x00, 0x07, 0x34, 0x86, 0x37, 0xE0, 0xD8,
+    0x04, 0x00, 0xF2, 0x64, 0xC2, 0x5C, 0x66, 0xD1, 0x01, 0x00, 0xF4, 0x79, 0x68, 0xAD, 0xB0, 0x22,
+    0x4F, 0x20, 0xE0, 0x43, 0x11, 0xB3, 0xF1, 0x44, 0x20, 0x00, 0x90, 0xC0, 0xF1, 0x65, 0x62, 0x8C,
+    0x39, 0x00, 0x80, 0x8E, 0xC6, 0x4C, 0x25, 0x19, 0x93, 0x00, 0xC0, 0xA1, 0x4E, 0xA3, 0x15, 0x29,
+    0x16, 0x01, 0x00, 0x28, 0x98, 0x4D, 0x23, 0x6F, 0xF4, 0x00, 0x00, 0x81, 0x2E, 0x54, 0x2E, 0x91,
+    0x38, 0x05, 0x00, 0xE6, 0x4C, 0xDE, 0x50, 0xBC, 0xB1, 0x16, 0x00, 0xB8, 0xB9, 0x68, 0xA9, 0xB4,
+    0xA2, 0x06, 0x00, 0xF8, 0x93, 0x21, 0x32, 0xE1, 0xC3, 0x27, 0x00, 0xA8, 0x86, 0x82, 0x96, 0x12,
+    0x8D, 0x51, 0x80, 0x40, 0x46, 0x07, 0x2C, 0x05, 0x18, 0x93, 0x01, 0x80, 0x82, 0x4A, 0x99, 0x4C,
+    0x2C, 0xB6, 0x02, 0x00, 0x22, 0x98, 0xAE, 0x91, 0x64, 0x04, 0x01, 0x01, 0x26, 0x30, 0x85, 0x26,
+    0x0A, 0xA9, 0x0B, 0x00, 0xCC, 0x68, 0x74, 0x68, 0x90, 0x90, 0x04, 0x10, 0xB8, 0xA1, 0xFC, 0xD1,
+    0x74, 0xE3, 0x0B, 0x20, 0xB0, 0xA3, 0x99, 0x82, 0x51, 0x44, 0x18, 0x00, 0x90, 0x21, 0x63, 0xF4,
+    0x71, 0x89, 0x00, 0x00
+};
+
+const struct fann_compressed_data compressed_data = {
+    3600, 21, 3, 65,
+    compressed_columns, compressed_dict, compressed_records
+};
+
+
+#endif // __THYROID_TEST_COMPRESSED__
@@ -0,0 +1,3654 @@
+#ifndef __THYROID_TEST_FAR__
+#define __THYROID_TEST_FAR__
+
+#include <stdint.h>
+
+
+uint16_t num_data = 3600;
+uint8_t num_input = 21;
+uint8_t num_output = 3;
+
+#include "fann.h"
+
+/* Far data set: 3600 records of 48 bytes, 172800 bytes in FRAM2 */
+#define FAR_NUM_INPUT                        21
+#define FAR_NUM_OUTPUT                       3
+
+const float far_scale[24] = {1.434348087e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05, 1.000000000e+00, 1.525902189e-05, 7.629510947e-06, 1.441977588e-06, 6.517128440e-06, 3.128099479e-06, 6.753642992e-06, 1.525902189e-05, 1.525902189e-05, 1.525902189e-05};
+const float far_offset[24] = {9.999999776e-03, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00, 5.000000237e-04, 2.899999963e-03, 2.800000086e-02, 2.400000114e-03, 0.000000000e+00, 0.000000000e+00, 0.000000000e+00};
+
+#pragma DATA_SECTION(far_chunk_0, ".fram2") // Place data in FRAM2
+const uint16_t far_chunk_0 [16368] = {
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 33634, 29016, 25894, 25705, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 10749, 18735, 21419, 19190, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 73, 12136, 13365, 16304, 16524, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 15604, 15513, 23976, 14600, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 16991, 16434, 20140, 17561, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 16297, 17354, 16624, 21115, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 20730, 30690, 16080, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 13592, 16434, 18222, 18745, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 197, 14910, 14592, 27493, 12379, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 13, 11443, 13672, 19501, 14896, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 16297, 13825, 26214, 12230, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 615, 8669, 21804, 21738, 21961, 0, 0, 65535,
+    26493, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 17661, 13746, 24224, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1966, 14078, 19963, 22058, 19930, 0, 65535, 0,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 13523, 15973, 17902, 18449, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 13939, 11370, 12468, 16672, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 14078, 16434, 21419, 16821, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 21037, 24296, 19190, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 9362, 16587, 31329, 12675, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 12136, 18582, 26534, 16228, 0, 65535, 0,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 16991, 24259, 17583, 28518, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 9362, 11217, 17583, 13119, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 7975, 8455, 17902, 9713, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 16991, 14746, 22058, 14748, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 111, 8669, 15206, 20140, 16376, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 12830, 18275, 21419, 18745, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 7, 24619, 13979, 23657, 13267, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 15604, 11217, 18542, 12675, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 15604, 16434, 23337, 15784, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 13592, 13518, 24296, 12675, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 354, 9362, 17968, 18222, 20522, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 19765, 14439, 23976, 13563, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4456, 4508, 7534, 26534, 6604, 65535, 0, 0,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10749, 17815, 24296, 16376, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16297, 16587, 20140, 17709, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 5895, 16741, 21099, 17265, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 11984, 15984, 15044, 0, 0, 65535,
+    49500, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 17047, 26534, 14748, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 12136, 14746, 22697, 14420, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 472, 13939, 13672, 25894, 12082, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 15604, 14746, 24296, 13119, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 14910, 19963, 21419, 20374, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10749, 14899, 19501, 16228, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 13592, 19042, 19501, 20818, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 44037, 28862, 22058, 28814, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 20883, 21738, 21039, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 9362, 11370, 13427, 15932, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 17815, 23337, 17265, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 16587, 33247, 12082, 0, 0, 65535,
+    55077, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 12136, 17968, 24296, 16821, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 62, 16297, 13672, 14066, 18597, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10748, 1040, 445, 23976, 471, 65535, 0, 0,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 16894, 26853, 14600, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 14078, 15820, 21099, 16376, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 10056, 15666, 18542, 17709, 0, 65535, 0,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 42, 18378, 14285, 35804, 9861, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    32070, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 11443, 16280, 19501, 17857, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 2427, 12291, 8312, 22447, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 14132, 23017, 13711, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 24413, 29091, 19782, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 13939, 10910, 18861, 12230, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 6588, 11063, 17263, 13267, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 380, 13592, 12137, 12468, 17709, 0, 0, 65535,
+    61352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 14910, 15666, 21099, 16228, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 31, 18378, 17508, 25575, 15636, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 144, 13939, 22111, 21419, 22447, 0, 0, 65535,
+    20915, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 58, 10056, 11063, 20460, 11638, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 170, 15604, 14439, 25894, 12675, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 12136, 12444, 22378, 12379, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 8, 28711, 35614, 26214, 31331, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 19071, 8762, 21419, 8973, 0, 0, 65535,
+    35556, 65535, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 14746, 20460, 15488, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 5895, 13979, 14705, 18449, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 12598, 18222, 14451, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1, 12830, 20423, 25255, 18449, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 18428, 18222, 21115, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1022, 11443, 10603, 20779, 11046, 0, 65535, 0,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 15604, 23185, 27493, 19634, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 16127, 23976, 15192, 0, 0, 65535,
+    697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 878, 6311, 4734, 23976, 4455, 65535, 0, 0,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 25312, 27788, 48592, 14748, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 15053, 24296, 14007, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 21152, 16434, 17263, 19486, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13523, 17661, 20460, 18745, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 17684, 15820, 22058, 15784, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 26006, 29169, 52748, 14451, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 11443, 12598, 17902, 14600, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 12136, 13211, 17583, 15192, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 157, 20458, 14132, 33886, 10157, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16297, 10910, 28132, 8973, 0, 0, 65535,
+    9063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 20458, 17047, 23017, 16524, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 45, 13939, 14132, 22697, 13711, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 13592, 15973, 24296, 14600, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 183, 15604, 10756, 25894, 9565, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 11370, 17583, 13415, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 14078, 17354, 24296, 15784, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 341, 12830, 17201, 23657, 16524, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 18428, 24296, 17117, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 14910, 15053, 24296, 13711, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 14287, 8669, 6306, 22378, 6308, 65535, 0, 0,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 12291, 16943, 14896, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 23492, 34526, 16672, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2752, 6311, 8762, 28132, 7196, 65535, 0, 0,
+    27887, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 39, 15604, 16587, 17583, 19486, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 13592, 27021, 16943, 32368, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 15604, 13672, 22697, 13376, 0, 0, 65535,
+    16035, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8651, 6588, 16741, 23337, 15932, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 3121, 7841, 18542, 8825, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 10056, 10756, 21738, 10879, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 170, 22538, 19502, 29731, 15488, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 115, 10749, 16127, 18222, 18449, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 14439, 26853, 12527, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 16297, 15513, 16943, 18597, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1296, 12136, 13211, 22697, 12971, 0, 65535, 0,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12136, 15513, 26534, 13563, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 19656, 21099, 20078, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 10056, 13825, 22058, 13711, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 144, 14078, 15513, 20140, 16524, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 10749, 15973, 24296, 14748, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 20423, 39001, 12971, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 12136, 21497, 20140, 22891, 0, 0, 65535,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13523, 23492, 28132, 19486, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 18378, 23492, 31009, 18153, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 8608, 18861, 9713, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1075, 14078, 11830, 23657, 11194, 0, 65535, 0,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17684, 24106, 19181, 26297, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 18378, 19809, 35485, 13859, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 10056, 23952, 28132, 19782, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 11443, 11984, 21738, 12082, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 8669, 16127, 16304, 19930, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 19071, 21651, 28132, 17857, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13592, 15666, 23337, 15044, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 273, 23232, 20270, 24296, 18745, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13592, 15053, 21738, 15192, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 16991, 16587, 31009, 12675, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 15206, 21738, 15340, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 249, 13592, 25180, 26534, 21855, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 25312, 24413, 38042, 15932, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16515, 8669, 5539, 25575, 5123, 65535, 0, 0,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 10056, 13058, 21099, 13563, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 12830, 17661, 25255, 15932, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 197, 13592, 14592, 19181, 16080, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 7975, 11217, 14705, 14748, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13523, 15820, 23337, 15044, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 12830, 18121, 25894, 16080, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 10056, 15820, 16304, 19486, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 13592, 21037, 20460, 22151, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 12830, 11523, 18222, 13119, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 7975, 13058, 11189, 20374, 0, 0, 65535,
+    697, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 17826, 13592, 7687, 15664, 9861, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 14910, 16938, 21738, 17081, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 10749, 15206, 30370, 11934, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 11443, 17201, 26534, 15044, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12830, 13979, 20140, 14748, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 12751, 23337, 12230, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 73, 14078, 20577, 20140, 22003, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 15604, 17047, 22697, 16659, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13523, 15666, 24296, 14451, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 21152, 19963, 39960, 12527, 0, 0, 65535,
+    54380, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 6588, 11984, 17263, 14303, 0, 0, 65535,
+    41134, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 13211, 18222, 15192, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 16991, 13979, 22378, 13859, 0, 0, 65535,
+    41831, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 12136, 12291, 13746, 16969, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13939, 13825, 28132, 11490, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 13979, 25894, 12379, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 13979, 16304, 17265, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 13979, 18542, 15784, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 11443, 18582, 26534, 16228, 0, 0, 65535,
+    59260, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 11063, 17263, 13267, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 25, 12830, 16280, 22058, 16228, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 14078, 14592, 19820, 15636, 0, 0, 65535,
+    50197, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 341, 10749, 13211, 21099, 13711, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 9222, 19501, 10157, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 26, 20458, 20270, 32288, 15192, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 13523, 18428, 27812, 15488, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 9362, 15360, 26214, 13563, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 773, 12136, 16938, 21738, 11342, 0, 0, 65535,
+    52289, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 3121, 8301, 22697, 8151, 0, 0, 65535,
+    47408, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 12751, 15025, 16672, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 12830, 20270, 23657, 19190, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 419, 14078, 11063, 24296, 10306, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 14910, 13825, 25575, 12527, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    42528, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 13523, 31624, 21738, 31924, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 8669, 16127, 15345, 20522, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3670, 11443, 12751, 23657, 12082, 0, 65535, 0,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4063, 17684, 6613, 23017, 6456, 65535, 0, 0,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 11443, 15666, 23657, 14896, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 118, 6588, 21190, 23657, 20078, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 1573, 21152, 13825, 21738, 13958, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 9836, 13746, 13563, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 21152, 15973, 24296, 14896, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 4587, 15604, 6000, 23337, 5715, 65535, 0, 0,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 144, 9362, 16434, 22697, 16062, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 18378, 17968, 22058, 17857, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 16894, 28132, 13859, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 7975, 7994, 14705, 10602, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 7282, 14899, 11509, 22743, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 288, 15604, 16894, 13107, 23928, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 262, 15604, 15206, 28132, 12675, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 11443, 17661, 26214, 15488, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1835, 11443, 13211, 23337, 12675, 0, 65535, 0,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 16991, 16280, 25255, 14748, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 9362, 17201, 20140, 18301, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 17661, 23657, 16672, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 12291, 15345, 15636, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 9362, 12598, 26853, 11046, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 11443, 11217, 18542, 12675, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 12830, 22725, 22058, 22595, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 16991, 19656, 20140, 20966, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1165, 11443, 9068, 15025, 11934, 0, 65535, 0,
+    48105, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 33, 19765, 20423, 37083, 13563, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 10749, 15206, 21099, 15784, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 8669, 17661, 18861, 19782, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 14132, 18542, 16080, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13939, 16741, 20460, 17561, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 957, 11443, 14132, 21419, 14358, 0, 65535, 0,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12136, 10756, 11509, 16524, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 16297, 20577, 29091, 16672, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13939, 14592, 18222, 16672, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 25026, 47633, 13563, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10749, 11370, 18222, 12971, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13939, 15206, 23976, 13415, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 590, 14078, 12291, 21419, 12527, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 22264, 18222, 25409, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1560, 17684, 11677, 19820, 12675, 0, 65535, 0,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 12830, 17661, 23657, 16821, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 10056, 14439, 18222, 16524, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 25640, 26214, 22595, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 12751, 21738, 12880, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 12136, 15666, 19820, 16969, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 12830, 18121, 23337, 17265, 0, 0, 65535,
+    18824, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 13939, 31624, 25575, 28370, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 13592, 17201, 31009, 13267, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 18378, 13365, 22697, 13119, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 11443, 17661, 26214, 15488, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 301, 10749, 11063, 20779, 11490, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 8, 26699, 22264, 23337, 21411, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 16297, 24873, 23017, 24076, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 8, 32178, 23645, 44756, 13563, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 20, 18378, 17354, 17263, 20818, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 10749, 16894, 19181, 18597, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 13939, 13058, 21419, 13267, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 16991, 15973, 23017, 15192, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 419, 14910, 17661, 22697, 17265, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 28711, 22725, 19181, 25112, 0, 0, 65535,
+    60655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 8669, 16434, 17263, 19486, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1442, 9362, 12137, 22697, 11934, 0, 65535, 0,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13592, 15973, 23976, 15044, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 18378, 17354, 27173, 14896, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16991, 18889, 27173, 16228, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16991, 18428, 26214, 16080, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 12137, 14705, 16080, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 8669, 17815, 19181, 19634, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 11443, 21651, 21099, 22299, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16297, 17201, 27493, 14451, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3408, 1734, 476, 16624, 770, 65535, 0, 0,
+    11852, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 13, 15604, 14592, 18222, 16672, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 12136, 15360, 14066, 20818, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 15604, 27328, 26534, 23928, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 8669, 9068, 15025, 11934, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 19349, 25575, 17413, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 14910, 12751, 25894, 11342, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 13592, 14592, 11189, 22743, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 19071, 16894, 28132, 13859, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 26699, 14439, 17902, 16672, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 236, 16991, 20423, 24296, 18745, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1573, 19765, 6306, 27173, 5419, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 16297, 16587, 26853, 14303, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 2427, 8148, 12787, 11934, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 19196, 22378, 19042, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1835, 46117, 42519, 18222, 48359, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3277, 5895, 7227, 17902, 8529, 65535, 0, 0,
+    39739, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 131, 12136, 16741, 14066, 22743, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 22418, 34845, 15784, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21845, 19349, 15664, 24520, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13523, 15666, 31968, 11934, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 14910, 16127, 26853, 13859, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 30860, 25794, 28132, 21559, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 170, 12136, 13979, 18542, 15932, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 446, 13939, 16741, 32608, 12379, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16297, 13518, 16304, 16672, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 11217, 20779, 11786, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 17684, 16894, 25894, 15044, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 15604, 11370, 16624, 13859, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 16297, 15360, 22058, 15488, 0, 0, 65535,
+    52289, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 10749, 19349, 22697, 18894, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 1152, 13523, 13518, 17263, 16080, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 13939, 19502, 22378, 19190, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 13518, 19501, 14748, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    48803, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13523, 15360, 22697, 15044, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 20, 14078, 14439, 23976, 13711, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 315, 13592, 26254, 28132, 21855, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 20423, 22378, 20078, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 94, 11443, 21651, 25575, 19338, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 957, 11443, 21344, 31329, 16376, 0, 65535, 0,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 16297, 11830, 24296, 10898, 0, 0, 65535,
+    41134, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 27393, 9989, 23017, 9565, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 17508, 25894, 15488, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 9362, 14746, 10230, 24076, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 9362, 10449, 16624, 12823, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 3146, 6311, 9222, 29411, 7492, 65535, 0, 0,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 16297, 20730, 28132, 17117, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 3121, 15513, 24296, 14303, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13523, 13365, 18222, 15340, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 878, 13592, 8148, 14386, 11046, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 58, 7282, 9682, 23017, 9417, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 14910, 17661, 23337, 16969, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 8669, 16127, 21738, 16267, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 197, 10749, 9682, 27812, 8085, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 12830, 12444, 12468, 18153, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 11443, 12137, 23017, 11638, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 10056, 13058, 22378, 12971, 0, 65535, 0,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 10749, 14592, 19181, 16080, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    2789, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 31164, 36124, 21263, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 6588, 13672, 19820, 14748, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 48891, 33773, 23017, 32516, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 22538, 12137, 19501, 13267, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 17684, 16894, 27173, 14451, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 17684, 16615, 22697, 16239, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 9529, 15664, 12230, 0, 0, 65535,
+    54380, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 16297, 14746, 14386, 19634, 0, 0, 65535,
+    57866, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13939, 32238, 22697, 31627, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 17354, 25575, 15488, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 12830, 23799, 25255, 21559, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 17684, 17047, 21419, 17413, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1, 10056, 12444, 22697, 12230, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 14078, 24873, 23017, 24076, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 113, 11443, 14592, 21738, 14748, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 14, 13592, 21190, 19820, 22891, 0, 0, 65535,
+    54380, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 10056, 20883, 22058, 20818, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 17684, 13672, 19820, 14748, 0, 0, 65535,
+    29282, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13939, 24106, 23976, 22743, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 37102, 24413, 14386, 32516, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 12830, 16894, 23976, 15932, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4194, 6311, 7994, 19501, 8825, 65535, 0, 0,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 13211, 22058, 13267, 0, 0, 65535,
+    17430, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 12136, 22111, 16304, 27037, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 18428, 22058, 18449, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 7975, 15820, 26214, 13859, 0, 0, 65535,
+    697, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13939, 21804, 20779, 22595, 0, 0, 65535,
+    63443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 8669, 17968, 17902, 20818, 0, 0, 65535,
+    54380, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 5895, 12751, 18222, 14748, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1152, 13592, 25026, 31968, 18894, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 12830, 13058, 24296, 12230, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13523, 13825, 22058, 13859, 0, 0, 65535,
+    18824, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 9, 13592, 25947, 45715, 14600, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 341, 14910, 21037, 33567, 15192, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 18378, 23338, 36764, 15784, 0, 0, 65535,
+    18824, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13592, 23645, 20140, 25260, 0, 0, 65535,
+    9063, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 21152, 16741, 24296, 15340, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 249, 11443, 15973, 25575, 14303, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 14942, 5201, 178, 24296, 213, 65535, 0, 0,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 5895, 18275, 19820, 19782, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 12136, 14439, 21738, 14574, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 223, 7282, 13979, 20140, 14896, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 11443, 13672, 22697, 13376, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 21037, 21738, 21263, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3539, 7975, 20883, 25894, 18597, 0, 65535, 0,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 13592, 14592, 14066, 19634, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3539, 15604, 20270, 40280, 12675, 0, 65535, 0,
+    13246, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 32941, 2931, 22697, 2927, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 14910, 15360, 34206, 10898, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 13939, 14285, 19181, 15784, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 20458, 15820, 26853, 13859, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 3238, 8951, 6012, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 13592, 24259, 18861, 27037, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 18, 12830, 10756, 28132, 8973, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 708, 14078, 15206, 26214, 13415, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 210, 13592, 14285, 21738, 14451, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 304, 14078, 16938, 21738, 17081, 0, 0, 65535,
+    10458, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 17684, 16280, 22697, 15932, 0, 0, 65535,
+    56472, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 9362, 17201, 14705, 22595, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 19765, 18735, 23657, 17709, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 19071, 14746, 12468, 21559, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 7994, 19820, 8825, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16991, 19963, 28132, 16672, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 23925, 25026, 34206, 17857, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 7282, 14132, 16304, 17413, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 15513, 20779, 16228, 0, 0, 65535,
+    9063, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 19071, 13825, 18542, 15784, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 12136, 22571, 24296, 21115, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 19765, 18275, 23657, 17265, 0, 0, 65535,
+    39042, 65535, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 16297, 17354, 19501, 18894, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3670, 11443, 12598, 23337, 12082, 0, 65535, 0,
+    30676, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 393, 13592, 15206, 19181, 16821, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3539, 11443, 10910, 23337, 10602, 0, 65535, 0,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5374, 10056, 6920, 28132, 5715, 65535, 0, 0,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 13523, 16280, 20779, 16969, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 15604, 15360, 25575, 13711, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 367, 17684, 16587, 18861, 18449, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 7975, 15666, 17902, 18153, 0, 65535, 0,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 10749, 13211, 17263, 15636, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 7975, 16127, 14386, 21559, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 11443, 19349, 26214, 16821, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 14132, 20460, 14896, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 9222, 19181, 10306, 0, 0, 65535,
+    56472, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13592, 17354, 14705, 22891, 0, 0, 65535,
+    39042, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 25794, 20460, 27185, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 13592, 13979, 21419, 14303, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13523, 9836, 14386, 13267, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 10749, 12444, 21738, 12527, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14910, 15820, 15025, 20522, 0, 0, 65535,
+    33465, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 13592, 18889, 17902, 21855, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 17968, 26534, 15636, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 3277, 11720, 10449, 24296, 9713, 0, 65535, 0,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13592, 21344, 28132, 17561, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 210, 11443, 18735, 21738, 18894, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 354, 15604, 12904, 28132, 10602, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 14910, 20423, 30690, 15932, 0, 65535, 0,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 10056, 18889, 21419, 19338, 0, 65535, 0,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 16297, 17508, 23657, 16672, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 19765, 17354, 28132, 14303, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 11443, 21190, 27812, 17857, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 26006, 27175, 41239, 16672, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13939, 13211, 21419, 13563, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 996, 15604, 19656, 27812, 16376, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 25952, 6311, 322, 21419, 459, 65535, 0, 0,
+    23704, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 17201, 21738, 17561, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13592, 13518, 15664, 17117, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 8669, 11830, 14705, 15636, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 16297, 18275, 21738, 18421, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 12136, 10603, 18542, 12082, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 24, 10056, 15360, 21738, 15497, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 16991, 27175, 30370, 21263, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16741, 19820, 18005, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 10749, 15666, 22697, 15316, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 16297, 14899, 22697, 14570, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 33, 13592, 15206, 15345, 19486, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 10756, 15664, 13711, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 11443, 15666, 20140, 16672, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 15604, 13825, 18542, 15636, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 13592, 11984, 21099, 12379, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 55, 8669, 9836, 25575, 8825, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 12136, 12751, 17263, 15192, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 13939, 16615, 14066, 17117, 0, 0, 65535,
+    48105, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12136, 25640, 22697, 24964, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 10056, 12904, 19501, 14155, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 8669, 15666, 24296, 14600, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 865, 9362, 20577, 26853, 17857, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 13592, 13825, 19181, 15340, 0, 0, 65535,
+    31373, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 24259, 22697, 23780, 0, 0, 65535,
+    16732, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 92, 13939, 27635, 36124, 18894, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13592, 14899, 15345, 19190, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 904, 11443, 12137, 20140, 12971, 0, 65535, 0,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 7282, 10143, 11509, 15488, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 111, 13592, 29630, 46354, 16376, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 13211, 18861, 14748, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 10056, 15973, 18542, 18005, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 7975, 9989, 2877, 26889, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 839, 15604, 12598, 24296, 11490, 0, 65535, 0,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 26, 18378, 11677, 22378, 11638, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13523, 11523, 17902, 13415, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 248, 10749, 12751, 15984, 16080, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 13523, 27635, 24296, 25409, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13939, 16280, 26534, 14155, 0, 0, 65535,
+    27190, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 13523, 8301, 12787, 12082, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 14078, 15973, 22697, 15636, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 3408, 20458, 8915, 19181, 9861, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 8669, 15666, 21099, 16228, 0, 0, 65535,
+    53683, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 9989, 23017, 9713, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 12136, 13979, 21099, 14451, 0, 0, 65535,
+    23007, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 52, 13939, 16280, 20140, 17413, 0, 0, 65535,
+    23007, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3539, 30167, 41445, 30050, 32516, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 249, 15604, 20270, 25255, 18301, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 13, 12136, 13825, 22697, 13526, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 19765, 17354, 21738, 17499, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 7282, 9375, 12468, 13711, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1049, 11443, 11217, 21419, 11490, 0, 65535, 0,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1, 37795, 33159, 16624, 40215, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 170, 14078, 11984, 19820, 12971, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 459, 10056, 12291, 20460, 12971, 0, 0, 65535,
+    28584, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1165, 8669, 11063, 14705, 14748, 0, 0, 65535,
+    39042, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 16434, 21099, 16969, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2412, 13523, 15666, 23017, 15176, 0, 65535, 0,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 7975, 14439, 19820, 15488, 0, 0, 65535,
+    34162, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1966, 13523, 10449, 25575, 9417, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 16991, 8762, 20140, 9269, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 13, 13939, 16894, 20140, 18153, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 7975, 11370, 18222, 13119, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 18378, 16894, 24296, 15488, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 695, 14078, 13672, 24296, 12675, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 8669, 13979, 23657, 13267, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 11443, 19809, 20779, 20522, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 25640, 49871, 13267, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 8669, 18121, 16624, 22151, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 15666, 21099, 16228, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 19071, 18582, 28132, 15340, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 1, 13939, 26561, 26534, 23039, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 19196, 26534, 16672, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 16991, 23645, 22058, 23632, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 7282, 13518, 18542, 15192, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 10056, 14899, 29411, 11934, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 15666, 20779, 16376, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 16991, 22111, 27173, 18745, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 16741, 27493, 14155, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 7975, 14592, 17583, 17117, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 7975, 16434, 16624, 20078, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13592, 12291, 18542, 14007, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3146, 5895, 9068, 19820, 9861, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 9362, 15973, 18542, 18005, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12444, 15984, 15636, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 262, 16991, 13365, 24296, 12230, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 14078, 12291, 17263, 14600, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 15604, 13365, 16943, 16228, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 14078, 16894, 19181, 18597, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 10056, 17815, 19820, 19190, 0, 0, 65535,
+    62049, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 347, 3851, 16304, 4827, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 7282, 11677, 14386, 15636, 0, 0, 65535,
+    6972, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 13939, 15666, 18222, 18005, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 10056, 16894, 24296, 15340, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1075, 5895, 19196, 20140, 20522, 0, 65535, 0,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 301, 15604, 13825, 31649, 10454, 0, 0, 65535,
+    22310, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 210, 13592, 12598, 23657, 11934, 0, 0, 65535,
+    61352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 10056, 17968, 20460, 18894, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13523, 19502, 20779, 20226, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 8, 21152, 23492, 21099, 24224, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 9362, 14132, 19820, 15192, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 13592, 17201, 22058, 16969, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 891, 11720, 21651, 32288, 16080, 0, 65535, 0,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 16127, 27812, 13563, 0, 0, 65535,
+    15338, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 13592, 30857, 33886, 22151, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13939, 16280, 20140, 17413, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 10749, 21344, 23337, 20522, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 10056, 14746, 19820, 15932, 0, 65535, 0,
+    39042, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14078, 29169, 21738, 29350, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 6588, 8762, 19181, 9713, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 11443, 15513, 19820, 16821, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 10749, 18275, 16304, 22447, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 16297, 19502, 21419, 19930, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 97, 13523, 16127, 10230, 26297, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 15604, 17968, 21099, 18597, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 23232, 22111, 34206, 15784, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 18378, 16127, 24296, 14896, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 17968, 22058, 18005, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 12136, 11984, 19501, 13119, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13592, 16434, 26534, 14303, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 5, 12830, 17508, 15664, 22299, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 19071, 15820, 33247, 11638, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 66, 5201, 18428, 28132, 15192, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 11443, 22264, 21419, 22595, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13523, 17047, 18222, 19486, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 6588, 20883, 16624, 25409, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 19765, 19502, 16624, 23780, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 4508, 16434, 20779, 17117, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 12598, 13107, 17857, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 19765, 12904, 26214, 11342, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 170, 14910, 15513, 20460, 16524, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13523, 19042, 27173, 16376, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 16297, 20883, 27812, 17561, 0, 0, 65535,
+    31373, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 21190, 22378, 20818, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 13523, 14592, 12468, 19042, 0, 0, 65535,
+    0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 865, 11443, 9989, 23017, 9703, 0, 65535, 0,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 8669, 10603, 19820, 11490, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 14592, 31968, 11046, 0, 0, 65535,
+    57169, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13523, 17354, 13746, 23780, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 996, 13592, 15820, 25255, 14451, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13592, 13825, 13107, 19634, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 537, 12830, 12598, 22697, 12230, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 14910, 12137, 15984, 15192, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 11443, 10910, 25255, 9861, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 248, 13939, 13211, 26214, 11638, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 11443, 12291, 18542, 14007, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 12, 14910, 29936, 22058, 29851, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 15604, 11984, 23337, 11490, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 10056, 25947, 27812, 21707, 0, 0, 65535,
+    57866, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 15604, 15053, 16943, 18153, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 16991, 13058, 21419, 13415, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 10056, 12904, 21099, 13415, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 14910, 17661, 19501, 19190, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 10749, 14132, 18222, 16228, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 210, 12136, 17047, 22378, 17413, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14078, 20270, 25575, 18153, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 21152, 19349, 22697, 18898, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13523, 17354, 31329, 13267, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 20, 13592, 26100, 26853, 22447, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23986, 9362, 1703, 32927, 1273, 65535, 0, 0,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 10749, 12751, 14066, 17265, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 22264, 27173, 19042, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12136, 20116, 23657, 19042, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 59, 21845, 19502, 49551, 10157, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 12830, 9682, 18222, 11046, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 16991, 29323, 25575, 26297, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 19765, 19809, 24296, 18005, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13523, 11984, 19181, 13267, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 5895, 13825, 18861, 15488, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 197, 13592, 13672, 18861, 15340, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 8669, 12751, 19181, 14303, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 17815, 26853, 15340, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 15604, 12904, 20779, 13563, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 102, 15604, 17354, 14386, 23187, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 12136, 14439, 23337, 13859, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 12136, 12444, 15025, 16376, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 8669, 11830, 23657, 11342, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 105, 14910, 14439, 26214, 12675, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 304, 13592, 15206, 21738, 14748, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 15604, 16938, 21738, 17081, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 9961, 3121, 2931, 26853, 2458, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 4508, 10143, 20779, 10602, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 19071, 17508, 22378, 16524, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 19765, 13672, 20779, 14451, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 92, 13523, 6460, 22697, 6361, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 9989, 11509, 15340, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 19071, 21344, 22697, 20818, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13592, 11830, 17263, 14155, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13939, 14132, 25575, 12675, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 83, 10749, 15973, 20779, 16672, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 12136, 24106, 26214, 21263, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 13939, 27175, 24296, 25112, 0, 0, 65535,
+    60655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13523, 18428, 28132, 15488, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13523, 18121, 24296, 16821, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 11443, 11370, 19820, 12230, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 96, 13523, 22878, 27812, 19042, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4194, 10056, 14285, 22378, 14155, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 13939, 10603, 16624, 12971, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 13592, 16127, 16624, 19486, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 16297, 15820, 23017, 15340, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 12136, 11984, 28132, 10009, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 15604, 12444, 22378, 12379, 0, 0, 65535,
+    13944, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2884, 10056, 15973, 20140, 17117, 0, 65535, 0,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 12136, 13825, 21419, 14049, 0, 65535, 0,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 73, 13592, 11984, 19820, 12971, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 30860, 14439, 22697, 14123, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 170, 13592, 17508, 19501, 19042, 0, 0, 65535,
+    17430, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1231, 11720, 10296, 21419, 10602, 0, 65535, 0,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 13523, 14132, 17583, 16672, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 14910, 13058, 21738, 13267, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 62, 9362, 6000, 14386, 8233, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 16297, 19502, 26534, 16969, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 210, 13592, 17508, 25255, 15784, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 13939, 12904, 19501, 14155, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 11443, 14439, 16304, 17709, 0, 0, 65535,
+    54380, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 17684, 23032, 30370, 18005, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 6588, 14285, 20779, 15044, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 5895, 20577, 21419, 20966, 0, 0, 65535,
+    31373, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1271, 3121, 5232, 14066, 7196, 65535, 0, 0,
+    8366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 6588, 15360, 14066, 20670, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 7282, 7534, 2557, 21115, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 15604, 15513, 24296, 14451, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 157, 8669, 16280, 20460, 17117, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 12751, 20140, 13563, 0, 0, 65535,
+    27887, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 26407, 25575, 23484, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 9362, 14899, 16624, 18005, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 144, 14910, 17201, 21419, 17561, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4325, 12830, 9529, 21099, 10009, 0, 65535, 0,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 131, 6588, 15206, 13107, 21559, 0, 0, 65535,
+    20915, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 13592, 19196, 18861, 21411, 0, 0, 65535,
+    27887, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 20458, 14285, 16943, 17265, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 97, 14078, 19042, 25255, 17265, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 13592, 27942, 45395, 15784, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577, 15604, 17661, 28132, 14600, 0, 0, 65535,
+    8366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13592, 11217, 22378, 11046, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 891, 14910, 11370, 23017, 11034, 0, 65535, 0,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13592, 21651, 19501, 23632, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 14285, 23976, 13415, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 14078, 12751, 20460, 13415, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 17968, 23976, 16821, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 18378, 24259, 20460, 25557, 0, 0, 65535,
+    62746, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13939, 16741, 22697, 16376, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13523, 17354, 24296, 15932, 0, 0, 65535
+};
+
+#pragma DATA_SECTION(far_chunk_1, ".fram2") // Place data in FRAM2
+const uint16_t far_chunk_1 [16368] = {
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 682, 13592, 14592, 14705, 19190, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13939, 10603, 15025, 13859, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 12830, 16434, 14386, 21855, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 14910, 11523, 24296, 10750, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10749, 16741, 27173, 14451, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 210, 13592, 20423, 25255, 18597, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13592, 11370, 16943, 13711, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9568, 6311, 6153, 18861, 6900, 65535, 0, 0,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2621, 16991, 8455, 25255, 7640, 65535, 0, 0,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 315, 8669, 6153, 19820, 6752, 0, 0, 65535,
+    2092, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 15360, 18542, 17413, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 10056, 14592, 14066, 19782, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 23492, 21419, 23928, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 760, 8669, 8301, 21738, 8418, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 10749, 18121, 27173, 15488, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 12830, 13672, 20460, 14600, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 7, 7282, 10143, 15984, 12675, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 5, 13523, 21958, 24296, 20226, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 15604, 17815, 21419, 18153, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 13592, 14439, 21099, 14896, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 9362, 17968, 17263, 21263, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 12830, 15820, 24296, 14451, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 16280, 35165, 11342, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12291, 17583, 14451, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13523, 16894, 17902, 19486, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 8669, 13211, 19820, 14155, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 14910, 14285, 20779, 14896, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 14910, 19809, 20779, 20670, 0, 0, 65535,
+    20218, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12830, 15973, 18222, 18301, 0, 0, 65535,
+    18127, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 27393, 28249, 51149, 14451, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 3, 13592, 16894, 20779, 17709, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 18428, 28132, 15044, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 8669, 14899, 18542, 16969, 0, 0, 65535,
+    23704, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 11443, 17047, 22378, 16672, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 9362, 14132, 26534, 12379, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 23925, 29323, 19820, 31479, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 7975, 10296, 13746, 14303, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 10749, 15053, 26214, 13267, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14910, 15973, 26853, 13859, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 16280, 16624, 19782, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 3814, 11523, 17902, 13415, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 52, 13939, 16894, 24296, 15340, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13939, 17508, 25575, 15636, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 14910, 10449, 15984, 13119, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 24619, 17201, 30370, 13415, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13592, 14439, 30370, 11342, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 19765, 20270, 16943, 24372, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 236, 13523, 15206, 17583, 18005, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 7975, 12444, 12468, 18153, 0, 0, 65535,
+    29979, 65535, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 2752, 13939, 11217, 19820, 12082, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12830, 17201, 29091, 14007, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 26006, 38376, 30690, 29851, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 10749, 19196, 22697, 18745, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 19071, 14285, 17263, 17117, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 957, 11443, 19042, 19820, 20522, 0, 65535, 0,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 11443, 14132, 21738, 14303, 0, 0, 65535,
+    39042, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13939, 18121, 16304, 22299, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13939, 12904, 20140, 13711, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13939, 20883, 25255, 18745, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 15604, 18735, 21419, 19190, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16991, 15820, 22378, 15636, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 17201, 22058, 17265, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 14078, 15206, 26853, 13119, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 262, 10749, 17354, 20779, 18153, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 13939, 15206, 19501, 16672, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 8669, 20423, 21099, 21115, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 19765, 20730, 30050, 16376, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 76, 17684, 14899, 23337, 14303, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 16297, 19042, 29411, 15340, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 2621, 19071, 10910, 21419, 11105, 0, 65535, 0,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 7975, 18428, 19820, 19930, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12830, 21344, 22378, 21115, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 15973, 22697, 15636, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 11443, 19196, 20779, 20078, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 249, 13592, 17047, 19820, 18449, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 25312, 22878, 20779, 23928, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 7975, 10756, 16624, 13119, 0, 65535, 0,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13523, 11523, 21099, 12527, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1087, 12830, 14132, 28132, 11638, 0, 65535, 0,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 16991, 11984, 14386, 16228, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 7282, 21037, 19820, 22743, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 14078, 12751, 16943, 15488, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 1704, 16991, 14285, 33567, 10454, 0, 65535, 0,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 16297, 15053, 28132, 12379, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25034, 5201, 322, 23976, 363, 65535, 0, 0,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 3814, 11830, 14066, 15932, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 14078, 16894, 25894, 16672, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    28584, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 107, 14078, 18121, 15664, 22891, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 5201, 24259, 22058, 24224, 0, 0, 65535,
+    16035, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 12830, 9989, 23976, 9417, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 22538, 23492, 44436, 13415, 0, 0, 65535,
+    18824, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13592, 15973, 25575, 14303, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13592, 12751, 21419, 13119, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 10056, 12137, 29091, 9861, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 8669, 20883, 22378, 20670, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 13939, 24413, 25255, 22151, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 10056, 14132, 15984, 17709, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13523, 11830, 23017, 11490, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 577, 13592, 19042, 34206, 13563, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 26407, 26853, 22743, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 13592, 11677, 14705, 15488, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 14910, 11217, 23337, 10750, 0, 65535, 0,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 14592, 19820, 15784, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 12830, 13211, 19181, 14748, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2359, 10056, 9682, 23017, 9417, 0, 65535, 0,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13592, 26868, 27173, 23039, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 18275, 26853, 15784, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 14910, 17201, 23657, 16524, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 21152, 9068, 21099, 9417, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 7975, 5539, 21419, 5715, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 10056, 16741, 19501, 18301, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 8669, 15053, 18542, 16969, 0, 0, 65535,
+    11155, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 15206, 20779, 15932, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 367, 13592, 17047, 21099, 17709, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 98, 13592, 19349, 23976, 18153, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 14910, 11984, 19820, 12971, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 13592, 10296, 12468, 15044, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 14910, 16587, 23337, 15932, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 485, 13592, 15666, 17583, 18449, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 524, 13592, 20730, 39001, 13267, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14078, 27635, 23657, 26149, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 11443, 14439, 24296, 13415, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 16297, 13825, 24296, 12823, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7340, 33634, 5232, 15984, 6604, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 341, 20458, 18735, 27173, 16080, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 12830, 16127, 20779, 16821, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 11443, 25794, 37723, 16969, 0, 0, 65535,
+    32767, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 9, 11443, 15513, 21738, 15651, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12830, 22725, 22378, 22447, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 18735, 28132, 15636, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 3121, 13825, 15025, 18005, 0, 0, 65535,
+    24401, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13592, 25487, 22378, 25112, 0, 0, 65535,
+    48105, 65535, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 4850, 8669, 13979, 23017, 13563, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 786, 17684, 19196, 31009, 14748, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 304, 13592, 15513, 23976, 14600, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 12136, 15973, 18222, 18301, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 16297, 20116, 20460, 21115, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 11443, 10143, 21738, 10306, 0, 65535, 0,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14078, 12444, 19820, 13415, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 122, 7282, 11370, 21738, 11496, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 8669, 12904, 19501, 14007, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 7975, 11063, 9271, 19190, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13523, 12444, 19820, 13415, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 16991, 15820, 22058, 15932, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12137, 25575, 10898, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 16991, 21651, 29091, 17561, 0, 0, 65535,
+    41831, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16991, 17047, 20779, 17709, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 24619, 20883, 39960, 13119, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 8, 12136, 20883, 22697, 20392, 0, 0, 65535,
+    43922, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 14746, 20460, 15636, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 19765, 17201, 25255, 15488, 0, 0, 65535,
+    6972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 12136, 16280, 17263, 19338, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 16991, 18428, 27812, 15488, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 223, 13523, 16127, 22058, 16080, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 17684, 13672, 19501, 14896, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 25312, 21344, 27173, 18301, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 472, 12830, 12137, 27173, 10454, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 131, 9362, 12291, 18542, 13859, 0, 0, 65535,
+    15338, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13592, 19042, 20779, 19930, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 13523, 11830, 13427, 16524, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 68, 9362, 19349, 21738, 19486, 0, 0, 65535,
+    21613, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 15604, 23645, 24296, 21855, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 5895, 12137, 26214, 10750, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14910, 19809, 19181, 21855, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 262, 16991, 16280, 23976, 15192, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 16297, 20577, 28132, 16821, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 16587, 21419, 16969, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 12830, 11217, 19181, 12379, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 16991, 11830, 19181, 13119, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 37102, 22878, 39001, 14748, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 1040, 17201, 20460, 18301, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 6588, 6613, 12148, 10009, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 11443, 13979, 18222, 16080, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13592, 23799, 20140, 25409, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13523, 18889, 25894, 16821, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 11443, 12904, 18861, 14451, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 13592, 17815, 24296, 16524, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 2427, 11830, 9271, 20374, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 14592, 26853, 12527, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 10056, 19656, 26853, 16969, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13592, 21497, 21738, 21653, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 16991, 13825, 25894, 12230, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 8669, 11984, 20140, 12823, 0, 65535, 0,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14910, 16741, 22378, 16672, 0, 0, 65535,
+    35556, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 315, 19071, 17661, 23337, 16969, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 18, 6588, 15360, 12148, 22743, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7282, 16127, 12148, 24076, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 5895, 13672, 13746, 18745, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13518, 20140, 14451, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 16434, 18861, 18301, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 13592, 26714, 20140, 28370, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 13592, 13365, 23657, 12823, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 13592, 11063, 23657, 10454, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 19349, 24296, 17857, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 17684, 11217, 18222, 12823, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 511, 13592, 13365, 23657, 12675, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 21152, 16434, 24296, 15044, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 16991, 18428, 23017, 17857, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 9362, 11523, 17263, 13859, 0, 0, 65535,
+    43225, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 13592, 14899, 21419, 15340, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 8669, 12291, 19181, 13711, 0, 65535, 0,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 14910, 12751, 13107, 18301, 0, 0, 65535,
+    39042, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 347, 8148, 15984, 10306, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 7534, 24296, 6900, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 12, 12830, 16127, 15664, 20374, 0, 0, 65535,
+    19521, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 14910, 21344, 20779, 22299, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 18378, 12904, 25255, 11638, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 16297, 15820, 18861, 17709, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3, 13592, 22418, 22378, 22151, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 55, 6588, 17201, 26534, 15044, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 20458, 21497, 33247, 15636, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 13523, 17661, 27493, 14896, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 13592, 29783, 47313, 16228, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 380, 13523, 14285, 20140, 15340, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1835, 13592, 8301, 17583, 9861, 0, 0, 65535,
+    23007, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 41956, 27481, 23017, 26593, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12830, 14132, 24296, 12971, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 262, 14910, 18428, 39641, 11638, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 223, 13592, 14132, 18542, 15932, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 9362, 16280, 14386, 21559, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 16587, 26534, 14451, 0, 0, 65535,
+    46711, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 15360, 22058, 15340, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 9362, 9222, 21738, 9340, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 13939, 15206, 17902, 17561, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13939, 15360, 23337, 14748, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 13592, 18275, 17902, 21115, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12845, 23925, 1550, 19820, 1718, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 11443, 11217, 11828, 16821, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 17684, 30704, 23337, 29258, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 12136, 15820, 21419, 16080, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 10749, 11984, 26214, 10602, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 7975, 8915, 18861, 10009, 0, 0, 65535,
+    6275, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 14592, 22697, 14303, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10749, 19349, 30050, 15340, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 5895, 14746, 22697, 14451, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 14910, 20116, 21419, 20522, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 6588, 21804, 22697, 21286, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 19502, 23976, 18301, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 249, 15604, 16741, 18861, 18745, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 7282, 18582, 18222, 21115, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 14078, 13365, 19181, 14748, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 3814, 12904, 18861, 14451, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 5895, 14746, 15984, 18449, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 16741, 21419, 17117, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 13592, 18735, 18861, 21115, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16991, 16587, 32608, 12230, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 10749, 11830, 11509, 18153, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 695, 13592, 14592, 15025, 18894, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 8915, 15664, 11342, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 11443, 15053, 20779, 15784, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 12291, 21738, 12527, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12830, 20116, 22378, 19930, 0, 0, 65535,
+    50197, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1114, 14078, 15513, 27173, 13267, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 7282, 10756, 16304, 13415, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 10056, 11984, 18542, 13563, 0, 0, 65535,
+    35689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 19809, 23657, 18745, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 419, 16297, 15206, 19181, 16821, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 7282, 8762, 19820, 9565, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 7282, 8762, 11509, 13563, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 10056, 14132, 12468, 20670, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 865, 9362, 17201, 21099, 17709, 0, 65535, 0,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 13592, 18121, 26534, 15784, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 170, 7975, 18428, 22378, 18301, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 459, 13592, 15973, 22378, 15784, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 22538, 20883, 23017, 20226, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 9362, 13211, 15345, 16969, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 16991, 14439, 20140, 15488, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 11443, 15820, 22058, 15932, 0, 65535, 0,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 3814, 8455, 14386, 11342, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 13592, 20577, 26534, 17857, 0, 0, 65535,
+    13944, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 5201, 11370, 21738, 11496, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14910, 13518, 15345, 17413, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 13592, 11984, 9271, 20670, 0, 0, 65535,
+    36253, 65535, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 10, 13939, 19042, 19820, 20522, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 14910, 22725, 20140, 24224, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 14592, 17583, 17265, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 10603, 10869, 16821, 0, 0, 65535,
+    26493, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 16297, 22264, 25255, 20078, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 16991, 16434, 31968, 12230, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 393, 12830, 15820, 22697, 15466, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 26006, 21958, 36444, 14896, 0, 0, 65535,
+    55774, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 157, 15604, 13211, 27493, 11194, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 9362, 19042, 21738, 19190, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1022, 11443, 11370, 15345, 14600, 0, 65535, 0,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 11443, 15973, 23337, 15340, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 20730, 17902, 24076, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 10056, 16127, 21099, 16672, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13523, 14746, 16624, 18005, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 14078, 17201, 24296, 16080, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 39, 12830, 17508, 25575, 15636, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10749, 20577, 21419, 20966, 0, 0, 65535,
+    54380, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 13523, 15973, 24296, 15044, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 15604, 22878, 20779, 23780, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 11830, 18542, 13415, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 157, 11443, 13672, 15345, 17561, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 8669, 21958, 20140, 23336, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 5767, 6311, 4312, 24296, 3939, 65535, 0, 0,
+    34859, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 131, 14910, 10143, 24296, 9417, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 11443, 22571, 18861, 25112, 0, 0, 65535,
+    50197, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 10749, 21497, 24296, 19486, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 20, 19765, 19809, 27493, 16821, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 459, 14078, 26714, 23017, 25853, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 7282, 19349, 16624, 23632, 0, 0, 65535,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 10749, 11677, 12148, 17413, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 15604, 13672, 16624, 16524, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 15973, 19820, 17265, 0, 0, 65535,
+    24401, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 16297, 27021, 34526, 19042, 0, 0, 65535,
+    13944, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 13825, 14386, 18449, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13523, 22418, 25894, 19782, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12136, 20270, 21099, 21115, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13523, 18889, 18222, 21559, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 26006, 24413, 24296, 22595, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 13592, 13979, 22058, 14007, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13939, 13365, 28132, 11046, 0, 0, 65535,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13939, 25026, 22058, 24816, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 13211, 22058, 13267, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 13592, 20116, 23657, 19042, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 10749, 16615, 22697, 16239, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 328, 13523, 20116, 28132, 16672, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 197, 19765, 13211, 23017, 12823, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12830, 14899, 22378, 14748, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 12830, 10143, 22697, 9943, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 11443, 15206, 15345, 19486, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 14078, 21037, 27493, 17857, 0, 0, 65535,
+    27887, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 13939, 19349, 34206, 13859, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 183, 15604, 14132, 22378, 14007, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13523, 9989, 20779, 10454, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 14078, 12904, 19501, 14155, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 12136, 15666, 20460, 16524, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 18378, 19502, 22697, 19046, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 21845, 21958, 29411, 17709, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13939, 26407, 24296, 24520, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 14078, 14899, 21419, 15192, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 5895, 15206, 21099, 15784, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 6613, 7672, 12379, 0, 0, 65535,
+    11852, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 14132, 20779, 14748, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 839, 5895, 15206, 22058, 15340, 0, 65535, 0,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 11523, 21738, 11638, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 8669, 16587, 21099, 17117, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 15604, 19502, 30690, 15192, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 5201, 12751, 12148, 18894, 0, 65535, 0,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12136, 27175, 17263, 32072, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 10056, 22725, 21738, 22885, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13592, 22111, 22058, 22151, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 10749, 18428, 23657, 17413, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 7975, 16280, 15984, 20374, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 13939, 17661, 21099, 18301, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 20458, 21804, 30370, 16969, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 8762, 17263, 10306, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 125, 13523, 20423, 23337, 19486, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 144, 12136, 11984, 18861, 13415, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 8669, 16938, 21738, 17081, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 20458, 15666, 22697, 15340, 0, 0, 65535,
+    5577, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 21845, 18735, 18222, 21411, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 16297, 14746, 27173, 12675, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12136, 12137, 20460, 12823, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 236, 14910, 15053, 27173, 12971, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 262, 21152, 20270, 28132, 16672, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 144, 12830, 15820, 28132, 13119, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 14910, 20116, 28132, 16524, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 22538, 23645, 31968, 17857, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 3814, 12751, 18861, 14451, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13523, 17815, 18542, 20078, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 17661, 26534, 15488, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 12904, 14386, 17265, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 7975, 13365, 17263, 15932, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 35, 12136, 14592, 25575, 13119, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 13592, 10910, 22697, 10750, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1126, 25312, 19656, 43797, 11342, 0, 65535, 0,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 15604, 18275, 26214, 16080, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 9362, 9682, 15984, 12230, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 14910, 25947, 26214, 22891, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 8669, 12444, 11189, 19338, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13523, 18121, 19501, 19782, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 14078, 16741, 31009, 12971, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 210, 13592, 16434, 23976, 15340, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 20116, 29411, 16228, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 12136, 16280, 20140, 17265, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 8, 36408, 31778, 18861, 35329, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 31317, 44116, 18153, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 11443, 13672, 23976, 12971, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 14078, 13365, 19501, 14600, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 367, 13523, 13825, 24296, 12823, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 11443, 14132, 16304, 17561, 0, 0, 65535,
+    18824, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 19071, 14899, 22697, 14570, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 13365, 16304, 16524, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 13592, 14132, 17263, 16821, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 6588, 9836, 21738, 10009, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13939, 16587, 26214, 14600, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 10, 30860, 29936, 27812, 25112, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 10056, 17661, 15025, 22891, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 393, 9362, 15360, 19181, 17117, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13523, 16434, 22697, 16080, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 14078, 18121, 23657, 17117, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26006, 38222, 27173, 32516, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 11443, 15973, 17902, 18449, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 130, 10056, 9222, 8951, 16376, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 5895, 16587, 24296, 15488, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 197, 13523, 15053, 19181, 16672, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 13592, 15513, 22697, 15340, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 111, 14078, 13825, 21738, 13958, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 13939, 17354, 26214, 15192, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 15604, 16894, 21738, 17117, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 5895, 17201, 15025, 22299, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2228, 6311, 4925, 17583, 5864, 65535, 0, 0,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16297, 20423, 25255, 18449, 0, 0, 65535,
+    11155, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 10749, 20730, 17902, 23928, 0, 0, 65535,
+    38345, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 15053, 16304, 18597, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13523, 15053, 27173, 12675, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3539, 12136, 9529, 22697, 9417, 0, 65535, 0,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 7282, 18889, 19501, 20670, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 35021, 25180, 23017, 24520, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 11443, 21037, 15664, 26593, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 55, 12830, 16280, 15664, 20078, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 14078, 17354, 12468, 25260, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 12904, 16624, 15784, 0, 0, 65535,
+    9063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 17047, 23976, 16080, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577, 10749, 14899, 23337, 14303, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 10749, 16894, 22697, 16524, 0, 0, 65535,
+    18824, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13939, 20730, 29731, 16672, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 262, 11443, 17201, 24296, 15192, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 20458, 23185, 27493, 19634, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 17684, 20883, 19820, 22299, 0, 0, 65535,
+    19521, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 14078, 16280, 27493, 13859, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 157, 14078, 19502, 22697, 19042, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 13939, 14592, 21099, 15044, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13523, 13058, 22697, 12778, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 15820, 20140, 16969, 0, 0, 65535,
+    13944, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 10749, 14746, 18861, 16524, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 14132, 15664, 17857, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 9, 21152, 23492, 16943, 28222, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13939, 21037, 36124, 14303, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13939, 8608, 7033, 17265, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1075, 9362, 19042, 26534, 16524, 0, 65535, 0,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10056, 18582, 25575, 16672, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 11443, 15206, 22378, 15044, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 15604, 29016, 38042, 18894, 0, 0, 65535,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13939, 17508, 22378, 17413, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 15604, 21497, 21419, 22003, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 12136, 12137, 17902, 14303, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 3, 30167, 35614, 20460, 37402, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 11443, 9836, 18861, 11046, 0, 65535, 0,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 8669, 15973, 18222, 18301, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 16297, 19349, 21099, 19930, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 9362, 12751, 15025, 16524, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6816, 7975, 9529, 20460, 10157, 0, 65535, 0,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 21152, 15206, 15025, 19782, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 11443, 14592, 17902, 16969, 0, 65535, 0,
+    12549, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 13592, 33926, 33886, 24372, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 14746, 18222, 16969, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 13672, 17583, 16080, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10749, 12444, 20140, 13267, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 4508, 9682, 28132, 7936, 0, 0, 65535,
+    36253, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13939, 7534, 25894, 20374, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 13523, 18735, 22058, 18597, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 288, 13592, 14746, 23976, 13711, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 9362, 16434, 15984, 20670, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13523, 14439, 29411, 11638, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12598, 15025, 16376, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22544, 6311, 4005, 17902, 4827, 65535, 0, 0,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 98, 15604, 17815, 21099, 18301, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1049, 11720, 9682, 12148, 14451, 0, 65535, 0,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 52, 13939, 13518, 21738, 13711, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 13592, 17661, 21738, 17807, 0, 0, 65535,
+    53683, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1075, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 18121, 32288, 13563, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 786, 13523, 15360, 22697, 15019, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 7282, 13672, 17902, 15932, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 33, 23232, 22725, 27173, 19486, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 10749, 10143, 17263, 11934, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 19071, 13672, 30050, 10750, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 16297, 23799, 28132, 19486, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 13592, 14592, 16943, 17561, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 16297, 13058, 10869, 20670, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 14592, 19501, 15932, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 10749, 16587, 15664, 21115, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 15604, 12904, 21738, 12971, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 8669, 16894, 17902, 19634, 0, 0, 65535,
+    6972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 18378, 14746, 23017, 14303, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 15053, 19820, 16228, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 13, 16991, 14899, 22378, 14896, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 11443, 18889, 30690, 14600, 0, 0, 65535,
+    8366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13592, 15206, 16624, 18597, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 12830, 13672, 23017, 13267, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 419, 11443, 12904, 15025, 16821, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 13523, 15053, 25894, 13267, 0, 0, 65535,
+    42528, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 10143, 18861, 11342, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 5201, 14746, 22058, 14748, 0, 65535, 0,
+    20218, 65535, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 12830, 17815, 17583, 20818, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 15053, 20460, 15932, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 27635, 42198, 16524, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 249, 13592, 18275, 15984, 22743, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 71, 13592, 11063, 13746, 15340, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 13939, 14592, 23657, 13859, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 13523, 13518, 18222, 15488, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 14910, 13518, 18222, 15488, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10056, 18735, 24296, 17117, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 22538, 23032, 29091, 18745, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 10056, 20270, 22697, 19794, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13523, 14746, 21738, 14896, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 11063, 12787, 15932, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 13592, 18582, 18542, 20966, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 12830, 19963, 22697, 19486, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 354, 16297, 20883, 22378, 20670, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 472, 13523, 12444, 15984, 15636, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 11984, 18542, 13563, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 10749, 17354, 20140, 18449, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 10749, 18735, 21419, 19190, 0, 0, 65535,
+    22310, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13939, 16741, 17583, 19486, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 17684, 16587, 24296, 15192, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 5112, 11720, 12291, 28132, 10009, 0, 65535, 0,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 8913, 1734, 9989, 19181, 11046, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 813, 4508, 7994, 9590, 13859, 0, 65535, 0,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 5895, 14439, 20779, 15044, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2359, 1734, 6306, 8951, 11046, 0, 65535, 0,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 8669, 11370, 11828, 17117, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 14078, 11830, 19501, 13119, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 35, 14078, 13672, 24296, 12675, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 26, 16991, 20730, 27812, 17265, 0, 0, 65535,
+    14641, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 13592, 23952, 24296, 22299, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 11443, 7381, 8951, 13119, 0, 0, 65535,
+    43225, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 8669, 14285, 20460, 15044, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 10749, 10756, 22058, 10750, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 19071, 27328, 31329, 20966, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 249, 12136, 17047, 23657, 16228, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 485, 13523, 7687, 13746, 10750, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 14439, 21738, 14574, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 15604, 12137, 23657, 11490, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 6588, 8762, 14705, 11638, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 197, 13592, 22571, 42198, 13563, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 14910, 16894, 28132, 14007, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 7282, 16434, 17902, 19042, 0, 65535, 0,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 14078, 19042, 23337, 18301, 0, 0, 65535,
+    8366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13979, 20140, 14896, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 11443, 12444, 22697, 12230, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 14078, 13825, 24296, 12675, 0, 0, 65535,
+    31373, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 65535, 0, 0, 0, 0, 0, 695, 10749, 13825, 20140, 14748, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 629, 13592, 8301, 16624, 10157, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 10, 14910, 19502, 20140, 20818, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 83, 13592, 16587, 22697, 16376, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 328, 21152, 17815, 30370, 14007, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13523, 15206, 17263, 18153, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 10749, 19656, 21419, 20078, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 5895, 9068, 8312, 16672, 0, 0, 65535,
+    8366, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 14078, 12137, 19181, 13415, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 16297, 18889, 20460, 19782, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 11523, 8631, 20670, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 11443, 10756, 15984, 13563, 0, 65535, 0,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 16991, 15206, 26214, 13415, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48891, 27788, 23976, 25853, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 14910, 11830, 25255, 10750, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 12598, 14386, 16821, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1060, 14078, 17661, 24296, 16228, 0, 65535, 0,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 26006, 19042, 27493, 16228, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 564, 7975, 3698, 23976, 3494, 0, 0, 65535,
+    36951, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 459, 11443, 16894, 21738, 17037, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 8762, 18861, 9861, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 12136, 13979, 17263, 16672, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 33, 14078, 21804, 23976, 20522, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 15604, 16587, 24296, 15192, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 101, 19071, 16434, 20140, 17561, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 13211, 14705, 17561, 0, 0, 65535,
+    54380, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 249, 13523, 28556, 24296, 26297, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 20, 18378, 19963, 24296, 18449, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13523, 17968, 21738, 18153, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 16127, 25894, 14303, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 24259, 19820, 26297, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14910, 15973, 21419, 16376, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 10910, 9590, 18153, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 26, 14910, 15820, 15025, 20522, 0, 0, 65535,
+    52289, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 13592, 9529, 20140, 10157, 0, 0, 65535,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 17968, 22378, 17709, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 13592, 14746, 21099, 15192, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 14910, 12291, 16624, 15044, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 92, 13939, 6613, 18861, 7344, 0, 0, 65535,
+    32070, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 12136, 20116, 22058, 20078, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 14910, 16615, 22697, 16239, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 12830, 19963, 22697, 19486, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 223, 12136, 10603, 13107, 15044, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 79, 13523, 17047, 23017, 16524, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 7282, 22264, 25894, 19782, 0, 0, 65535,
+    17430, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 5, 10749, 14439, 23017, 13711, 0, 0, 65535,
+    46014, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 7975, 19196, 20460, 20226, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 13592, 15206, 21738, 15340, 0, 0, 65535,
+    43225, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 10, 12830, 28095, 21738, 28272, 0, 0, 65535,
+    46711, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 5895, 11217, 11189, 17561, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 721, 14910, 15973, 18542, 18005, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 9362, 17661, 23657, 16821, 0, 0, 65535,
+    35556, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5767, 16991, 9682, 30050, 7640, 65535, 0, 0,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3146, 7282, 14899, 17263, 17709, 0, 65535, 0,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 14078, 24719, 34526, 17561, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4456, 11443, 18428, 25255, 16672, 0, 65535, 0,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 13592, 16434, 24296, 15340, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 341, 13592, 12291, 25255, 11194, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 826, 9362, 9682, 11509, 14896, 0, 65535, 0,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 16991, 15513, 29411, 12379, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 8669, 12751, 23657, 12082, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 15604, 17815, 19820, 19190, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 10749, 12291, 13427, 17117, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 21190, 22058, 21115, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 354, 15604, 13518, 22697, 13267, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5374, 11720, 17661, 27173, 15192, 0, 65535, 0,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12830, 13518, 21738, 13711, 0, 0, 65535,
+    29282, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 19765, 19196, 18861, 21559, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 13592, 9222, 19181, 10306, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12136, 18121, 21099, 18745, 0, 0, 65535,
+    40436, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 18378, 17508, 14705, 22891, 0, 0, 65535,
+    47408, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 347, 7841, 13746, 10898, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12830, 13825, 17902, 16080, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 45424, 37609, 19501, 41104, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 852, 15604, 15053, 27493, 12823, 0, 65535, 0,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 10749, 10756, 16624, 13267, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14078, 17508, 21419, 17857, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10056, 16434, 16624, 19930, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 15604, 8762, 19501, 9713, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1245, 14078, 21037, 38682, 13563, 0, 65535, 0,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 13592, 19196, 23657, 18153, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 15604, 12137, 19181, 13267, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 524, 16297, 18428, 21738, 18575, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 13365, 20140, 14303, 0, 0, 65535,
+    34859, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16991, 17508, 17583, 20522, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 12136, 12137, 15664, 15488, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 12830, 15206, 18861, 17117, 0, 0, 65535,
+    11852, 65535, 65535, 0, 0, 0, 0, 0, 65535, 65535, 65535, 0, 0, 0, 0, 0, 3277, 7282, 20423, 21738, 20818, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 3814, 11677, 20140, 12527, 0, 0, 65535,
+    32767, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 4438, 17201, 16624, 20966, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 16991, 27175, 31009, 20966, 0, 0, 65535,
+    30676, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1180, 19071, 35921, 28132, 29702, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 19765, 14899, 24296, 13711, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13523, 12291, 11189, 19190, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 11443, 13979, 23017, 13563, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 590, 13592, 14439, 18222, 16524, 0, 0, 65535,
+    9063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 20458, 19196, 26534, 16821, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 865, 10056, 16587, 18542, 18745, 0, 65535, 0,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 13523, 13979, 22697, 13674, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 8669, 14899, 18222, 17117, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12830, 16280, 23976, 15340, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 15604, 13825, 23337, 13267, 0, 0, 65535,
+    26493, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 12830, 13979, 20779, 14600, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 1734, 10756, 15984, 13563, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13523, 15820, 23337, 15192, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 14078, 14132, 25255, 12823, 0, 65535, 0,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2359, 12830, 14439, 20779, 15044, 0, 65535, 0,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9568, 15604, 12904, 26853, 11194, 0, 65535, 0,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 15604, 15206, 23017, 14748, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 17047, 27493, 14451, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 106, 13592, 18889, 21738, 19042, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 14078, 13825, 21738, 14007, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 1100, 11443, 13979, 17902, 16228, 0, 65535, 0,
+    55774, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 79, 3814, 18428, 20140, 19634, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1060, 12136, 8608, 21738, 8677, 65535, 0, 0,
+    55077, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 695, 13523, 12751, 23657, 11934, 0, 0, 65535,
+    39042, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 15666, 21099, 16080, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 14078, 13979, 23017, 13563, 0, 0, 65535
+};
+
+#pragma DATA_SECTION(far_chunk_2, ".fram2") // Place data in FRAM2
+const uint16_t far_chunk_2 [16368] = {
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13523, 15820, 19820, 17117, 0, 0, 65535,
+    14641, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 12, 14910, 28556, 23657, 27037, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 157, 13939, 17201, 22058, 16524, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 11443, 18582, 6713, 37106, 0, 0, 65535,
+    7669, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 20458, 26561, 19501, 28814, 0, 0, 65535,
+    21613, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 25312, 20883, 33886, 15044, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12136, 12137, 20779, 12675, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3408, 13523, 13211, 39001, 8381, 65535, 0, 0,
+    28584, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 27393, 30243, 40919, 18597, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 760, 7282, 6767, 22697, 6752, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 14910, 14746, 23657, 14007, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 19765, 24873, 26853, 21411, 0, 0, 65535,
+    36951, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 11370, 19820, 12379, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 11443, 27942, 16624, 33848, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 11443, 8148, 19820, 8825, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 8669, 13825, 18861, 15488, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 13365, 19820, 14451, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 17684, 14592, 21419, 14896, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 136, 16991, 17354, 19501, 19042, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3670, 16991, 13609, 23017, 13193, 0, 65535, 0,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 10056, 19502, 18542, 22003, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13365, 19501, 14600, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 8669, 17661, 26853, 15192, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 10449, 10550, 16821, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 10749, 14439, 15984, 18153, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 304, 12830, 16938, 21738, 17081, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 12904, 29411, 10454, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 14910, 14285, 18542, 16080, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14078, 14746, 18222, 16969, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 9362, 21651, 22697, 21138, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 17508, 22697, 17117, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 17661, 19181, 19486, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 64, 11443, 15053, 15025, 19486, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 15604, 14285, 11828, 21559, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 682, 7282, 16741, 15984, 20818, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 13592, 24873, 43477, 14600, 0, 0, 65535,
+    30676, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 15820, 21738, 15932, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 11370, 11189, 17709, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13592, 23952, 24296, 22299, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 16991, 14592, 24296, 13267, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 236, 13592, 17354, 21099, 17857, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 10749, 14746, 20460, 15636, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 25026, 34206, 17857, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 341, 4508, 17201, 22697, 16809, 0, 0, 65535,
+    10458, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 3801, 12830, 8455, 23976, 7936, 65535, 0, 0,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 19071, 16615, 22697, 16239, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 1040, 6153, 11189, 9713, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 66, 15604, 17201, 23017, 16672, 0, 0, 65535,
+    17430, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 27393, 25333, 41239, 15340, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20458, 31778, 38362, 20670, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13523, 21190, 24296, 19486, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 14910, 12291, 22697, 12032, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 11370, 19501, 12527, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14078, 14592, 19820, 15784, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 88, 13592, 16127, 22697, 15784, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 4508, 14746, 21099, 15192, 0, 0, 65535,
+    52289, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 46, 9362, 20883, 20460, 22003, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 16991, 20116, 27173, 17265, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 9, 14910, 20730, 18222, 23632, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 10749, 13979, 24296, 12823, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12830, 15666, 19820, 16969, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1573, 11720, 11370, 24296, 10454, 0, 65535, 0,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10749, 12444, 18861, 14007, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 10, 13939, 18889, 23017, 18301, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 7282, 25640, 21738, 25705, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 8669, 16127, 17583, 18894, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 10749, 14746, 21099, 15192, 0, 0, 65535,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 10749, 18582, 19501, 20226, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 13523, 15513, 18861, 17413, 0, 0, 65535,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 865, 14910, 15360, 18542, 17413, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12830, 14746, 17583, 17265, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10749, 15666, 18861, 17413, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 15604, 19809, 21099, 20374, 0, 0, 65535,
+    64141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 20577, 24296, 19042, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 13672, 23976, 12823, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 11443, 14439, 20140, 15488, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 288, 12136, 18428, 24296, 17117, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 682, 13592, 15360, 37723, 10157, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 957, 16297, 9682, 25894, 8677, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13523, 13058, 21419, 13267, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 12136, 19196, 27493, 16228, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 14078, 7994, 18222, 9269, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 16, 15604, 15820, 20460, 16672, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 11443, 16280, 17902, 18894, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 13592, 10910, 34526, 7640, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 18582, 23337, 17709, 0, 0, 65535,
+    58563, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 17047, 10550, 27333, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 773, 7975, 7687, 16304, 9565, 0, 0, 65535,
+    13944, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 17201, 13746, 23632, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 23645, 24296, 21559, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 12904, 20460, 13711, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 21152, 20270, 22697, 19794, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 721, 4508, 11370, 14705, 15044, 0, 0, 65535,
+    6972, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 19071, 13672, 22058, 13711, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 12136, 11523, 11828, 17561, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 25180, 40280, 15636, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 46811, 16280, 21738, 16376, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 13592, 29783, 19501, 32368, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13893, 2427, 1089, 26534, 933, 65535, 0, 0,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 26699, 28095, 21099, 28962, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13523, 11063, 21738, 11188, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11443, 17354, 22697, 16958, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 5895, 8915, 22697, 8677, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1114, 10749, 16741, 20140, 17857, 0, 65535, 0,
+    50894, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 9362, 16280, 17583, 19042, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 826, 11443, 21958, 30050, 17265, 0, 65535, 0,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13939, 16894, 17263, 20078, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 472, 12136, 20883, 26534, 18153, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 15973, 25255, 14451, 0, 0, 65535,
+    36253, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 14078, 11063, 18542, 12527, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 10449, 23337, 10009, 0, 0, 65535,
+    48105, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 13939, 24413, 26853, 21263, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 17661, 19181, 19338, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 32178, 18428, 0, 65535, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 262, 20458, 14439, 27493, 12230, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4194, 14078, 12137, 14386, 16228, 0, 65535, 0,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 21152, 22725, 35804, 15636, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 11443, 15820, 21099, 16524, 0, 65535, 0,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14078, 27635, 23657, 26149, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 19071, 22264, 25894, 19782, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14078, 12904, 20779, 13563, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12136, 21344, 24296, 19634, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 15604, 13979, 19820, 15192, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 19071, 12444, 22697, 12379, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 97, 26699, 22264, 39960, 14007, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 9529, 20779, 10009, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 577, 16297, 17201, 27493, 14600, 0, 0, 65535,
+    38345, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 13592, 20116, 12148, 29851, 0, 0, 65535,
+    41831, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 157, 15604, 14285, 14066, 19338, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 13592, 18428, 27812, 15488, 0, 0, 65535,
+    39042, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2884, 16297, 16741, 21738, 16883, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 75, 13592, 20730, 15345, 26593, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 577, 12830, 12137, 19820, 12971, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 15604, 18582, 17263, 22003, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 14910, 18582, 32927, 13711, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 16587, 20779, 17265, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14078, 16741, 22697, 16362, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 11443, 25180, 29731, 19930, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 18735, 25575, 16672, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 16297, 15820, 22058, 15784, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 12830, 8915, 17263, 10602, 0, 65535, 0,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 11443, 17661, 22697, 17265, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 13592, 21190, 46354, 11638, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 13592, 23185, 46993, 12675, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 13939, 14132, 22378, 14155, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 23232, 19349, 39960, 12082, 0, 0, 65535,
+    13246, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 20458, 16280, 24296, 14896, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 13939, 14439, 13107, 20522, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12830, 14439, 23017, 14007, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 273, 11443, 19656, 23017, 18894, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 72, 14078, 11063, 23337, 10602, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 15604, 13365, 22378, 13267, 0, 65535, 0,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 12830, 17354, 22697, 16958, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 10749, 17201, 22697, 16809, 0, 0, 65535,
+    4880, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 16297, 18889, 21738, 19042, 0, 0, 65535,
+    60655, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 14910, 15053, 23017, 14600, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 21845, 16127, 25255, 14451, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 12830, 17815, 23017, 17265, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 13592, 9529, 25255, 8677, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 17815, 21099, 18449, 0, 0, 65535,
+    32070, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 13592, 16894, 20140, 18153, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14910, 13058, 19820, 14155, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 16297, 13979, 28132, 11638, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 433, 12830, 16938, 28132, 15192, 0, 0, 65535,
+    38345, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16280, 19501, 17709, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 25165, 6311, 4344, 23657, 4149, 65535, 0, 0,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 16587, 25575, 14748, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 170, 13592, 18735, 21099, 19338, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 14899, 20140, 15932, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 11063, 15025, 14451, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12830, 23492, 21738, 23655, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13523, 13518, 15984, 16969, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13592, 22264, 23976, 20966, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 3, 9362, 13365, 16943, 16080, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 14910, 13979, 16943, 16821, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 6588, 15206, 20140, 16228, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 10056, 15206, 21738, 15340, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 15604, 19502, 23976, 18301, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 10749, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 7975, 14285, 20779, 14896, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 13592, 27175, 37723, 17857, 0, 0, 65535,
+    51591, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 48, 11443, 15053, 15664, 19042, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 13592, 18428, 22697, 18005, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 14078, 16894, 21099, 17413, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 8669, 15513, 24296, 14303, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 341, 14910, 24413, 24296, 22743, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 328, 13592, 16127, 22378, 15932, 0, 0, 65535,
+    35556, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 15666, 17583, 18449, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13523, 10910, 13107, 15488, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16741, 22058, 16821, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 12136, 14746, 23976, 13859, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 273, 26699, 17201, 24296, 15932, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3015, 12136, 12904, 21738, 13119, 0, 65535, 0,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 983, 11443, 19042, 22058, 19042, 0, 65535, 0,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 7975, 15666, 20140, 16672, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16894, 20779, 17709, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 26868, 23017, 26001, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 28711, 18889, 26214, 16672, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 20458, 18735, 30690, 14600, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 13592, 11830, 20779, 12379, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13523, 14746, 23657, 14007, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3670, 1040, 4619, 13427, 6604, 65535, 0, 0,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 10749, 13058, 19501, 14451, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13592, 26868, 13746, 36810, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 16894, 15345, 21707, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 10749, 12751, 14705, 16080, 0, 0, 65535,
+    16035, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 11370, 21419, 11638, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 197, 13939, 15360, 25255, 14007, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13939, 13825, 27812, 11638, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 15513, 22697, 15167, 0, 0, 65535,
+    11852, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 14078, 11677, 26214, 10306, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8669, 15053, 22697, 14719, 0, 0, 65535,
+    13246, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 27481, 36764, 18449, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 17661, 23017, 17117, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 97, 13939, 10910, 15664, 14007, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13592, 13825, 15664, 17561, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13592, 6613, 9590, 11342, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 11443, 11217, 22697, 10988, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 94, 13592, 19656, 20140, 20818, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 16297, 13672, 18222, 15636, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4981, 7975, 8762, 23976, 8233, 65535, 0, 0,
+    20218, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 31, 12136, 28402, 21738, 28580, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13523, 17201, 26214, 15044, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13939, 12444, 21419, 12675, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1075, 11443, 9529, 21738, 9713, 0, 65535, 0,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16297, 12137, 20140, 12971, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10056, 19196, 19501, 20966, 0, 0, 65535,
+    26493, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 904, 10749, 18735, 23657, 17857, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 13, 19071, 20730, 27173, 17709, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 17684, 19809, 23976, 18597, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13893, 3814, 322, 19501, 459, 65535, 0, 0,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2097, 11443, 11063, 23017, 10738, 0, 65535, 0,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 5201, 15666, 17263, 18449, 0, 0, 65535,
+    13246, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 17684, 15820, 20140, 16821, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 12830, 14746, 29091, 11934, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 11443, 16894, 21099, 17413, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 4508, 10143, 15664, 12823, 0, 0, 65535,
+    43225, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13939, 11830, 17902, 13711, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 10056, 15206, 21419, 15636, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 12136, 11217, 23657, 10750, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8651, 6311, 3851, 25255, 3494, 65535, 0, 0,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 10749, 15360, 20779, 16080, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 32178, 25947, 49551, 13563, 0, 0, 65535,
+    36253, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 17508, 21419, 17857, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 354, 13592, 20883, 25575, 18745, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 7282, 19963, 17583, 23336, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 183, 19071, 12904, 27493, 12527, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 79, 14078, 22264, 29091, 18005, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 12751, 16624, 15636, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 15604, 17201, 18222, 19782, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 10749, 16434, 22378, 16228, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3146, 12830, 9529, 23017, 9259, 0, 65535, 0,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 8669, 20730, 17583, 24224, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 13592, 17968, 22058, 17857, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 13211, 17583, 15488, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 15604, 13211, 21099, 13711, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3801, 10749, 6767, 22058, 6752, 65535, 0, 0,
+    33465, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 18378, 21190, 28132, 17413, 0, 0, 65535,
+    43922, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13592, 9529, 17263, 11490, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 6588, 25487, 21738, 25656, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 17201, 22378, 16969, 0, 0, 65535,
+    13246, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 52, 15604, 19809, 17583, 23187, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 695, 13523, 21344, 27812, 17857, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 10749, 17968, 20140, 19190, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14910, 14592, 15664, 18449, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 11677, 21738, 11786, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 12830, 11984, 17583, 14155, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 14910, 14746, 25255, 13267, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 35021, 28249, 28132, 23336, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13523, 11984, 15345, 15340, 0, 0, 65535,
+    52289, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4325, 16297, 9375, 28132, 7788, 65535, 0, 0,
+    45317, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 12, 23232, 23032, 65535, 9417, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 15604, 16894, 23657, 16080, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13523, 13058, 17902, 15192, 0, 0, 65535,
+    22310, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16297, 20883, 21738, 21115, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13939, 23185, 33886, 16672, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 20458, 24259, 46674, 13415, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 10749, 15973, 27812, 13415, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13523, 13365, 19820, 14451, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 7975, 14746, 19181, 16228, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 8762, 30050, 7048, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 93, 29473, 19349, 42838, 11342, 0, 0, 65535,
+    19521, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1966, 13939, 16894, 27173, 14451, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 26, 7282, 28249, 21419, 28814, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13523, 13825, 23337, 13415, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 12598, 16304, 15636, 0, 0, 65535,
+    16732, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 144, 17684, 32085, 46993, 17561, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 10749, 10603, 18222, 12230, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 12830, 13518, 23976, 12823, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 14910, 13518, 21099, 13859, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 12830, 19349, 23657, 18301, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 13939, 19349, 27493, 16524, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 12830, 13825, 22058, 13859, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 11443, 12598, 22697, 12331, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 13592, 16587, 23657, 15784, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 16127, 21099, 16672, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3015, 11443, 11523, 20460, 12230, 0, 65535, 0,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 14078, 13518, 20779, 14155, 0, 0, 65535,
+    35556, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 18121, 19181, 20078, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 66, 13939, 18889, 23657, 18005, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 14910, 15206, 19820, 16376, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 10056, 13518, 16943, 16376, 0, 0, 65535,
+    38345, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 786, 13592, 16434, 23976, 15488, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 36408, 41291, 22058, 41252, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 118, 7975, 14439, 20140, 15488, 0, 0, 65535,
+    64838, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 5895, 15820, 27493, 13415, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 15206, 26214, 13415, 0, 0, 65535,
+    11155, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 13592, 11370, 20140, 12230, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 11443, 11217, 15984, 14155, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 10056, 19196, 21738, 19345, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10749, 18275, 16943, 22151, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 273, 13592, 17047, 18222, 19634, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 16991, 24259, 31329, 18597, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 16297, 12904, 21099, 13415, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 9362, 16587, 22058, 16672, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 13939, 25947, 27812, 21855, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14910, 19196, 26853, 16524, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 347, 5232, 7672, 10157, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 19071, 16434, 27493, 14007, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 23232, 13518, 22058, 13563, 0, 0, 65535,
+    65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 14592, 20140, 15636, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 16297, 20577, 34206, 14600, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1152, 14910, 16280, 22058, 16376, 0, 65535, 0,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 11443, 15206, 21738, 15343, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 11443, 17201, 18861, 19338, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 15604, 14899, 26534, 12971, 0, 0, 65535,
+    54380, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 4508, 17354, 18222, 19930, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 5895, 15206, 13746, 20966, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 1734, 8915, 8312, 16376, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 26006, 26714, 46993, 14600, 0, 0, 65535,
+    22310, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 157, 14910, 17508, 21099, 18301, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 9682, 15984, 12230, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 17684, 14132, 24296, 12971, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 16587, 22058, 16524, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 12136, 12751, 16943, 15340, 0, 0, 65535,
+    53683, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 157, 7975, 12137, 23337, 11638, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 13939, 14592, 23976, 13711, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 7975, 19042, 19501, 20818, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 14078, 16127, 21738, 16228, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 11443, 11830, 21419, 12082, 0, 0, 65535,
+    37648, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 13592, 13672, 9590, 22891, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 17354, 21419, 17709, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 22538, 21651, 28132, 17709, 0, 0, 65535,
+    19521, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 13939, 14592, 18222, 16524, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 16297, 16587, 27812, 14007, 0, 0, 65535,
+    38345, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 682, 13939, 20577, 31968, 15488, 0, 0, 65535,
+    19521, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 17684, 23645, 32927, 17413, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 21152, 16280, 25894, 14451, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 21152, 17815, 16624, 21707, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 22538, 14132, 20140, 15044, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 13523, 15973, 22058, 15932, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13592, 24873, 19820, 26593, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 15604, 13365, 21099, 13859, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 14078, 17354, 27493, 14748, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13523, 15360, 25894, 13711, 0, 0, 65535,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 27393, 26868, 27493, 22743, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 9362, 11677, 16304, 14600, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 16434, 23017, 15932, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 18378, 20577, 27493, 17413, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5895, 14899, 23337, 14451, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 5201, 10910, 14066, 14896, 0, 0, 65535,
+    53683, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 826, 8669, 17968, 26534, 15784, 0, 0, 65535,
+    32070, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 16297, 22571, 26214, 19782, 0, 0, 65535,
+    29979, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13592, 28556, 23017, 27778, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 12136, 11984, 20140, 12675, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 17661, 31968, 13415, 0, 0, 65535,
+    11852, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 97, 15604, 21497, 27812, 18005, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 354, 8669, 14899, 17583, 17561, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 14910, 18889, 28132, 15784, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 17684, 16127, 25255, 14600, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 13365, 19501, 14748, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 13523, 7841, 44116, 4531, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 14078, 19809, 26214, 17413, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 14078, 16127, 20140, 17265, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 13592, 17047, 5435, 37106, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 11443, 17968, 20140, 19190, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14078, 17201, 22058, 17265, 0, 0, 65535,
+    13246, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 13523, 13672, 23976, 12823, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 9362, 11217, 9271, 19190, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64749, 3121, 1396, 35485, 977, 65535, 0, 0,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 9362, 18582, 18542, 20966, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 10056, 23645, 20140, 25112, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 14910, 21344, 21738, 21500, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 9, 13523, 14746, 18542, 16672, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24619, 21651, 17902, 24964, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 11443, 17047, 23976, 16080, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 11830, 21419, 12082, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13939, 25794, 22378, 25409, 0, 0, 65535,
+    12549, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 865, 12136, 18275, 28132, 15044, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 20458, 17047, 20779, 17709, 0, 0, 65535,
+    6972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13211, 19501, 14451, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 13592, 13825, 22697, 13415, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 891, 12830, 13365, 22378, 13267, 0, 65535, 0,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 7687, 8312, 14155, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 17684, 17661, 26214, 15488, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16280, 23976, 15340, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 983, 11443, 11984, 23976, 11342, 0, 65535, 0,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12136, 15360, 19501, 16672, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 16297, 19809, 29731, 15784, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 123, 13523, 15206, 18542, 17265, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5201, 10910, 15025, 14303, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 10749, 11063, 15345, 14303, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 38489, 44360, 22378, 43769, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 4508, 12137, 16304, 15044, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 7282, 19656, 24296, 18301, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 10603, 20460, 11194, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 17354, 20460, 18301, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 119, 12136, 18735, 14705, 24668, 0, 0, 65535,
+    42528, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 16991, 19349, 24296, 18005, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 14910, 27481, 34845, 19338, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 17508, 18542, 19782, 0, 0, 65535,
+    55077, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 16587, 19181, 18449, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 54, 13592, 26714, 38682, 17265, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 996, 11443, 19196, 25575, 17117, 0, 65535, 0,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13592, 28249, 14066, 38439, 0, 0, 65535,
+    16732, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 33, 23232, 15053, 22697, 14719, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13523, 19349, 23657, 18301, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 15513, 16624, 18894, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12830, 12904, 26853, 11194, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 10056, 11370, 21738, 11496, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 13, 12830, 18889, 15345, 23780, 0, 0, 65535,
+    61352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 7975, 10296, 24296, 9417, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 223, 13939, 12137, 19501, 13267, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 30146, 10056, 5079, 33886, 3642, 65535, 0, 0,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 341, 11443, 12137, 23976, 11342, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14078, 13518, 22697, 13267, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 13939, 15053, 19181, 16672, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13523, 13672, 23017, 13267, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 16991, 15053, 22378, 14896, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 11443, 12598, 20460, 13267, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 19071, 12904, 23017, 12527, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 14910, 10910, 18542, 12379, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13523, 20883, 17263, 24816, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16297, 15206, 32927, 11194, 0, 0, 65535,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 16991, 21344, 31009, 16376, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 10056, 15206, 16624, 18597, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 15604, 14746, 22378, 14600, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 485, 19071, 28709, 35804, 19782, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 10056, 16587, 14386, 22151, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 13592, 17661, 20140, 18894, 0, 0, 65535,
+    42528, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 10449, 14066, 14303, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 13592, 15053, 23337, 14451, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 20458, 13672, 21419, 13267, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13592, 24566, 19501, 26593, 0, 0, 65535,
+    36951, 65535, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 13058, 18861, 14451, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 16297, 23338, 27173, 19930, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 537, 13939, 17508, 39321, 11194, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 26006, 23645, 39641, 14896, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 9362, 16894, 21738, 17037, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 14285, 18222, 16228, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 197, 13592, 23952, 22378, 23632, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13939, 17047, 19501, 18745, 0, 0, 65535,
+    13246, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 131, 16297, 24873, 22058, 24816, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 24619, 17815, 19820, 19338, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 11443, 13672, 21738, 13859, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 14910, 17354, 23976, 16228, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 904, 11443, 14132, 24296, 12971, 0, 65535, 0,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7078, 14078, 7227, 26214, 6456, 65535, 0, 0,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 13592, 17968, 25575, 15932, 0, 0, 65535,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 301, 13592, 14132, 20140, 15044, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 16297, 8608, 19181, 9565, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3146, 10749, 14132, 18542, 15932, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 11443, 12291, 22058, 12379, 0, 0, 65535,
+    36253, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 511, 13939, 17047, 28132, 14007, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 28711, 20116, 43797, 11638, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 14078, 11370, 14066, 15488, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 144, 13592, 15360, 22697, 15044, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 13592, 13979, 26214, 12379, 0, 0, 65535,
+    6275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 12291, 20779, 12823, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 37, 13592, 17047, 21099, 17561, 0, 0, 65535,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 87, 15604, 17047, 19181, 18745, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 6588, 7841, 15984, 10009, 0, 0, 65535,
+    45317, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 655, 13523, 15820, 24296, 14600, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2228, 13592, 16280, 23337, 15636, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 12830, 13365, 22378, 13267, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 23232, 13518, 26214, 11934, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 16991, 18889, 25575, 16969, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 4508, 16127, 13107, 22743, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 144, 13592, 21958, 25575, 19782, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 18378, 14746, 19181, 16376, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 12904, 22058, 12971, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 56, 13592, 15973, 22378, 15784, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7282, 21804, 18861, 24372, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 17684, 17661, 29091, 14303, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 852, 12830, 13058, 23657, 12379, 0, 65535, 0,
+    33465, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 393, 14910, 13518, 18542, 15192, 0, 0, 65535,
+    43225, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1060, 13939, 12137, 13107, 17265, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 10749, 21037, 23337, 20078, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 28086, 17201, 21738, 17413, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 10056, 18582, 19181, 20522, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 23232, 24719, 17263, 29258, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13592, 26868, 41239, 16524, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 773, 16297, 8915, 22697, 8749, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 9568, 6588, 3391, 22697, 3346, 65535, 0, 0,
+    20218, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 21497, 22058, 21411, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 22878, 39001, 14748, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1, 13939, 26561, 23657, 24964, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 16297, 18275, 24296, 16969, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 564, 25312, 18582, 37723, 12230, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 10056, 18428, 21738, 18575, 0, 0, 65535,
+    43225, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 12136, 13979, 19181, 15488, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 28402, 48911, 15044, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13592, 11830, 15025, 15488, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 288, 15604, 14746, 16304, 18153, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 695, 6588, 14439, 11828, 21855, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13939, 22111, 25255, 20078, 0, 0, 65535,
+    41134, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 11443, 11063, 23976, 10306, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 96, 14910, 15820, 14705, 20818, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 16297, 16741, 23657, 15932, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 12136, 14746, 16624, 18005, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12136, 12751, 18542, 14600, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 12830, 13211, 18222, 15044, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 16991, 25640, 35804, 17561, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 16127, 20779, 16821, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 40569, 27635, 17263, 32664, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 24619, 26561, 36764, 17857, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 24106, 24296, 22151, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 459, 11443, 14746, 27493, 12527, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25821, 6311, 1703, 10869, 3050, 65535, 0, 0,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 12136, 15053, 25255, 13563, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 25312, 26868, 21738, 27042, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 5201, 10910, 18222, 12527, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 11720, 12904, 20460, 13563, 0, 65535, 0,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13523, 26714, 28132, 21855, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13523, 12751, 18542, 14451, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13939, 13365, 25255, 12082, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 957, 14078, 20883, 27812, 17561, 0, 65535, 0,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 11443, 10449, 14066, 14303, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 7733, 12830, 5386, 27173, 4679, 65535, 0, 0,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 273, 14078, 15973, 20779, 16672, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 14078, 12751, 22697, 12379, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 12291, 17902, 14303, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 85, 13592, 17047, 21419, 17413, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 73, 16297, 14439, 21738, 14574, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 30167, 29476, 17263, 34737, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 13365, 18861, 14896, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 7282, 14285, 21099, 14748, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 15604, 11370, 22697, 11138, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 13211, 28132, 10898, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 12136, 18889, 16943, 22743, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 5895, 22571, 19820, 24372, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 262, 18378, 18121, 22058, 18153, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12583, 2427, 0, 29411, 0, 65535, 0, 0,
+    47408, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 20423, 18222, 23187, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 11984, 18222, 13711, 0, 0, 65535,
+    34859, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19071, 19809, 21419, 20226, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 10603, 15025, 13859, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13523, 24719, 20460, 26001, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 11443, 11677, 15984, 14600, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 170, 12830, 9682, 21738, 9713, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 419, 6588, 12598, 9590, 20966, 0, 0, 65535,
+    11155, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1966, 12136, 19809, 19501, 21559, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 406, 18378, 14899, 20779, 15636, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 3814, 11830, 13427, 16672, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 10056, 16615, 22697, 16239, 0, 0, 65535,
+    41831, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 16991, 15053, 23017, 14600, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13592, 16741, 33567, 12082, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 18378, 12904, 18222, 14748, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 13523, 21344, 23017, 20670, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 7975, 15053, 25255, 13563, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 16297, 19196, 26534, 16672, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 8, 13523, 11677, 16943, 14155, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 14078, 25947, 23337, 24964, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 12830, 16894, 27493, 14303, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 16297, 18121, 30370, 14155, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 18378, 14746, 23017, 14303, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 13592, 13825, 11509, 21263, 0, 0, 65535,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 93, 11443, 13825, 19181, 15340, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 39182, 25947, 18542, 29258, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10749, 13365, 22058, 13415, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 13592, 15053, 15664, 19042, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1022, 13523, 23952, 39321, 15192, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 11720, 21344, 34845, 15044, 0, 65535, 0,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 786, 13592, 20270, 21738, 20522, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 210, 13523, 12904, 10550, 20818, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 14439, 16304, 17857, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 14910, 14132, 17902, 16376, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 852, 4508, 12751, 14066, 17413, 0, 65535, 0,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 11443, 19502, 23657, 18597, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 14910, 16127, 19181, 17709, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 15513, 29731, 12527, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 7282, 11523, 13746, 15932, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 249, 15604, 24259, 24296, 22595, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 14078, 13058, 13427, 18153, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 15206, 25255, 13711, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 10449, 15345, 13415, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 4508, 11677, 15664, 14748, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 3814, 20883, 18542, 23484, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4063, 15604, 35767, 23657, 33848, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13523, 16741, 23337, 16080, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 17815, 19820, 19190, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 13523, 12137, 22697, 11884, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 13523, 21344, 24296, 19634, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 13939, 19042, 22058, 19042, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10749, 18889, 18861, 21115, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 3814, 15360, 23337, 14748, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 944, 11443, 15820, 17583, 18597, 0, 65535, 0,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 14910, 17968, 21738, 18301, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 65535, 52, 16297, 15360, 20140, 16524, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 16297, 17508, 25255, 15636, 0, 65535, 0,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 210, 12136, 11523, 20460, 12230, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1349, 13523, 9989, 27812, 8381, 65535, 0, 0,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2621, 6311, 6000, 22378, 6012, 65535, 0, 0,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 12136, 17047, 23017, 16524, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 760, 12136, 14592, 18861, 16228, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13523, 14592, 17902, 16969, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 14078, 27788, 36124, 18894, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 9362, 18582, 29411, 14896, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 10749, 14746, 21738, 14882, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3146, 13592, 36995, 60100, 16376, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 16991, 15666, 24296, 14451, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 12137, 23337, 11786, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 14910, 15360, 20460, 16228, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 12136, 14592, 21738, 14728, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 354, 13592, 18735, 24296, 17265, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 367, 8669, 12751, 19501, 13859, 0, 0, 65535,
+    21613, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 39, 20458, 15053, 27493, 12823, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 15820, 23017, 15340, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 16297, 14592, 25575, 13119, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 92, 13592, 21958, 21738, 22151, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 367, 13939, 20116, 24296, 18597, 0, 0, 65535,
+    42528, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 14078, 11370, 19820, 12379, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 10056, 5539, 18222, 6456, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 18735, 15984, 23336, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 104, 12830, 15973, 22697, 15636, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 16991, 17815, 40600, 10898, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 46811, 25487, 17902, 29406, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 315, 23925, 25794, 38682, 16672, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 1311, 1734, 9836, 23017, 9555, 0, 65535, 0,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 19765, 21651, 41559, 13119, 0, 0, 65535,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 12830, 9068, 15664, 11638, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 9362, 9836, 13746, 13563, 0, 65535, 0,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 223, 6588, 16741, 23657, 15932, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 5895, 12137, 10869, 19338, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 13592, 19963, 24296, 18153, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 11720, 16741, 25575, 14896, 0, 65535, 0,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 6588, 11370, 18542, 12971, 0, 0, 65535,
+    23704, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 14899, 22378, 14748, 0, 0, 65535,
+    19521, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 25, 11443, 22111, 21738, 22269, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 15604, 19349, 30690, 14896, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 12751, 15664, 16228, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 11523, 13427, 16080, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 12830, 11370, 16624, 14007, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 12830, 14899, 20779, 15488, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 13592, 16741, 19501, 18301, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 26006, 24259, 46674, 13415, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 12136, 14592, 17583, 17117, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 18378, 15360, 22697, 15019, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 19765, 15053, 23017, 14451, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 85, 8669, 20423, 29091, 16672, 0, 0, 65535,
+    27887, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1966, 11443, 17815, 22697, 17413, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7209, 3814, 1857, 19501, 2162, 65535, 0, 0,
+    10458, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 16991, 10449, 16624, 12675, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 511, 14910, 8915, 15345, 11490, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 629, 3814, 14592, 16624, 17709, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13939, 14592, 27493, 12379, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 13523, 15820, 24296, 14600, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 12830, 15513, 22058, 15488, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 109, 16297, 17047, 23657, 16228, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 249, 9362, 9836, 11828, 14896, 0, 0, 65535
+};
+
+#pragma DATA_SECTION(far_chunk_3, ".fram2") // Place data in FRAM2
+const uint16_t far_chunk_3 [16368] = {
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 15604, 15206, 21099, 15784, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 10056, 10143, 16624, 12379, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 12136, 14285, 20140, 15340, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 22725, 14386, 30295, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 13592, 30704, 53387, 15044, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 3814, 22878, 15025, 29702, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 17684, 14746, 20779, 15340, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 4456, 6311, 1703, 23976, 1570, 65535, 0, 0,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 19071, 19963, 19501, 21707, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19792, 6588, 4465, 28132, 3791, 65535, 0, 0,
+    39042, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 14910, 22571, 23337, 21707, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 10749, 18889, 23657, 17857, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 19071, 22264, 38682, 14303, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 839, 16297, 21190, 31329, 16228, 0, 65535, 0,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16991, 15206, 20779, 15932, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 511, 10056, 8455, 9590, 14303, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 20423, 15025, 26445, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 16297, 19349, 27493, 16376, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 68, 17684, 13518, 22058, 13563, 0, 0, 65535,
+    43922, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10056, 19656, 25575, 17561, 0, 0, 65535,
+    10458, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 12598, 23017, 12230, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 10749, 15360, 27173, 13119, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 16991, 20116, 19181, 22151, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 8669, 16741, 16624, 20374, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 17815, 24296, 16524, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 15206, 21099, 15784, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 5895, 7841, 15345, 10306, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 7975, 12751, 18222, 14600, 0, 65535, 0,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 25640, 44116, 14748, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 14910, 17354, 23976, 16228, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13592, 17201, 17583, 20078, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 721, 13523, 14132, 25575, 12675, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 20458, 9989, 18222, 11490, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 12136, 15206, 22058, 15340, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 21152, 22878, 27812, 19190, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 16991, 21190, 31968, 15932, 0, 0, 65535,
+    26493, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 9222, 18861, 10306, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 85, 10056, 16587, 21738, 16821, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 15604, 11984, 20460, 12675, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 786, 13523, 13518, 25255, 12230, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 19349, 31968, 14600, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18481, 0, 15, 24296, 89, 65535, 0, 0,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 11443, 25180, 21738, 25348, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 8, 17684, 16434, 21738, 16575, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 16991, 16434, 28132, 13563, 0, 65535, 0,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 19071, 17661, 28132, 14600, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 13592, 7381, 12148, 11194, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2097, 10749, 9068, 19181, 10157, 0, 65535, 0,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 16297, 16587, 23017, 16080, 0, 0, 65535,
+    58563, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 7282, 19809, 18222, 22447, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 7282, 18121, 26534, 15784, 0, 0, 65535,
+    20218, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 13592, 15360, 16304, 18894, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 13523, 20883, 23657, 19930, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 2621, 6311, 322, 23017, 385, 65535, 0, 0,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 304, 13592, 8608, 15664, 11046, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 16991, 20883, 26853, 18005, 0, 0, 65535,
+    49500, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17684, 12137, 19501, 13415, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 11443, 14285, 22697, 13973, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 14078, 16741, 26534, 14600, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12136, 11830, 15664, 15044, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 23032, 32927, 16821, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9175, 6311, 9222, 29091, 7492, 65535, 0, 0,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 11443, 19042, 20460, 20078, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3932, 7282, 6460, 20140, 6900, 65535, 0, 0,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 9362, 27788, 10869, 43621, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13939, 16894, 18222, 19338, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 511, 13939, 12291, 18222, 14007, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 19502, 20140, 20818, 0, 0, 65535,
+    53683, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 944, 9362, 19656, 25894, 17561, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 6588, 13672, 8951, 23928, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 29473, 28249, 21738, 28370, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13592, 15206, 16624, 18597, 0, 0, 65535,
+    9063, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 14910, 11523, 19181, 12823, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13592, 19502, 25255, 17709, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 8669, 17815, 19820, 19338, 0, 0, 65535,
+    22310, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 10749, 1550, 20460, 1718, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 14910, 16280, 25255, 14600, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 14592, 17263, 17117, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 9362, 16894, 18222, 19190, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 17684, 11830, 17902, 13711, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 30, 13592, 14132, 28132, 11638, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 8669, 13518, 23657, 12823, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12137, 20140, 12971, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 11443, 13825, 15984, 17265, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 13518, 17902, 15636, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 11443, 18428, 15025, 23928, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 12830, 14132, 26214, 12527, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 12904, 19181, 14303, 0, 0, 65535,
+    39042, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 11677, 16943, 14155, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 878, 11443, 13365, 23657, 12675, 0, 65535, 0,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 1734, 3084, 7353, 6308, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 15513, 21738, 15636, 0, 0, 65535,
+    23007, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 25312, 27481, 46993, 15044, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 14078, 18428, 20140, 19634, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 236, 14078, 14439, 24296, 13415, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 10056, 18735, 15664, 23780, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1585, 23232, 13979, 20460, 14748, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 301, 13523, 9222, 21419, 9417, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13939, 19656, 17583, 23039, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2621, 11443, 15513, 21419, 15751, 0, 65535, 0,
+    52986, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1296, 13939, 18121, 23657, 17117, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 12830, 14746, 23976, 14007, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1573, 11443, 18428, 23976, 17413, 0, 65535, 0,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16127, 13746, 22151, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 16991, 19656, 28132, 15932, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 12830, 13211, 20460, 13859, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12830, 22878, 16943, 27481, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 19071, 30090, 37723, 19930, 0, 0, 65535,
+    19521, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2621, 11443, 11677, 28132, 9713, 0, 65535, 0,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 79, 13939, 12904, 23017, 12675, 0, 0, 65535,
+    53683, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1, 14078, 32392, 18861, 35921, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 16297, 15513, 14705, 20522, 0, 0, 65535,
+    42528, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 17684, 21344, 22697, 20839, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13939, 11677, 21419, 11934, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 11443, 14592, 21738, 14728, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 13592, 17354, 19181, 19190, 0, 0, 65535,
+    17430, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 304, 20458, 28556, 29731, 22743, 0, 0, 65535,
+    23704, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 12136, 13979, 18542, 15932, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 11443, 16280, 17263, 19338, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7209, 4508, 1857, 25575, 1718, 65535, 0, 0,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 10056, 14899, 18542, 16821, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 9362, 22878, 24296, 21115, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 12136, 13058, 22697, 12778, 0, 0, 65535,
+    58563, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 13592, 12444, 16624, 15192, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 19071, 20270, 29411, 16376, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13939, 21190, 28132, 17413, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 406, 16991, 22418, 25894, 19930, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 5895, 17354, 5435, 37846, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1009, 13592, 7227, 12148, 10898, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 19765, 17354, 29411, 14007, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 14078, 9375, 13427, 13119, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 13592, 17201, 25575, 15340, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 21152, 20116, 23017, 19486, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 118, 24619, 16741, 28132, 13859, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 970, 7975, 12751, 21738, 12971, 0, 0, 65535,
+    37648, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16297, 14132, 24296, 12971, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 10749, 14899, 19181, 16376, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 13523, 16127, 19820, 17265, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 15604, 17968, 16624, 21707, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 14910, 20270, 25255, 18301, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 14910, 20730, 30690, 16080, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 5201, 15206, 16624, 18597, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 3539, 11443, 12904, 22697, 12630, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 10749, 12751, 21099, 13267, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 223, 17684, 16894, 19820, 18301, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 11830, 19181, 13119, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 16280, 23017, 15784, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 197, 7975, 13518, 22058, 13563, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 170, 7975, 13211, 21099, 13711, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13523, 22878, 21419, 23336, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 1040, 8608, 16304, 10602, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    55774, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 10749, 16741, 20140, 17857, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 14910, 22264, 30050, 17561, 0, 0, 65535,
+    48105, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 13, 14078, 18889, 17583, 22151, 0, 0, 65535,
+    41831, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 8669, 13825, 17902, 16080, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 7975, 16127, 21099, 16672, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 12830, 12291, 23976, 11638, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 197, 18378, 17968, 32927, 13119, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 5201, 15053, 22697, 14896, 0, 0, 65535,
+    64141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 13592, 12291, 18861, 13711, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14910, 15360, 19820, 16524, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 18378, 16587, 20140, 17709, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 14910, 17047, 20779, 17857, 0, 0, 65535,
+    62746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 7975, 12444, 20140, 13267, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 131, 13592, 13211, 17902, 15340, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 7975, 26254, 22697, 25616, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 13825, 21738, 14155, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14287, 1040, 15, 23657, 89, 65535, 0, 0,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 7, 15604, 14132, 19501, 15340, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 46, 17684, 9222, 20460, 9861, 0, 0, 65535,
+    30676, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 58, 19071, 23032, 20140, 24520, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 11830, 15025, 15488, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 18582, 26214, 16376, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 12136, 16280, 20460, 17117, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 12136, 14132, 17263, 16821, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 13592, 11063, 17263, 13119, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 10749, 20270, 18542, 22891, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 11217, 15345, 14451, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 20458, 20423, 23017, 19634, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 14910, 18121, 23337, 17561, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28086, 20883, 13746, 28666, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 19042, 25575, 17117, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 16991, 20423, 19501, 22299, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 7975, 17815, 21738, 17961, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 16297, 8915, 17263, 10750, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 33, 13523, 17047, 19820, 18597, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 13592, 11830, 21738, 11958, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 13592, 14899, 16943, 17709, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 5, 26006, 44360, 20140, 47175, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10749, 17047, 14066, 23039, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 328, 15604, 13365, 20140, 14303, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13939, 18428, 14705, 24224, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 288, 5895, 10143, 14705, 13415, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 12830, 14592, 11828, 22003, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 642, 13939, 10910, 20460, 11490, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 13592, 16587, 15345, 21263, 0, 0, 65535,
+    9063, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13592, 13211, 14705, 17561, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 12136, 18275, 18222, 20966, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 39143, 27493, 33256, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 12291, 15025, 16080, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 17684, 17815, 30050, 14007, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 13592, 11830, 19181, 13119, 0, 0, 65535,
+    39739, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14078, 19502, 18861, 21707, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1231, 5201, 11830, 34206, 8381, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 12830, 13365, 18861, 15044, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 13592, 27021, 16304, 33256, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 14746, 24296, 13563, 0, 0, 65535,
+    20915, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 655, 13939, 21190, 25894, 18894, 0, 0, 65535,
+    18127, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16434, 26214, 14451, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 9362, 14132, 16943, 17117, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 11443, 12751, 20140, 13711, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 197, 19071, 14746, 21419, 15044, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 22418, 32288, 16821, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 3121, 7687, 31009, 5864, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 125, 17684, 22878, 35804, 15932, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1734, 12904, 13107, 18301, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 14078, 12904, 24296, 11934, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23232, 31778, 26534, 27481, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 16991, 13365, 23976, 12675, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 58, 13939, 21804, 25575, 19634, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 10756, 20140, 11638, 0, 0, 65535,
+    32070, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13523, 16434, 23657, 15636, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 10749, 8762, 11828, 13267, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 17684, 17815, 24296, 16524, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 13592, 19809, 50830, 10157, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 537, 8669, 15053, 15984, 18894, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 5, 20458, 19349, 22058, 19338, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 14285, 19501, 15636, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 16991, 17201, 26853, 14896, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 13939, 14285, 17263, 17117, 0, 0, 65535,
+    39739, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 10910, 17263, 12971, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 304, 5895, 9222, 11828, 14007, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 15604, 15360, 24296, 14155, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 13592, 13058, 17583, 15340, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1191, 13523, 10603, 19820, 11490, 0, 65535, 0,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 13979, 15664, 17857, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 577, 13592, 17968, 15345, 23039, 0, 0, 65535,
+    46014, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 4, 16297, 20577, 18222, 23484, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 11443, 15206, 19820, 16376, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 14078, 17354, 24296, 15932, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 13979, 19181, 15488, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13592, 13518, 17902, 15636, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13523, 16587, 16624, 20078, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 17354, 23337, 16672, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13523, 20116, 16304, 24816, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 564, 10056, 21344, 22058, 21263, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 786, 10749, 14746, 21419, 15044, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 10749, 19349, 25255, 17561, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 4508, 10143, 21738, 10264, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 12830, 17201, 22378, 17117, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 10056, 19963, 21738, 20226, 0, 0, 65535,
+    41831, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 8915, 15984, 11638, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1442, 10749, 17968, 21419, 18230, 0, 65535, 0,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 13939, 12598, 20460, 13267, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 19656, 24296, 18301, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 10749, 11523, 19181, 12823, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 17968, 21738, 18153, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 13523, 13058, 24296, 12230, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 16297, 11063, 22378, 11046, 0, 0, 65535,
+    1394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 26699, 16938, 21738, 17081, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13523, 18735, 26853, 16228, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 7975, 18275, 21099, 19042, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13939, 13058, 18861, 14451, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 3121, 322, 29091, 237, 65535, 0, 0,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 117, 12136, 15360, 22378, 15192, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10749, 10449, 22697, 10306, 0, 0, 65535,
+    41134, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 10749, 14592, 15025, 19042, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 13592, 14439, 20460, 15340, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 13592, 13825, 18222, 15784, 0, 0, 65535,
+    17430, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 10, 11443, 26254, 30370, 20670, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 12136, 16434, 19501, 18005, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 197, 12830, 15820, 24296, 15044, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 15604, 15360, 21419, 15636, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 21152, 21344, 47633, 11490, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14910, 21190, 22378, 20966, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 5201, 12291, 22697, 12082, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 21497, 21738, 21653, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 11443, 11677, 21419, 11934, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 10056, 16741, 22697, 16524, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 15604, 17968, 28132, 14896, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 15604, 22571, 36444, 15340, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 9362, 21037, 19820, 22743, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 10910, 22697, 10688, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 328, 10056, 10143, 19820, 11046, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 498, 15604, 19042, 22058, 19042, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 5, 13939, 22418, 43797, 12971, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 15604, 16894, 26214, 14896, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 92, 13523, 14132, 22697, 13859, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 210, 12136, 20423, 28132, 16969, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 21497, 23017, 20818, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2884, 1040, 169, 23337, 237, 65535, 0, 0,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 76, 13939, 17661, 23976, 16524, 0, 0, 65535,
+    64141, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 5895, 13672, 16943, 16228, 0, 0, 65535,
+    18824, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 19765, 17815, 36124, 12082, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 24619, 45741, 46993, 25112, 0, 0, 65535,
+    52986, 65535, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 122, 12830, 18121, 34526, 12823, 0, 0, 65535,
+    19521, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1835, 10056, 14132, 19820, 15340, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 21845, 20116, 22378, 19930, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 14910, 21804, 23337, 20966, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 12830, 19963, 23017, 19338, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 12830, 21037, 21738, 21115, 0, 0, 65535,
+    46014, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 13523, 21037, 34526, 14896, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 18378, 23952, 29091, 19486, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 16991, 24566, 26534, 21559, 0, 0, 65535,
+    52986, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13939, 17047, 23017, 16672, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2884, 9362, 10449, 22058, 10454, 0, 65535, 0,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 13592, 14439, 22378, 14303, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 13592, 21958, 33247, 16080, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 7975, 14132, 17583, 16524, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2884, 11443, 13058, 26214, 11490, 0, 65535, 0,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 1442, 14078, 11063, 23337, 10602, 0, 65535, 0,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 16741, 23337, 16080, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 19765, 13979, 27812, 11786, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13939, 24566, 21419, 25112, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 17508, 20460, 18449, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 16991, 24873, 23976, 23484, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 21845, 27942, 20140, 30147, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 14910, 18582, 16943, 22151, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 157, 13592, 17354, 23976, 16376, 0, 0, 65535,
+    16035, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13939, 18889, 18542, 21263, 0, 0, 65535,
+    27887, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 367, 13939, 22418, 23017, 21559, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14910, 12291, 17583, 14600, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 10056, 18889, 18542, 21411, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 983, 28086, 20883, 43797, 12082, 0, 65535, 0,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 10910, 31649, 8233, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 7975, 13518, 21419, 13859, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 10, 16297, 19809, 21419, 20226, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 197, 13939, 13825, 15025, 18153, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 13592, 20883, 15984, 26149, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 4508, 12137, 21419, 12379, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2752, 10749, 18582, 25894, 16524, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 12830, 13518, 16624, 16524, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 12751, 18542, 14451, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 115, 19765, 9989, 21738, 10110, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 9362, 13365, 22058, 13267, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 15604, 19349, 32288, 14451, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 157, 13592, 15666, 22378, 15488, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 11443, 20116, 17902, 23336, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 12136, 13518, 20460, 14303, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 10749, 17661, 24296, 16080, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 19071, 13518, 22697, 13227, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 11443, 15360, 15664, 19486, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 14439, 21738, 14600, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 8669, 24719, 23017, 23928, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13939, 18889, 17583, 22151, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 14078, 21344, 25255, 19338, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 5201, 15053, 16943, 18153, 0, 0, 65535,
+    34162, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 12136, 16280, 15664, 20522, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 13592, 13825, 15664, 17561, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 14910, 29936, 30370, 23336, 0, 0, 65535,
+    20218, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13592, 26561, 41239, 16228, 0, 0, 65535,
+    26493, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 13592, 24566, 30370, 19338, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 12830, 14899, 20460, 15784, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13523, 15053, 23337, 14451, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 9362, 14899, 16624, 17857, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13523, 16894, 23976, 15932, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1114, 14078, 13518, 28132, 11342, 0, 65535, 0,
+    33465, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13939, 20577, 16624, 24816, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 118, 9362, 16587, 23657, 15784, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 17661, 22697, 17257, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13939, 11984, 18542, 13563, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1887, 7282, 7381, 12787, 10750, 0, 65535, 0,
+    52986, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 472, 12136, 20116, 23657, 19042, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 13, 13939, 17815, 20140, 19042, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 13939, 14592, 16304, 18153, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 197, 13592, 19656, 23337, 18894, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 12830, 16741, 21099, 17265, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 16991, 30550, 23017, 29554, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 13592, 22111, 28132, 18449, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 16434, 26853, 14155, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 18428, 20140, 19634, 0, 0, 65535,
+    27190, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 20730, 21419, 21115, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 9362, 16127, 23657, 15192, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 341, 16297, 15666, 22697, 15340, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 9682, 20779, 10157, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 1, 13939, 20270, 17263, 24224, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 28, 13592, 15513, 21419, 15932, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 23232, 18889, 30050, 14896, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 11443, 16587, 18222, 19042, 0, 65535, 0,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 13592, 13058, 22697, 12823, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13592, 10910, 17583, 12823, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 19765, 16894, 27173, 14451, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 19765, 15973, 23337, 15340, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 13939, 22418, 24296, 20818, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 7975, 12444, 15984, 15488, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 20458, 10143, 12468, 14748, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 12830, 15053, 22697, 14748, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 12830, 13058, 16624, 15932, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 10056, 13058, 17902, 15192, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 13523, 7841, 20779, 8233, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 615, 17684, 10756, 22058, 10750, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 12136, 15513, 19501, 16969, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 12598, 13427, 17561, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 11443, 17354, 21099, 17857, 0, 65535, 0,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 14078, 13058, 21738, 13267, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 15360, 22697, 15044, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 380, 12830, 13365, 22058, 13415, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10056, 16127, 25255, 14600, 0, 0, 65535,
+    46711, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 341, 13523, 22878, 36124, 15636, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 10749, 10449, 24296, 9565, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 4508, 18275, 27173, 15636, 0, 65535, 0,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20458, 24259, 20779, 25409, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 14078, 28249, 19501, 30739, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 13939, 13058, 14066, 17709, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 10056, 20270, 24296, 18449, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14910, 11984, 21099, 12379, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 21845, 36228, 17583, 42288, 0, 0, 65535,
+    54380, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 13592, 19042, 20779, 19930, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 11443, 20730, 23657, 19782, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 13592, 16280, 23337, 15636, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4587, 7975, 2010, 18542, 2458, 65535, 0, 0,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 393, 7975, 10143, 22697, 10009, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 18428, 28132, 15488, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 7282, 13672, 16943, 16524, 0, 0, 65535,
+    43225, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 7534, 18222, 8677, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 983, 13592, 12751, 36444, 8677, 0, 0, 65535,
+    33465, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 16297, 27175, 31009, 20966, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13523, 16894, 18542, 19042, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 18889, 22058, 18745, 0, 0, 65535,
+    62746, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 13592, 15513, 19501, 16969, 0, 0, 65535,
+    30676, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 13592, 19349, 18222, 22151, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 288, 14078, 14285, 18542, 16228, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 347, 4772, 10550, 7936, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 23232, 24873, 39641, 15636, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 13592, 15820, 21099, 16376, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 9362, 9529, 18222, 11046, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 14910, 18275, 26214, 16080, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 11370, 22697, 11194, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 7, 42650, 38683, 24296, 35773, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 23925, 16615, 22697, 16239, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 15820, 19181, 17413, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2359, 14078, 9989, 25575, 8973, 65535, 0, 0,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 12136, 17968, 23337, 17265, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 22725, 24296, 20670, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 3814, 17968, 24296, 16376, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 10056, 11370, 16304, 14007, 0, 0, 65535,
+    42528, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 13592, 16587, 19820, 18005, 0, 0, 65535,
+    18127, 0, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 28086, 23645, 55305, 11194, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 21845, 20730, 25575, 18597, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 419, 14910, 15973, 23017, 15488, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 130, 15604, 19502, 23337, 18745, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 12830, 16127, 24296, 14896, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 19071, 21344, 24296, 19634, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 15604, 22571, 31009, 17413, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 14132, 22697, 13859, 0, 0, 65535,
+    58563, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 15604, 19196, 24296, 17561, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 11720, 12904, 18222, 14896, 0, 65535, 0,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 9362, 16615, 22697, 16239, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 12830, 17047, 22697, 16659, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13939, 18735, 36764, 12527, 0, 0, 65535,
+    39739, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13939, 20577, 20140, 22003, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 13592, 22878, 16624, 27778, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 16991, 17815, 24296, 16524, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 12976, 5201, 1396, 31649, 1125, 65535, 0, 0,
+    20915, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14078, 32085, 28132, 26445, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 15973, 23337, 15340, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13523, 15053, 21099, 15636, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 22538, 30243, 23017, 29258, 0, 0, 65535,
+    697, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 537, 13592, 23338, 24296, 21707, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 16297, 14285, 22378, 14303, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 7282, 13211, 15025, 17117, 0, 0, 65535,
+    41831, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 865, 14910, 15666, 19181, 17265, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 15053, 19820, 16228, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13939, 16434, 21099, 16969, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 8669, 13058, 18222, 14896, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 16991, 19502, 25575, 17561, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 14910, 15666, 20140, 16672, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 26, 29473, 21037, 44756, 11934, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 14439, 23657, 13711, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 16991, 16587, 22058, 16524, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 10749, 17815, 20460, 18894, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 12136, 22264, 29091, 18153, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 6588, 19196, 25255, 17265, 0, 0, 65535,
+    34162, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 13592, 23645, 29411, 19042, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 7282, 17815, 19181, 19634, 0, 0, 65535,
+    35556, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 16297, 17661, 23337, 16969, 0, 0, 65535,
+    15338, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 41, 11443, 22111, 24296, 20522, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13592, 22264, 22378, 22003, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 16991, 15820, 22697, 15466, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 19765, 23799, 23976, 22447, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 10056, 16434, 19501, 18005, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 14078, 24106, 22378, 23780, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10749, 13825, 16943, 16524, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 19765, 19963, 28132, 16376, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13939, 17661, 22058, 17561, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 21845, 16615, 22697, 16239, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 21152, 16434, 25575, 14748, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 10056, 17968, 15345, 23039, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 24619, 21651, 47313, 11786, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 23232, 19963, 7672, 36810, 0, 0, 65535,
+    43922, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 9362, 17508, 22058, 17561, 0, 0, 65535,
+    10458, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 28, 16297, 18889, 20779, 19634, 0, 0, 65535,
+    13246, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1573, 18378, 18121, 21738, 18267, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 8669, 10603, 15025, 13859, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 9362, 8455, 17583, 9861, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1009, 12136, 16587, 25255, 15044, 0, 65535, 0,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10056, 15973, 16304, 19634, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 14746, 22697, 14303, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 16991, 12904, 16304, 15784, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 10056, 21651, 30690, 16821, 0, 65535, 0,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 13939, 13825, 17902, 15932, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 20, 37795, 24259, 42518, 14451, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 16297, 18275, 26853, 15784, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 760, 13939, 39603, 65215, 16376, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13939, 15973, 27812, 13267, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 12136, 11217, 16624, 13711, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 8669, 14592, 23976, 13711, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 17684, 18121, 24296, 16672, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 13592, 15513, 12787, 22299, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 262, 16297, 14285, 22378, 14155, 0, 0, 65535,
+    61352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 12136, 12751, 24296, 11934, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 9, 34328, 32698, 18542, 36810, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 11830, 22378, 11786, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 104, 12136, 11984, 18542, 13563, 0, 0, 65535,
+    40436, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 18378, 10910, 26853, 9417, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 5, 13939, 21190, 23976, 19930, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 304, 13592, 15206, 24296, 13859, 0, 0, 65535,
+    26493, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 16297, 5232, 16943, 6308, 0, 0, 65535,
+    8366, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 14910, 24259, 30690, 18894, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 13592, 15820, 30370, 12379, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 14910, 21497, 20460, 22447, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 17, 14078, 12444, 15025, 16228, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 9362, 13058, 18542, 14748, 0, 0, 65535,
+    11155, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3670, 13523, 12751, 22697, 12527, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 15053, 17583, 17709, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 16434, 22697, 16080, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 5409, 15513, 15664, 19634, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 13523, 15513, 21419, 15784, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7602, 11720, 10910, 19820, 11786, 0, 65535, 0,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13592, 23032, 12468, 33404, 0, 0, 65535,
+    46014, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 25180, 36764, 16969, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13939, 14132, 23657, 13415, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 10056, 13825, 18861, 15488, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 9362, 14439, 18861, 16080, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 223, 12830, 19809, 27812, 16524, 0, 0, 65535,
+    6275, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 27393, 13365, 26534, 11638, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4, 9362, 23799, 21738, 23963, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 13523, 10296, 15345, 13267, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 12136, 18582, 22697, 18153, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 7975, 19963, 21099, 20670, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 6588, 18889, 25575, 16969, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13939, 12444, 19820, 13415, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 7282, 21497, 20140, 22891, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 101, 13592, 14132, 23657, 13415, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 15604, 12137, 19181, 13415, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 14910, 13518, 24296, 12675, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 29473, 37915, 23337, 36217, 0, 0, 65535,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 10749, 13365, 16304, 16524, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 11443, 20883, 34206, 14896, 0, 65535, 0,
+    24401, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    49500, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 11063, 23337, 10602, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    26493, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 19765, 18735, 21738, 18894, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 24259, 23657, 23039, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 354, 13939, 13058, 25255, 11786, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 406, 13592, 20116, 25255, 18153, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 248, 19071, 17968, 28132, 14748, 0, 0, 65535,
+    38345, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 20423, 19181, 22595, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 32178, 25947, 18861, 28962, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 13592, 14746, 19501, 16080, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 19765, 14899, 23657, 14155, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 12830, 11217, 17583, 13267, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 12136, 17508, 23017, 16969, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 12830, 12751, 22697, 12481, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 210, 24619, 19963, 37083, 13415, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 18378, 15666, 28132, 13119, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 236, 6588, 16741, 22378, 16376, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 107, 14078, 18582, 23976, 17561, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 878, 14078, 24106, 29731, 19190, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 11443, 15973, 18222, 18301, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 19349, 23017, 18745, 0, 0, 65535,
+    16035, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 12830, 15973, 18222, 18301, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 22538, 17815, 32927, 12971, 0, 0, 65535,
+    33465, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 8669, 12137, 23017, 11786, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 12136, 13979, 22697, 13674, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 12830, 20730, 20140, 22595, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 459, 8669, 10296, 20460, 10898, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 17684, 22878, 27173, 19634, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1180, 11720, 14132, 18861, 15932, 0, 65535, 0,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 10749, 18735, 24296, 17117, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 18378, 18275, 17583, 21411, 0, 0, 65535,
+    42528, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13523, 15360, 21419, 15784, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 10056, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 721, 13592, 18889, 28132, 15784, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13518, 23337, 12971, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 10056, 12751, 11828, 19190, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 16991, 24259, 31649, 18449, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 12, 25312, 30397, 22058, 30295, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12136, 13672, 17902, 15932, 0, 0, 65535,
+    26493, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 16297, 20270, 39321, 12823, 0, 0, 65535,
+    46711, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10056, 10910, 14066, 14896, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 5895, 7227, 10869, 11638, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 52359, 17968, 24296, 16821, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4719, 11720, 12137, 23657, 11638, 0, 65535, 0,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 126, 13939, 15513, 23017, 15044, 0, 0, 65535,
+    23007, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 16991, 28095, 33567, 20374, 0, 0, 65535,
+    36951, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 13939, 17968, 23337, 17117, 0, 0, 65535,
+    28584, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 26699, 31011, 45395, 17561, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 5201, 22725, 23337, 21855, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13523, 11677, 10869, 18301, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 39, 10056, 15053, 16943, 18153, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 9362, 13672, 20460, 14600, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 14910, 17508, 18542, 19782, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 11370, 11828, 17117, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5505, 1040, 292, 19820, 444, 65535, 0, 0,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 10056, 14285, 16624, 17561, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 13592, 20883, 21419, 21263, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13592, 15206, 15664, 19338, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 3, 14910, 16127, 18222, 18301, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 12136, 12444, 20140, 13415, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1191, 11720, 15053, 26853, 12971, 0, 65535, 0,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 380, 13523, 9989, 19181, 11046, 0, 0, 65535,
+    42528, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14910, 27635, 23976, 26001, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 19765, 20883, 39960, 13119, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 11443, 10296, 19820, 11194, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 157, 8669, 14132, 23657, 13415, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 16991, 14439, 23017, 12230, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 13592, 11830, 20140, 12675, 0, 0, 65535,
+    12549, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 20116, 26853, 15784, 0, 0, 65535,
+    54380, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 1734, 13672, 5115, 30147, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 14078, 15360, 23976, 14451, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 21344, 29411, 17117, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 157, 13592, 12598, 21738, 12823, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 17684, 16615, 22697, 16239, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 17684, 17968, 29411, 14451, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2884, 13523, 13211, 26214, 11638, 0, 65535, 0,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13523, 14746, 21738, 15044, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 6588, 8301, 19501, 9121, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 262, 13939, 12598, 23017, 12230, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 786, 4508, 8455, 12468, 12527, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 380, 10056, 14285, 17902, 16524, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 14910, 17201, 20779, 18005, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 56, 14910, 18275, 28132, 15044, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 16991, 13518, 28132, 11194, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 5895, 10910, 13746, 15044, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 304, 13592, 14285, 21419, 14451, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 33, 15604, 14746, 21419, 15044, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 16297, 11984, 15025, 15784, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 249, 16297, 14132, 29731, 11194, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 18735, 25894, 16524, 0, 0, 65535,
+    33465, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 11984, 27493, 10157, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 10749, 16127, 17583, 18894, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 20, 36408, 35307, 20460, 37106, 0, 0, 65535,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 16991, 14746, 27812, 12379, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 8669, 15206, 20779, 15932, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 9362, 23952, 21419, 24224, 0, 0, 65535,
+    50197, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 79, 10056, 17968, 17263, 21263, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 111, 12136, 18275, 12148, 27037, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 14078, 20116, 24296, 18449, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 236, 12830, 27788, 21738, 27964, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 33, 13523, 12291, 27493, 10306, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 12830, 9836, 21419, 10306, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 33, 12136, 17968, 18222, 20374, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12136, 12598, 20460, 13267, 0, 0, 65535,
+    36951, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12598, 19501, 13859, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 524, 7282, 17201, 19820, 18597, 0, 0, 65535,
+    35556, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 14592, 13746, 20078, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 13523, 18121, 23657, 17117, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 549, 7282, 11523, 22058, 11638, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 878, 13523, 16434, 28132, 13563, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 8669, 14592, 20140, 15636, 0, 0, 65535,
+    62746, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 11443, 12137, 19181, 13415, 0, 65535, 0,
+    45317, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 131, 13523, 13518, 21419, 13711, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 13518, 16943, 16228, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13939, 15513, 21099, 16228, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 7282, 16741, 12787, 24076, 0, 0, 65535
+};
+
+#pragma DATA_SECTION(far_chunk_4, ".fram2") // Place data in FRAM2
+const uint16_t far_chunk_4 [16368] = {
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 13518, 19820, 14600, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 210, 13592, 24719, 24296, 23039, 0, 0, 65535,
+    22310, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 354, 21845, 21497, 17902, 24816, 0, 0, 65535,
+    10458, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13523, 15360, 23976, 14451, 0, 0, 65535,
+    53683, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 341, 1734, 12904, 21419, 13119, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12444, 21099, 12823, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4063, 11443, 9836, 20460, 10454, 0, 65535, 0,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 354, 15604, 13979, 21099, 14451, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 13592, 15820, 20779, 16524, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 15604, 15360, 23657, 14451, 0, 0, 65535,
+    55077, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 11443, 12291, 26534, 10898, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 7282, 18428, 21099, 19042, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 760, 9362, 15973, 25255, 14451, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13592, 24259, 23976, 22891, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 12136, 19502, 18861, 21707, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 472, 16991, 8762, 21099, 9121, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 341, 14910, 16280, 21738, 16421, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 19765, 17354, 23657, 16524, 0, 65535, 0,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 14078, 14592, 26853, 12527, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 13592, 19656, 22697, 19190, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 10056, 20730, 24296, 19042, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 13523, 18582, 21738, 18894, 0, 0, 65535,
+    48803, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1022, 9362, 16587, 21738, 16821, 0, 0, 65535,
+    47408, 65535, 65535, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 12, 13592, 19656, 13427, 27185, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1126, 7282, 12444, 14705, 16524, 0, 65535, 0,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 1442, 6588, 15053, 16304, 18597, 0, 65535, 0,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 14439, 16943, 17413, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 17968, 23017, 17413, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 5201, 12904, 19501, 14155, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13893, 1734, 322, 26534, 311, 65535, 0, 0,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 13, 65535, 13365, 26853, 11490, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 10056, 12904, 16624, 15784, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 14078, 21344, 25894, 18745, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 13939, 11370, 14705, 15044, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 14078, 16741, 22378, 16524, 0, 0, 65535,
+    23704, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 170, 10749, 12904, 21738, 13034, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 15513, 20779, 16228, 0, 0, 65535,
+    41134, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13592, 23338, 15984, 29110, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 17684, 12751, 20140, 13563, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 14910, 13365, 17902, 15488, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 118, 15604, 17508, 21419, 17857, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 9362, 20270, 29091, 16376, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13523, 11523, 21738, 11650, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 1573, 10056, 12751, 23017, 12379, 0, 65535, 0,
+    52289, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 865, 6588, 13518, 24296, 12675, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 14078, 12904, 17583, 15192, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 16297, 19349, 22378, 19042, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 11830, 15664, 15044, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13939, 23952, 25255, 21707, 0, 0, 65535,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 3121, 15666, 17263, 18745, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 13592, 19042, 21099, 19634, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 7975, 16280, 18542, 18449, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 7975, 13211, 19820, 14303, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 3814, 7074, 8312, 12971, 0, 0, 65535,
+    16732, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 315, 14910, 22878, 34526, 16228, 0, 0, 65535,
+    31373, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 11443, 19809, 23657, 18894, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 16297, 16741, 23976, 15784, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 6588, 16587, 18222, 19042, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 1704, 5201, 12291, 16943, 14896, 0, 65535, 0,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 11443, 13825, 14386, 18449, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 13939, 19809, 19820, 21411, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 15604, 18275, 18542, 20670, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 7975, 12904, 14066, 17561, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 13592, 14592, 23337, 14007, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 14910, 14746, 24296, 13859, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10056, 14285, 19181, 15784, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13523, 14285, 24296, 13267, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 1040, 8608, 14386, 11786, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 147, 17684, 18275, 21419, 18449, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 12830, 14592, 23337, 14007, 0, 0, 65535,
+    44620, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 7975, 17661, 19820, 18894, 0, 0, 65535,
+    46711, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 11443, 21651, 21738, 21855, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 7975, 16127, 19820, 17413, 0, 65535, 0,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 26714, 39321, 16969, 0, 0, 65535,
+    13944, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 210, 11443, 11677, 15664, 14748, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13939, 11830, 18542, 13415, 0, 0, 65535,
+    52986, 65535, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 249, 10749, 17047, 22697, 16524, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 14910, 16741, 22058, 16672, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 852, 12136, 14439, 32288, 10898, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 66, 12136, 16587, 17583, 19486, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 14910, 15360, 26214, 13415, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    59260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 10749, 18582, 23337, 17709, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 8669, 9682, 28132, 7936, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 16741, 14386, 22299, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 5895, 15666, 10550, 25260, 0, 0, 65535,
+    35689, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 13523, 16894, 25575, 15044, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 751, 12136, 16280, 24296, 15044, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 17684, 13979, 21099, 14451, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 682, 13592, 14285, 19501, 15636, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 19765, 14899, 22058, 14896, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 16297, 22418, 28132, 18301, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 3121, 11370, 26214, 10009, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 9836, 17583, 11638, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 9362, 16894, 18222, 19190, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 157, 13592, 15666, 25255, 14303, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 273, 13592, 14899, 24296, 13859, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 11370, 13746, 15784, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 21152, 35000, 21738, 35329, 0, 0, 65535,
+    21613, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 11370, 14386, 15192, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14078, 17047, 19820, 18301, 0, 0, 65535,
+    39042, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15604, 32238, 25894, 28518, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 249, 14078, 16894, 23337, 16228, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 19963, 23017, 19338, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 20, 50278, 65535, 25894, 58132, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 15604, 12751, 25575, 11490, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 13365, 17902, 15488, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 273, 11443, 12291, 9590, 20818, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 29473, 27788, 29091, 22595, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 14078, 12137, 18542, 13711, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 262, 12830, 20883, 21738, 21115, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 11370, 18222, 13119, 0, 0, 65535,
+    30676, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 170, 8669, 10756, 24296, 10009, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 16297, 10756, 19501, 11786, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4325, 21845, 16938, 21738, 17081, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 15604, 16894, 17902, 19486, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 14910, 15666, 23337, 15192, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 1311, 14078, 9529, 23017, 9259, 0, 65535, 0,
+    53683, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 12136, 18275, 25255, 16524, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 3121, 20116, 14386, 26741, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 813, 11720, 16127, 27493, 13563, 0, 65535, 0,
+    45317, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 16297, 18275, 20460, 19338, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 5895, 13365, 10869, 21115, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 577, 13592, 20423, 23017, 19782, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14078, 14439, 14066, 19634, 0, 0, 65535,
+    28584, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 5, 14078, 16587, 19501, 18153, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 11443, 13672, 23337, 13119, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13523, 20423, 27493, 17265, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 288, 13939, 14899, 27493, 12527, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13523, 17815, 20460, 18745, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13939, 10296, 19820, 11194, 0, 0, 65535,
+    18824, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 315, 14078, 18735, 22697, 18301, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 1835, 13939, 11984, 19820, 12971, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 14910, 15513, 26534, 13415, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5636, 1734, 1703, 23976, 1639, 65535, 0, 0,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 94, 13592, 17968, 19181, 20226, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 8669, 13825, 16943, 16672, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 15604, 20270, 22058, 20374, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14910, 10449, 23017, 10157, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 13939, 18735, 17902, 21707, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 15604, 12598, 16943, 15192, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 15820, 27173, 13563, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 13939, 65535, 25894, 58132, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 210, 21152, 8915, 20779, 9417, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9362, 13211, 27173, 11342, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1966, 13523, 11984, 23337, 11638, 0, 65535, 0,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 7975, 15053, 19820, 16228, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 9362, 17354, 16943, 20818, 0, 0, 65535,
+    27887, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 9362, 19502, 28132, 16228, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16297, 16280, 22697, 15913, 0, 0, 65535,
+    57866, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 13939, 23185, 22058, 23187, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 341, 5201, 14439, 19501, 15784, 0, 0, 65535,
+    32767, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 157, 13592, 15666, 14066, 21263, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10749, 13979, 16624, 17265, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 21845, 18428, 32288, 13859, 0, 0, 65535,
+    48803, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 10749, 24719, 26534, 21559, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 249, 14078, 17661, 29411, 14155, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 891, 4508, 12444, 15984, 15488, 0, 65535, 0,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 21152, 17047, 20140, 18301, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 9362, 13365, 16624, 16376, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 5112, 7975, 6920, 27493, 5864, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 13592, 21037, 39001, 13415, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 16991, 14746, 26853, 12823, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 11443, 14285, 19501, 15636, 0, 65535, 0,
+    38345, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 18378, 32085, 27812, 26889, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 10749, 13211, 14705, 17265, 0, 0, 65535,
+    23007, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 19071, 24106, 39321, 15340, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 11443, 17354, 23017, 16821, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 66, 14910, 13211, 24296, 12082, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 406, 12136, 14132, 20140, 15044, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 13592, 12291, 17902, 14303, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 17047, 19820, 18449, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 1311, 14910, 12751, 20140, 13711, 0, 65535, 0,
+    9761, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 19765, 15053, 21738, 15340, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 11443, 20730, 23976, 19486, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 11523, 16624, 14155, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 131, 21845, 17508, 26534, 15192, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 11443, 10449, 25575, 9417, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 33, 16297, 16280, 22058, 16376, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 16991, 16434, 23017, 15932, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 18889, 28132, 15784, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 13523, 26407, 24296, 24076, 0, 0, 65535,
+    49500, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 28095, 30690, 21855, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2490, 7975, 15206, 21419, 15442, 0, 65535, 0,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 16297, 14899, 23017, 14451, 0, 0, 65535,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 18378, 24566, 24296, 22743, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 13592, 20270, 19181, 22299, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 4719, 7975, 16280, 24296, 14896, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 16991, 8148, 19820, 8825, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 17047, 26214, 15044, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2490, 11720, 13825, 29411, 11046, 0, 65535, 0,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 15604, 15206, 22697, 14869, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 15604, 13672, 24296, 12675, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14078, 12137, 19181, 13415, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13939, 12598, 11828, 19042, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 5201, 6920, 13427, 9861, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 14078, 14132, 22058, 14155, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 12830, 12444, 15984, 15488, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 13592, 13825, 20779, 14451, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 813, 11443, 10603, 19501, 11638, 0, 65535, 0,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 1734, 11830, 14066, 16080, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 76, 15604, 14746, 21738, 14896, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 14078, 11217, 16304, 13859, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13523, 14899, 20460, 15784, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 12136, 19502, 26853, 16821, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 328, 13523, 15053, 18222, 17265, 0, 0, 65535,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 98, 14910, 15820, 19181, 17413, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 304, 2427, 16938, 21738, 17081, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1271, 7282, 11370, 16304, 14007, 0, 65535, 0,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 13592, 16434, 23976, 15488, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 13592, 15513, 18861, 17413, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 12830, 16280, 15984, 20226, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 197, 14078, 19349, 25575, 17413, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 9362, 13825, 15664, 17561, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 18428, 21738, 18575, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 1734, 6306, 3197, 17117, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 72, 2427, 13365, 13746, 18449, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13592, 13058, 14705, 17265, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 13592, 10910, 11189, 16821, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 5374, 11443, 14132, 23657, 13415, 0, 65535, 0,
+    50894, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 14078, 11370, 20140, 12082, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 21152, 17815, 25575, 15784, 0, 0, 65535,
+    57866, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 5895, 10296, 15984, 12971, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13939, 15820, 23657, 15192, 0, 0, 65535,
+    13944, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 12136, 14132, 21738, 14303, 0, 0, 65535,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 419, 13592, 24106, 22378, 23632, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 380, 11443, 11063, 22058, 11046, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 13365, 15664, 16969, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3146, 11443, 11063, 17902, 12823, 0, 65535, 0,
+    38345, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 17968, 22378, 17709, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 8669, 13518, 18861, 15044, 0, 0, 65535,
+    35208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13523, 17661, 27173, 15044, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 21344, 29411, 17117, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 8669, 10449, 21738, 10572, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 16297, 19502, 30690, 15192, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 19809, 26853, 17117, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 8301, 18222, 9269, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13939, 14592, 14066, 19782, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 13592, 20270, 28132, 16821, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 13939, 11063, 10230, 18005, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    36253, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 13592, 23032, 21419, 23484, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 8669, 11523, 15345, 14896, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 16297, 14132, 21419, 14451, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 17201, 19820, 18597, 0, 0, 65535,
+    37648, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12830, 15973, 14705, 20966, 0, 0, 65535,
+    17430, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13523, 10603, 13107, 15044, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12136, 16127, 13746, 22003, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 878, 10056, 15053, 11828, 22595, 0, 65535, 0,
+    56472, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 11443, 14746, 20140, 15636, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 12830, 15053, 25575, 13563, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 16991, 18735, 30050, 14748, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1060, 7975, 13672, 21738, 13859, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 16991, 31471, 18542, 35477, 0, 0, 65535,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13592, 10603, 21738, 10725, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 13592, 15973, 18542, 18005, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13523, 13825, 22378, 13711, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13939, 19042, 20460, 20078, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 10056, 15206, 22697, 14869, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 13592, 14285, 19820, 15488, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13592, 11063, 21419, 11342, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 16297, 15206, 26853, 13267, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 13523, 14439, 22697, 14155, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 15604, 17661, 22058, 17413, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573, 11720, 15053, 25575, 13563, 0, 65535, 0,
+    18824, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 4508, 12904, 25575, 11638, 0, 0, 65535,
+    28584, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7209, 13592, 11370, 22058, 11490, 0, 0, 65535,
+    62746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 9362, 15053, 19181, 16672, 0, 0, 65535,
+    13944, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 5895, 9989, 21738, 10110, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 12136, 17815, 22378, 17413, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 12136, 13825, 13107, 19634, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5505, 1040, 1703, 28132, 1421, 65535, 0, 0,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 2621, 16991, 16587, 41239, 10157, 0, 65535, 0,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 15604, 15053, 22697, 14748, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 15604, 9989, 21099, 10306, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 23925, 31317, 21738, 31504, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 12830, 9682, 13746, 13415, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 17684, 16127, 24296, 14748, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 11443, 15206, 26853, 13267, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 7975, 18582, 26853, 16080, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 12136, 10449, 14066, 14303, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 12136, 14746, 22378, 14600, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 15604, 32085, 33886, 23039, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 6291, 3121, 198, 34526, 104, 65535, 0, 0,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 13592, 14285, 22697, 14007, 0, 0, 65535,
+    8366, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 12137, 21419, 12379, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 210, 11443, 15206, 19501, 16672, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 15604, 21037, 29411, 16821, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13592, 17047, 21419, 17413, 0, 0, 65535,
+    59958, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 26, 10056, 19809, 18542, 22299, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 16297, 17508, 24296, 16376, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 15604, 13365, 19181, 14748, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 12136, 17815, 20140, 18894, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3670, 13939, 10910, 23976, 10306, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12136, 13058, 27493, 10898, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 273, 10749, 20423, 21738, 20577, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 16991, 17047, 26534, 14896, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13939, 25640, 21738, 25853, 0, 0, 65535,
+    23007, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3408, 25312, 15973, 29731, 12675, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 944, 23925, 18889, 35165, 13267, 0, 65535, 0,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 16991, 12444, 24296, 11342, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 18378, 18582, 23337, 17857, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 17684, 19349, 36444, 13119, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 13592, 20116, 23657, 19042, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 9362, 21651, 32608, 15932, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 18378, 18428, 32288, 13711, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 13592, 14439, 21419, 14748, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 10056, 9375, 23337, 8973, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 68, 12136, 15973, 20779, 16672, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 23232, 31778, 24296, 29110, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 11443, 14285, 20779, 14896, 0, 65535, 0,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 1734, 10756, 18222, 12379, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 18378, 16434, 25894, 14600, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 9362, 9068, 11509, 14155, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13592, 15206, 20779, 15932, 0, 0, 65535,
+    11155, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 22538, 12444, 21738, 12572, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 13939, 22725, 54026, 10898, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 115, 14078, 13058, 18222, 15044, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 10056, 14899, 23337, 14303, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 15604, 13211, 18222, 15192, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 1734, 6613, 9590, 11342, 0, 0, 65535,
+    47408, 65535, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9362, 24566, 17263, 29110, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 13592, 12598, 15345, 16080, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 1734, 4465, 7672, 8529, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1087, 11443, 17201, 18542, 19486, 0, 65535, 0,
+    23704, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13523, 18121, 16943, 21559, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 11443, 13211, 18542, 15044, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 16991, 13672, 21419, 13893, 0, 65535, 0,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 760, 8669, 13672, 21099, 14155, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 17508, 25894, 15488, 0, 0, 65535,
+    31373, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13592, 11523, 20779, 12082, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 11443, 14285, 17583, 16821, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 12136, 15053, 23976, 14155, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 249, 13592, 27481, 53387, 13415, 0, 0, 65535,
+    15338, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 6588, 17201, 20460, 18153, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 13523, 18428, 21738, 18575, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 9362, 19656, 22378, 19338, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 9375, 16624, 11490, 0, 0, 65535,
+    32070, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 12136, 16587, 20460, 17413, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 13939, 15513, 26853, 13267, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 16991, 12598, 16943, 15192, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 66, 16297, 14899, 25255, 13415, 0, 0, 65535,
+    14641, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 87, 14910, 17968, 30050, 14155, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 12830, 19656, 21419, 20078, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 248, 13939, 19809, 18861, 22151, 0, 0, 65535,
+    65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577, 2427, 7841, 10869, 12527, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 8669, 10756, 15345, 13859, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 54, 13592, 17508, 27493, 14896, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 11443, 9375, 22058, 9417, 0, 65535, 0,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 17354, 22378, 17117, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 6103, 13211, 12148, 19634, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 13592, 13825, 17583, 16228, 0, 0, 65535,
+    39042, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 16991, 9682, 20140, 10454, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 19071, 16280, 19820, 17561, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 852, 11443, 16434, 36124, 11194, 0, 65535, 0,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 17684, 12904, 27173, 11194, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 11443, 17354, 25255, 15636, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 301, 14910, 14592, 20779, 15192, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 13523, 21344, 23976, 20078, 0, 0, 65535,
+    20218, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 7, 12830, 16741, 15664, 21115, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 83, 17684, 24106, 29411, 19486, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 17684, 32392, 22697, 31627, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 76, 13939, 22571, 23976, 21263, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 7282, 10296, 23017, 10009, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12136, 26100, 23017, 25260, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3460, 15604, 10756, 25894, 9565, 0, 65535, 0,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 22538, 19809, 29731, 15932, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 8669, 16434, 26853, 14155, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 85, 13939, 18889, 32927, 13859, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4981, 2427, 5232, 14705, 7048, 65535, 0, 0,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 183, 16991, 15053, 23976, 13859, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14910, 17354, 27493, 14748, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 16938, 21738, 17081, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 14078, 21958, 29411, 17561, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 11370, 18861, 12675, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 11443, 14592, 25575, 12971, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 12136, 21344, 27173, 18153, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 301, 14910, 18428, 25894, 16376, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 826, 6311, 8608, 22378, 8529, 65535, 0, 0,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 17661, 20140, 18894, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 11443, 11984, 19501, 13119, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 13592, 15206, 17902, 17709, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 13939, 13825, 22058, 13711, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 15360, 25894, 13711, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 288, 13592, 12904, 16624, 15784, 0, 0, 65535,
+    24401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 472, 8669, 23032, 23017, 22151, 0, 0, 65535,
+    20218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 16991, 17047, 28132, 14007, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 63, 20458, 14439, 24296, 13267, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 406, 13592, 17661, 23337, 16969, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13523, 21190, 23976, 19930, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 15360, 27812, 12971, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 12136, 15666, 22697, 15316, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 15973, 26534, 13859, 0, 0, 65535,
+    48803, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 3277, 1734, 4312, 12787, 6456, 65535, 0, 0,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 5201, 15666, 19181, 17413, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 3121, 16938, 21738, 17081, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 13523, 6767, 15025, 8973, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 13592, 13365, 12787, 19190, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 7282, 13825, 15984, 17265, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 9362, 10910, 14386, 14600, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 5201, 23185, 15025, 29851, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 3, 19071, 15666, 21738, 15805, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4325, 13592, 35460, 59781, 15784, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 5201, 15360, 19501, 16821, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10749, 14899, 18542, 16969, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 433, 4508, 11217, 14066, 15192, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 8669, 13518, 23657, 12823, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 10749, 14439, 26853, 12527, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 11443, 15053, 18542, 16969, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 41, 19765, 21497, 35485, 14896, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 15604, 14285, 24296, 13267, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 13592, 21037, 24296, 19190, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 6588, 13365, 15664, 16969, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 12136, 19502, 20140, 20818, 0, 0, 65535,
+    43225, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13592, 6920, 8631, 12527, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 11443, 15973, 27173, 13711, 0, 65535, 0,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 14592, 16943, 17413, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 23032, 40919, 14155, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 5201, 11370, 17263, 13415, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 14899, 18542, 16969, 0, 0, 65535,
+    46711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 13523, 16280, 27812, 13563, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13523, 19502, 22697, 19046, 0, 0, 65535,
+    51591, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 17684, 13365, 22697, 13119, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 12830, 16615, 22697, 16239, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 21152, 18582, 26214, 16376, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 4508, 8915, 5754, 19338, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 695, 9362, 8148, 19181, 9121, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 18378, 20423, 31649, 15488, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 15513, 20779, 16228, 0, 0, 65535,
+    46711, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1231, 6311, 4772, 11189, 7640, 65535, 0, 0,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 315, 16991, 13825, 25255, 12527, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13939, 17508, 29731, 14007, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1311, 14910, 11984, 25894, 10602, 0, 65535, 0,
+    45317, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 773, 10056, 16127, 19501, 17561, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 210, 14910, 12904, 21419, 13267, 0, 0, 65535,
+    48105, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 301, 19071, 13365, 26214, 11786, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1507, 6588, 19196, 21738, 19338, 0, 65535, 0,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13939, 18582, 22697, 18894, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 10749, 29016, 28132, 23928, 0, 0, 65535,
+    51591, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 15604, 14132, 26214, 12379, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 7, 13592, 22111, 27493, 18745, 0, 0, 65535,
+    20915, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 12136, 9836, 19501, 10306, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6160, 6311, 2470, 21099, 2606, 65535, 0, 0,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 11443, 23032, 24296, 20966, 0, 0, 65535,
+    39739, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 23232, 19349, 21419, 19782, 0, 0, 65535,
+    43922, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 10056, 13211, 22058, 13267, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 12136, 17047, 20460, 18005, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 354, 10056, 15360, 21419, 15784, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 14078, 15053, 17902, 17561, 0, 0, 65535,
+    47408, 65535, 65535, 0, 0, 0, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 0, 39, 17684, 13211, 26214, 11638, 0, 0, 65535,
+    48105, 0, 65535, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 524, 12136, 16280, 17263, 19338, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 18428, 24296, 16821, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 11443, 13979, 22697, 13674, 0, 0, 65535,
+    50894, 65535, 65535, 0, 65535, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 682, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 0, 0, 0, 328, 13939, 17661, 23017, 17117, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 107, 9362, 19349, 19181, 21411, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 105, 14910, 13518, 16304, 16672, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 13592, 23032, 22697, 22595, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13939, 22878, 27173, 19634, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 11443, 11063, 16943, 13415, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 12136, 14439, 18222, 16524, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 11677, 16304, 14451, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 17661, 21419, 18005, 0, 0, 65535,
+    34162, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 14910, 13518, 26534, 11786, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 12830, 13365, 22697, 13119, 0, 0, 65535,
+    20915, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 5, 18378, 24566, 21099, 25112, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 13939, 15513, 19820, 16821, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 12136, 14899, 20140, 15932, 0, 0, 65535,
+    57169, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 12136, 14746, 15345, 18894, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13523, 17815, 26534, 15488, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 20577, 27812, 17265, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 4508, 12904, 20140, 13859, 0, 0, 65535,
+    4183, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 13523, 13825, 17902, 15932, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 419, 8669, 11523, 22058, 11490, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 9362, 17201, 22058, 17117, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 37609, 36764, 25260, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13939, 13979, 22058, 14007, 0, 0, 65535,
+    24401, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 20458, 10449, 18222, 12082, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 10749, 13518, 19181, 14896, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 16297, 21958, 20460, 23187, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 19765, 14746, 27493, 12675, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 16991, 12904, 26534, 11194, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 118, 16297, 18428, 22697, 18153, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12830, 14899, 24296, 13415, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 13592, 24106, 47952, 12971, 0, 0, 65535,
+    19521, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 7282, 6613, 22697, 15044, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 14439, 23337, 14007, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 19071, 18275, 26853, 15784, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 14910, 10603, 28132, 8825, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 12830, 18889, 19820, 20522, 0, 0, 65535,
+    27887, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 472, 23232, 14746, 25255, 13415, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 10056, 8301, 13107, 11934, 0, 65535, 0,
+    39739, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13939, 24719, 26214, 21707, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 7282, 15666, 18861, 17561, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 12830, 15513, 23337, 15044, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 14439, 27173, 12379, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 13592, 19502, 24296, 17857, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13523, 15513, 21099, 16080, 0, 0, 65535,
+    34859, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 8669, 24106, 22697, 23632, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16991, 22725, 29731, 18153, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 354, 6588, 9836, 17583, 11490, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 13939, 17661, 17583, 20670, 0, 0, 65535,
+    50197, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 23492, 22697, 23039, 0, 0, 65535,
+    27887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 13523, 19042, 24296, 17709, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 1573, 14910, 10449, 35804, 7196, 65535, 0, 0,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 13523, 14439, 18861, 16228, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 5895, 21037, 22697, 20540, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 983, 10749, 12137, 25575, 11046, 0, 65535, 0,
+    13246, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 10056, 15360, 26214, 13415, 0, 0, 65535,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 79, 14910, 18428, 20779, 19190, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 485, 14078, 18582, 21419, 19042, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 1040, 11830, 16624, 14303, 0, 0, 65535,
+    18127, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 114, 12136, 14592, 23017, 14155, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 16894, 20460, 17857, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 12, 33634, 33466, 20779, 34737, 0, 0, 65535,
+    10458, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16991, 15360, 18542, 17413, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 16894, 22058, 16969, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 13523, 14592, 19181, 16228, 0, 0, 65535,
+    34859, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 20577, 17902, 23780, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 20458, 13518, 27812, 11342, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 13939, 17047, 24296, 15636, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 13939, 12291, 24296, 11490, 0, 0, 65535,
+    23007, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 19071, 23338, 23017, 22595, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 15604, 12291, 22058, 12230, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 13592, 17354, 23017, 16969, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 13523, 15513, 24296, 14155, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13365, 23017, 12971, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 12830, 14285, 26853, 12230, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 29, 19071, 14132, 26214, 12379, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 3814, 8915, 9590, 15192, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 170, 11443, 13365, 9271, 23039, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 13592, 20270, 23657, 19338, 0, 0, 65535,
+    31373, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 393, 15604, 12598, 19820, 13563, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 14910, 16127, 19501, 17561, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 13523, 12904, 27812, 10898, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 109, 12830, 17354, 22697, 16969, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13939, 15053, 19820, 16376, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 13592, 16894, 21099, 17413, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 25312, 25487, 27493, 21559, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 904, 11720, 14439, 18861, 16228, 0, 65535, 0,
+    43225, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 4, 10056, 22111, 20779, 23039, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 16297, 17354, 22058, 17413, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12136, 13365, 13746, 18301, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 13939, 20577, 43157, 12082, 0, 0, 65535,
+    52986, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 13939, 19656, 14705, 25705, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 16297, 18428, 27493, 15636, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 13592, 22264, 18861, 24816, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 668, 10749, 13518, 25575, 12230, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 6588, 15360, 22697, 15019, 0, 0, 65535,
+    52986, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 13523, 11830, 21738, 11958, 0, 0, 65535,
+    27887, 65535, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 14910, 9375, 21099, 9861, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    61352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 10749, 16127, 20460, 17117, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13592, 14439, 17583, 16969, 0, 0, 65535,
+    18824, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 12830, 26407, 30370, 20818, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 22571, 24296, 20670, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13592, 14592, 15025, 19042, 0, 0, 65535,
+    38345, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 20458, 15513, 27812, 12971, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 13523, 11523, 23017, 11182, 0, 65535, 0,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 8669, 16587, 18542, 18597, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 170, 12830, 15053, 22697, 14719, 0, 0, 65535,
+    35556, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 10056, 16587, 22378, 16524, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 170, 12136, 15513, 22697, 15167, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 19656, 27173, 16821, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    33465, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13939, 27788, 18542, 31331, 0, 0, 65535,
+    59958, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 7975, 15360, 18861, 17117, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 10056, 17047, 13427, 23780, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11665, 1040, 1089, 27173, 977, 65535, 0, 0,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 23925, 29936, 48272, 16080, 0, 0, 65535,
+    36951, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13939, 23492, 30370, 18301, 0, 0, 65535,
+    47408, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 10749, 12751, 13427, 17857, 0, 0, 65535,
+    27190, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 315, 7975, 14132, 16624, 17265, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 223, 13592, 10143, 7672, 18894, 0, 0, 65535,
+    34859, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 11370, 15664, 14303, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 144, 11443, 16587, 17583, 19486, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 17583, 16524, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 13939, 15973, 22697, 15488, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 10056, 21037, 19181, 23336, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 4, 17684, 19196, 23976, 18005, 0, 0, 65535,
+    33465, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 15604, 18428, 27812, 15340, 0, 0, 65535,
+    13246, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12136, 18889, 25255, 16969, 0, 0, 65535,
+    55077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 14910, 14439, 24296, 13563, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 23952, 48592, 12675, 0, 0, 65535,
+    52986, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    14641, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 11443, 15360, 23017, 14896, 0, 0, 65535,
+    25099, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 12830, 17508, 23017, 17117, 0, 0, 65535,
+    46014, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 13939, 18121, 21738, 18449, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 7282, 25794, 25894, 22891, 0, 0, 65535,
+    41134, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 9362, 8301, 10869, 13267, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 23232, 20423, 14386, 27037, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 13523, 11217, 23976, 10454, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 14910, 16615, 22697, 13711, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 16991, 14899, 20779, 15488, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 12137, 25255, 11046, 0, 0, 65535,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 20458, 19809, 34206, 14155, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 79, 13939, 11523, 25255, 10454, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 10056, 13825, 15025, 18005, 0, 0, 65535,
+    18824, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 19765, 25794, 29411, 20818, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 7282, 10296, 20460, 10898, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 248, 19765, 23952, 36764, 16080, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 6588, 21497, 17583, 25260, 0, 0, 65535,
+    21613, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    20915, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 12136, 17968, 30050, 14303, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 223, 12830, 15513, 27173, 13267, 0, 0, 65535,
+    32767, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9362, 19349, 19820, 20818, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 6588, 22725, 13427, 31627, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 262, 12136, 18889, 20140, 20078, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 16991, 13979, 21099, 14451, 0, 0, 65535,
+    29282, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13939, 20116, 23976, 19042, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 8782, 4508, 11830, 25255, 10602, 0, 0, 65535,
+    63443, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 39, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39042, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 13592, 21344, 18861, 23780, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 301, 13592, 11984, 20140, 12823, 0, 0, 65535,
+    61352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 13592, 15513, 23337, 14896, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 14910, 11984, 21738, 12082, 0, 0, 65535,
+    30676, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16991, 17047, 23337, 16376, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 14910, 24259, 24296, 22299, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 11443, 15513, 22697, 15167, 0, 0, 65535,
+    32767, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 878, 13592, 24259, 42838, 14303, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 20270, 25255, 18449, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 16991, 13979, 27812, 11786, 0, 0, 65535,
+    23704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12830, 16434, 20779, 17117, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 33, 26699, 20883, 31649, 15932, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 10749, 15666, 18542, 17709, 0, 0, 65535,
+    16732, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 11443, 18428, 24296, 16821, 0, 0, 65535,
+    37648, 65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 1126, 1734, 10756, 15345, 13859, 0, 65535, 0,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 248, 13939, 13058, 18861, 14451, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 58600, 36995, 22378, 36514, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 304, 14078, 14899, 21738, 15044, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 13592, 15666, 24296, 14600, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4063, 5201, 1550, 29091, 1273, 65535, 0, 0,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 18378, 14285, 24296, 13119, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13592, 15973, 27173, 13711, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 11443, 15513, 23337, 14896, 0, 0, 65535,
+    56472, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 10749, 14592, 19501, 15932, 0, 0, 65535,
+    46014, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 262, 16991, 19963, 29091, 16228, 0, 0, 65535,
+    37648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 12830, 12598, 25255, 11490, 0, 65535, 0,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 30860, 30857, 55945, 14451, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 23925, 21958, 26214, 19338, 0, 0, 65535,
+    27190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 786, 13523, 18735, 24296, 17413, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 236, 14078, 15360, 20460, 16228, 0, 0, 65535,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 549, 14078, 12291, 29091, 9861, 0, 0, 65535,
+    32070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 50, 23232, 21651, 31329, 16524, 0, 0, 65535,
+    23007, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 21152, 14439, 26214, 12379, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577, 11443, 13979, 22058, 14007, 0, 0, 65535,
+    57866, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3408, 13939, 10756, 23976, 10306, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 65535, 0, 0, 249, 14078, 14132, 21099, 14600, 0, 0, 65535,
+    9761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 23492, 23657, 22151, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13592, 14132, 11189, 22003, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 7975, 15820, 30370, 12379, 0, 0, 65535,
+    48803, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 9362, 17968, 18861, 20078, 0, 0, 65535,
+    46014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 131, 9362, 17968, 21099, 18597, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 2228, 14910, 19656, 30050, 15636, 0, 0, 65535,
+    12549, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 13592, 12137, 9590, 20226, 0, 0, 65535,
+    48105, 0, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 5895, 15513, 17583, 18005, 0, 0, 65535,
+    24401, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 16991, 15206, 21738, 15340, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 12830, 20423, 19820, 22151, 0, 0, 65535
+};
+
+#pragma DATA_SECTION(far_chunk_5, ".fram2") // Place data in FRAM2
+const uint16_t far_chunk_5 [4560] = {
+    9761, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 15604, 27635, 19501, 29999, 0, 0, 65535,
+    11155, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 13592, 10910, 15664, 13859, 0, 0, 65535,
+    25796, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 10749, 22418, 22058, 22447, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 13592, 11063, 23017, 10750, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 15604, 25026, 17902, 28962, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 16991, 13518, 23657, 12971, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 328, 14078, 11677, 22697, 11490, 0, 0, 65535,
+    43225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 12136, 15360, 17902, 18005, 0, 0, 65535,
+    46711, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 12751, 20779, 13267, 0, 0, 65535,
+    47408, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 13939, 10756, 20779, 11342, 0, 0, 65535,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 17684, 17508, 24296, 16080, 0, 0, 65535,
+    34162, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 7995, 6311, 1550, 28132, 1273, 65535, 0, 0,
+    48105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 13592, 16587, 17263, 19930, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 13592, 12598, 21099, 12971, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 13523, 14746, 23976, 13711, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16991, 15206, 28132, 12527, 0, 0, 65535,
+    12549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 14910, 13365, 28132, 11194, 0, 0, 65535,
+    14641, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 12136, 21804, 20460, 23039, 0, 0, 65535,
+    56472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 3121, 14899, 21738, 15044, 0, 0, 65535,
+    22310, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 14910, 13365, 22378, 13119, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 16991, 17661, 22697, 17257, 0, 0, 65535,
+    15338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 603, 13939, 23645, 45715, 13267, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1966, 13592, 24566, 40919, 15044, 0, 0, 65535,
+    34859, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 14910, 24719, 25894, 22003, 0, 0, 65535,
+    29282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9175, 3121, 0, 24296, 59, 65535, 0, 0,
+    26493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    55774, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 511, 9362, 15206, 23657, 14451, 0, 0, 65535,
+    38345, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1245, 13939, 17201, 32927, 12675, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 20116, 31968, 15192, 0, 0, 65535,
+    25099, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 13939, 27328, 29731, 21855, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 16991, 15666, 23337, 14896, 0, 0, 65535,
+    54380, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 315, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    52289, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 12136, 19042, 31968, 14303, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10749, 18428, 25894, 16376, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 8520, 6311, 7074, 21419, 7344, 65535, 0, 0,
+    20915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 17684, 13825, 28132, 11342, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16297, 19042, 17902, 22151, 0, 0, 65535,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 15604, 17047, 24296, 15932, 0, 0, 65535,
+    57866, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 16991, 20577, 26214, 18153, 0, 0, 65535,
+    51591, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 23232, 15360, 33247, 11194, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 0, 13518, 22058, 13415, 0, 65535, 0,
+    16035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 83, 16297, 13979, 20779, 14600, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 459, 5201, 9989, 22058, 10009, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 21152, 20423, 25255, 18449, 0, 0, 65535,
+    11852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 773, 14078, 13825, 21738, 14007, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 944, 13592, 35460, 13427, 49099, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 21152, 19809, 24296, 18153, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13523, 12904, 22697, 12630, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 13979, 16624, 17117, 0, 0, 65535,
+    31373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 15604, 14592, 20779, 15192, 0, 0, 65535,
+    19521, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 183, 23232, 22111, 38682, 14303, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 8126, 5895, 12904, 21099, 13267, 0, 65535, 0,
+    39739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2621, 6311, 5539, 23017, 5419, 65535, 0, 0,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 17968, 22378, 17709, 0, 0, 65535,
+    55774, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 11443, 10449, 20460, 11046, 0, 0, 65535,
+    41134, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 14746, 23976, 13859, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 354, 8669, 15666, 23337, 15044, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 17684, 14132, 23337, 13711, 0, 0, 65535,
+    57866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 10056, 12291, 15984, 15340, 0, 0, 65535,
+    27190, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 13939, 17968, 24296, 16524, 0, 0, 65535,
+    7669, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 16938, 21738, 17081, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 10749, 21037, 21419, 21559, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 16297, 21344, 26853, 18449, 0, 0, 65535,
+    45317, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 12830, 10603, 17902, 12379, 0, 0, 65535,
+    52289, 65535, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 157, 14078, 11984, 21099, 12379, 0, 0, 65535,
+    20915, 65535, 65535, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13939, 16587, 23017, 16080, 0, 0, 65535,
+    46014, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 12136, 21497, 18861, 23928, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 1, 12830, 13058, 16943, 15784, 0, 0, 65535,
+    43922, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 10056, 19963, 25575, 18005, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 15604, 15513, 25575, 13859, 0, 0, 65535,
+    29979, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 117, 13939, 5693, 21738, 5864, 0, 0, 65535,
+    28584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 13592, 19042, 24296, 17561, 0, 0, 65535,
+    40436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 19765, 18428, 32927, 13563, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 14910, 11677, 13427, 16524, 0, 0, 65535,
+    25796, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 96, 16297, 20270, 24296, 18745, 0, 0, 65535,
+    32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 16297, 20116, 27493, 16969, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 9362, 16894, 23976, 15932, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 5895, 14285, 15025, 18449, 0, 0, 65535,
+    25099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 84, 14078, 13672, 22697, 13415, 0, 0, 65535,
+    16732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 11523, 19820, 12527, 0, 0, 65535,
+    13944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 14078, 12137, 15345, 15636, 0, 0, 65535,
+    29282, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 14910, 19502, 22058, 19486, 0, 0, 65535,
+    50894, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 944, 8669, 14285, 22697, 14007, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 13518, 13746, 18597, 0, 0, 65535,
+    39042, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 16991, 18121, 23657, 17265, 0, 0, 65535,
+    49500, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 590, 13592, 15206, 21099, 15636, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 144, 16297, 11984, 22058, 12082, 0, 0, 65535,
+    41134, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 10056, 18889, 21738, 19042, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 16297, 15360, 27493, 12971, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 157, 13592, 10603, 17902, 12379, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 14078, 14899, 24296, 13711, 0, 0, 65535,
+    26493, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 8669, 12444, 20140, 14007, 0, 0, 65535,
+    23704, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 13592, 16938, 21738, 20818, 0, 0, 65535,
+    35556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 10749, 15360, 20460, 16080, 0, 0, 65535,
+    55077, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 26, 12136, 16587, 22058, 16524, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 20730, 20779, 21559, 0, 0, 65535,
+    36253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13939, 18428, 20140, 19782, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 7975, 16894, 23337, 16080, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 13592, 17815, 26853, 15488, 0, 0, 65535,
+    48105, 65535, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 3814, 17201, 14386, 23039, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 603, 10056, 13672, 23657, 12971, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 11443, 16280, 20779, 16969, 0, 0, 65535,
+    44620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 9362, 19349, 23017, 18745, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 13939, 13058, 20779, 13711, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 14910, 13365, 22378, 13267, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2884, 7975, 10449, 26534, 9121, 65535, 0, 0,
+    36951, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 13, 12830, 15206, 20779, 15932, 0, 0, 65535,
+    49500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 197, 12136, 14439, 23017, 14007, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 12136, 13825, 21419, 14155, 0, 0, 65535,
+    52289, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 118, 14910, 15666, 25894, 13859, 0, 0, 65535,
+    50894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 13592, 23645, 30690, 18449, 0, 0, 65535,
+    29979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 13592, 13979, 19820, 15192, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 11443, 16587, 17263, 19634, 0, 0, 65535,
+    43225, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13939, 24259, 25255, 22003, 0, 0, 65535,
+    30676, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 10, 13592, 25794, 19181, 28370, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 13939, 16615, 22697, 16239, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 273, 13939, 11217, 23017, 10750, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16991, 19656, 26534, 17117, 0, 0, 65535,
+    11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 12291, 22697, 12082, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 13592, 12751, 25894, 11342, 0, 0, 65535,
+    14641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 157, 12830, 13672, 18861, 15192, 0, 0, 65535,
+    41831, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 15604, 15513, 20460, 16376, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4063, 28086, 34847, 54985, 16672, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 304, 18378, 10449, 18222, 12082, 0, 0, 65535,
+    38345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 11443, 8762, 15664, 11194, 0, 0, 65535,
+    34859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 12830, 14285, 23017, 13859, 0, 0, 65535,
+    41831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 13592, 16434, 23337, 15784, 0, 0, 65535,
+    18127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 15360, 27493, 13119, 0, 0, 65535,
+    44620, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 406, 18378, 19656, 23976, 18301, 0, 0, 65535,
+    42528, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 4508, 10449, 14705, 13859, 0, 0, 65535,
+    40436, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 16297, 12751, 19820, 13859, 0, 0, 65535,
+    10458, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 12830, 16741, 31329, 12823, 0, 0, 65535,
+    28584, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 15604, 20116, 23017, 19486, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564, 13523, 23185, 23017, 22447, 0, 0, 65535,
+    48803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 14078, 17815, 23976, 16821, 0, 0, 65535,
+    41831, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 15604, 22571, 29411, 18153, 0, 0, 65535,
+    16732, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 273, 13939, 15053, 23017, 14600, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 4, 18378, 16741, 23017, 16228, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2490, 14910, 12291, 23976, 11638, 0, 65535, 0,
+    46014, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 5895, 11063, 14386, 14748, 0, 0, 65535,
+    40436, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 13592, 17968, 20779, 18745, 0, 0, 65535,
+    58563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 7282, 16434, 25575, 14748, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 839, 11443, 14439, 18861, 16228, 0, 65535, 0,
+    22310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 21845, 23185, 33247, 16969, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 14910, 12137, 21099, 12527, 0, 0, 65535,
+    20218, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577, 18378, 19656, 22697, 19190, 0, 0, 65535,
+    36951, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 5243, 12830, 6920, 16304, 8677, 65535, 0, 0,
+    48105, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 118, 13939, 10296, 16624, 12527, 0, 0, 65535,
+    17430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 13523, 11830, 15664, 15044, 0, 0, 65535,
+    9063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 7975, 15360, 19181, 17117, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 13592, 14592, 20779, 15192, 0, 0, 65535,
+    41134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 13939, 17354, 24296, 15784, 0, 0, 65535,
+    18824, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 17684, 21497, 25255, 19486, 0, 0, 65535,
+    51591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 15820, 27493, 13415, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 37, 5895, 11677, 13427, 16228, 0, 0, 65535,
+    38345, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 19765, 19963, 23017, 19338, 0, 0, 65535,
+    42528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2752, 9362, 13058, 15664, 16672, 0, 65535, 0,
+    45317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 14910, 16434, 29731, 13119, 0, 0, 65535,
+    32767, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 10749, 14285, 16304, 17709, 0, 0, 65535,
+    50894, 65535, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 14078, 25026, 19501, 27185, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 126, 9362, 15820, 19820, 17117, 0, 0, 65535,
+    49500, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 13592, 13979, 10550, 22447, 0, 0, 65535,
+    44620, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 12830, 16280, 20460, 17117, 0, 0, 65535,
+    52289, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 17684, 23645, 25894, 20966, 0, 0, 65535,
+    53683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 10056, 13058, 18861, 14600, 0, 0, 65535,
+    13246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 17684, 12904, 22697, 12630, 0, 0, 65535,
+    46014, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 13592, 20730, 22697, 20226, 0, 0, 65535,
+    52986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 13523, 15360, 19820, 16524, 0, 0, 65535,
+    10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 7282, 14285, 18861, 16080, 0, 0, 65535,
+    41134, 0, 65535, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 393, 10749, 15513, 22378, 15340, 0, 0, 65535,
+    43922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 6588, 15053, 17263, 17857, 0, 0, 65535,
+    39042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 13592, 16127, 18542, 18153, 0, 0, 65535,
+    50197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 14910, 21804, 33886, 15636, 0, 0, 65535,
+    47408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 12830, 23952, 28132, 19930, 0, 0, 65535,
+    21613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 12136, 13518, 19820, 14600, 0, 0, 65535,
+    57169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 10056, 17201, 17902, 19930, 0, 0, 65535,
+    36253, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 12136, 14285, 18542, 16228, 0, 0, 65535,
+    18824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 13523, 11063, 17263, 13267, 0, 0, 65535,
+    54380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 183, 10749, 16434, 18222, 18745, 0, 0, 65535,
+    55774, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 66, 14910, 15206, 18222, 17265, 0, 0, 65535,
+    50197, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 11443, 15973, 21099, 16376, 0, 0, 65535,
+    32070, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 12830, 14746, 16304, 18153, 0, 0, 65535,
+    23007, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 50, 12830, 20577, 17263, 24372, 0, 0, 65535,
+    39739, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 13592, 9529, 21738, 9713, 0, 0, 65535,
+    25796, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 236, 10749, 19656, 21738, 19807, 0, 0, 65535,
+    33465, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 315, 13592, 13365, 20460, 14155, 0, 0, 65535,
+    34162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 13523, 11370, 15025, 14896, 0, 0, 65535
+};
+
+const void *const far_chunks[6] = {
+    far_chunk_0, far_chunk_1, far_chunk_2, far_chunk_3, far_chunk_4, far_chunk_5
+};
+
+const struct fann_far_data far_data = {
+    3600, 21, 3, 2, 682,
+    far_chunks, far_scale, far_offset
+};
+
+
+#endif // __THYROID_TEST_FAR__
@@ -146,6 +146,8 @@ extern "C"
 #include "fann_train.h"
 #include "fann_cascade.h"
 #include "fann_io.h"
+#include "fann_compressed_data.h"
+#include "fann_far_data.h"
 
 /* Function: fann_create_standard
 	
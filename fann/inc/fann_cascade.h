@@ -86,6 +86,190 @@ FANN_EXTERNAL void FANN_API fann_cascadetrain_on_file(struct fann *ann, const ch
 													  unsigned int neurons_between_reports,
 													  float desired_error);
 
+#ifdef FANN_CASCADE_ARENA
+
+/* Group: Intermittent Cascade Training
+
+   With FANN_CASCADE_ARENA defined, cascade training does not allocate memory:
+   the network grows inside a fixed arena sized at compile time for
+   FANN_CASCADE_MAX_NEURONS hidden neurons and FANN_CASCADE_MAX_CANDIDATES
+   candidates. The arena is kept twice in FRAM2 (about 44 KB each with the
+   defaults below): every step trains one epoch on a copy of the last
+   committed arena (weights, slopes, previous steps, stagnation counters and
+   stage of the algorithm), then commits it by switching a single persistent
+   index, so that a power failure loses at most the epoch in progress.
+*/
+
+/* Maximum number of hidden neurons added by cascade training */
+#ifndef FANN_CASCADE_MAX_NEURONS
+#define FANN_CASCADE_MAX_NEURONS 4
+#endif
+
+/* Maximum number of inputs and outputs of the network */
+#ifndef FANN_CASCADE_MAX_INPUT
+#define FANN_CASCADE_MAX_INPUT 21
+#endif
+#ifndef FANN_CASCADE_MAX_OUTPUT
+#define FANN_CASCADE_MAX_OUTPUT 3
+#endif
+
+/* Maximum number of candidates (see <fann_get_cascade_num_candidates>) */
+#ifndef FANN_CASCADE_MAX_CANDIDATES
+#define FANN_CASCADE_MAX_CANDIDATES 80
+#endif
+
+/* Maximum number of training samples whose activations are cached during
+   candidate training (about 46 KB of FRAM2 with the defaults); larger data
+   sets are run through the network at every candidate epoch */
+#ifndef FANN_CASCADE_MAX_DATA
+#define FANN_CASCADE_MAX_DATA 400
+#endif
+
+/* Function: fann_cascade_arena_init
+
+   Start a new cascade training session in the arena, discarding any previous
+   one. The network starts with no hidden layer and shortcut connections,
+   with the inputs, outputs, output activation functions and training
+   parameters of ann, and random weights. Incremental and batch training
+   are replaced by FANN_TRAIN_RPROP, as cascade training cannot use them.
+
+   Returns 0, or -1 if ann or its candidates do not fit in the arena.
+ */
+FANN_EXTERNAL int FANN_API fann_cascade_arena_init(struct fann *ann, unsigned int max_neurons,
+												   float desired_error);
+
+/* Function: fann_cascade_arena_step
+
+   Run one epoch (output or candidate training) of the session in the arena on
+   data, together with the transitions of the algorithm that follow it, and
+   commit the result. To be called again until it returns 1, which it does
+   once the session is over (or if no session was started).
+ */
+FANN_EXTERNAL int FANN_API fann_cascade_arena_step(struct fann_train_data *data);
+
+/* Function: fann_cascade_arena_pending
+
+   Returns 1 if a session is started and not over, 0 otherwise.
+ */
+FANN_EXTERNAL int FANN_API fann_cascade_arena_pending(void);
+
+/* Function: fann_cascade_arena_ann
+
+   Returns the network of the last committed step, which stays valid until the
+   next call to <fann_cascade_arena_init> or <fann_cascade_arena_step>.
+ */
+FANN_EXTERNAL struct fann * FANN_API fann_cascade_arena_ann(void);
+
+#endif	/* FANN_CASCADE_ARENA */
+
+#ifdef FANN_CASCADE_THREADS
+
+/* Group: Multi-threaded Cascade Training
+
+   Host builds only: with FANN_CASCADE_THREADS defined (and -pthread), the
+   candidates are trained by a pool of threads, each one in charge of a
+   range of candidates. The results are the same as with a single thread.
+
+   The training data can also be split in shards for the training of the
+   outputs (see <fann_set_cascade_num_shards>): the threads accumulate the
+   slopes of their shards in private buffers, which are then added in shard
+   order. The results then depend on the number of shards, but not on the
+   number of threads.
+*/
+
+#ifndef FANN_CASCADE_MAX_THREADS
+#define FANN_CASCADE_MAX_THREADS 64
+#endif
+
+#ifndef FANN_CASCADE_MAX_SHARDS
+#define FANN_CASCADE_MAX_SHARDS 64
+#endif
+
+/* Function: fann_set_cascade_num_threads
+
+   Set the number of threads training the candidates, the calling one
+   included (1, the default, trains them in the calling thread only).
+
+   Returns 0, or -1 if the threads cannot be started (a single thread is
+   then used).
+ */
+FANN_EXTERNAL int FANN_API fann_set_cascade_num_threads(unsigned int num_threads);
+
+/* Function: fann_get_cascade_num_threads
+
+   Returns the number of threads training the candidates.
+ */
+FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_num_threads(void);
+
+/* Function: fann_set_cascade_num_shards
+
+   Set the number of shards the training data is split in for the training of
+   the outputs (1, the default, runs the samples in order on the network, as
+   without FANN_CASCADE_THREADS). Use at least as many shards as threads.
+
+   Returns 0, or -1 if num_shards is 0 or above FANN_CASCADE_MAX_SHARDS.
+ */
+FANN_EXTERNAL int FANN_API fann_set_cascade_num_shards(unsigned int num_shards);
+
+/* Function: fann_get_cascade_num_shards
+
+   Returns the number of shards of the training data.
+ */
+FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_num_shards(void);
+
+#endif	/* FANN_CASCADE_THREADS */
+
+#ifdef FANN_CASCADE_SIMD
+
+/* Group: Vectorized Cascade Training
+
+   Host builds only: with FANN_CASCADE_SIMD defined (GCC or Clang), the
+   candidate weights and slopes are gathered once per epoch into a
+   candidate-major layout, so that FANN_CASCADE_SIMD_WIDTH candidates are
+   trained at once by every vector instruction. Combines with
+   FANN_CASCADE_THREADS; the results are the same as without it.
+
+   The RPROP, SARPROP and Quickprop weight updates of the cascade training run
+   8 weights at a time as well, with the best kernel for the CPU picked at run
+   time (see <fann_set_cascade_weight_kernel>).
+*/
+
+/* Candidates per vector (4 for SSE or NEON, 8 for AVX with -mavx) */
+#ifndef FANN_CASCADE_SIMD_WIDTH
+#define FANN_CASCADE_SIMD_WIDTH 4
+#endif
+
+/* Enum: fann_cascade_kernel_enum
+   Implementations of the weight updates.
+
+   FANN_CASCADE_KERNEL_SCALAR - The functions of fann_train.c, one weight at a time
+   FANN_CASCADE_KERNEL_VECTOR - Vector extensions of the compiler, for the target of the build
+   FANN_CASCADE_KERNEL_AVX - The same code built for AVX, on x86 CPUs that have it
+*/
+enum fann_cascade_kernel_enum
+{
+	FANN_CASCADE_KERNEL_SCALAR = 0,
+	FANN_CASCADE_KERNEL_VECTOR,
+	FANN_CASCADE_KERNEL_AVX
+};
+
+/* Function: fann_set_cascade_weight_kernel
+
+   Set the implementation of the weight updates. All of them give the same
+   weights, bit for bit; the default is the fastest one the CPU can run.
+
+   Returns 0, or -1 if the CPU cannot run the kernel.
+ */
+FANN_EXTERNAL int FANN_API fann_set_cascade_weight_kernel(enum fann_cascade_kernel_enum kernel);
+
+/* Function: fann_get_cascade_weight_kernel
+
+   Returns the implementation of the weight updates.
+ */
+FANN_EXTERNAL enum fann_cascade_kernel_enum FANN_API fann_get_cascade_weight_kernel(void);
+
+#endif	/* FANN_CASCADE_SIMD */
+
 /* Group: Parameters */
 													  
 /* Function: fann_get_cascade_output_change_fraction
@@ -392,6 +576,57 @@ FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_min_cand_epochs(struct fann
 FANN_EXTERNAL void FANN_API fann_set_cascade_min_cand_epochs(struct fann *ann, 
 															 unsigned int cascade_min_cand_epochs);
 
+/* Function: fann_get_cascade_candidate_prune_epochs
+
+   The candidate prune epochs is the number of epochs between two eliminations of the
+   candidates with the worst scores during a candidate training phase (successive halving).
+   At every such checkpoint, <fann_get_cascade_candidate_prune_fraction> of the candidates
+   still trained are dropped, so that the following epochs only train the best ones. The
+   best candidate is never dropped.
+
+   The default candidate prune epochs is 0, which trains every candidate until the end of
+   the phase.
+
+   See also:
+   		<fann_set_cascade_candidate_prune_epochs>, <fann_get_cascade_candidate_prune_fraction>
+ */
+FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_candidate_prune_epochs(struct fann *ann);
+
+
+/* Function: fann_set_cascade_candidate_prune_epochs
+
+   Sets the candidate prune epochs.
+
+   See also:
+   		<fann_get_cascade_candidate_prune_epochs>
+ */
+FANN_EXTERNAL void FANN_API fann_set_cascade_candidate_prune_epochs(struct fann *ann,
+															 unsigned int cascade_candidate_prune_epochs);
+
+/* Function: fann_get_cascade_candidate_prune_fraction
+
+   The candidate prune fraction is the fraction of the candidates still trained that are
+   dropped at every checkpoint (see <fann_get_cascade_candidate_prune_epochs>), a number
+   between 0 and 1.
+
+   The default candidate prune fraction is 0.5
+
+   See also:
+   		<fann_set_cascade_candidate_prune_fraction>
+ */
+FANN_EXTERNAL float FANN_API fann_get_cascade_candidate_prune_fraction(struct fann *ann);
+
+
+/* Function: fann_set_cascade_candidate_prune_fraction
+
+   Sets the candidate prune fraction.
+
+   See also:
+   		<fann_get_cascade_candidate_prune_fraction>
+ */
+FANN_EXTERNAL void FANN_API fann_set_cascade_candidate_prune_fraction(struct fann *ann,
+															 float cascade_candidate_prune_fraction);
+
 /* Function: fann_get_cascade_num_candidates
 
    The number of candidates used during training (calculated by multiplying <fann_get_cascade_activation_functions_count>,
@@ -0,0 +1,80 @@
+/*
+ *******************************************************************************
+ * fann_compressed_data.h
+ *
+ * Compressed test data sets, decoded one record at a time.
+ *
+ * Every column (inputs, then outputs) is stored as a fixed-width code:
+ *   - dictionary columns: the code indexes the sorted distinct values of the
+ *     column (lossless; binary flags take 1 bit, constant columns 0 bits);
+ *   - quantized columns: value = offset + scale * code (lossy, used when a
+ *     column has too many distinct values for a dictionary).
+ * The codes of a record are bit-packed (LSB first) into record_bits bits,
+ * so any record can be decoded in place without touching the others.
+ *
+ * Headers in this format are generated with host/fann2header -f compressed.
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#ifndef __fann_compressed_data_h__
+#define __fann_compressed_data_h__
+
+#include <stdint.h>
+
+/* Enum: fann_column_enum
+	Encoding of a compressed column.
+
+	FANN_COLUMN_DICTIONARY - The code indexes the column dictionary.
+	FANN_COLUMN_QUANTIZED - The code is linearly quantized.
+*/
+enum fann_column_enum
+{
+	FANN_COLUMN_DICTIONARY = 0,
+	FANN_COLUMN_QUANTIZED
+};
+
+/* Struct: struct fann_compressed_column
+	Description of one compressed column.
+*/
+struct fann_compressed_column
+{
+	/* Width of the code in bits (at most 16, 0 for constant columns) */
+	uint8_t bits;
+	/* One of <fann_column_enum> */
+	uint8_t type;
+	/* Dictionary columns: index of the first entry in the dictionary */
+	uint16_t dict;
+	/* Quantized columns: value = offset + scale * code */
+	fann_type scale;
+	fann_type offset;
+};
+
+/* Struct: struct fann_compressed_data
+	Compressed data set.
+*/
+struct fann_compressed_data
+{
+	uint32_t num_data;
+	uint8_t num_input;
+	uint8_t num_output;
+	/* Size of a packed record in bits */
+	uint16_t record_bits;
+	/* num_input + num_output column descriptions */
+	const struct fann_compressed_column *columns;
+	/* Dictionaries of all the dictionary columns, one after the other */
+	const fann_type *dict;
+	/* num_data records of record_bits bits, followed by 2 padding bytes */
+	const uint8_t *records;
+};
+
+/* Function: fann_decompress_record
+
+   Decode record idx of a compressed data set into input (num_input values)
+   and output (num_output values). Either may be NULL if not needed.
+ */
+FANN_EXTERNAL void FANN_API fann_decompress_record(const struct fann_compressed_data *data, uint32_t idx,
+                                                   fann_type *input, fann_type *output);
+
+#endif
@@ -661,6 +661,21 @@ struct fann
 	 */
 	unsigned int cascade_min_cand_epochs;	
 
+	/* Candidate epochs between two eliminations of the worst candidates
+	 * (0 to train all the candidates until the end of the phase)
+	 */
+	unsigned int cascade_candidate_prune_epochs;
+
+	/* Fraction of the remaining candidates eliminated every
+	 * cascade_candidate_prune_epochs epochs
+	 */
+	float cascade_candidate_prune_fraction;
+
+	/* The number of candidates still trained in the current candidate phase,
+	 * the first ones of the candidate array
+	 */
+	unsigned int cascade_num_active_candidates;
+
 	/* An array consisting of the activation functions used when doing
 	 * cascade training.
 	 */
@@ -690,6 +705,19 @@ struct fann
 	 * which is used to decide which candidate is the best
 	 */
 	fann_type *cascade_candidate_scores;
+
+	/* The values of the neurons feeding the candidates, followed by the
+	 * output errors (total_neurons values per sample), for every sample,
+	 * computed once per candidate training phase since the network does
+	 * not change meanwhile
+	 */
+	fann_type *cascade_candidate_cache;
+
+	/* The number of values allocated in cascade_candidate_cache */
+	unsigned int cascade_candidate_cache_size;
+
+	/* The number of samples in cascade_candidate_cache (0 if not in use) */
+	unsigned int cascade_candidate_cache_data;
 	
 	/* The number of allocated neurons during cascade correlation algorithms.
 	 * This number might be higher than the actual number of neurons to avoid
@@ -703,6 +731,12 @@ struct fann
 	 */
 	unsigned int total_connections_allocated;
 
+	/* The number of allocated layers during cascade correlation algorithms.
+	 * This number might be higher than the actual number of layers to avoid
+	 * allocating new space too often.
+	 */
+	unsigned int total_layers_allocated;
+
 	/* Variables for use with Quickprop training */
 
 	/* Decay is used to make the weights not go so high */
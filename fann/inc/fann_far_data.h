@@ -0,0 +1,82 @@
+/*
+ *******************************************************************************
+ * fann_far_data.h
+ *
+ * Test data sets stored in the upper FRAM (FRAM2, from 0x10000), beyond the
+ * lower FRAM shared with the code, and read with 20-bit address accessors.
+ *
+ * Records (inputs, then outputs) are stored one after the other as floats or
+ * as per-column quantized codes (value = offset + scale * code), split in
+ * chunks of records_per_chunk records: a single C object cannot exceed 64 KB
+ * with 16-bit size_t, while a data set may fill the whole of FRAM2. Chunks
+ * are constant arrays placed in the ".fram2" section of the linker command
+ * file, so they are not part of the C auto-initialisation.
+ *
+ * Records are not read in place by fann_run(): fann_far_get_record() copies
+ * (and dequantizes) them into a double buffer in SRAM, and
+ * fann_far_prefetch() fills the other half with the next record while the
+ * current one is still in use.
+ *
+ * The chunk table holds 20-bit pointers, so the device must be built with
+ * the restricted or large data model (the project default is restricted).
+ *
+ * Headers in this format are generated with host/fann2header -F.
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#ifndef __fann_far_data_h__
+#define __fann_far_data_h__
+
+#include <stdint.h>
+
+/* Largest record (num_input + num_output) held by the SRAM buffers */
+#ifndef FANN_FAR_MAX_RECORD
+#define FANN_FAR_MAX_RECORD 32
+#endif
+
+/* Struct: struct fann_far_data
+	Data set stored in FRAM2.
+*/
+struct fann_far_data
+{
+	uint32_t num_data;
+	uint8_t num_input;
+	uint8_t num_output;
+	/* Size of a stored value in bytes: 4 (float), 2 or 1 (quantized code) */
+	uint8_t value_size;
+	uint16_t records_per_chunk;
+	/* Chunks of records_per_chunk records, in FRAM2 */
+	const void *const *chunks;
+	/* Quantized data sets: value = offset[j] + scale[j] * code of column j
+	   (num_input + num_output entries); NULL for floats */
+	const float *scale;
+	const float *offset;
+};
+
+/* Function: fann_far_read_record
+
+   Copy record idx of a far data set into input (num_input values) and
+   output (num_output values). Either may be NULL if not needed.
+ */
+FANN_EXTERNAL void FANN_API fann_far_read_record(const struct fann_far_data *data, uint32_t idx,
+                                                 fann_type *input, fann_type *output);
+
+/* Function: fann_far_get_record
+
+   Return record idx in SRAM (num_input inputs followed by num_output
+   outputs), reading it from FRAM2 unless it has been prefetched. The record
+   stays valid until record idx + 2 is requested or prefetched.
+ */
+FANN_EXTERNAL fann_type * FANN_API fann_far_get_record(const struct fann_far_data *data, uint32_t idx);
+
+/* Function: fann_far_prefetch
+
+   Read record idx into the SRAM buffer not holding record idx - 1, to be
+   called with the next index once the current record has been processed.
+   The buffers are lost on power failure and read again on demand.
+ */
+FANN_EXTERNAL void FANN_API fann_far_prefetch(const struct fann_far_data *data, uint32_t idx);
+
+#endif
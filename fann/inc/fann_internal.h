@@ -104,19 +104,85 @@ fann_type fann_activation_derived(unsigned int activation_function,
 int fann_desired_error_reached(struct fann *ann, float desired_error);
 
 /* Some functions for cascade */
+
+/* Progress of an output or candidate training phase, kept out of the stack so
+   that the phase can be run one epoch at a time (see fann_cascade_arena.c) */
+struct fann_cascade_phase
+{
+    /* Epochs run so far, 0 before the phase starts */
+    unsigned int epoch;
+    /* Epoch by which the next improvement is due */
+    unsigned int stagnation;
+    /* Error after the first epoch (output training only) */
+    float initial_error;
+    /* Improvement (or candidate score) bounds of the current goal */
+    float target;
+    float backslide;
+};
+
 int fann_train_outputs(struct fann *ann, struct fann_train_data *data, float desired_error);
 
+int fann_train_outputs_step(struct fann *ann, struct fann_train_data *data, float desired_error,
+                            struct fann_cascade_phase *phase);
+
 float fann_train_outputs_epoch(struct fann *ann, struct fann_train_data *data);
 
 int fann_train_candidates(struct fann *ann, struct fann_train_data *data);
 
+int fann_train_candidates_step(struct fann *ann, struct fann_train_data *data,
+                               struct fann_cascade_phase *phase);
+
+void fann_update_candidate_slopes(struct fann *ann, unsigned int first, unsigned int last);
+
+void fann_compute_candidate_errors(struct fann *ann, fann_type *desired_output);
+
+void fann_cache_candidate_inputs(struct fann *ann, struct fann_train_data *data);
+
+void fann_update_candidate_slopes_data(struct fann *ann, struct fann_train_data *data,
+                                       unsigned int first, unsigned int last);
+
+void fann_update_output_slopes_data(struct fann *ann, struct fann_train_data *data,
+                                    unsigned int first, unsigned int last);
+
+#ifdef FANN_CASCADE_THREADS
+void fann_cascade_threads_update_slopes(struct fann *ann, struct fann_train_data *data);
+
+void fann_cascade_threads_update_output_slopes(struct fann *ann, struct fann_train_data *data);
+#endif
+
+/* Candidate weights and slopes in candidate-major order (fann_cascade_simd.c) */
+struct fann_cascade_pack;
+
+#ifdef FANN_CASCADE_SIMD
+struct fann_cascade_pack *fann_cascade_simd_pack(struct fann *ann, unsigned int first, unsigned int last);
+
+void fann_cascade_simd_update_slopes(struct fann *ann, struct fann_cascade_pack *pack);
+
+void fann_cascade_simd_unpack(struct fann *ann, struct fann_cascade_pack *pack);
+
+void fann_cascade_simd_update_weights_quickprop(struct fann *ann, unsigned int num_data,
+                                                unsigned int first_weight, unsigned int past_end);
+
+void fann_cascade_simd_update_weights_irpropm(struct fann *ann, unsigned int first_weight,
+                                              unsigned int past_end);
+
+void fann_cascade_simd_update_weights_sarprop(struct fann *ann, unsigned int epoch, unsigned int first_weight,
+                                              unsigned int past_end);
+#endif
+
 fann_type fann_train_candidates_epoch(struct fann *ann, struct fann_train_data *data);
 
 void fann_install_candidate(struct fann *ann);
+
+int fann_reallocate_layers(struct fann *ann, unsigned int total_layers);
+
+int fann_reserve_cascade(struct fann *ann, unsigned int max_neurons);
 int fann_check_input_output_sizes(struct fann *ann, struct fann_train_data *data);
 
 int fann_initialize_candidates(struct fann *ann);
 
+void fann_prune_candidates(struct fann *ann);
+
 void fann_set_shortcut_connections(struct fann *ann);
 
 int fann_allocate_scale(struct fann *ann);
@@ -20,6 +20,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #ifndef __fann_train_h__
 #define __fann_train_h__
 
+#include <stdint.h>
+
 /* Section: FANN Training 
  
  	There are many different ways of training neural networks and the FANN library supports
@@ -61,6 +63,15 @@ struct fann_train_data
 	unsigned int num_output;
 	fann_type **input;
 	fann_type **output;
+
+	/* Row-major storage of the patterns: pattern i starts at
+	   input_base + i * input_stride (resp. output_base + i * output_stride).
+	   Views (see <fann_create_train_view>) only set these, input and output
+	   being NULL. */
+	fann_type *input_base;
+	fann_type *output_base;
+	unsigned int input_stride;
+	unsigned int output_stride;
 };
 
 /* Section: FANN Training */
@@ -89,7 +100,90 @@ FANN_EXTERNAL void FANN_API fann_train(struct fann *ann, fann_type * input,
 
 #endif	/* NOT FIXEDFANN */
 
-FANN_EXTERNAL struct fann_train_data *FANN_API fann_create_tests_from_header();
+#if defined(FANN_ONLINE) && !defined(FIXEDFANN)
+
+/* Group: Online Training
+
+   With FANN_ONLINE defined, the output layer of a trained network can be
+   fine-tuned on the device with labelled samples (e.g. calibration samples),
+   one sample per call to <fann_online_train>, without a retrain on the host.
+   The hidden layers are not changed.
+
+   The output weights and their training state are kept twice in FRAM:
+   every step trains on a copy of the last committed block and then commits
+   it by switching a single persistent index, so that a power failure loses
+   at most the sample in progress and a sample is never trained on twice.
+
+   With the FANN_TRAIN_RPROP training algorithm, the slopes of
+   FANN_ONLINE_BATCH samples are summed before an iRPROP- step, since the sign
+   of the slope of a single sample is too noisy. With any other algorithm,
+   every sample makes a gradient descent step with the learning rate and
+   momentum of the network (see <fann_set_learning_rate>).
+*/
+
+/* Maximum number of output connections and of neurons of the network */
+#ifndef FANN_ONLINE_MAX_WEIGHTS
+#define FANN_ONLINE_MAX_WEIGHTS 64
+#endif
+#ifndef FANN_ONLINE_MAX_NEURONS
+#define FANN_ONLINE_MAX_NEURONS 64
+#endif
+
+/* Samples per RPROP step */
+#ifndef FANN_ONLINE_BATCH
+#define FANN_ONLINE_BATCH 32
+#endif
+
+/* Function: fann_online_init
+
+   Starts a session from the current output weights of ann, dropping the
+   state of any previous session.
+
+   Returns 0, or -1 if the network exceeds FANN_ONLINE_MAX_WEIGHTS output
+   connections or FANN_ONLINE_MAX_NEURONS neurons.
+ */
+FANN_EXTERNAL int FANN_API fann_online_init(struct fann *ann);
+
+/* Function: fann_online_train
+
+   Trains the output layer of ann on one sample and commits the new weights,
+   which are then also copied into ann.
+
+   Returns 0, or -1 if no session is started.
+ */
+FANN_EXTERNAL int FANN_API fann_online_train(struct fann *ann, fann_type *input, fann_type *desired_output);
+
+/* Function: fann_online_sync
+
+   Copies the committed output weights into ann, which may hold weights
+   partially copied when power failed. To be called before running ann
+   outside <fann_online_train>.
+ */
+FANN_EXTERNAL void FANN_API fann_online_sync(struct fann *ann);
+
+/* Function: fann_online_get_num_samples
+
+   Returns the number of samples trained on in the current session, which
+   can serve as the index of the next sample.
+ */
+FANN_EXTERNAL uint32_t FANN_API fann_online_get_num_samples(void);
+
+/* Function: fann_online_get_MSE
+
+   Returns the mean square error of the session, each sample being measured
+   before the network is trained on it.
+ */
+FANN_EXTERNAL float FANN_API fann_online_get_MSE(void);
+
+#endif	/* FANN_ONLINE */
+
+/* Macro: fann_create_tests_from_header
+   Initialise data as a view (see <fann_create_train_view>) over the test set
+   of database/<example>_test.h, which must be included by the caller.
+ */
+#define fann_create_tests_from_header(data) \
+	fann_create_train_view((data), num_data, num_input, &input[0][0], num_output, &output[0][0])
+
 /* Function: fann_test
    Test with a set of inputs, and a set of desired outputs.
    This operation updates the mean square error, but does not
@@ -296,6 +390,25 @@ FANN_EXTERNAL struct fann_train_data * FANN_API fann_create_train_pointer_array(
 */ 
 FANN_EXTERNAL struct fann_train_data * FANN_API fann_create_train_array(unsigned int num_data, unsigned int num_input, fann_type *input, unsigned int num_output, fann_type *output);
 
+/* Function: fann_create_train_view
+   Initialises data as a view over existing arrays (e.g. PERSISTENT arrays in
+   FRAM or constant tables) with the dimensions:
+   input[num_data*num_input]
+   output[num_data*num_output]
+
+   Nothing is allocated and nothing is copied: patterns are located through
+   strides, so data must only be accessed through <fann_get_train_input> and
+   <fann_get_train_output>. The arrays must outlive the view, and
+   <fann_destroy_train> must not be called on it.
+
+   Returns:
+     data, for convenience.
+
+   See also:
+     <fann_create_train_array>, <fann_test_data>
+*/
+FANN_EXTERNAL struct fann_train_data * FANN_API fann_create_train_view(struct fann_train_data *data, unsigned int num_data, unsigned int num_input, fann_type *input, unsigned int num_output, fann_type *output);
+
 /* Function: fann_create_train_from_callback
    Creates the training data struct from a user supplied function.
    As the training data are numerable (data 1, data 2...), the user must write
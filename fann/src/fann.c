@@ -9,7 +9,9 @@
  *******************************************************************************
  */
 
+#ifdef __MSP430__
 #include <msp430.h>
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -48,11 +50,21 @@ extern struct fann fram_ann;
 enum fann_activationfunc_enum fram_cascade_activation_functions[10 * sizeof(enum fann_activationfunc_enum)];
 */
 
+#ifdef FANN_FAR_MODEL
+/// Large models: connections in FRAM2 (20-bit pointers needed, see
+/// fann_far_data.h), in a section left uninitialised like NOINIT ones
+#pragma DATA_SECTION(fram_weights, ".fram2_noinit")
+#else
 #pragma NOINIT(fram_weights)
-fann_type fram_weights [NUM_CONNECTIONS * sizeof(fann_type)];
+#endif
+fann_type fram_weights [NUM_CONNECTIONS];
 
+#ifdef FANN_FAR_MODEL
+#pragma DATA_SECTION(fram_connections, ".fram2_noinit")
+#else
 #pragma NOINIT(fram_connections)
-struct fann_neuron* fram_connections [NUM_CONNECTIONS * sizeof(struct fann_neuron*)];
+#endif
+struct fann_neuron* fram_connections [NUM_CONNECTIONS];
 
 #pragma PERSISTENT(fram_cascade_activation_functions)
 enum fann_activationfunc_enum fram_cascade_activation_functions[CASCADE_ACTIVATION_FUNCTIONS_COUNT * sizeof(enum fann_activationfunc_enum)] = {
@@ -160,7 +172,13 @@ struct fann *fann_allocate_structure(unsigned int num_layers)
     ann->cascade_max_cand_epochs = 150;
     ann->cascade_min_out_epochs = 50;
     ann->cascade_min_cand_epochs = 50;
+    ann->cascade_candidate_prune_epochs = 0;
+    ann->cascade_candidate_prune_fraction = 0.5f;
+    ann->cascade_num_active_candidates = 0;
     ann->cascade_candidate_scores = NULL;
+    ann->cascade_candidate_cache = NULL;
+    ann->cascade_candidate_cache_size = 0;
+    ann->cascade_candidate_cache_data = 0;
     ann->cascade_activation_functions_count = 10;
     ann->cascade_activation_functions = fram_cascade_activation_functions;
 
@@ -197,6 +215,7 @@ struct fann *fann_allocate_structure(unsigned int num_layers)
     /* allocate room for the layers */
     ann->first_layer = fram_first_layer;
     ann->last_layer = ann->first_layer + num_layers;
+    ann->total_layers_allocated = num_layers;
 
     return ann;
 }
@@ -219,6 +238,7 @@ FANN_EXTERNAL void FANN_API fann_destroy(struct fann *ann)
     fann_safe_free(ann->cascade_activation_functions);
     fann_safe_free(ann->cascade_activation_steepnesses);
     fann_safe_free(ann->cascade_candidate_scores);
+    fann_safe_free(ann->cascade_candidate_cache);
 
 #ifndef FIXEDFANN
     fann_safe_free( ann->scale_mean_in );
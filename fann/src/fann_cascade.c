@@ -27,6 +27,17 @@
 /* #define CASCADE_DEBUG */
 /* #define CASCADE_DEBUG_FULL */
 
+#ifdef FANN_CASCADE_SIMD
+/* vectorized weight updates (fann_cascade_simd.c), which give the same weights */
+#define fann_cascade_update_weights_quickprop fann_cascade_simd_update_weights_quickprop
+#define fann_cascade_update_weights_irpropm fann_cascade_simd_update_weights_irpropm
+#define fann_cascade_update_weights_sarprop fann_cascade_simd_update_weights_sarprop
+#else
+#define fann_cascade_update_weights_quickprop fann_update_weights_quickprop
+#define fann_cascade_update_weights_irpropm fann_update_weights_irpropm
+#define fann_cascade_update_weights_sarprop fann_update_weights_sarprop
+#endif
+
 void fann_print_connections_raw(struct fann *ann)
 {
 	unsigned int i;
@@ -48,6 +59,26 @@ void fann_print_connections_raw(struct fann *ann)
    The connected_neurons pointers are not valid during training,
    but they will be again after training.
  */
+#ifdef FANN_CASCADE_ARENA
+/* Train in the arena, one checkpointed epoch at a time, resuming the
+   session left unfinished by a power failure if there is one.
+   Reports and callbacks are not supported in this mode.
+ */
+FANN_EXTERNAL void FANN_API fann_cascadetrain_on_data(struct fann *ann, struct fann_train_data *data,
+										unsigned int max_neurons,
+										unsigned int neurons_between_reports,
+										float desired_error)
+{
+	if(!fann_cascade_arena_pending() &&
+	   fann_cascade_arena_init(ann, max_neurons, desired_error) == -1)
+	{
+		return;
+	}
+	while(fann_cascade_arena_step(data) == 0)
+		;
+	*ann = *fann_cascade_arena_ann();
+}
+#else
 FANN_EXTERNAL void FANN_API fann_cascadetrain_on_data(struct fann *ann, struct fann_train_data *data,
 										unsigned int max_neurons,
 										unsigned int neurons_between_reports,
@@ -63,6 +94,9 @@ FANN_EXTERNAL void FANN_API fann_cascadetrain_on_data(struct fann *ann, struct f
 		//printf("Max neurons %3d. Desired error: %.6f\n", max_neurons, desired_error);
 	}
 
+	/* Not fatal: the arrays then grow as the neurons are added */
+	fann_reserve_cascade(ann, max_neurons);
+
 	for(i = 1; i <= max_neurons; i++)
 	{
 		/* train output neurons */
@@ -127,6 +161,7 @@ FANN_EXTERNAL void FANN_API fann_cascadetrain_on_data(struct fann *ann, struct f
 	 */
 	fann_set_shortcut_connections(ann);
 }
+#endif	/* FANN_CASCADE_ARENA */
 
 FANN_EXTERNAL void FANN_API fann_cascadetrain_on_file(struct fann *ann, const char *filename,
 													  unsigned int max_neurons,
@@ -145,93 +180,124 @@ FANN_EXTERNAL void FANN_API fann_cascadetrain_on_file(struct fann *ann, const ch
 
 int fann_train_outputs(struct fann *ann, struct fann_train_data *data, float desired_error)
 {
-	float error, initial_error, error_improvement;
-	float target_improvement = 0.0;
-	float backslide_improvement = -1.0e20f;
-	unsigned int i;
+	struct fann_cascade_phase phase;
+
+	phase.epoch = 0;
+	while(fann_train_outputs_step(ann, data, desired_error, &phase) == 0)
+		;
+
+	return phase.epoch;
+}
+
+/* Run one epoch of output training. The whole state of the phase is in ann
+   and *phase (phase->epoch = 0 starts it), so it can be checkpointed between
+   steps. Returns 1 when the phase is over (phase->epoch epochs run), 0 otherwise.
+ */
+int fann_train_outputs_step(struct fann *ann, struct fann_train_data *data, float desired_error,
+							struct fann_cascade_phase *phase)
+{
+	float error, error_improvement;
+	unsigned int i = phase->epoch;
 	unsigned int max_epochs = ann->cascade_max_out_epochs;
 	unsigned int min_epochs = ann->cascade_min_out_epochs;
-	unsigned int stagnation = max_epochs;
 
-	/* TODO should perhaps not clear all arrays */
-	fann_clear_train_arrays(ann);
+	if(i == 0)
+	{
+		/* TODO should perhaps not clear all arrays */
+		fann_clear_train_arrays(ann);
 
-	/* run an initial epoch to set the initital error */
-	initial_error = fann_train_outputs_epoch(ann, data);
+		/* run an initial epoch to set the initital error */
+		phase->initial_error = fann_train_outputs_epoch(ann, data);
+		phase->target = 0.0;
+		phase->backslide = -1.0e20f;
+		phase->stagnation = max_epochs;
+		phase->epoch = 1;
 
-	if(fann_desired_error_reached(ann, desired_error) == 0)
-		return 1;
+		return fann_desired_error_reached(ann, desired_error) == 0 || phase->epoch >= max_epochs;
+	}
 
-	for(i = 1; i < max_epochs; i++)
-	{
-		error = fann_train_outputs_epoch(ann, data);
+	error = fann_train_outputs_epoch(ann, data);
+	phase->epoch = i + 1;
 
-		/*printf("Epoch %6d. Current error: %.6f. Bit fail %d.\n", i, error, ann->num_bit_fail); */
+	/*printf("Epoch %6d. Current error: %.6f. Bit fail %d.\n", i, error, ann->num_bit_fail); */
 
-		if(fann_desired_error_reached(ann, desired_error) == 0)
-		{
+	if(fann_desired_error_reached(ann, desired_error) == 0)
+	{
 #ifdef CASCADE_DEBUG
-			//printf("Error %f < %f\n", error, desired_error);
+		//printf("Error %f < %f\n", error, desired_error);
 #endif
-			return i + 1;
-		}
+		return 1;
+	}
 
-		/* Improvement since start of train */
-		error_improvement = initial_error - error;
+	/* Improvement since start of train */
+	error_improvement = phase->initial_error - error;
 
-		/* After any significant change, set a new goal and
-		 * allow a new quota of epochs to reach it */
-		
-		if((target_improvement >= 0 &&
-			(error_improvement > target_improvement || error_improvement < backslide_improvement)) ||
-		(target_improvement < 0 &&
-			(error_improvement < target_improvement || error_improvement > backslide_improvement)))
-		{
-			/*printf("error_improvement=%f, target_improvement=%f, backslide_improvement=%f, stagnation=%d\n", error_improvement, target_improvement, backslide_improvement, stagnation); */
+	/* After any significant change, set a new goal and
+	 * allow a new quota of epochs to reach it */
+	
+	if((phase->target >= 0 &&
+		(error_improvement > phase->target || error_improvement < phase->backslide)) ||
+	(phase->target < 0 &&
+		(error_improvement < phase->target || error_improvement > phase->backslide)))
+	{
+		/*printf("error_improvement=%f, target_improvement=%f, backslide_improvement=%f, stagnation=%d\n", error_improvement, phase->target, phase->backslide, phase->stagnation); */
 
-			target_improvement = error_improvement * (1.0f + ann->cascade_output_change_fraction);
-			backslide_improvement = error_improvement * (1.0f - ann->cascade_output_change_fraction);
-			stagnation = i + ann->cascade_output_stagnation_epochs;
-		}
+		phase->target = error_improvement * (1.0f + ann->cascade_output_change_fraction);
+		phase->backslide = error_improvement * (1.0f - ann->cascade_output_change_fraction);
+		phase->stagnation = i + ann->cascade_output_stagnation_epochs;
+	}
 
-		/* No improvement in allotted period, so quit */
-		if(i >= stagnation && i >= min_epochs)
-		{
-			return i + 1;
-		}
+	/* No improvement in allotted period, so quit */
+	if(i >= phase->stagnation && i >= min_epochs)
+	{
+		return 1;
 	}
 
-	return max_epochs;
+	return phase->epoch >= max_epochs;
 }
 
-float fann_train_outputs_epoch(struct fann *ann, struct fann_train_data *data)
+/* Run samples [first, last) of data, accumulating the slopes of the output
+   connections and the MSE.
+ */
+void fann_update_output_slopes_data(struct fann *ann, struct fann_train_data *data,
+									unsigned int first, unsigned int last)
 {
 	unsigned int i;
-	
-	fann_reset_MSE(ann);
 
-	for(i = 0; i < data->num_data; i++)
+	for(i = first; i < last; i++)
 	{
-		fann_run(ann, data->input[i]);
-		fann_compute_MSE(ann, data->output[i]);
+		fann_run(ann, fann_get_train_input(data, i));
+		fann_compute_MSE(ann, fann_get_train_output(data, i));
 		fann_update_slopes_batch(ann, ann->last_layer - 1, ann->last_layer - 1);
 	}
+}
+
+float fann_train_outputs_epoch(struct fann *ann, struct fann_train_data *data)
+{
+	fann_reset_MSE(ann);
+
+#ifdef FANN_CASCADE_THREADS
+	/* data split in shards among the threads (see fann_cascade_threads.c) */
+	fann_cascade_threads_update_output_slopes(ann, data);
+#else
+	fann_update_output_slopes_data(ann, data, 0, data->num_data);
+#endif
 
 	switch (ann->training_algorithm)
 	{
 		case FANN_TRAIN_RPROP:
-			fann_update_weights_irpropm(ann, (ann->last_layer - 1)->first_neuron->first_con,
-										ann->total_connections);
+			fann_cascade_update_weights_irpropm(ann, (ann->last_layer - 1)->first_neuron->first_con,
+												ann->total_connections);
 			break;
 		case FANN_TRAIN_SARPROP:
-			fann_update_weights_sarprop(ann, ann->sarprop_epoch, (ann->last_layer - 1)->first_neuron->first_con,
-										ann->total_connections);
+			fann_cascade_update_weights_sarprop(ann, ann->sarprop_epoch, (ann->last_layer - 1)->first_neuron->first_con,
+												ann->total_connections);
 			++(ann->sarprop_epoch);
 			break;
 		case FANN_TRAIN_QUICKPROP:
-			fann_update_weights_quickprop(ann, data->num_data,
-										  (ann->last_layer - 1)->first_neuron->first_con,
-										  ann->total_connections);
+			fann_cascade_update_weights_quickprop(ann, data->num_data,
+												  (ann->last_layer - 1)->first_neuron->first_con,
+												  ann->total_connections);
 			break;
 		case FANN_TRAIN_BATCH:
 		case FANN_TRAIN_INCREMENTAL:
@@ -247,6 +313,11 @@ int fann_reallocate_connections(struct fann *ann, unsigned int total_connections
 	 * first moved in the end of the cascade training session.
 	 */
 
+#ifdef FANN_CASCADE_ARENA
+	/* fixed capacity, already all allocated (see fann_cascade_arena.c) */
+	return -1;
+#endif
+
 #ifdef CASCADE_DEBUG
 	//printf("realloc from %d to %d\n", ann->total_connections_allocated, total_connections);
 #endif
@@ -301,6 +372,11 @@ int fann_reallocate_neurons(struct fann *ann, unsigned int total_neurons)
 	unsigned int num_neurons = 0;
 	unsigned int num_neurons_so_far = 0;
 
+#ifdef FANN_CASCADE_ARENA
+	/* fixed capacity, already all allocated (see fann_cascade_arena.c) */
+	return -1;
+#endif
+
 	neurons =
 		(struct fann_neuron *) realloc(ann->first_layer->first_neuron,
 									   total_neurons * sizeof(struct fann_neuron));
@@ -341,6 +417,78 @@ int fann_reallocate_neurons(struct fann *ann, unsigned int total_neurons)
 	return 0;
 }
 
+int fann_reallocate_layers(struct fann *ann, unsigned int total_layers)
+{
+	unsigned int num_layers = (unsigned int)(ann->last_layer - ann->first_layer);
+	struct fann_layer *layers;
+
+#ifdef FANN_CASCADE_ARENA
+	/* fixed capacity, already all allocated (see fann_cascade_arena.c) */
+	return -1;
+#endif
+
+	layers = (struct fann_layer *) realloc(ann->first_layer, total_layers * sizeof(struct fann_layer));
+	if(layers == NULL)
+	{
+		// fann_error((struct fann_error *) ann, FANN_E_CANT_ALLOCATE_MEM);
+		return -1;
+	}
+
+	ann->first_layer = layers;
+	ann->last_layer = layers + num_layers;
+	ann->total_layers_allocated = total_layers;
+
+	return 0;
+}
+
+/* Allocate at once the neurons, connections and layers needed to add
+   max_neurons neurons, so that the network then grows in place: installing
+   a candidate only moves the output neurons and their weights.
+ */
+int fann_reserve_cascade(struct fann *ann, unsigned int max_neurons)
+{
+	unsigned int num_candidates = fann_get_cascade_num_candidates(ann);
+	unsigned int total_neurons = ann->total_neurons;
+	unsigned int total_connections = ann->total_connections;
+	unsigned int num_layers = (unsigned int)(ann->last_layer - ann->first_layer) + max_neurons;
+	unsigned int i;
+
+	if(max_neurons == 0)
+	{
+		return 0;
+	}
+
+	/* Installing a neuron adds as many connections as there are neurons
+	 * before it (its inputs and the connections to the outputs) */
+	for(i = 1; i < max_neurons; i++)
+	{
+		total_connections += total_neurons;
+		total_neurons++;
+	}
+
+	/* The room needed by the last candidates (see fann_initialize_candidates) */
+	total_connections += total_neurons * (num_candidates + 1);
+	total_neurons += num_candidates + 1;
+
+	if(total_neurons > ann->total_neurons_allocated &&
+	   fann_reallocate_neurons(ann, total_neurons) == -1)
+	{
+		return -1;
+	}
+	if(total_connections > ann->total_connections_allocated &&
+	   fann_reallocate_connections(ann, total_connections) == -1)
+	{
+		return -1;
+	}
+	if(num_layers > ann->total_layers_allocated &&
+	   fann_reallocate_layers(ann, num_layers) == -1)
+	{
+		return -1;
+	}
+
+	return 0;
+}
+
 void initialize_candidate_weights(struct fann *ann, unsigned int first_con, unsigned int last_con, float scale_factor)
 {
 	fann_type prev_step;
@@ -470,6 +618,9 @@ int fann_initialize_candidates(struct fann *ann)
 		}
 	}
 
+	/* All the candidates are trained until fann_prune_candidates drops some */
+	ann->cascade_num_active_candidates = num_candidates;
+
 	
 	/* Now randomize the weights and zero out the arrays that needs zeroing out.
 	 */
@@ -494,74 +645,206 @@ int fann_initialize_candidates(struct fann *ann)
 
 int fann_train_candidates(struct fann *ann, struct fann_train_data *data)
 {
-	fann_type best_cand_score = 0.0;
-	fann_type target_cand_score = 0.0;
-	fann_type backslide_cand_score = -1.0e20f;
-	unsigned int i;
+	struct fann_cascade_phase phase;
+
+	phase.epoch = 0;
+	while(fann_train_candidates_step(ann, data, &phase) == 0)
+		;
+
+	return phase.epoch;
+}
+
+/* Run one epoch of candidate training, see fann_train_outputs_step.
+ */
+int fann_train_candidates_step(struct fann *ann, struct fann_train_data *data,
+							   struct fann_cascade_phase *phase)
+{
+	fann_type best_cand_score;
+	unsigned int i = phase->epoch;
 	unsigned int max_epochs = ann->cascade_max_cand_epochs;
 	unsigned int min_epochs = ann->cascade_min_cand_epochs;
-	unsigned int stagnation = max_epochs;
 
-	if(ann->cascade_candidate_scores == NULL)
+	if(i == 0)
 	{
-		ann->cascade_candidate_scores =
-			(fann_type *) malloc(fann_get_cascade_num_candidates(ann) * sizeof(fann_type));
+#ifndef FANN_CASCADE_ARENA
 		if(ann->cascade_candidate_scores == NULL)
 		{
-			// fann_error((struct fann_error *) ann, FANN_E_CANT_ALLOCATE_MEM);
-			return 0;
+			ann->cascade_candidate_scores =
+				(fann_type *) malloc(fann_get_cascade_num_candidates(ann) * sizeof(fann_type));
+			if(ann->cascade_candidate_scores == NULL)
+			{
+				// fann_error((struct fann_error *) ann, FANN_E_CANT_ALLOCATE_MEM);
+				return 1;
+			}
 		}
+#endif
+		/* The network is frozen until the end of the phase */
+		fann_cache_candidate_inputs(ann, data);
+
+		phase->target = 0.0;
+		phase->backslide = -1.0e20f;
+		phase->stagnation = max_epochs;
 	}
 
-	for(i = 0; i < max_epochs; i++)
+	if(i >= max_epochs)
 	{
-		best_cand_score = fann_train_candidates_epoch(ann, data);
+#ifdef CASCADE_DEBUG
+		//printf("Max epochs %d reached\n", max_epochs);
+#endif
+		return 1;
+	}
 
-		if(best_cand_score / ann->MSE_value > ann->cascade_candidate_limit)
-		{
+	best_cand_score = fann_train_candidates_epoch(ann, data);
+	phase->epoch = i + 1;
+
+	if(best_cand_score / ann->MSE_value > ann->cascade_candidate_limit)
+	{
 #ifdef CASCADE_DEBUG
-			//printf("above candidate limit %f/%f > %f", best_cand_score, ann->MSE_value,
-			//	   ann->cascade_candidate_limit);
+		//printf("above candidate limit %f/%f > %f", best_cand_score, ann->MSE_value,
+		//	   ann->cascade_candidate_limit);
 #endif
-			return i + 1;
-		}
+		return 1;
+	}
 
-		if((best_cand_score > target_cand_score) || (best_cand_score < backslide_cand_score))
-		{
+	if((best_cand_score > phase->target) || (best_cand_score < phase->backslide))
+	{
 #ifdef CASCADE_DEBUG_FULL
-			//printf("Best candidate score %f, real score: %f\n", ann->MSE_value - best_cand_score,
-			//	   best_cand_score);
-			/* printf("best_cand_score=%f, target_cand_score=%f, backslide_cand_score=%f, stagnation=%d\n", best_cand_score, target_cand_score, backslide_cand_score, stagnation); */
+		//printf("Best candidate score %f, real score: %f\n", ann->MSE_value - best_cand_score,
+		//	   best_cand_score);
+		/* printf("best_cand_score=%f, target_cand_score=%f, backslide_cand_score=%f, stagnation=%d\n", best_cand_score, phase->target, phase->backslide, phase->stagnation); */
 #endif
 
-			target_cand_score = best_cand_score * (1.0f + ann->cascade_candidate_change_fraction);
-			backslide_cand_score = best_cand_score * (1.0f - ann->cascade_candidate_change_fraction);
-			stagnation = i + ann->cascade_candidate_stagnation_epochs;
-		}
+		phase->target = best_cand_score * (1.0f + ann->cascade_candidate_change_fraction);
+		phase->backslide = best_cand_score * (1.0f - ann->cascade_candidate_change_fraction);
+		phase->stagnation = i + ann->cascade_candidate_stagnation_epochs;
+	}
 
-		/* No improvement in allotted period, so quit */
-		if(i >= stagnation && i >= min_epochs)
-		{
+	/* No improvement in allotted period, so quit */
+	if(i >= phase->stagnation && i >= min_epochs)
+	{
 #ifdef CASCADE_DEBUG
-			//printf("Stagnation with %d epochs, best candidate score %f, real score: %f\n", i + 1,
-			//	   ann->MSE_value - best_cand_score, best_cand_score);
+		//printf("Stagnation with %d epochs, best candidate score %f, real score: %f\n", i + 1,
+		//	   ann->MSE_value - best_cand_score, best_cand_score);
 #endif
-			return i + 1;
+		return 1;
+	}
+
+	if(phase->epoch >= max_epochs)
+		return 1;
+
+	if(ann->cascade_candidate_prune_epochs != 0 &&
+	   phase->epoch % ann->cascade_candidate_prune_epochs == 0)
+	{
+		fann_prune_candidates(ann);
+	}
+
+	return 0;
+}
+
+/* Move candidate from to the place of candidate to (from > to), with its
+   weights and training state. Every place keeps its own connections.
+ */
+static void fann_move_candidate(struct fann *ann, unsigned int to, unsigned int from)
+{
+	struct fann_neuron *candidates = ann->first_layer->first_neuron + ann->total_neurons + 1;
+	struct fann_neuron *dst = candidates + to;
+	struct fann_neuron *src = candidates + from;
+	/* input and output connections */
+	size_t size = (src->last_con - src->first_con + ann->num_output) * sizeof(fann_type);
+
+	memcpy(ann->weights + dst->first_con, ann->weights + src->first_con, size);
+	memcpy(ann->train_slopes + dst->first_con, ann->train_slopes + src->first_con, size);
+	memcpy(ann->prev_steps + dst->first_con, ann->prev_steps + src->first_con, size);
+	memcpy(ann->prev_train_slopes + dst->first_con, ann->prev_train_slopes + src->first_con, size);
+
+	dst->value = src->value;
+	dst->sum = src->sum;
+	dst->activation_function = src->activation_function;
+	dst->activation_steepness = src->activation_steepness;
+	ann->cascade_candidate_scores[to] = ann->cascade_candidate_scores[from];
+}
+
+/* Drop the cascade_candidate_prune_fraction of the active candidates with the
+   worst scores in the last epoch, and move the others to the front of the
+   candidate array in their current order.
+ */
+void fann_prune_candidates(struct fann *ann)
+{
+	unsigned int num_active = ann->cascade_num_active_candidates;
+	unsigned int num_keep = num_active - (unsigned int)(num_active * ann->cascade_candidate_prune_fraction);
+	unsigned int first_candidate = ann->total_neurons + 1;
+	fann_type *scores = ann->cascade_candidate_scores;
+	fann_type threshold = scores[0];
+	unsigned int i, j, num_better, num_ties, kept;
+	int keep;
+
+	if(num_keep == 0)
+		num_keep = 1;
+	if(num_keep >= num_active)
+		return;
+
+	/* The num_keep-th best score: the lowest score with fewer than num_keep
+	 * better ones, starting from the best score */
+	for(i = 1; i < num_active; i++)
+	{
+		if(scores[i] > threshold)
+			threshold = scores[i];
+	}
+	for(i = 0; i < num_active; i++)
+	{
+		num_better = 0;
+		for(j = 0; j < num_active; j++)
+		{
+			if(scores[j] > scores[i])
+				num_better++;
 		}
+		if(num_better < num_keep && scores[i] < threshold)
+			threshold = scores[i];
 	}
 
-#ifdef CASCADE_DEBUG
-	//printf("Max epochs %d reached, best candidate score %f, real score: %f\n", max_epochs,
-	//	   ann->MSE_value - best_cand_score, best_cand_score);
-#endif
-	return max_epochs;
+	/* Candidates above it are kept, and then the first ones equal to it */
+	num_better = 0;
+	for(i = 0; i < num_active; i++)
+	{
+		if(scores[i] > threshold)
+			num_better++;
+	}
+	num_ties = num_keep - num_better;
+
+	for(i = 0, kept = 0; i < num_active; i++)
+	{
+		keep = scores[i] > threshold;
+		if(!keep && scores[i] == threshold && num_ties != 0)
+		{
+			keep = 1;
+			num_ties--;
+		}
+		if(!keep)
+			continue;
+
+		if(ann->cascade_best_candidate == first_candidate + i)
+		{
+			ann->cascade_best_candidate = first_candidate + kept;
+		}
+		if(kept != i)
+		{
+			fann_move_candidate(ann, kept, i);
+		}
+		kept++;
+	}
+
+	ann->cascade_num_active_candidates = kept;
 }
 
-void fann_update_candidate_slopes(struct fann *ann)
+/* Accumulate the slopes and scores of candidates [first, last) for the
+   sample just run through the network.
+ */
+void fann_update_candidate_slopes(struct fann *ann, unsigned int first, unsigned int last)
 {
 	struct fann_neuron *neurons = ann->first_layer->first_neuron;
-	struct fann_neuron *first_cand = neurons + ann->total_neurons + 1;
-	struct fann_neuron *last_cand = first_cand + fann_get_cascade_num_candidates(ann);
+	struct fann_neuron *candidates = neurons + ann->total_neurons + 1;
+	struct fann_neuron *first_cand = candidates + first;
+	struct fann_neuron *last_cand = candidates + last;
 	struct fann_neuron *cand_it;
 	unsigned int i, j, num_connections;
 	unsigned int num_output = ann->num_output;
@@ -571,7 +854,7 @@ void fann_update_candidate_slopes(struct fann *ann)
 
 	for(cand_it = first_cand; cand_it < last_cand; cand_it++)
 	{
-		cand_score = ann->cascade_candidate_scores[cand_it - first_cand];
+		cand_score = ann->cascade_candidate_scores[cand_it - candidates];
 		error_value = 0.0;
 
 		/* code more or less stolen from fann_run to fast forward pass
@@ -652,7 +935,7 @@ void fann_update_candidate_slopes(struct fann *ann)
 #endif
 		}
 
-		ann->cascade_candidate_scores[cand_it - first_cand] = cand_score;
+		ann->cascade_candidate_scores[cand_it - candidates] = cand_score;
 		error_value *= derived;
 
 		cand_slopes = ann->train_slopes + cand_it->first_con;
@@ -666,22 +949,22 @@ void fann_update_candidate_slopes(struct fann *ann)
 void fann_update_candidate_weights(struct fann *ann, unsigned int num_data)
 {
 	struct fann_neuron *first_cand = (ann->last_layer - 1)->last_neuron + 1;	/* there is an empty neuron between the actual neurons and the candidate neuron */
-	struct fann_neuron *last_cand = first_cand + fann_get_cascade_num_candidates(ann) - 1;
+	struct fann_neuron *last_cand = first_cand + ann->cascade_num_active_candidates - 1;
 
 	switch (ann->training_algorithm)
 	{
 		case FANN_TRAIN_RPROP:
-			fann_update_weights_irpropm(ann, first_cand->first_con,
-										last_cand->last_con + ann->num_output);
+			fann_cascade_update_weights_irpropm(ann, first_cand->first_con,
+												last_cand->last_con + ann->num_output);
 			break;
 		case FANN_TRAIN_SARPROP:
 			/* TODO: increase epoch? */
-			fann_update_weights_sarprop(ann, ann->sarprop_epoch, first_cand->first_con,
-										last_cand->last_con + ann->num_output);
+			fann_cascade_update_weights_sarprop(ann, ann->sarprop_epoch, first_cand->first_con,
+												last_cand->last_con + ann->num_output);
 			break;
 		case FANN_TRAIN_QUICKPROP:
-			fann_update_weights_quickprop(ann, num_data, first_cand->first_con,
-										  last_cand->last_con + ann->num_output);
+			fann_cascade_update_weights_quickprop(ann, num_data, first_cand->first_con,
+												  last_cand->last_con + ann->num_output);
 			break;
 		case FANN_TRAIN_BATCH:
 		case FANN_TRAIN_INCREMENTAL:
@@ -690,68 +973,203 @@ void fann_update_candidate_weights(struct fann *ann, unsigned int num_data)
 	}
 }
 
-fann_type fann_train_candidates_epoch(struct fann *ann, struct fann_train_data *data)
+/* Set the output errors seen by the candidates for the sample just run
+   through the network.
+ */
+void fann_compute_candidate_errors(struct fann *ann, fann_type *desired_output)
 {
-	unsigned int i, j;
-	unsigned int best_candidate;
-	fann_type best_score;
-	unsigned int num_cand = fann_get_cascade_num_candidates(ann);
+	unsigned int j;
 	fann_type *output_train_errors = ann->train_errors + (ann->total_neurons - ann->num_output);
 	struct fann_neuron *output_neurons = (ann->last_layer - 1)->first_neuron;
 
-	for(i = 0; i < num_cand; i++)
+	for(j = 0; j < ann->num_output; j++)
 	{
-		/* The ann->MSE_value is actually the sum squared error */
-		ann->cascade_candidate_scores[i] = ann->MSE_value;
+		/* TODO only debug, but the error is in opposite direction, this might be usefull info */
+		/*          if(output_train_errors[j] != (ann->output[j] - data->output[i][j])){
+		 * printf("difference in calculated error at %f != %f; %f = %f - %f;\n", output_train_errors[j], (ann->output[j] - data->output[i][j]), output_train_errors[j], ann->output[j], data->output[i][j]);
+		 * } */
+
+		/*
+		 * output_train_errors[j] = (data->output[i][j] - ann->output[j])/2;
+		 * output_train_errors[j] = ann->output[j] - data->output[i][j];
+		 */
+
+		output_train_errors[j] = (desired_output[j] - ann->output[j]);
+
+		switch (output_neurons[j].activation_function)
+		{
+			case FANN_LINEAR_PIECE_SYMMETRIC:
+			case FANN_SIGMOID_SYMMETRIC:
+			case FANN_SIGMOID_SYMMETRIC_STEPWISE:
+			case FANN_THRESHOLD_SYMMETRIC:
+			case FANN_ELLIOT_SYMMETRIC:
+			case FANN_GAUSSIAN_SYMMETRIC:
+			case FANN_SIN_SYMMETRIC:
+			case FANN_COS_SYMMETRIC:
+				output_train_errors[j] /= 2.0;
+				break;
+			case FANN_LINEAR:
+			case FANN_THRESHOLD:
+			case FANN_SIGMOID:
+			case FANN_SIGMOID_STEPWISE:
+			case FANN_GAUSSIAN:
+			case FANN_GAUSSIAN_STEPWISE:
+			case FANN_ELLIOT:
+			case FANN_LINEAR_PIECE:
+			case FANN_SIN:
+			case FANN_COS:
+				break;
+		}
 	}
-	/*printf("start score: %f\n", ann->MSE_value); */
+}
+
+/* Run the network, which does not change during a candidate training phase,
+   once on every sample of data and keep what the candidates read: the values
+   of the neurons before the outputs and the output errors. The cache is not
+   used (cascade_candidate_cache_data = 0) if it cannot hold all the samples.
+ */
+void fann_cache_candidate_inputs(struct fann *ann, struct fann_train_data *data)
+{
+	unsigned int i, j;
+	unsigned int row_len = ann->total_neurons;
+	unsigned int num_values = ann->total_neurons - ann->num_output;
+	struct fann_neuron *neurons = ann->first_layer->first_neuron;
+	fann_type *output_train_errors = ann->train_errors + num_values;
+	fann_type *row;
 
+	ann->cascade_candidate_cache_data = 0;
+
+#ifndef FANN_CASCADE_ARENA
+	if(data->num_data > ann->cascade_candidate_cache_size / row_len)
+	{
+		row = (fann_type *) realloc(ann->cascade_candidate_cache,
+									(size_t) data->num_data * row_len * sizeof(fann_type));
+		if(row == NULL)
+		{
+			/* not fatal, the network is then run at every epoch */
+			return;
+		}
+		ann->cascade_candidate_cache = row;
+		ann->cascade_candidate_cache_size = data->num_data * row_len;
+	}
+#endif
+	if(data->num_data > ann->cascade_candidate_cache_size / row_len)
+	{
+		return;
+	}
+
+	row = ann->cascade_candidate_cache;
 	for(i = 0; i < data->num_data; i++)
 	{
-		fann_run(ann, data->input[i]);
+		fann_run(ann, fann_get_train_input(data, i));
+		fann_compute_candidate_errors(ann, fann_get_train_output(data, i));
 
+		for(j = 0; j < num_values; j++)
+		{
+			row[j] = neurons[j].value;
+		}
 		for(j = 0; j < ann->num_output; j++)
 		{
-			/* TODO only debug, but the error is in opposite direction, this might be usefull info */
-			/*          if(output_train_errors[j] != (ann->output[j] - data->output[i][j])){
-			 * printf("difference in calculated error at %f != %f; %f = %f - %f;\n", output_train_errors[j], (ann->output[j] - data->output[i][j]), output_train_errors[j], ann->output[j], data->output[i][j]);
-			 * } */
+			row[num_values + j] = output_train_errors[j];
+		}
+		row += row_len;
+	}
+
+	ann->cascade_candidate_cache_data = data->num_data;
+}
+
+/* Update the slopes of candidates [first, last) for the sample in the network,
+   with the packed kernel of fann_cascade_simd.c if pack is not NULL.
+ */
+static void fann_update_candidate_slopes_packed(struct fann *ann, unsigned int first, unsigned int last,
+												struct fann_cascade_pack *pack)
+{
+#ifdef FANN_CASCADE_SIMD
+	if(pack != NULL)
+	{
+		fann_cascade_simd_update_slopes(ann, pack);
+		return;
+	}
+#endif
+	fann_update_candidate_slopes(ann, first, last);
+}
 
-			/*
-			 * output_train_errors[j] = (data->output[i][j] - ann->output[j])/2;
-			 * output_train_errors[j] = ann->output[j] - data->output[i][j];
-			 */
+/* Run all the samples of data, accumulating the slopes and scores of
+   candidates [first, last). Samples are taken from the candidate cache when
+   it holds them.
+ */
+void fann_update_candidate_slopes_data(struct fann *ann, struct fann_train_data *data,
+									   unsigned int first, unsigned int last)
+{
+	unsigned int i, j;
+	unsigned int num_values = ann->total_neurons - ann->num_output;
+	struct fann_neuron *neurons = ann->first_layer->first_neuron;
+	fann_type *output_train_errors = ann->train_errors + num_values;
+	const fann_type *row;
+	struct fann_cascade_pack *pack = NULL;
 
-			output_train_errors[j] = (data->output[i][j] - ann->output[j]);
+#ifdef FANN_CASCADE_SIMD
+	/* NULL if it cannot be allocated: the scalar kernel is then used */
+	pack = fann_cascade_simd_pack(ann, first, last);
+#endif
 
-			switch (output_neurons[j].activation_function)
+	if(ann->cascade_candidate_cache_data != 0 && ann->cascade_candidate_cache_data == data->num_data)
+	{
+		row = ann->cascade_candidate_cache;
+		for(i = 0; i < data->num_data; i++)
+		{
+			/* restore the state left by fann_run and fann_compute_candidate_errors */
+			for(j = 0; j < num_values; j++)
 			{
-				case FANN_LINEAR_PIECE_SYMMETRIC:
-				case FANN_SIGMOID_SYMMETRIC:
-				case FANN_SIGMOID_SYMMETRIC_STEPWISE:
-				case FANN_THRESHOLD_SYMMETRIC:
-				case FANN_ELLIOT_SYMMETRIC:
-				case FANN_GAUSSIAN_SYMMETRIC:
-				case FANN_SIN_SYMMETRIC:
-				case FANN_COS_SYMMETRIC:
-					output_train_errors[j] /= 2.0;
-					break;
-				case FANN_LINEAR:
-				case FANN_THRESHOLD:
-				case FANN_SIGMOID:
-				case FANN_SIGMOID_STEPWISE:
-				case FANN_GAUSSIAN:
-				case FANN_GAUSSIAN_STEPWISE:
-				case FANN_ELLIOT:
-				case FANN_LINEAR_PIECE:
-				case FANN_SIN:
-				case FANN_COS:
-					break;
+				neurons[j].value = row[j];
 			}
+			for(j = 0; j < ann->num_output; j++)
+			{
+				output_train_errors[j] = row[num_values + j];
+			}
+			row += ann->total_neurons;
+
+			fann_update_candidate_slopes_packed(ann, first, last, pack);
+		}
+	}
+	else
+	{
+		for(i = 0; i < data->num_data; i++)
+		{
+			fann_run(ann, fann_get_train_input(data, i));
+			fann_compute_candidate_errors(ann, fann_get_train_output(data, i));
+			fann_update_candidate_slopes_packed(ann, first, last, pack);
 		}
+	}
 
-		fann_update_candidate_slopes(ann);
+#ifdef FANN_CASCADE_SIMD
+	if(pack != NULL)
+	{
+		fann_cascade_simd_unpack(ann, pack);
 	}
+#endif
+}
+
+fann_type fann_train_candidates_epoch(struct fann *ann, struct fann_train_data *data)
+{
+	unsigned int i;
+	unsigned int best_candidate;
+	fann_type best_score;
+	unsigned int num_cand = ann->cascade_num_active_candidates;
+
+	for(i = 0; i < num_cand; i++)
+	{
+		/* The ann->MSE_value is actually the sum squared error */
+		ann->cascade_candidate_scores[i] = ann->MSE_value;
+	}
+	/*printf("start score: %f\n", ann->MSE_value); */
+
+#ifdef FANN_CASCADE_THREADS
+	/* candidates split among the threads (see fann_cascade_threads.c) */
+	fann_cascade_threads_update_slopes(ann, data);
+#else
+	fann_update_candidate_slopes_data(ann, data, 0, num_cand);
+#endif
 
 	fann_update_candidate_weights(ann, data->num_data);
 
@@ -787,15 +1205,17 @@ struct fann_layer *fann_add_layer(struct fann *ann, struct fann_layer *layer)
 	int layer_pos = (int)(layer - ann->first_layer);
 	int num_layers = (int)(ann->last_layer - ann->first_layer + 1);
 	int i;
+	struct fann_layer *layers;
 
-	/* allocate the layer */
-	struct fann_layer *layers =
-		(struct fann_layer *) realloc(ann->first_layer, num_layers * sizeof(struct fann_layer));
-	if(layers == NULL)
+	if((unsigned int)num_layers > ann->total_layers_allocated)
 	{
-		// fann_error((struct fann_error *) ann, FANN_E_CANT_ALLOCATE_MEM);
-		return NULL;
+		/* allocate the layer, and a few more (see fann_initialize_candidates) */
+		if(fann_reallocate_layers(ann, num_layers + num_layers / 2) == -1)
+		{
+			return NULL;
+		}
 	}
+	layers = ann->first_layer;
 
 	/* copy layers so that the free space is at the right location */
 	for(i = num_layers - 1; i >= layer_pos; i--)
@@ -992,6 +1412,8 @@ FANN_GET_SET(unsigned int, cascade_max_out_epochs)
 FANN_GET_SET(unsigned int, cascade_max_cand_epochs)
 FANN_GET_SET(unsigned int, cascade_min_out_epochs)
 FANN_GET_SET(unsigned int, cascade_min_cand_epochs)
+FANN_GET_SET(unsigned int, cascade_candidate_prune_epochs)
+FANN_GET_SET(float, cascade_candidate_prune_fraction)
 
 FANN_GET(unsigned int, cascade_activation_functions_count)
 FANN_GET(enum fann_activationfunc_enum *, cascade_activation_functions)
@@ -0,0 +1,320 @@
+/*
+ *******************************************************************************
+ * fann_cascade_arena.c
+ *
+ * Heap-free cascade training that survives power failures (see the
+ * "Intermittent Cascade Training" group in fann_cascade.h).
+ *
+ * The network, its training arrays and the state of the algorithm are kept
+ * in an arena of fixed capacity. There are two arenas in FRAM2: a step
+ * copies the committed one into the other, moves the pointers of the copy
+ * to its own arrays, runs one epoch there and commits it by switching
+ * fann_cascade_committed. Re-executing an interrupted step starts again from
+ * the same committed arena, so every step is idempotent.
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "config.h"
+#include "fann.h"
+
+#if defined(FANN_CASCADE_ARENA) && !defined(FIXEDFANN)
+
+/* Neurons feeding a neuron, at most (inputs, bias and hidden neurons) */
+#define FANN_CASCADE_MAX_SPAN (FANN_CASCADE_MAX_INPUT + 1 + FANN_CASCADE_MAX_NEURONS)
+
+#define FANN_CASCADE_MAX_LAYERS (2 + FANN_CASCADE_MAX_NEURONS)
+
+/* Network neurons, then an empty slot and the candidates
+   (see fann_initialize_candidates) */
+#define FANN_CASCADE_MAX_TOTAL_NEURONS \
+    (FANN_CASCADE_MAX_SPAN + FANN_CASCADE_MAX_OUTPUT + 1 + FANN_CASCADE_MAX_CANDIDATES)
+
+/* Output and hidden connections, then room for installing a neuron and the
+   input and output connections of every candidate */
+#define FANN_CASCADE_MAX_CONNECTIONS \
+    ((FANN_CASCADE_MAX_OUTPUT + FANN_CASCADE_MAX_NEURONS) * FANN_CASCADE_MAX_SPAN + \
+     (FANN_CASCADE_MAX_SPAN + FANN_CASCADE_MAX_OUTPUT) * (FANN_CASCADE_MAX_CANDIDATES + 1))
+
+/* Values of the neurons before the outputs, then the output errors, per
+   sample (see fann_cache_candidate_inputs) */
+#define FANN_CASCADE_MAX_CACHE \
+    ((FANN_CASCADE_MAX_SPAN + FANN_CASCADE_MAX_OUTPUT) * FANN_CASCADE_MAX_DATA)
+
+#define FANN_CASCADE_NONE 0xFF
+
+/* Stages of the algorithm, in the order of fann_cascadetrain_on_data */
+enum fann_cascade_stage_enum
+{
+    FANN_CASCADE_OUTPUTS = 0,
+    FANN_CASCADE_CANDIDATES,
+    FANN_CASCADE_FINAL_OUTPUTS,
+    FANN_CASCADE_DONE
+};
+
+struct fann_cascade_arena
+{
+    struct fann ann;
+
+    /* One of fann_cascade_stage_enum */
+    uint8_t stage;
+    /* Neuron being added (1 to max_neurons) */
+    unsigned int neuron;
+    unsigned int max_neurons;
+    unsigned int total_epochs;
+    float desired_error;
+    struct fann_cascade_phase phase;
+
+    struct fann_layer layers[FANN_CASCADE_MAX_LAYERS];
+    struct fann_neuron neurons[FANN_CASCADE_MAX_TOTAL_NEURONS];
+    fann_type output[FANN_CASCADE_MAX_OUTPUT];
+    fann_type train_errors[FANN_CASCADE_MAX_TOTAL_NEURONS];
+    fann_type candidate_scores[FANN_CASCADE_MAX_CANDIDATES];
+
+    fann_type weights[FANN_CASCADE_MAX_CONNECTIONS];
+    fann_type train_slopes[FANN_CASCADE_MAX_CONNECTIONS];
+    fann_type prev_steps[FANN_CASCADE_MAX_CONNECTIONS];
+    fann_type prev_train_slopes[FANN_CASCADE_MAX_CONNECTIONS];
+};
+
+/// Separate objects: each must stay under 64 KB (16-bit size_t)
+#pragma DATA_SECTION(fann_cascade_arena_0, ".fram2_noinit")
+static struct fann_cascade_arena fann_cascade_arena_0;
+
+#pragma DATA_SECTION(fann_cascade_arena_1, ".fram2_noinit")
+static struct fann_cascade_arena fann_cascade_arena_1;
+
+static struct fann_cascade_arena *const fann_cascade_arenas[2] = {
+    &fann_cascade_arena_0,
+    &fann_cascade_arena_1
+};
+
+/// Only set by fann_set_shortcut_connections() at the end of training, so
+/// shared by the two arenas
+#pragma DATA_SECTION(fann_cascade_connections, ".fram2_noinit")
+static struct fann_neuron *fann_cascade_connections[FANN_CASCADE_MAX_CONNECTIONS];
+
+/// Only written by the first epoch of a candidate phase, which runs from an
+/// arena that does not read it, so also shared
+#pragma DATA_SECTION(fann_cascade_cache, ".fram2_noinit")
+static fann_type fann_cascade_cache[FANN_CASCADE_MAX_CACHE];
+
+/// Arena of the last committed step, FANN_CASCADE_NONE if there is none
+#pragma PERSISTENT(fann_cascade_committed)
+static uint8_t fann_cascade_committed = FANN_CASCADE_NONE;
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Point the network of arena a, copied from arena from, to the arrays of a.
+ */
+static void fann_cascade_arena_bind(struct fann_cascade_arena *a, const struct fann_cascade_arena *from)
+{
+    struct fann *ann = &a->ann;
+    struct fann_layer *layer_it;
+
+    ann->first_layer = a->layers;
+    ann->last_layer = a->layers + (from->ann.last_layer - from->layers);
+    for (layer_it = ann->first_layer; layer_it != ann->last_layer; layer_it++) {
+        layer_it->first_neuron = a->neurons + (layer_it->first_neuron - from->neurons);
+        layer_it->last_neuron = a->neurons + (layer_it->last_neuron - from->neurons);
+    }
+
+    ann->output = a->output;
+    ann->train_errors = a->train_errors;
+    ann->cascade_candidate_scores = a->candidate_scores;
+    ann->weights = a->weights;
+    ann->train_slopes = a->train_slopes;
+    ann->prev_steps = a->prev_steps;
+    ann->prev_train_slopes = a->prev_train_slopes;
+    ann->connections = fann_cascade_connections;
+    ann->cascade_candidate_cache = fann_cascade_cache;
+    ann->cascade_candidate_cache_size = FANN_CASCADE_MAX_CACHE;
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Advance the algorithm of fann_cascadetrain_on_data() by one epoch.
+ */
+static void fann_cascade_arena_advance(struct fann_cascade_arena *a, struct fann_train_data *data)
+{
+    struct fann *ann = &a->ann;
+
+    switch (a->stage) {
+    case FANN_CASCADE_OUTPUTS:
+        if (!fann_train_outputs_step(ann, data, a->desired_error, &a->phase)) {
+            break;
+        }
+        a->total_epochs += a->phase.epoch;
+        a->phase.epoch = 0;
+
+        if (fann_desired_error_reached(ann, a->desired_error) == 0 ||
+            fann_initialize_candidates(ann) == -1) {
+            a->stage = FANN_CASCADE_FINAL_OUTPUTS;
+        }
+        else {
+            a->stage = FANN_CASCADE_CANDIDATES;
+        }
+        break;
+
+    case FANN_CASCADE_CANDIDATES:
+        if (!fann_train_candidates_step(ann, data, &a->phase)) {
+            break;
+        }
+        a->total_epochs += a->phase.epoch;
+        a->phase.epoch = 0;
+
+        /* this installs the best candidate */
+        fann_install_candidate(ann);
+
+        if (++a->neuron > a->max_neurons) {
+            a->stage = FANN_CASCADE_FINAL_OUTPUTS;
+        }
+        else {
+            a->stage = FANN_CASCADE_OUTPUTS;
+        }
+        break;
+
+    case FANN_CASCADE_FINAL_OUTPUTS:
+        /* Train outputs one last time but without any desired error */
+        if (!fann_train_outputs_step(ann, data, 0.0f, &a->phase)) {
+            break;
+        }
+        a->total_epochs += a->phase.epoch;
+        a->phase.epoch = 0;
+
+        fann_set_shortcut_connections(ann);
+        a->stage = FANN_CASCADE_DONE;
+        break;
+    }
+}
+
+
+FANN_EXTERNAL int FANN_API fann_cascade_arena_init(struct fann *ann, unsigned int max_neurons,
+                                                   float desired_error)
+{
+    struct fann_cascade_arena *a = fann_cascade_arenas[0];
+    struct fann *arena_ann = &a->ann;
+    struct fann_neuron *neuron_it, *output_neurons;
+    unsigned int num_input = ann->num_input;
+    unsigned int num_output = ann->num_output;
+    unsigned int i;
+
+    if (num_input > FANN_CASCADE_MAX_INPUT || num_output > FANN_CASCADE_MAX_OUTPUT ||
+        fann_get_cascade_num_candidates(ann) > FANN_CASCADE_MAX_CANDIDATES) {
+        return -1;
+    }
+
+    /* Never resume a half-built arena */
+    fann_cascade_committed = FANN_CASCADE_NONE;
+
+    /* Parameters of ann, with a shortcut network with no hidden layer */
+    *arena_ann = *ann;
+    arena_ann->network_type = FANN_NETTYPE_SHORTCUT;
+    arena_ann->connection_rate = 1;
+    arena_ann->callback = NULL;
+    arena_ann->prev_weights_deltas = NULL;
+    arena_ann->sarprop_epoch = 0;
+    arena_ann->cascade_candidate_cache_data = 0;
+    if (ann->training_algorithm == FANN_TRAIN_INCREMENTAL || ann->training_algorithm == FANN_TRAIN_BATCH) {
+        /* Not supported by cascade training */
+        arena_ann->training_algorithm = FANN_TRAIN_RPROP;
+    }
+    arena_ann->total_neurons = num_input + 1 + num_output;
+    arena_ann->total_neurons_allocated = FANN_CASCADE_MAX_TOTAL_NEURONS;
+    arena_ann->total_connections = num_output * (num_input + 1);
+    arena_ann->total_connections_allocated = FANN_CASCADE_MAX_CONNECTIONS;
+    arena_ann->total_layers_allocated = FANN_CASCADE_MAX_LAYERS;
+
+    arena_ann->last_layer = a->layers + 2;
+    a->layers[0].first_neuron = a->neurons;
+    a->layers[0].last_neuron = a->neurons + num_input + 1;
+    a->layers[1].first_neuron = a->layers[0].last_neuron;
+    a->layers[1].last_neuron = a->layers[1].first_neuron + num_output;
+    fann_cascade_arena_bind(a, a);
+
+    for (neuron_it = a->layers[0].first_neuron; neuron_it != a->layers[0].last_neuron; neuron_it++) {
+        neuron_it->first_con = 0;
+        neuron_it->last_con = 0;
+        neuron_it->value = 0;
+        neuron_it->sum = 0;
+    }
+
+    /* Outputs keep the activation of the outputs of ann */
+    output_neurons = (ann->last_layer - 1)->first_neuron;
+    for (i = 0, neuron_it = a->layers[1].first_neuron; i < num_output; i++, neuron_it++) {
+        neuron_it->first_con = i * (num_input + 1);
+        neuron_it->last_con = neuron_it->first_con + num_input + 1;
+        neuron_it->value = 0;
+        neuron_it->sum = 0;
+        neuron_it->activation_function = output_neurons[i].activation_function;
+        neuron_it->activation_steepness = output_neurons[i].activation_steepness;
+    }
+
+    for (i = 0; i < arena_ann->total_connections; i++) {
+        a->weights[i] = fann_random_weight();
+    }
+    fann_reset_MSE(arena_ann);
+
+    a->stage = FANN_CASCADE_OUTPUTS;
+    a->neuron = 1;
+    a->max_neurons = max_neurons < FANN_CASCADE_MAX_NEURONS ? max_neurons : FANN_CASCADE_MAX_NEURONS;
+    a->total_epochs = 0;
+    a->desired_error = desired_error;
+    a->phase.epoch = 0;
+
+    fann_cascade_committed = 0;
+
+    return 0;
+}
+
+
+FANN_EXTERNAL int FANN_API fann_cascade_arena_step(struct fann_train_data *data)
+{
+    struct fann_cascade_arena *src, *dst;
+    uint8_t committed = fann_cascade_committed;
+
+    if (committed == FANN_CASCADE_NONE) {
+        return 1;
+    }
+    src = fann_cascade_arenas[committed];
+    if (src->stage == FANN_CASCADE_DONE) {
+        return 1;
+    }
+
+    dst = fann_cascade_arenas[committed ^ 1];
+    memcpy(dst, src, sizeof(struct fann_cascade_arena));
+    fann_cascade_arena_bind(dst, src);
+
+    fann_cascade_arena_advance(dst, data);
+
+    /* Commit */
+    fann_cascade_committed = committed ^ 1;
+
+    return dst->stage == FANN_CASCADE_DONE;
+}
+
+
+FANN_EXTERNAL int FANN_API fann_cascade_arena_pending(void)
+{
+    return fann_cascade_committed != FANN_CASCADE_NONE &&
+           fann_cascade_arenas[fann_cascade_committed]->stage != FANN_CASCADE_DONE;
+}
+
+
+FANN_EXTERNAL struct fann * FANN_API fann_cascade_arena_ann(void)
+{
+    if (fann_cascade_committed == FANN_CASCADE_NONE) {
+        return NULL;
+    }
+    return &fann_cascade_arenas[fann_cascade_committed]->ann;
+}
+
+#endif /* FANN_CASCADE_ARENA && !FIXEDFANN */
@@ -0,0 +1,683 @@
+/*
+ *******************************************************************************
+ * fann_cascade_simd.c
+ *
+ * Candidate slopes computed for several candidates at once with the vector
+ * extensions of GCC and Clang, for host builds of the cascade trainer
+ * (define FANN_CASCADE_SIMD; the device never defines it).
+ *
+ * All the candidates read the same neuron values and have the same number
+ * of input connections, so their weights and slopes are gathered once per
+ * epoch into a candidate-major pack: element i of the pack is a row of
+ * vectors holding connection i of every candidate, and each neuron value is
+ * broadcast to whole vectors. Activations are still computed one candidate
+ * at a time, since candidates differ in activation function. Every lane
+ * runs the operations of fann_update_candidate_slopes() in the same order,
+ * so the results are bit-identical.
+ *
+ * The weight updates of RPROP, SARPROP and Quickprop run 8 weights at a time
+ * the same way: both branches of every test are computed and the lanes pick
+ * theirs with a mask. The kernel is built twice, for the target of the build
+ * and for AVX, and the one to use is picked once from the CPU.
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "fann.h"
+
+#if defined(FANN_CASCADE_SIMD) && !defined(FIXEDFANN)
+
+typedef fann_type fann_cascade_vec
+    __attribute__((vector_size(FANN_CASCADE_SIMD_WIDTH * sizeof(fann_type))));
+
+struct fann_cascade_pack
+{
+    /* Candidates [first, last) */
+    unsigned int first, last;
+    /* Vectors per row (candidates rounded up to FANN_CASCADE_SIMD_WIDTH) */
+    unsigned int width;
+    /* Input connections of every candidate */
+    unsigned int num_connections;
+    /* num_connections rows, then num_output rows for the output connections */
+    fann_cascade_vec *weights;
+    fann_cascade_vec *slopes;
+    fann_cascade_vec *scores;
+    /* One row each */
+    fann_cascade_vec *sums;
+    fann_cascade_vec *values;
+    fann_cascade_vec *derived;
+};
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Lane c of a row of vectors, as a scalar.
+ */
+static fann_type *fann_cascade_lane(fann_cascade_vec *row, unsigned int c)
+{
+    return (fann_type *) row + c;
+}
+
+
+struct fann_cascade_pack *fann_cascade_simd_pack(struct fann *ann, unsigned int first, unsigned int last)
+{
+    struct fann_neuron *candidates = ann->first_layer->first_neuron + ann->total_neurons + 1;
+    unsigned int num_output = ann->num_output;
+    unsigned int num_connections, num_rows, width, i, c;
+    struct fann_cascade_pack *pack;
+    fann_type *weights, *slopes;
+    void *p;
+
+    if (first == last) {
+        return NULL;
+    }
+    num_connections = candidates[first].last_con - candidates[first].first_con;
+    for (c = first + 1; c < last; c++) {
+        if (candidates[c].last_con - candidates[c].first_con != num_connections) {
+            return NULL;
+        }
+    }
+
+    width = (last - first + FANN_CASCADE_SIMD_WIDTH - 1) / FANN_CASCADE_SIMD_WIDTH;
+    num_rows = num_connections + num_output;
+
+    if ((pack = malloc(sizeof(struct fann_cascade_pack))) == NULL) {
+        return NULL;
+    }
+    /* Every array in a single block, aligned for the vectors */
+    if (posix_memalign(&p, sizeof(fann_cascade_vec),
+                       (2 * num_rows + 4) * width * sizeof(fann_cascade_vec)) != 0) {
+        free(pack);
+        return NULL;
+    }
+    memset(p, 0, (2 * num_rows + 4) * width * sizeof(fann_cascade_vec));
+
+    pack->first = first;
+    pack->last = last;
+    pack->width = width;
+    pack->num_connections = num_connections;
+    pack->weights = p;
+    pack->slopes = pack->weights + num_rows * width;
+    pack->scores = pack->slopes + num_rows * width;
+    pack->sums = pack->scores + width;
+    pack->values = pack->sums + width;
+    pack->derived = pack->values + width;
+
+    for (c = first; c < last; c++) {
+        weights = ann->weights + candidates[c].first_con;
+        slopes = ann->train_slopes + candidates[c].first_con;
+        for (i = 0; i < num_rows; i++) {
+            *fann_cascade_lane(pack->weights + i * width, c - first) = weights[i];
+            *fann_cascade_lane(pack->slopes + i * width, c - first) = slopes[i];
+        }
+        *fann_cascade_lane(pack->scores, c - first) = ann->cascade_candidate_scores[c];
+    }
+
+    return pack;
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * acc += row * value, value being broadcast to every lane.
+ */
+static void fann_cascade_madd(fann_cascade_vec *acc, const fann_cascade_vec *row, fann_type value,
+                              unsigned int width)
+{
+    unsigned int k;
+
+    for (k = 0; k < width; k++) {
+        acc[k] += row[k] * value;
+    }
+}
+
+
+void fann_cascade_simd_update_slopes(struct fann *ann, struct fann_cascade_pack *pack)
+{
+    struct fann_neuron *neurons = ann->first_layer->first_neuron;
+    struct fann_neuron *cand_it = neurons + ann->total_neurons + 1 + pack->first;
+    fann_type *output_train_errors = ann->train_errors + (ann->total_neurons - ann->num_output);
+    unsigned int num_connections = pack->num_connections;
+    unsigned int num_output = ann->num_output;
+    unsigned int width = pack->width;
+    unsigned int i, j, k, c;
+    const fann_cascade_vec *w0, *w1, *w2, *w3, *ow;
+    fann_cascade_vec *os;
+    fann_cascade_vec activation, error_value, diff;
+    fann_type v0, v1, v2, v3, max_sum, sum, value;
+
+    /* Dot products, in the order of the unrolled loop of
+     * fann_update_candidate_slopes() */
+    for (k = 0; k < width; k++) {
+        pack->sums[k] = (fann_cascade_vec) {0};
+    }
+    i = num_connections & 3;
+    switch (i) {
+    case 3:
+        fann_cascade_madd(pack->sums, pack->weights + 2 * width, neurons[2].value, width);
+    case 2:
+        fann_cascade_madd(pack->sums, pack->weights + width, neurons[1].value, width);
+    case 1:
+        fann_cascade_madd(pack->sums, pack->weights, neurons[0].value, width);
+    case 0:
+        break;
+    }
+    for (; i != num_connections; i += 4) {
+        v0 = neurons[i].value;
+        v1 = neurons[i + 1].value;
+        v2 = neurons[i + 2].value;
+        v3 = neurons[i + 3].value;
+        w0 = pack->weights + i * width;
+        w1 = w0 + width;
+        w2 = w1 + width;
+        w3 = w2 + width;
+        for (k = 0; k < width; k++) {
+            pack->sums[k] += w0[k] * v0 + w1[k] * v1 + w2[k] * v2 + w3[k] * v3;
+        }
+    }
+
+    /* Activations, one candidate at a time */
+    for (c = 0; c < pack->last - pack->first; c++, cand_it++) {
+        sum = *fann_cascade_lane(pack->sums, c);
+        max_sum = 150 / cand_it->activation_steepness;
+        if (sum > max_sum)
+            sum = max_sum;
+        else if (sum < -max_sum)
+            sum = -max_sum;
+
+        value = fann_activation(ann, cand_it->activation_function, cand_it->activation_steepness, sum);
+        cand_it->sum = sum;
+        cand_it->value = value;
+        *fann_cascade_lane(pack->values, c) = value;
+        *fann_cascade_lane(pack->derived, c) =
+            fann_activation_derived(cand_it->activation_function, cand_it->activation_steepness, value, sum);
+    }
+
+    /* The output connections follow the input connections */
+    ow = pack->weights + num_connections * width;
+    os = pack->slopes + num_connections * width;
+    for (k = 0; k < width; k++) {
+        activation = pack->values[k];
+        error_value = (fann_cascade_vec) {0};
+        for (j = 0; j < num_output; j++) {
+            diff = (activation * ow[j * width + k]) - output_train_errors[j];
+            os[j * width + k] -= 2.0f * diff * activation;
+            error_value += diff * ow[j * width + k];
+            pack->scores[k] -= (diff * diff);
+        }
+
+        /* derived now holds the error propagated to the inputs */
+        pack->derived[k] *= error_value;
+    }
+
+    for (i = 0; i < num_connections; i++) {
+        fann_cascade_madd(pack->slopes + i * width, pack->derived, -neurons[i].value, width);
+    }
+}
+
+
+void fann_cascade_simd_unpack(struct fann *ann, struct fann_cascade_pack *pack)
+{
+    struct fann_neuron *candidates = ann->first_layer->first_neuron + ann->total_neurons + 1;
+    unsigned int num_rows = pack->num_connections + ann->num_output;
+    unsigned int width = pack->width;
+    fann_type *slopes;
+    unsigned int i, c;
+
+    /* Weights do not change during an epoch */
+    for (c = pack->first; c < pack->last; c++) {
+        slopes = ann->train_slopes + candidates[c].first_con;
+        for (i = 0; i < num_rows; i++) {
+            slopes[i] = *fann_cascade_lane(pack->slopes + i * width, c - pack->first);
+        }
+        ann->cascade_candidate_scores[c] = *fann_cascade_lane(pack->scores, c - pack->first);
+    }
+
+    free(pack->weights);
+    free(pack);
+}
+
+
+/* Weights per vector of the weight updates */
+#define FANN_WEIGHT_LANES 8
+
+typedef fann_type fann_weight_vec __attribute__((vector_size(FANN_WEIGHT_LANES * sizeof(fann_type))));
+typedef int32_t fann_weight_mask __attribute__((vector_size(FANN_WEIGHT_LANES * sizeof(int32_t))));
+
+#define FANN_WEIGHT_INLINE static inline __attribute__((always_inline))
+
+/* Lanes of a where mask is set, of b elsewhere */
+#define fann_weight_select(mask, a, b) \
+    ((fann_weight_vec) (((mask) & (fann_weight_mask) (a)) | (~(mask) & (fann_weight_mask) (b))))
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FANN_WEIGHT_AVX
+#endif
+
+/* 0xFF: not picked yet */
+static uint8_t fann_cascade_weight_kernel = 0xFF;
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Load n <= FANN_WEIGHT_LANES weights into v, the other lanes being 0.
+ */
+FANN_WEIGHT_INLINE void fann_weight_load(fann_weight_vec *v, const fann_type *p, unsigned int n)
+{
+    /* Constant size for full vectors, so that it is a single load */
+    if (n == FANN_WEIGHT_LANES) {
+        memcpy(v, p, sizeof(fann_weight_vec));
+    }
+    else {
+        *v = (fann_weight_vec) {0};
+        memcpy(v, p, n * sizeof(fann_type));
+    }
+}
+
+
+FANN_WEIGHT_INLINE void fann_weight_store(fann_type *p, const fann_weight_vec *v, unsigned int n)
+{
+    if (n == FANN_WEIGHT_LANES) {
+        memcpy(p, v, sizeof(fann_weight_vec));
+    }
+    else {
+        memcpy(p, v, n * sizeof(fann_type));
+    }
+}
+
+
+FANN_WEIGHT_INLINE void fann_weight_fill(fann_weight_vec *v, fann_type x)
+{
+    unsigned int k;
+
+    for (k = 0; k < FANN_WEIGHT_LANES; k++) {
+        (*v)[k] = x;
+    }
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Smallest float above x (x > 0): for a float f, f > x computed in double,
+ * as in fann_train.c, is then f >= fann_weight_above(x).
+ */
+static fann_type fann_weight_above(double x)
+{
+    fann_type f = (fann_type) x;
+
+    return (double) f > x ? f : nextafterf(f, 2 * f);
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * fann_update_weights_quickprop(), FANN_WEIGHT_LANES weights at a time.
+ */
+FANN_WEIGHT_INLINE void fann_weight_quickprop(struct fann *ann, unsigned int num_data,
+                                              unsigned int first_weight, unsigned int past_end)
+{
+    fann_type *train_slopes = ann->train_slopes;
+    fann_type *weights = ann->weights;
+    fann_type *prev_steps = ann->prev_steps;
+    fann_type *prev_train_slopes = ann->prev_train_slopes;
+
+    float epsilon = ann->learning_rate / num_data;
+    float decay = ann->quickprop_decay;
+    float mu = ann->quickprop_mu;
+    float shrink_factor = (float) (mu / (1.0 + mu));
+    fann_type threshold = fann_weight_above(0.001);
+
+    fann_weight_vec w, prev_step, slope, prev_slope, next_step, shrunk, zero, upper, lower;
+    fann_weight_mask positive, negative, linear, take_max;
+    unsigned int i, n;
+
+    fann_weight_fill(&zero, 0);
+    fann_weight_fill(&upper, 1500);
+    fann_weight_fill(&lower, -1500);
+
+    for (i = first_weight; i < past_end; i += n) {
+        n = past_end - i < FANN_WEIGHT_LANES ? past_end - i : FANN_WEIGHT_LANES;
+        fann_weight_load(&w, weights + i, n);
+        fann_weight_load(&prev_step, prev_steps + i, n);
+        fann_weight_load(&slope, train_slopes + i, n);
+        slope += decay * w;
+        fann_weight_load(&prev_slope, prev_train_slopes + i, n);
+
+        positive = prev_step >= threshold;
+        negative = prev_step <= -threshold;
+        shrunk = shrink_factor * prev_slope;
+
+        /* Linear term: last step zero, or slope opposite to the last step */
+        linear = (positive & (slope > 0)) | (negative & (slope < 0)) | ~(positive | negative);
+        next_step = 0 + fann_weight_select(linear, epsilon * slope, zero);
+
+        /* Maximum step, or quadratic estimate */
+        take_max = (positive & (slope > shrunk)) | (negative & (slope < shrunk));
+        next_step = fann_weight_select(positive | negative,
+                                       next_step + fann_weight_select(take_max, mu * prev_step,
+                                                                      prev_step * slope / (prev_slope - slope)),
+                                       next_step);
+
+        w += next_step;
+        w = fann_weight_select(w > 1500, upper, w);
+        w = fann_weight_select(w < -1500, lower, w);
+
+        fann_weight_store(prev_steps + i, &next_step, n);
+        fann_weight_store(weights + i, &w, n);
+        fann_weight_store(prev_train_slopes + i, &slope, n);
+        fann_weight_store(train_slopes + i, &zero, n);
+    }
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * fann_update_weights_irpropm(), FANN_WEIGHT_LANES weights at a time.
+ */
+FANN_WEIGHT_INLINE void fann_weight_irpropm(struct fann *ann, unsigned int first_weight,
+                                            unsigned int past_end)
+{
+    fann_type *train_slopes = ann->train_slopes;
+    fann_type *weights = ann->weights;
+    fann_type *prev_steps = ann->prev_steps;
+    fann_type *prev_train_slopes = ann->prev_train_slopes;
+
+    float increase_factor = ann->rprop_increase_factor;
+    float decrease_factor = ann->rprop_decrease_factor;
+    float delta_min = ann->rprop_delta_min;
+    float delta_max = ann->rprop_delta_max;
+
+    fann_weight_vec w, prev_step, slope, prev_slope, next_step, up, down;
+    fann_weight_vec zero, min_step, delta_min_vec, delta_max_vec, upper, lower;
+    fann_weight_mask same_sign;
+    unsigned int i, n;
+
+    fann_weight_fill(&zero, 0);
+    fann_weight_fill(&min_step, (fann_type) 0.0001);
+    fann_weight_fill(&delta_min_vec, delta_min);
+    fann_weight_fill(&delta_max_vec, delta_max);
+    fann_weight_fill(&upper, 1500);
+    fann_weight_fill(&lower, -1500);
+
+    for (i = first_weight; i < past_end; i += n) {
+        n = past_end - i < FANN_WEIGHT_LANES ? past_end - i : FANN_WEIGHT_LANES;
+        fann_weight_load(&w, weights + i, n);
+        fann_weight_load(&prev_step, prev_steps + i, n);
+        /* prev_step may not be zero because then the training will stop */
+        prev_step = fann_weight_select(prev_step > min_step, prev_step, min_step);
+        fann_weight_load(&slope, train_slopes + i, n);
+        fann_weight_load(&prev_slope, prev_train_slopes + i, n);
+
+        same_sign = prev_slope * slope >= 0;
+
+        up = prev_step * increase_factor;
+        up = fann_weight_select(up < delta_max, up, delta_max_vec);
+        down = prev_step * decrease_factor;
+        down = fann_weight_select(down > delta_min, down, delta_min_vec);
+        next_step = fann_weight_select(same_sign, up, down);
+        slope = fann_weight_select(same_sign, slope, zero);
+
+        /* Each direction is only bounded on its own side */
+        up = w + next_step;
+        up = fann_weight_select(up > 1500, upper, up);
+        down = w - next_step;
+        down = fann_weight_select(down < -1500, lower, down);
+        w = fann_weight_select(slope < 0, down, up);
+
+        fann_weight_store(weights + i, &w, n);
+        fann_weight_store(prev_steps + i, &next_step, n);
+        fann_weight_store(prev_train_slopes + i, &slope, n);
+        fann_weight_store(train_slopes + i, &zero, n);
+    }
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * fann_update_weights_sarprop(), FANN_WEIGHT_LANES weights at a time.
+ *
+ * Two things are left to a pass over the lanes, in order: the random steps,
+ * which must draw from rand() in the same order, and the weights whose slope
+ * did not change sign, which get the step of the weight before them (as the
+ * scalar loop, where next_step keeps its last value).
+ */
+FANN_WEIGHT_INLINE void fann_weight_sarprop(struct fann *ann, unsigned int epoch, unsigned int first_weight,
+                                            unsigned int past_end)
+{
+    fann_type *train_slopes = ann->train_slopes;
+    fann_type *weights = ann->weights;
+    fann_type *prev_steps = ann->prev_steps;
+    fann_type *prev_train_slopes = ann->prev_train_slopes;
+
+    float increase_factor = ann->rprop_increase_factor;
+    float decrease_factor = ann->rprop_decrease_factor;
+    /* SARPROP uses 1x10^-6 (Braun and Riedmiller, 1993) */
+    float delta_min = 0.000001f;
+    float delta_max = ann->rprop_delta_max;
+    float weight_decay_shift = ann->sarprop_weight_decay_shift;
+    float step_error_threshold_factor = ann->sarprop_step_error_threshold_factor;
+    float step_error_shift = ann->sarprop_step_error_shift;
+    float T = ann->sarprop_temperature;
+    float MSE = fann_get_MSE(ann);
+    float RMSE = sqrtf(MSE);
+    /* The same for every weight */
+    fann_type weight_decay = (fann_type) fann_exp2(-T * epoch + weight_decay_shift);
+    fann_type step_error = (fann_type) fann_exp2(-T * epoch + step_error_shift);
+
+    fann_type carried_step = 0;
+    fann_weight_vec w, prev_step, slope, prev_slope, same_sign, next_step, up, down, moved;
+    fann_weight_vec zero, min_step, delta_min_vec, delta_max_vec;
+    fann_weight_mask grow, shrink, random;
+    unsigned int i, k, n;
+
+    fann_weight_fill(&zero, 0);
+    fann_weight_fill(&min_step, (fann_type) 0.000001);
+    fann_weight_fill(&delta_min_vec, delta_min);
+    fann_weight_fill(&delta_max_vec, delta_max);
+
+    for (i = first_weight; i < past_end; i += n) {
+        n = past_end - i < FANN_WEIGHT_LANES ? past_end - i : FANN_WEIGHT_LANES;
+        fann_weight_load(&w, weights + i, n);
+        fann_weight_load(&prev_step, prev_steps + i, n);
+        /* prev_step may not be zero because then the training will stop */
+        prev_step = fann_weight_select(prev_step > min_step, prev_step, min_step);
+        /* calculate SARPROP slope */
+        fann_weight_load(&slope, train_slopes + i, n);
+        slope = -slope - w * weight_decay;
+
+        fann_weight_load(&prev_slope, prev_train_slopes + i, n);
+        same_sign = prev_slope * slope;
+        grow = same_sign > 0;
+        shrink = same_sign < 0;
+        random = shrink & (prev_step < step_error_threshold_factor * MSE);
+
+        up = prev_step * increase_factor;
+        up = fann_weight_select(up < delta_max, up, delta_max_vec);
+        down = prev_step * decrease_factor;
+        down = fann_weight_select(down > delta_min, down, delta_min_vec);
+        next_step = fann_weight_select(grow, up, down);
+
+        /* Growing steps move by the new step, unchanged signs by the last one */
+        moved = fann_weight_select(grow, up, prev_step);
+        moved = fann_weight_select(slope < 0, w + moved, w - moved);
+        w = fann_weight_select(shrink, w, moved);
+        slope = fann_weight_select(shrink, zero, slope);
+
+        for (k = 0; k < n; k++) {
+            if (random[k]) {
+                next_step[k] = prev_step[k] * decrease_factor + (float) rand() / RAND_MAX * RMSE * step_error;
+            }
+            if (grow[k] || shrink[k]) {
+                carried_step = next_step[k];
+            }
+            else {
+                next_step[k] = carried_step;
+            }
+        }
+
+        fann_weight_store(weights + i, &w, n);
+        fann_weight_store(prev_steps + i, &next_step, n);
+        fann_weight_store(prev_train_slopes + i, &slope, n);
+        fann_weight_store(train_slopes + i, &zero, n);
+    }
+}
+
+
+static void fann_weight_quickprop_vector(struct fann *ann, unsigned int num_data,
+                                         unsigned int first_weight, unsigned int past_end)
+{
+    fann_weight_quickprop(ann, num_data, first_weight, past_end);
+}
+
+
+static void fann_weight_irpropm_vector(struct fann *ann, unsigned int first_weight, unsigned int past_end)
+{
+    fann_weight_irpropm(ann, first_weight, past_end);
+}
+
+
+static void fann_weight_sarprop_vector(struct fann *ann, unsigned int epoch, unsigned int first_weight,
+                                       unsigned int past_end)
+{
+    fann_weight_sarprop(ann, epoch, first_weight, past_end);
+}
+
+#ifdef FANN_WEIGHT_AVX
+/* No FMA: a fused multiply-add would round differently from fann_train.c */
+__attribute__((target("avx")))
+static void fann_weight_quickprop_avx(struct fann *ann, unsigned int num_data,
+                                      unsigned int first_weight, unsigned int past_end)
+{
+    fann_weight_quickprop(ann, num_data, first_weight, past_end);
+}
+
+
+__attribute__((target("avx")))
+static void fann_weight_irpropm_avx(struct fann *ann, unsigned int first_weight, unsigned int past_end)
+{
+    fann_weight_irpropm(ann, first_weight, past_end);
+}
+
+
+__attribute__((target("avx")))
+static void fann_weight_sarprop_avx(struct fann *ann, unsigned int epoch, unsigned int first_weight,
+                                    unsigned int past_end)
+{
+    fann_weight_sarprop(ann, epoch, first_weight, past_end);
+}
+#endif
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Whether the CPU can run kernel.
+ */
+static int fann_weight_kernel_supported(enum fann_cascade_kernel_enum kernel)
+{
+    switch (kernel) {
+    case FANN_CASCADE_KERNEL_SCALAR:
+    case FANN_CASCADE_KERNEL_VECTOR:
+        return 1;
+    case FANN_CASCADE_KERNEL_AVX:
+#ifdef FANN_WEIGHT_AVX
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx");
+#endif
+    default:
+        return 0;
+    }
+}
+
+
+FANN_EXTERNAL int FANN_API fann_set_cascade_weight_kernel(enum fann_cascade_kernel_enum kernel)
+{
+    if (!fann_weight_kernel_supported(kernel)) {
+        return -1;
+    }
+    fann_cascade_weight_kernel = kernel;
+    return 0;
+}
+
+
+FANN_EXTERNAL enum fann_cascade_kernel_enum FANN_API fann_get_cascade_weight_kernel(void)
+{
+    if (fann_cascade_weight_kernel == 0xFF) {
+        fann_cascade_weight_kernel = fann_weight_kernel_supported(FANN_CASCADE_KERNEL_AVX) ?
+                                     FANN_CASCADE_KERNEL_AVX : FANN_CASCADE_KERNEL_VECTOR;
+    }
+    return (enum fann_cascade_kernel_enum) fann_cascade_weight_kernel;
+}
+
+
+void fann_cascade_simd_update_weights_quickprop(struct fann *ann, unsigned int num_data,
+                                                unsigned int first_weight, unsigned int past_end)
+{
+    switch (fann_get_cascade_weight_kernel()) {
+#ifdef FANN_WEIGHT_AVX
+    case FANN_CASCADE_KERNEL_AVX:
+        fann_weight_quickprop_avx(ann, num_data, first_weight, past_end);
+        break;
+#endif
+    case FANN_CASCADE_KERNEL_VECTOR:
+        fann_weight_quickprop_vector(ann, num_data, first_weight, past_end);
+        break;
+    default:
+        fann_update_weights_quickprop(ann, num_data, first_weight, past_end);
+        break;
+    }
+}
+
+
+void fann_cascade_simd_update_weights_irpropm(struct fann *ann, unsigned int first_weight,
+                                              unsigned int past_end)
+{
+    switch (fann_get_cascade_weight_kernel()) {
+#ifdef FANN_WEIGHT_AVX
+    case FANN_CASCADE_KERNEL_AVX:
+        fann_weight_irpropm_avx(ann, first_weight, past_end);
+        break;
+#endif
+    case FANN_CASCADE_KERNEL_VECTOR:
+        fann_weight_irpropm_vector(ann, first_weight, past_end);
+        break;
+    default:
+        fann_update_weights_irpropm(ann, first_weight, past_end);
+        break;
+    }
+}
+
+
+void fann_cascade_simd_update_weights_sarprop(struct fann *ann, unsigned int epoch, unsigned int first_weight,
+                                              unsigned int past_end)
+{
+    switch (fann_get_cascade_weight_kernel()) {
+#ifdef FANN_WEIGHT_AVX
+    case FANN_CASCADE_KERNEL_AVX:
+        fann_weight_sarprop_avx(ann, epoch, first_weight, past_end);
+        break;
+#endif
+    case FANN_CASCADE_KERNEL_VECTOR:
+        fann_weight_sarprop_vector(ann, epoch, first_weight, past_end);
+        break;
+    default:
+        fann_update_weights_sarprop(ann, epoch, first_weight, past_end);
+        break;
+    }
+}
+
+#endif /* FANN_CASCADE_SIMD && !FIXEDFANN */
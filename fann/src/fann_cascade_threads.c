@@ -0,0 +1,417 @@
+/*
+ *******************************************************************************
+ * fann_cascade_threads.c
+ *
+ * Candidate training on a pool of POSIX threads, for host builds of the
+ * cascade trainer (define FANN_CASCADE_THREADS and link with -pthread; the
+ * device never defines it).
+ *
+ * Once the network has been run on a sample, every candidate updates its
+ * own slopes and score only. The candidates are thus split in contiguous
+ * ranges, one per thread: every thread runs all the samples through a
+ * private copy of the neurons and accumulates the slopes of its range in
+ * the shared arrays. Each candidate sees the same operations in the same
+ * order as with a single thread, so the results are bit-identical.
+ *
+ * The outputs are trained in batch: every sample adds to the slopes of all
+ * the output connections. The data is thus split in shards instead, each one
+ * accumulating its slopes and error in a private buffer, and the shards are
+ * spread over the threads. The buffers are then added to the slopes of the
+ * network in shard order, so the results only depend on the number of
+ * shards, whatever the number of threads.
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "fann.h"
+
+#if defined(FANN_CASCADE_THREADS) && !defined(FIXEDFANN)
+
+/* Not available on the device, hence inside the guard */
+#include <pthread.h>
+
+struct fann_cascade_worker
+{
+    pthread_t thread;
+    /* Last job run */
+    unsigned int generation;
+    /* Candidates, or shards, of the current job */
+    unsigned int first, last;
+    /* Private copy of the network, sharing weights, slopes and scores */
+    struct fann ann;
+    struct fann_layer *layers;
+    struct fann_neuron *neurons;
+    fann_type *output;
+    fann_type *train_errors;
+    unsigned int layers_allocated;
+    unsigned int neurons_allocated;
+};
+
+struct fann_cascade_shard
+{
+    /* Slopes of the shard, indexed as ann->train_slopes */
+    fann_type *train_slopes;
+    unsigned int slopes_allocated;
+    float MSE_value;
+    unsigned int num_MSE;
+    unsigned int num_bit_fail;
+};
+
+enum fann_cascade_job
+{
+    FANN_CASCADE_JOB_CANDIDATES,
+    FANN_CASCADE_JOB_OUTPUTS
+};
+
+/* Worker 0 is the calling thread */
+static struct fann_cascade_worker fann_cascade_workers[FANN_CASCADE_MAX_THREADS];
+static unsigned int fann_cascade_num_threads = 1;
+
+static struct fann_cascade_shard fann_cascade_shards[FANN_CASCADE_MAX_SHARDS];
+static unsigned int fann_cascade_num_shards = 1;
+
+static pthread_mutex_t fann_cascade_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fann_cascade_pool_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t fann_cascade_pool_done = PTHREAD_COND_INITIALIZER;
+static unsigned int fann_cascade_pool_generation;
+static unsigned int fann_cascade_pool_pending;
+static int fann_cascade_pool_exit;
+static struct fann_train_data *fann_cascade_pool_data;
+static enum fann_cascade_job fann_cascade_pool_job;
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Copy the network into the private arrays of worker w.
+ *
+ * Returns 0, or -1 if they cannot be allocated.
+ */
+static int fann_cascade_worker_clone(struct fann_cascade_worker *w, struct fann *ann,
+                                     unsigned int num_neurons)
+{
+    unsigned int num_layers = (unsigned int) (ann->last_layer - ann->first_layer);
+    struct fann_neuron *neurons = ann->first_layer->first_neuron;
+    struct fann_layer *layer_it;
+    void *p;
+
+    if (num_layers > w->layers_allocated) {
+        if ((p = realloc(w->layers, num_layers * sizeof(struct fann_layer))) == NULL) {
+            return -1;
+        }
+        w->layers = p;
+        w->layers_allocated = num_layers;
+    }
+    if (num_neurons > w->neurons_allocated) {
+        if ((p = realloc(w->neurons, num_neurons * sizeof(struct fann_neuron))) == NULL) {
+            return -1;
+        }
+        w->neurons = p;
+        if ((p = realloc(w->train_errors, num_neurons * sizeof(fann_type))) == NULL) {
+            return -1;
+        }
+        w->train_errors = p;
+        w->neurons_allocated = num_neurons;
+    }
+    if (w->output == NULL && (w->output = malloc(ann->num_output * sizeof(fann_type))) == NULL) {
+        return -1;
+    }
+
+    memcpy(w->layers, ann->first_layer, num_layers * sizeof(struct fann_layer));
+    memcpy(w->neurons, neurons, num_neurons * sizeof(struct fann_neuron));
+    memcpy(w->train_errors, ann->train_errors, ann->total_neurons * sizeof(fann_type));
+    for (layer_it = w->layers; layer_it != w->layers + num_layers; layer_it++) {
+        layer_it->first_neuron = w->neurons + (layer_it->first_neuron - neurons);
+        layer_it->last_neuron = w->neurons + (layer_it->last_neuron - neurons);
+    }
+
+    w->ann = *ann;
+    w->ann.first_layer = w->layers;
+    w->ann.last_layer = w->layers + num_layers;
+    w->ann.output = w->output;
+    w->ann.train_errors = w->train_errors;
+
+    return 0;
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Run the shards of worker w on its copy of the network, each one into its
+ * own buffer.
+ */
+static void fann_cascade_worker_outputs(struct fann_cascade_worker *w, struct fann_train_data *data)
+{
+    unsigned int first_con = (w->ann.last_layer - 1)->first_neuron->first_con;
+    unsigned int num_shards = fann_cascade_num_shards;
+    struct fann_cascade_shard *shard;
+    unsigned int s;
+
+    for (s = w->first; s < w->last; s++) {
+        shard = &fann_cascade_shards[s];
+        memset(shard->train_slopes + first_con, 0,
+               (w->ann.total_connections - first_con) * sizeof(fann_type));
+        w->ann.train_slopes = shard->train_slopes;
+        w->ann.MSE_value = 0;
+        w->ann.num_MSE = 0;
+        w->ann.num_bit_fail = 0;
+
+        fann_update_output_slopes_data(&w->ann, data, data->num_data * s / num_shards,
+                                       data->num_data * (s + 1) / num_shards);
+
+        shard->MSE_value = w->ann.MSE_value;
+        shard->num_MSE = w->ann.num_MSE;
+        shard->num_bit_fail = w->ann.num_bit_fail;
+    }
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Thread body: run the range of candidates, or shards, of every new job.
+ */
+static void *fann_cascade_worker_main(void *arg)
+{
+    struct fann_cascade_worker *w = (struct fann_cascade_worker *) arg;
+
+    pthread_mutex_lock(&fann_cascade_pool_lock);
+    for (;;) {
+        while (w->generation == fann_cascade_pool_generation && !fann_cascade_pool_exit) {
+            pthread_cond_wait(&fann_cascade_pool_start, &fann_cascade_pool_lock);
+        }
+        if (fann_cascade_pool_exit) {
+            break;
+        }
+        w->generation = fann_cascade_pool_generation;
+        pthread_mutex_unlock(&fann_cascade_pool_lock);
+
+        if (fann_cascade_pool_job == FANN_CASCADE_JOB_OUTPUTS) {
+            fann_cascade_worker_outputs(w, fann_cascade_pool_data);
+        }
+        else {
+            fann_update_candidate_slopes_data(&w->ann, fann_cascade_pool_data, w->first, w->last);
+        }
+
+        pthread_mutex_lock(&fann_cascade_pool_lock);
+        if (--fann_cascade_pool_pending == 0) {
+            pthread_cond_signal(&fann_cascade_pool_done);
+        }
+    }
+    pthread_mutex_unlock(&fann_cascade_pool_lock);
+
+    return NULL;
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Stop the worker threads and release their arrays.
+ */
+static void fann_cascade_pool_stop(void)
+{
+    struct fann_cascade_worker *w;
+    unsigned int i;
+
+    pthread_mutex_lock(&fann_cascade_pool_lock);
+    fann_cascade_pool_exit = 1;
+    pthread_cond_broadcast(&fann_cascade_pool_start);
+    pthread_mutex_unlock(&fann_cascade_pool_lock);
+
+    for (i = 0; i < fann_cascade_num_threads; i++) {
+        w = &fann_cascade_workers[i];
+        if (i != 0) {
+            pthread_join(w->thread, NULL);
+        }
+        free(w->layers);
+        free(w->neurons);
+        free(w->output);
+        free(w->train_errors);
+        memset(w, 0, sizeof(struct fann_cascade_worker));
+    }
+
+    fann_cascade_pool_exit = 0;
+    fann_cascade_num_threads = 1;
+}
+
+
+FANN_EXTERNAL int FANN_API fann_set_cascade_num_threads(unsigned int num_threads)
+{
+    struct fann_cascade_worker *w;
+    unsigned int i;
+
+    if (num_threads == 0 || num_threads > FANN_CASCADE_MAX_THREADS) {
+        return -1;
+    }
+
+    fann_cascade_pool_stop();
+
+    for (i = 1; i < num_threads; i++) {
+        w = &fann_cascade_workers[i];
+        w->generation = fann_cascade_pool_generation;
+        if (pthread_create(&w->thread, NULL, fann_cascade_worker_main, w) != 0) {
+            fann_cascade_pool_stop();
+            return -1;
+        }
+        fann_cascade_num_threads = i + 1;
+    }
+
+    return 0;
+}
+
+
+FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_num_threads(void)
+{
+    return fann_cascade_num_threads;
+}
+
+
+FANN_EXTERNAL int FANN_API fann_set_cascade_num_shards(unsigned int num_shards)
+{
+    if (num_shards == 0 || num_shards > FANN_CASCADE_MAX_SHARDS) {
+        return -1;
+    }
+    fann_cascade_num_shards = num_shards;
+    return 0;
+}
+
+
+FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_num_shards(void)
+{
+    return fann_cascade_num_shards;
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Start the current job on workers 1 to n - 1.
+ */
+static void fann_cascade_pool_run(enum fann_cascade_job job, struct fann_train_data *data)
+{
+    pthread_mutex_lock(&fann_cascade_pool_lock);
+    fann_cascade_pool_job = job;
+    fann_cascade_pool_data = data;
+    fann_cascade_pool_pending = fann_cascade_num_threads - 1;
+    fann_cascade_pool_generation++;
+    pthread_cond_broadcast(&fann_cascade_pool_start);
+    pthread_mutex_unlock(&fann_cascade_pool_lock);
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Wait for workers 1 to n - 1 to finish the current job.
+ */
+static void fann_cascade_pool_wait(void)
+{
+    pthread_mutex_lock(&fann_cascade_pool_lock);
+    while (fann_cascade_pool_pending != 0) {
+        pthread_cond_wait(&fann_cascade_pool_done, &fann_cascade_pool_lock);
+    }
+    pthread_mutex_unlock(&fann_cascade_pool_lock);
+}
+
+
+void fann_cascade_threads_update_slopes(struct fann *ann, struct fann_train_data *data)
+{
+    unsigned int num_cand = ann->cascade_num_active_candidates;
+    unsigned int num_neurons = ann->total_neurons + 1 + num_cand;
+    unsigned int n = fann_cascade_num_threads;
+    struct fann_neuron *candidates = ann->first_layer->first_neuron + ann->total_neurons + 1;
+    struct fann_cascade_worker *w;
+    unsigned int i;
+
+    /* Copies are made here, before any thread touches the network */
+    for (i = 1; i < n; i++) {
+        w = &fann_cascade_workers[i];
+        w->first = num_cand * i / n;
+        w->last = num_cand * (i + 1) / n;
+        if (fann_cascade_worker_clone(w, ann, num_neurons) == -1) {
+            /* Out of memory: do it all here */
+            fann_update_candidate_slopes_data(ann, data, 0, num_cand);
+            return;
+        }
+    }
+
+    fann_cascade_pool_run(FANN_CASCADE_JOB_CANDIDATES, data);
+
+    /* The first range runs on the network itself, which thus ends up in the
+     * same state as with a single thread */
+    fann_update_candidate_slopes_data(ann, data, 0, num_cand / n);
+
+    fann_cascade_pool_wait();
+
+    /* Bring back the last activations of the other candidates */
+    for (i = 1; i < n; i++) {
+        w = &fann_cascade_workers[i];
+        memcpy(candidates + w->first, w->neurons + ann->total_neurons + 1 + w->first,
+               (w->last - w->first) * sizeof(struct fann_neuron));
+    }
+}
+
+
+void fann_cascade_threads_update_output_slopes(struct fann *ann, struct fann_train_data *data)
+{
+    unsigned int num_shards = fann_cascade_num_shards;
+    unsigned int n = fann_cascade_num_threads;
+    unsigned int first_con = (ann->last_layer - 1)->first_neuron->first_con;
+    struct fann_cascade_shard *shard;
+    struct fann_cascade_worker *w;
+    unsigned int i, s;
+    void *p;
+
+    if (num_shards == 1 || data->num_data < num_shards) {
+        fann_update_output_slopes_data(ann, data, 0, data->num_data);
+        return;
+    }
+
+    for (s = 0; s < num_shards; s++) {
+        shard = &fann_cascade_shards[s];
+        if (ann->total_connections > shard->slopes_allocated) {
+            if ((p = realloc(shard->train_slopes, ann->total_connections * sizeof(fann_type))) == NULL) {
+                fann_update_output_slopes_data(ann, data, 0, data->num_data);
+                return;
+            }
+            shard->train_slopes = p;
+            shard->slopes_allocated = ann->total_connections;
+        }
+    }
+
+    /* Every worker, the calling thread included, runs on a copy: the shards
+     * are not run in order */
+    for (i = 0; i < n; i++) {
+        w = &fann_cascade_workers[i];
+        w->first = num_shards * i / n;
+        w->last = num_shards * (i + 1) / n;
+        if (fann_cascade_worker_clone(w, ann, ann->total_neurons) == -1) {
+            fann_update_output_slopes_data(ann, data, 0, data->num_data);
+            return;
+        }
+    }
+
+    fann_cascade_pool_run(FANN_CASCADE_JOB_OUTPUTS, data);
+    fann_cascade_worker_outputs(&fann_cascade_workers[0], data);
+    fann_cascade_pool_wait();
+
+    /* Fixed order, whatever worker ran which shard */
+    for (s = 0; s < num_shards; s++) {
+        shard = &fann_cascade_shards[s];
+        for (i = first_con; i < ann->total_connections; i++) {
+            ann->train_slopes[i] += shard->train_slopes[i];
+        }
+        ann->MSE_value += shard->MSE_value;
+        ann->num_MSE += shard->num_MSE;
+        ann->num_bit_fail += shard->num_bit_fail;
+    }
+}
+
+#endif /* FANN_CASCADE_THREADS && !FIXEDFANN */
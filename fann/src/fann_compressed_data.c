@@ -0,0 +1,72 @@
+/*
+ *******************************************************************************
+ * fann_compressed_data.c
+ *
+ * Per-record decoder of compressed test data sets (see
+ * fann_compressed_data.h).
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#include <stdint.h>
+
+#include "fann.h"
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Read a code of at most 16 bits starting at bit pos (LSB first). Three
+ * bytes always cover it, the record array being padded accordingly.
+ */
+static uint16_t fann_read_bits(const uint8_t *buf, uint32_t pos, uint8_t bits)
+{
+    const uint8_t *p = buf + (pos >> 3);
+    uint32_t window;
+
+    window = (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16);
+
+    return (uint16_t) ((window >> (pos & 7)) & ((1UL << bits) - 1));
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Decode one column of a record.
+ */
+static fann_type fann_decode_column(const struct fann_compressed_data *data,
+                                    const struct fann_compressed_column *col, uint16_t code)
+{
+    if (col->type == FANN_COLUMN_QUANTIZED) {
+        return col->offset + col->scale * (fann_type) code;
+    }
+    return data->dict[col->dict + code];
+}
+
+
+FANN_EXTERNAL void FANN_API fann_decompress_record(const struct fann_compressed_data *data, uint32_t idx,
+                                                   fann_type *input, fann_type *output)
+{
+    const struct fann_compressed_column *col = data->columns;
+    uint32_t pos = idx * (uint32_t) data->record_bits;
+    uint16_t code;
+    uint8_t i;
+
+    for (i = 0; i < data->num_input; i++, col++) {
+        code = col->bits ? fann_read_bits(data->records, pos, col->bits) : 0;
+        pos += col->bits;
+        if (input != NULL) {
+            input[i] = fann_decode_column(data, col, code);
+        }
+    }
+
+    for (i = 0; i < data->num_output; i++, col++) {
+        code = col->bits ? fann_read_bits(data->records, pos, col->bits) : 0;
+        pos += col->bits;
+        if (output != NULL) {
+            output[i] = fann_decode_column(data, col, code);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ *******************************************************************************
+ * fann_far_data.c
+ *
+ * Access to test data sets stored in FRAM2 (see fann_far_data.h).
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#include <msp430.h>
+#include <stdint.h>
+
+#include "fann.h"
+
+
+/* SRAM double buffer: record idx goes into buffer idx & 1. */
+static fann_type far_buffer[2][FANN_FAR_MAX_RECORD];
+static const struct fann_far_data *far_owner[2];
+static uint32_t far_index[2];
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Read one stored value at the 20-bit address addr.
+ */
+static fann_type fann_far_read_value(const struct fann_far_data *data, uint32_t addr, uint8_t col)
+{
+    union {
+        uint32_t u;
+        float f;
+    } v;
+
+    switch (data->value_size) {
+    case 4:
+        v.u = __data20_read_long(addr);
+        return (fann_type) v.f;
+    case 2:
+        return (fann_type) (data->offset[col] + data->scale[col] * (float) __data20_read_short(addr));
+    default:
+        return (fann_type) (data->offset[col] + data->scale[col] * (float) __data20_read_char(addr));
+    }
+}
+
+
+FANN_EXTERNAL void FANN_API fann_far_read_record(const struct fann_far_data *data, uint32_t idx,
+                                                 fann_type *input, fann_type *output)
+{
+    uint8_t row_len = data->num_input + data->num_output;
+    uint32_t addr;
+    uint8_t j;
+
+    addr = (uint32_t) (uintptr_t) data->chunks[idx / data->records_per_chunk];
+    addr += (idx % data->records_per_chunk) * (uint32_t) row_len * data->value_size;
+
+    for (j = 0; j < row_len; j++, addr += data->value_size) {
+        if (j < data->num_input) {
+            if (input != NULL) {
+                input[j] = fann_far_read_value(data, addr, j);
+            }
+        }
+        else if (output != NULL) {
+            output[j - data->num_input] = fann_far_read_value(data, addr, j);
+        }
+    }
+}
+
+
+FANN_EXTERNAL fann_type * FANN_API fann_far_get_record(const struct fann_far_data *data, uint32_t idx)
+{
+    uint8_t b = idx & 1;
+
+    if (data->num_input + data->num_output > FANN_FAR_MAX_RECORD) {
+        return NULL;
+    }
+    if (far_owner[b] != data || far_index[b] != idx) {
+        fann_far_read_record(data, idx, far_buffer[b], far_buffer[b] + data->num_input);
+        far_owner[b] = data;
+        far_index[b] = idx;
+    }
+
+    return far_buffer[b];
+}
+
+
+FANN_EXTERNAL void FANN_API fann_far_prefetch(const struct fann_far_data *data, uint32_t idx)
+{
+    if (idx < data->num_data) {
+        fann_far_get_record(data, idx);
+    }
+}
@@ -0,0 +1,227 @@
+/*
+ *******************************************************************************
+ * fann_online.c
+ *
+ * Fine-tuning of the output layer on the device, one labelled sample at a
+ * time, that survives power failures (see the "Online Training" group in
+ * fann_train.h).
+ *
+ * The output weights and their training state are kept in two blocks in
+ * FRAM: a step copies the committed block into the other one, updates it
+ * with the sample and commits it by switching fann_online_committed. The
+ * output weights of the network are only a copy of the committed block,
+ * written again at the beginning of every step, so every step is idempotent.
+ *
+ * Created on: Oct 19, 2026
+ *******************************************************************************
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "config.h"
+#include "fann.h"
+
+#if defined(FANN_ONLINE) && !defined(FIXEDFANN)
+
+#define FANN_ONLINE_NONE 0xFF
+
+struct fann_online_block
+{
+    /* Samples trained on since fann_online_init() */
+    uint32_t num_samples;
+    /* Error on the samples, measured before training on each of them */
+    float MSE_value;
+    unsigned int num_MSE;
+    unsigned int num_bit_fail;
+
+    fann_type weights[FANN_ONLINE_MAX_WEIGHTS];
+    /* RPROP step sizes, or previous weight changes (momentum) */
+    fann_type prev_steps[FANN_ONLINE_MAX_WEIGHTS];
+    /* RPROP only: slopes summed over the current batch, and over the last one */
+    fann_type train_slopes[FANN_ONLINE_MAX_WEIGHTS];
+    fann_type prev_train_slopes[FANN_ONLINE_MAX_WEIGHTS];
+};
+
+#pragma NOINIT(fann_online_block_0)
+static struct fann_online_block fann_online_block_0;
+
+#pragma NOINIT(fann_online_block_1)
+static struct fann_online_block fann_online_block_1;
+
+static struct fann_online_block *const fann_online_blocks[2] = {
+    &fann_online_block_0,
+    &fann_online_block_1
+};
+
+/// Block of the last committed step, FANN_ONLINE_NONE if there is none
+#pragma PERSISTENT(fann_online_committed)
+static uint8_t fann_online_committed = FANN_ONLINE_NONE;
+
+/* Scratch data of a step, recomputed when a step is re-executed */
+static struct fann fann_online_view;
+static fann_type fann_online_errors[FANN_ONLINE_MAX_NEURONS];
+static fann_type fann_online_slopes[FANN_ONLINE_MAX_WEIGHTS];
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * First output connection: the output layer comes last in the weights.
+ */
+static unsigned int fann_online_first_con(struct fann *ann)
+{
+    return (ann->last_layer - 1)->first_neuron->first_con;
+}
+
+
+FANN_EXTERNAL int FANN_API fann_online_init(struct fann *ann)
+{
+    struct fann_online_block *b = fann_online_blocks[0];
+    unsigned int first_con = fann_online_first_con(ann);
+    unsigned int num_weights = ann->total_connections - first_con;
+    fann_type initial_step;
+    unsigned int i;
+
+    if (num_weights > FANN_ONLINE_MAX_WEIGHTS || ann->total_neurons > FANN_ONLINE_MAX_NEURONS) {
+        return -1;
+    }
+
+    /* Never resume a half-written block */
+    fann_online_committed = FANN_ONLINE_NONE;
+
+    /* As fann_clear_train_arrays() */
+    initial_step = ann->training_algorithm == FANN_TRAIN_RPROP ? ann->rprop_delta_zero : 0;
+
+    memcpy(b->weights, ann->weights + first_con, num_weights * sizeof(fann_type));
+    for (i = 0; i < num_weights; i++) {
+        b->prev_steps[i] = initial_step;
+        b->train_slopes[i] = 0;
+        b->prev_train_slopes[i] = 0;
+    }
+    b->num_samples = 0;
+    b->MSE_value = 0;
+    b->num_MSE = 0;
+    b->num_bit_fail = 0;
+
+    fann_online_committed = 0;
+
+    return 0;
+}
+
+
+FANN_EXTERNAL int FANN_API fann_online_train(struct fann *ann, fann_type *input, fann_type *desired_output)
+{
+    struct fann *view = &fann_online_view;
+    struct fann_online_block *src, *dst;
+    struct fann_neuron *neuron_it, *last_neuron, **connections;
+    unsigned int first_con = fann_online_first_con(ann);
+    unsigned int num_weights = ann->total_connections - first_con;
+    fann_type *error_it, *slope_it, delta;
+    uint8_t committed = fann_online_committed;
+    unsigned int i, num_connections;
+
+    if (committed == FANN_ONLINE_NONE) {
+        return -1;
+    }
+    src = fann_online_blocks[committed];
+    dst = fann_online_blocks[committed ^ 1];
+
+    /* Forward pass with the committed weights. The error is measured on the
+     * view, so that the network itself is left as it was. */
+    fann_online_sync(ann);
+    *view = *ann;
+    view->train_errors = fann_online_errors;
+    view->MSE_value = src->MSE_value;
+    view->num_MSE = src->num_MSE;
+    view->num_bit_fail = src->num_bit_fail;
+    fann_run(view, input);
+    fann_compute_MSE(view, desired_output);
+
+    memcpy(dst, src, sizeof(struct fann_online_block));
+
+    /* Slopes of the output connections, as fann_update_slopes_batch() */
+    neuron_it = (ann->last_layer - 1)->first_neuron;
+    last_neuron = (ann->last_layer - 1)->last_neuron;
+    error_it = fann_online_errors + (neuron_it - ann->first_layer->first_neuron);
+    slope_it = fann_online_slopes;
+    for (; neuron_it != last_neuron; neuron_it++, error_it++) {
+        num_connections = neuron_it->last_con - neuron_it->first_con;
+        connections = ann->connections + neuron_it->first_con;
+        for (i = 0; i < num_connections; i++) {
+            *slope_it++ = *error_it * connections[i]->value;
+        }
+    }
+
+    dst->num_samples++;
+
+    if (ann->training_algorithm == FANN_TRAIN_RPROP) {
+        /* RPROP only looks at the sign of the slopes, which is too noisy on
+         * a single sample: update once per batch */
+        for (i = 0; i < num_weights; i++) {
+            dst->train_slopes[i] += fann_online_slopes[i];
+        }
+        if (dst->num_samples % FANN_ONLINE_BATCH == 0) {
+            view->weights = dst->weights;
+            view->train_slopes = dst->train_slopes;
+            view->prev_steps = dst->prev_steps;
+            view->prev_train_slopes = dst->prev_train_slopes;
+            fann_update_weights_irpropm(view, 0, num_weights);
+        }
+    }
+    else {
+        /* Gradient descent with momentum, as the incremental training of FANN */
+        for (i = 0; i < num_weights; i++) {
+            delta = ann->learning_rate * fann_online_slopes[i] +
+                    ann->learning_momentum * dst->prev_steps[i];
+            dst->weights[i] += delta;
+            dst->prev_steps[i] = delta;
+        }
+    }
+
+    dst->MSE_value = view->MSE_value;
+    dst->num_MSE = view->num_MSE;
+    dst->num_bit_fail = view->num_bit_fail;
+
+    /* Commit */
+    fann_online_committed = committed ^ 1;
+
+    fann_online_sync(ann);
+
+    return 0;
+}
+
+
+FANN_EXTERNAL void FANN_API fann_online_sync(struct fann *ann)
+{
+    unsigned int first_con = fann_online_first_con(ann);
+
+    if (fann_online_committed == FANN_ONLINE_NONE) {
+        return;
+    }
+    memcpy(ann->weights + first_con, fann_online_blocks[fann_online_committed]->weights,
+           (ann->total_connections - first_con) * sizeof(fann_type));
+}
+
+
+FANN_EXTERNAL uint32_t FANN_API fann_online_get_num_samples(void)
+{
+    if (fann_online_committed == FANN_ONLINE_NONE) {
+        return 0;
+    }
+    return fann_online_blocks[fann_online_committed]->num_samples;
+}
+
+
+FANN_EXTERNAL float FANN_API fann_online_get_MSE(void)
+{
+    const struct fann_online_block *b;
+
+    if (fann_online_committed == FANN_ONLINE_NONE) {
+        return 0;
+    }
+    b = fann_online_blocks[fann_online_committed];
+    return b->num_MSE ? b->MSE_value / (float) b->num_MSE : 0;
+}
+
+#endif /* FANN_ONLINE && !FIXEDFANN */
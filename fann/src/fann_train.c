@@ -102,6 +102,33 @@ FANN_EXTERNAL fann_type *FANN_API fann_test(struct fann *ann, fann_type * input,
     return output_begin;
 }
 
+/* test a set of training data, walking it through its strides so that views
+ * over FRAM-resident data sets are tested in place.
+ */
+FANN_EXTERNAL float FANN_API fann_test_data(struct fann *ann, struct fann_train_data *data)
+{
+    unsigned int i;
+    fann_type *input, *output;
+
+    if(data->num_input != ann->num_input || data->num_output != ann->num_output)
+    {
+        return 0;
+    }
+
+    fann_reset_MSE(ann);
+
+    input = data->input_base;
+    output = data->output_base;
+    for(i = 0; i != data->num_data; i++)
+    {
+        fann_test(ann, input, output);
+        input += data->input_stride;
+        output += data->output_stride;
+    }
+
+    return fann_get_MSE(ann);
+}
+
 /* get the mean square error.
  */
 FANN_EXTERNAL float FANN_API fann_get_MSE(struct fann *ann)
@@ -125,3 +152,429 @@ FANN_EXTERNAL void FANN_API fann_reset_MSE(struct fann *ann)
     ann->MSE_value = 0;
     ann->num_bit_fail = 0;
 }
+
+/* check the stop criterion (see fann_set_train_stop_function).
+   Returns 0 when the desired error is reached, -1 otherwise.
+ */
+int fann_desired_error_reached(struct fann *ann, float desired_error)
+{
+    switch (ann->train_stop_function)
+    {
+    case FANN_STOPFUNC_MSE:
+        if(fann_get_MSE(ann) <= desired_error)
+            return 0;
+        break;
+    case FANN_STOPFUNC_BIT:
+        if(ann->num_bit_fail <= (unsigned int) desired_error)
+            return 0;
+        break;
+    }
+    return -1;
+}
+
+#ifndef FIXEDFANN
+
+/*
+ *******************************************************************************
+ * Training kernels, used by cascade training.
+ *
+ * Unlike the original FANN, nothing is allocated here: train_errors,
+ * train_slopes, prev_steps and prev_train_slopes must point to arrays of
+ * total_neurons_allocated and total_connections_allocated elements (see
+ * fann_cascade_arena.c).
+ *******************************************************************************
+ */
+
+fann_type fann_activation(struct fann * ann, unsigned int activation_function, fann_type steepness,
+                          fann_type value)
+{
+    value = fann_mult(steepness, value);
+    fann_activation_switch(activation_function, value, value);
+    return value;
+}
+
+fann_type fann_activation_derived(unsigned int activation_function,
+                                  fann_type steepness, fann_type value, fann_type sum)
+{
+    switch (activation_function)
+    {
+    case FANN_LINEAR:
+    case FANN_LINEAR_PIECE:
+    case FANN_LINEAR_PIECE_SYMMETRIC:
+        return (fann_type) fann_linear_derive(steepness, value);
+    case FANN_SIGMOID:
+    case FANN_SIGMOID_STEPWISE:
+        value = fann_clip(value, 0.01f, 0.99f);
+        return (fann_type) fann_sigmoid_derive(steepness, value);
+    case FANN_SIGMOID_SYMMETRIC:
+    case FANN_SIGMOID_SYMMETRIC_STEPWISE:
+        value = fann_clip(value, -0.98f, 0.98f);
+        return (fann_type) fann_sigmoid_symmetric_derive(steepness, value);
+    case FANN_GAUSSIAN:
+        return (fann_type) fann_gaussian_derive(steepness, value, sum);
+    case FANN_GAUSSIAN_SYMMETRIC:
+        return (fann_type) fann_gaussian_symmetric_derive(steepness, value, sum);
+    case FANN_ELLIOT:
+        value = fann_clip(value, 0.01f, 0.99f);
+        return (fann_type) fann_elliot_derive(steepness, value, sum);
+    case FANN_ELLIOT_SYMMETRIC:
+        value = fann_clip(value, -0.98f, 0.98f);
+        return (fann_type) fann_elliot_symmetric_derive(steepness, value, sum);
+    case FANN_SIN_SYMMETRIC:
+        return (fann_type) fann_sin_symmetric_derive(steepness, sum);
+    case FANN_COS_SYMMETRIC:
+        return (fann_type) fann_cos_symmetric_derive(steepness, sum);
+    case FANN_SIN:
+        return (fann_type) fann_sin_derive(steepness, sum);
+    case FANN_COS:
+        return (fann_type) fann_cos_derive(steepness, sum);
+    case FANN_THRESHOLD:
+        // fann_error(NULL, FANN_E_CANT_TRAIN_ACTIVATION);
+        break;
+    }
+    return 0;
+}
+
+/* INTERNAL FUNCTION
+   compute the error at the network output
+   (usually, after forward propagation of a certain input vector, fann_run)
+   the error is a sum of squares for all the output units
+   also increments a counter because MSE is an average of such errors
+ */
+void fann_compute_MSE(struct fann *ann, fann_type * desired_output)
+{
+    fann_type neuron_value, neuron_diff, *error_it;
+    struct fann_neuron *last_layer_begin = (ann->last_layer - 1)->first_neuron;
+    const struct fann_neuron *last_layer_end = last_layer_begin + ann->num_output;
+    const struct fann_neuron *first_neuron = ann->first_layer->first_neuron;
+
+    /* clear the error variables */
+    memset(ann->train_errors, 0, (ann->total_neurons) * sizeof(fann_type));
+
+    /* calculate the error and place it in the output layer */
+    error_it = ann->train_errors + (last_layer_begin - first_neuron);
+
+    for(; last_layer_begin != last_layer_end; last_layer_begin++)
+    {
+        neuron_value = last_layer_begin->value;
+        neuron_diff = *desired_output - neuron_value;
+
+        neuron_diff = fann_update_MSE(ann, last_layer_begin, neuron_diff);
+
+        if(ann->train_error_function)
+        {
+            if(neuron_diff < -.9999999)
+                neuron_diff = -17.0;
+            else if(neuron_diff > .9999999)
+                neuron_diff = 17.0;
+            else
+                neuron_diff = (fann_type) log((1.0 + neuron_diff) / (1.0 - neuron_diff));
+        }
+
+        *error_it = fann_activation_derived(last_layer_begin->activation_function,
+                                            last_layer_begin->activation_steepness, neuron_value,
+                                            last_layer_begin->sum) * neuron_diff;
+
+        desired_output++;
+        error_it++;
+
+        ann->num_MSE++;
+    }
+}
+
+/* INTERNAL FUNCTION
+   Update slopes for batch training
+   layer_begin = ann->first_layer+1 and layer_end = ann->last_layer-1
+   will update all slopes.
+ */
+void fann_update_slopes_batch(struct fann *ann, struct fann_layer *layer_begin,
+                              struct fann_layer *layer_end)
+{
+    struct fann_neuron *neuron_it, *last_neuron, *prev_neurons, **connections;
+    fann_type tmp_error;
+    unsigned int i, num_connections;
+
+    /* store some variables local for fast access */
+    struct fann_neuron *first_neuron = ann->first_layer->first_neuron;
+    fann_type *error_begin = ann->train_errors;
+    fann_type *slope_begin = ann->train_slopes;
+    fann_type *neuron_slope;
+
+    if(layer_begin == NULL)
+    {
+        layer_begin = ann->first_layer + 1;
+    }
+
+    if(layer_end == NULL)
+    {
+        layer_end = ann->last_layer - 1;
+    }
+
+    prev_neurons = first_neuron;
+
+    for(; layer_begin <= layer_end; layer_begin++)
+    {
+        last_neuron = layer_begin->last_neuron;
+        if(ann->connection_rate >= 1)
+        {
+            if(ann->network_type == FANN_NETTYPE_LAYER)
+            {
+                prev_neurons = (layer_begin - 1)->first_neuron;
+            }
+
+            for(neuron_it = layer_begin->first_neuron; neuron_it != last_neuron; neuron_it++)
+            {
+                tmp_error = error_begin[neuron_it - first_neuron];
+                neuron_slope = slope_begin + neuron_it->first_con;
+                num_connections = neuron_it->last_con - neuron_it->first_con;
+                for(i = 0; i != num_connections; i++)
+                {
+                    neuron_slope[i] += tmp_error * prev_neurons[i].value;
+                }
+            }
+        }
+        else
+        {
+            for(neuron_it = layer_begin->first_neuron; neuron_it != last_neuron; neuron_it++)
+            {
+                tmp_error = error_begin[neuron_it - first_neuron];
+                neuron_slope = slope_begin + neuron_it->first_con;
+                num_connections = neuron_it->last_con - neuron_it->first_con;
+                connections = ann->connections + neuron_it->first_con;
+                for(i = 0; i != num_connections; i++)
+                {
+                    neuron_slope[i] += tmp_error * connections[i]->value;
+                }
+            }
+        }
+    }
+}
+
+/* INTERNAL FUNCTION
+   Clears arrays used for training before a new training session.
+ */
+void fann_clear_train_arrays(struct fann *ann)
+{
+    unsigned int i;
+    fann_type delta_zero;
+
+    memset(ann->train_slopes, 0, (ann->total_connections_allocated) * sizeof(fann_type));
+
+    if(ann->training_algorithm == FANN_TRAIN_RPROP)
+    {
+        delta_zero = ann->rprop_delta_zero;
+        for(i = 0; i < ann->total_connections_allocated; i++)
+            ann->prev_steps[i] = delta_zero;
+    }
+    else
+    {
+        memset(ann->prev_steps, 0, (ann->total_connections_allocated) * sizeof(fann_type));
+    }
+
+    memset(ann->prev_train_slopes, 0, (ann->total_connections_allocated) * sizeof(fann_type));
+}
+
+/* INTERNAL FUNCTION
+   The quickprop training algorithm
+ */
+void fann_update_weights_quickprop(struct fann *ann, unsigned int num_data,
+                                   unsigned int first_weight, unsigned int past_end)
+{
+    fann_type *train_slopes = ann->train_slopes;
+    fann_type *weights = ann->weights;
+    fann_type *prev_steps = ann->prev_steps;
+    fann_type *prev_train_slopes = ann->prev_train_slopes;
+
+    fann_type w, prev_step, slope, prev_slope, next_step;
+
+    float epsilon = ann->learning_rate / num_data;
+    float decay = ann->quickprop_decay;
+    float mu = ann->quickprop_mu;
+    float shrink_factor = (float) (mu / (1.0 + mu));
+
+    unsigned int i = first_weight;
+
+    for(; i != past_end; i++)
+    {
+        w = weights[i];
+        prev_step = prev_steps[i];
+        slope = train_slopes[i] + decay * w;
+        prev_slope = prev_train_slopes[i];
+        next_step = 0.0;
+
+        /* The step must always be in direction opposite to the slope. */
+        if(prev_step > 0.001)
+        {
+            /* If last step was positive...  */
+            if(slope > 0.0)
+                next_step += epsilon * slope;
+
+            /* If current slope is close to or larger than prev slope...  */
+            if(slope > (shrink_factor * prev_slope))
+                next_step += mu * prev_step;    /* Take maximum size negative step. */
+            else
+                next_step += prev_step * slope / (prev_slope - slope);  /* Else, use quadratic estimate. */
+        }
+        else if(prev_step < -0.001)
+        {
+            /* If last step was negative...  */
+            if(slope < 0.0)
+                next_step += epsilon * slope;
+
+            /* If current slope is close to or more neg than prev slope... */
+            if(slope < (shrink_factor * prev_slope))
+                next_step += mu * prev_step;    /* Take maximum size negative step. */
+            else
+                next_step += prev_step * slope / (prev_slope - slope);  /* Else, use quadratic estimate. */
+        }
+        else
+        {
+            /* Last step was zero, so use only linear term. */
+            next_step += epsilon * slope;
+        }
+
+        /* update global data arrays */
+        prev_steps[i] = next_step;
+
+        w += next_step;
+
+        if(w > 1500)
+            weights[i] = 1500;
+        else if(w < -1500)
+            weights[i] = -1500;
+        else
+            weights[i] = w;
+
+        prev_train_slopes[i] = slope;
+        train_slopes[i] = 0.0;
+    }
+}
+
+/* INTERNAL FUNCTION
+   The iRprop- algorithm
+ */
+void fann_update_weights_irpropm(struct fann *ann, unsigned int first_weight, unsigned int past_end)
+{
+    fann_type *train_slopes = ann->train_slopes;
+    fann_type *weights = ann->weights;
+    fann_type *prev_steps = ann->prev_steps;
+    fann_type *prev_train_slopes = ann->prev_train_slopes;
+
+    fann_type prev_step, slope, prev_slope, next_step, same_sign;
+
+    float increase_factor = ann->rprop_increase_factor;
+    float decrease_factor = ann->rprop_decrease_factor;
+    float delta_min = ann->rprop_delta_min;
+    float delta_max = ann->rprop_delta_max;
+
+    unsigned int i = first_weight;
+
+    for(; i != past_end; i++)
+    {
+        /* prev_step may not be zero because then the training will stop */
+        prev_step = fann_max(prev_steps[i], (fann_type) 0.0001);
+        slope = train_slopes[i];
+        prev_slope = prev_train_slopes[i];
+
+        same_sign = prev_slope * slope;
+
+        if(same_sign >= 0.0)
+            next_step = fann_min(prev_step * increase_factor, delta_max);
+        else
+        {
+            next_step = fann_max(prev_step * decrease_factor, delta_min);
+            slope = 0;
+        }
+
+        if(slope < 0)
+        {
+            weights[i] -= next_step;
+            if(weights[i] < -1500)
+                weights[i] = -1500;
+        }
+        else
+        {
+            weights[i] += next_step;
+            if(weights[i] > 1500)
+                weights[i] = 1500;
+        }
+
+        /* update global data arrays */
+        prev_steps[i] = next_step;
+        prev_train_slopes[i] = slope;
+        train_slopes[i] = 0.0;
+    }
+}
+
+/* INTERNAL FUNCTION
+   The SARprop- algorithm
+ */
+void fann_update_weights_sarprop(struct fann *ann, unsigned int epoch, unsigned int first_weight,
+                                 unsigned int past_end)
+{
+    fann_type *train_slopes = ann->train_slopes;
+    fann_type *weights = ann->weights;
+    fann_type *prev_steps = ann->prev_steps;
+    fann_type *prev_train_slopes = ann->prev_train_slopes;
+
+    fann_type prev_step, slope, prev_slope, next_step = 0, same_sign;
+
+    float increase_factor = ann->rprop_increase_factor;
+    float decrease_factor = ann->rprop_decrease_factor;
+    /* SARPROP uses 1x10^-6 (Braun and Riedmiller, 1993) */
+    float delta_min = 0.000001f;
+    float delta_max = ann->rprop_delta_max;
+    float weight_decay_shift = ann->sarprop_weight_decay_shift;
+    float step_error_threshold_factor = ann->sarprop_step_error_threshold_factor;
+    float step_error_shift = ann->sarprop_step_error_shift;
+    float T = ann->sarprop_temperature;
+    float MSE = fann_get_MSE(ann);
+    float RMSE = sqrtf(MSE);
+
+    unsigned int i = first_weight;
+
+    for(; i != past_end; i++)
+    {
+        /* prev_step may not be zero because then the training will stop */
+        prev_step = fann_max(prev_steps[i], (fann_type) 0.000001);
+        /* calculate SARPROP slope */
+        slope = -train_slopes[i] - weights[i] * (fann_type) fann_exp2(-T * epoch + weight_decay_shift);
+
+        prev_slope = prev_train_slopes[i];
+
+        same_sign = prev_slope * slope;
+
+        if(same_sign > 0.0)
+        {
+            next_step = fann_min(prev_step * increase_factor, delta_max);
+            if(slope < 0.0)
+                weights[i] += next_step;
+            else
+                weights[i] -= next_step;
+        }
+        else if(same_sign < 0.0)
+        {
+            if(prev_step < step_error_threshold_factor * MSE)
+                next_step = prev_step * decrease_factor + (float) rand() / RAND_MAX * RMSE *
+                            (fann_type) fann_exp2(-T * epoch + step_error_shift);
+            else
+                next_step = fann_max(prev_step * decrease_factor, delta_min);
+
+            slope = 0.0;
+        }
+        else
+        {
+            if(slope < 0.0)
+                weights[i] += prev_step;
+            else
+                weights[i] -= prev_step;
+        }
+
+        /* update global data arrays */
+        prev_steps[i] = next_step;
+        prev_train_slopes[i] = slope;
+        train_slopes[i] = 0.0;
+    }
+}
+
+#endif  /* NOT FIXEDFANN */
@@ -117,6 +117,11 @@ FANN_EXTERNAL struct fann_train_data * FANN_API fann_create_train(unsigned int n
         return NULL;
     }
 
+    data->input_base = data_input;
+    data->output_base = data_output;
+    data->input_stride = num_input;
+    data->output_stride = num_output;
+
     for(i = 0; i != num_data; i++) {
         data->input[i] = data_input;
         data_input += num_input;
@@ -128,19 +133,47 @@ FANN_EXTERNAL struct fann_train_data * FANN_API fann_create_train(unsigned int n
 }
 
 
-/**
- * Create test data from header file.
+/*
+ * Wraps existing arrays into a train data structure, without allocating or
+ * copying anything.
  */
-FANN_EXTERNAL struct fann_train_data *FANN_API fann_create_tests_from_header()
+FANN_EXTERNAL struct fann_train_data * FANN_API fann_create_train_view(struct fann_train_data *data, unsigned int num_data, unsigned int num_input, fann_type *input, unsigned int num_output, fann_type *output)
 {
-    struct fann_train_data *data;
+    data->errno_f = FANN_E_NO_ERROR;
+    data->error_log = NULL;
+    data->errstr = NULL;
 
-    // data = fann_read_test_msp430();
+    data->num_data = num_data;
+    data->num_input = num_input;
+    data->num_output = num_output;
+    data->input = NULL;
+    data->output = NULL;
+
+    data->input_base = input;
+    data->output_base = output;
+    data->input_stride = num_input;
+    data->output_stride = num_output;
 
     return data;
 }
 
 
+FANN_EXTERNAL fann_type * FANN_API fann_get_train_input(struct fann_train_data *data, unsigned int position)
+{
+    if(position >= data->num_data)
+        return NULL;
+    return data->input_base + (size_t) position * data->input_stride;
+}
+
+
+FANN_EXTERNAL fann_type * FANN_API fann_get_train_output(struct fann_train_data *data, unsigned int position)
+{
+    if(position >= data->num_data)
+        return NULL;
+    return data->output_base + (size_t) position * data->output_stride;
+}
+
+
 FANN_EXTERNAL unsigned int FANN_API fann_length_train_data(struct fann_train_data *data)
 {
     return data->num_data;
@@ -0,0 +1,570 @@
+/*
+ * cascade_train.c
+ *
+ * Host-side cascade training: grow a shortcut network on a FANN data file
+ * with the cascade code of the device library (fann_cascadetrain_on_data),
+ * training the candidates on a pool of threads (see
+ * fann_cascade_threads.c), and save it as a FANN .net file for fann2header:
+ *
+ *   ./cascade_train -j 8 -m 6 -o thyroid_cascade.net ../database/thyroid.test
+ *   ./fann2header thyroid_cascade.net
+ *
+ * The network is the same whatever the number of threads (-j); -T checks it
+ * by training twice, with one thread and with -j threads, and comparing the
+ * two networks bit for bit. -p drops the worst candidates every few candidate
+ * epochs (see fann_set_cascade_candidate_prune_epochs), which changes the
+ * network but saves most of the candidate training. -S splits the data in
+ * shards for the training of the outputs, run on the threads too: the
+ * network then depends on the number of shards, but still not on -j.
+ *
+ * -V checks instead that the vectorized weight updates give the weights of
+ * the scalar ones of fann_train.c, bit for bit, for every kernel the CPU can
+ * run (see fann_set_cascade_weight_kernel), and times them; it needs
+ * FANN_CASCADE_SIMD, which the tool builds without too.
+ *
+ * Build (from this directory):
+ *
+ *   cc -O2 -Wall -Wno-unknown-pragmas -pthread -DFANN_CASCADE_THREADS \
+ *      -DFANN_CASCADE_SIMD -I../fann/inc -I../database -o cascade_train \
+ *      cascade_train.c fann_ref.c ../fann/src/fann.c ../fann/src/fann_error.c \
+ *      ../fann/src/fann_train.c ../fann/src/fann_train_data.c \
+ *      ../fann/src/fann_cascade.c ../fann/src/fann_cascade_threads.c \
+ *      ../fann/src/fann_cascade_simd.c -lm
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fann.h"
+#include "fann_ref.h"
+
+struct options {
+    const char *data_path;
+    const char *test_path;
+    const char *out_path;
+    unsigned int threads;
+    unsigned int shards;
+    unsigned int max_neurons;
+    float desired_error;
+    unsigned int activation;
+    fann_type steepness;
+    unsigned int seed;
+    unsigned int prune_epochs;
+    float prune_fraction;
+    int check;
+    int check_kernels;
+};
+
+/* Defaults of the library (fann_allocate_structure) live here */
+struct fann fram_ann;
+
+struct fann *fann_allocate_structure(unsigned int num_layers);
+
+
+static double monotonic_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+/*
+ * Not part of the device library, which has no file system: read a data
+ * file into a data set allocated with fann_create_train().
+ */
+struct fann_train_data *fann_read_train_from_file(const char *filename)
+{
+    struct ref_data ref;
+    struct fann_train_data *data;
+    unsigned int i;
+
+    if (ref_data_load(&ref, filename, 0) != 0) {
+        return NULL;
+    }
+    data = fann_create_train(ref.num_data, ref.num_input, ref.num_output);
+    if (data != NULL) {
+        for (i = 0; i < ref.num_data; i++) {
+            memcpy(fann_get_train_input(data, i), ref.input + i * ref.num_input,
+                   ref.num_input * sizeof(fann_type));
+            memcpy(fann_get_train_output(data, i), ref.output + i * ref.num_output,
+                   ref.num_output * sizeof(fann_type));
+        }
+    }
+    ref_data_free(&ref);
+
+    return data;
+}
+
+
+/*
+ * Create a shortcut network with no hidden layer and the default training
+ * parameters, with every array on the heap so that cascade training can
+ * grow it.
+ */
+static struct fann *create_shortcut(unsigned int num_input, unsigned int num_output,
+                                    unsigned int activation, fann_type steepness)
+{
+    struct fann *ann = fann_allocate_structure(2);
+    struct fann_neuron *neurons;
+    unsigned int i;
+
+    ann->network_type = FANN_NETTYPE_SHORTCUT;
+    ann->connection_rate = 1;
+    ann->num_input = num_input;
+    ann->num_output = num_output;
+    ann->total_neurons = num_input + 1 + num_output;
+    ann->total_connections = num_output * (num_input + 1);
+    ann->total_neurons_allocated = ann->total_neurons;
+    ann->total_connections_allocated = ann->total_connections;
+
+    ann->first_layer = malloc(2 * sizeof(struct fann_layer));
+    neurons = calloc(ann->total_neurons, sizeof(struct fann_neuron));
+    ann->output = calloc(num_output, sizeof(fann_type));
+    ann->train_errors = calloc(ann->total_neurons, sizeof(fann_type));
+    ann->weights = calloc(ann->total_connections, sizeof(fann_type));
+    ann->connections = calloc(ann->total_connections, sizeof(struct fann_neuron *));
+    ann->train_slopes = calloc(ann->total_connections, sizeof(fann_type));
+    ann->prev_steps = calloc(ann->total_connections, sizeof(fann_type));
+    ann->prev_train_slopes = calloc(ann->total_connections, sizeof(fann_type));
+    if (ann->first_layer == NULL || neurons == NULL || ann->output == NULL ||
+        ann->train_errors == NULL || ann->weights == NULL || ann->connections == NULL ||
+        ann->train_slopes == NULL || ann->prev_steps == NULL || ann->prev_train_slopes == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return NULL;
+    }
+
+    ann->last_layer = ann->first_layer + 2;
+    ann->first_layer[0].first_neuron = neurons;
+    ann->first_layer[0].last_neuron = neurons + num_input + 1;
+    ann->first_layer[1].first_neuron = ann->first_layer[0].last_neuron;
+    ann->first_layer[1].last_neuron = ann->first_layer[1].first_neuron + num_output;
+
+    for (i = 0; i < num_output; i++) {
+        neurons[num_input + 1 + i].first_con = i * (num_input + 1);
+        neurons[num_input + 1 + i].last_con = (i + 1) * (num_input + 1);
+        neurons[num_input + 1 + i].activation_function = activation;
+        neurons[num_input + 1 + i].activation_steepness = steepness;
+    }
+    for (i = 0; i < ann->total_connections; i++) {
+        ann->weights[i] = fann_random_weight();
+    }
+    fann_set_shortcut_connections(ann);
+
+    return ann;
+}
+
+
+static void free_shortcut(struct fann *ann)
+{
+    free(ann->first_layer->first_neuron);
+    free(ann->first_layer);
+    free(ann->output);
+    free(ann->train_errors);
+    free(ann->weights);
+    free(ann->connections);
+    free(ann->train_slopes);
+    free(ann->prev_steps);
+    free(ann->prev_train_slopes);
+    free(ann->cascade_candidate_scores);
+    free(ann->cascade_candidate_cache);
+}
+
+
+/*
+ * Write the network in the FANN_FLO_2.1 format read by fann2header and
+ * fann_ref.
+ */
+static int save_net(struct fann *ann, const char *path)
+{
+    struct fann_layer *layer_it;
+    struct fann_neuron *neuron_it, *first_neuron = ann->first_layer->first_neuron;
+    unsigned int i;
+    FILE *f;
+
+    if ((f = fopen(path, "w")) == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    fprintf(f, "FANN_FLO_2.1\n");
+    fprintf(f, "num_layers=%u\n", (unsigned int) (ann->last_layer - ann->first_layer));
+    fprintf(f, "learning_rate=%f\n", ann->learning_rate);
+    fprintf(f, "connection_rate=%f\n", ann->connection_rate);
+    fprintf(f, "network_type=%u\n", ann->network_type);
+    fprintf(f, "learning_momentum=%f\n", ann->learning_momentum);
+    fprintf(f, "training_algorithm=%u\n", ann->training_algorithm);
+    fprintf(f, "train_error_function=%u\n", ann->train_error_function);
+    fprintf(f, "train_stop_function=%u\n", ann->train_stop_function);
+    fprintf(f, "cascade_output_change_fraction=%f\n", ann->cascade_output_change_fraction);
+    fprintf(f, "quickprop_decay=%f\n", ann->quickprop_decay);
+    fprintf(f, "quickprop_mu=%f\n", ann->quickprop_mu);
+    fprintf(f, "rprop_increase_factor=%f\n", ann->rprop_increase_factor);
+    fprintf(f, "rprop_decrease_factor=%f\n", ann->rprop_decrease_factor);
+    fprintf(f, "rprop_delta_min=%f\n", ann->rprop_delta_min);
+    fprintf(f, "rprop_delta_max=%f\n", ann->rprop_delta_max);
+    fprintf(f, "rprop_delta_zero=%f\n", ann->rprop_delta_zero);
+    fprintf(f, "cascade_output_stagnation_epochs=%u\n", ann->cascade_output_stagnation_epochs);
+    fprintf(f, "cascade_candidate_change_fraction=%f\n", ann->cascade_candidate_change_fraction);
+    fprintf(f, "cascade_candidate_stagnation_epochs=%u\n", ann->cascade_candidate_stagnation_epochs);
+    fprintf(f, "cascade_max_out_epochs=%u\n", ann->cascade_max_out_epochs);
+    fprintf(f, "cascade_min_out_epochs=%u\n", ann->cascade_min_out_epochs);
+    fprintf(f, "cascade_max_cand_epochs=%u\n", ann->cascade_max_cand_epochs);
+    fprintf(f, "cascade_min_cand_epochs=%u\n", ann->cascade_min_cand_epochs);
+    fprintf(f, "cascade_num_candidate_groups=%u\n", ann->cascade_num_candidate_groups);
+    fprintf(f, "bit_fail_limit=%.20e\n", ann->bit_fail_limit);
+    fprintf(f, "cascade_candidate_limit=%.20e\n", ann->cascade_candidate_limit);
+    fprintf(f, "cascade_weight_multiplier=%.20e\n", ann->cascade_weight_multiplier);
+
+    fprintf(f, "cascade_activation_functions_count=%u\n", ann->cascade_activation_functions_count);
+    fprintf(f, "cascade_activation_functions=");
+    for (i = 0; i < ann->cascade_activation_functions_count; i++) {
+        fprintf(f, "%u ", ann->cascade_activation_functions[i]);
+    }
+    fprintf(f, "\ncascade_activation_steepnesses_count=%u\n", ann->cascade_activation_steepnesses_count);
+    fprintf(f, "cascade_activation_steepnesses=");
+    for (i = 0; i < ann->cascade_activation_steepnesses_count; i++) {
+        fprintf(f, "%.20e ", ann->cascade_activation_steepnesses[i]);
+    }
+
+    fprintf(f, "\nlayer_sizes=");
+    for (layer_it = ann->first_layer; layer_it != ann->last_layer; layer_it++) {
+        fprintf(f, "%u ", (unsigned int) (layer_it->last_neuron - layer_it->first_neuron));
+    }
+    fprintf(f, "\nscale_included=0\n");
+
+    fprintf(f, "neurons (num_inputs, activation_function, activation_steepness)=");
+    for (layer_it = ann->first_layer; layer_it != ann->last_layer; layer_it++) {
+        for (neuron_it = layer_it->first_neuron; neuron_it != layer_it->last_neuron; neuron_it++) {
+            fprintf(f, "(%u, %u, %.20e) ", neuron_it->last_con - neuron_it->first_con,
+                    neuron_it->activation_function, neuron_it->activation_steepness);
+        }
+    }
+
+    fprintf(f, "\nconnections (connected_to_neuron, weight)=");
+    for (i = 0; i < ann->total_connections; i++) {
+        fprintf(f, "(%u, %.20e) ", (unsigned int) (ann->connections[i] - first_neuron), ann->weights[i]);
+    }
+    fprintf(f, "\n");
+
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+
+/*
+ * Train a new network on data with the given number of threads.
+ */
+static struct fann *train(const struct options *opt, struct fann_train_data *data,
+                          unsigned int threads, double *seconds)
+{
+    struct fann *ann;
+    double t_start;
+
+    if (fann_set_cascade_num_threads(threads) != 0) {
+        fprintf(stderr, "Cannot start %u threads\n", threads);
+        return NULL;
+    }
+    if (fann_set_cascade_num_shards(opt->shards) != 0) {
+        fprintf(stderr, "Cannot split the data in %u shards\n", opt->shards);
+        return NULL;
+    }
+
+    srand(opt->seed);
+    ann = create_shortcut(data->num_input, data->num_output, opt->activation, opt->steepness);
+    if (ann == NULL) {
+        return NULL;
+    }
+    fann_set_cascade_candidate_prune_epochs(ann, opt->prune_epochs);
+    fann_set_cascade_candidate_prune_fraction(ann, opt->prune_fraction);
+
+    t_start = monotonic_seconds();
+    fann_cascadetrain_on_data(ann, data, opt->max_neurons, 0, opt->desired_error);
+    *seconds = monotonic_seconds() - t_start;
+
+    return ann;
+}
+
+
+/*
+ * Compare the parts of two trained networks that end up in the .net file.
+ */
+static int same_network(struct fann *a, struct fann *b)
+{
+    unsigned int i;
+    struct fann_neuron *na = a->first_layer->first_neuron, *nb = b->first_layer->first_neuron;
+
+    if (a->total_neurons != b->total_neurons || a->total_connections != b->total_connections) {
+        return 0;
+    }
+    if (memcmp(a->weights, b->weights, a->total_connections * sizeof(fann_type)) != 0) {
+        return 0;
+    }
+    for (i = 0; i < a->total_neurons; i++) {
+        if (na[i].first_con != nb[i].first_con || na[i].last_con != nb[i].last_con ||
+            na[i].activation_function != nb[i].activation_function ||
+            na[i].activation_steepness != nb[i].activation_steepness) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+#ifdef FANN_CASCADE_SIMD
+/*
+ * Run rounds of weight updates of one algorithm with one kernel on random
+ * weights and slopes. The network is left with the final weights.
+ */
+#define CHECK_WEIGHTS 4099
+#define CHECK_ROUNDS 1000
+
+static float check_random(float lo, float hi)
+{
+    return lo + (hi - lo) * ((float) rand() / RAND_MAX);
+}
+
+static double check_kernel(struct fann *ann, enum fann_train_enum algorithm,
+                           enum fann_cascade_kernel_enum kernel)
+{
+    unsigned int i, round;
+    double seconds = 0, t_start;
+
+    fann_set_cascade_weight_kernel(kernel);
+    ann->training_algorithm = algorithm;
+    ann->sarprop_epoch = 0;
+    srand(1);
+
+    /* Every branch of the updates: zero slopes and steps, steps on the
+     * Quickprop thresholds, weights next to the bounds */
+    for (i = 0; i < ann->total_connections; i++) {
+        ann->weights[i] = i % 97 == 0 ? check_random(-1600, 1600) : check_random(-1, 1);
+        ann->prev_train_slopes[i] = i % 5 == 0 ? 0 : check_random(-1, 1);
+        switch (i % 7) {
+        case 0: ann->prev_steps[i] = 0; break;
+        case 1: ann->prev_steps[i] = 0.001f; break;
+        case 2: ann->prev_steps[i] = -0.001f; break;
+        default: ann->prev_steps[i] = check_random(-0.1f, 0.1f); break;
+        }
+    }
+
+    for (round = 0; round < CHECK_ROUNDS; round++) {
+        for (i = 0; i < ann->total_connections; i++) {
+            ann->train_slopes[i] = (i + round) % 11 == 0 ? 0 : check_random(-1, 1);
+        }
+        ann->MSE_value = check_random(0, 1);
+        ann->num_MSE = 1;
+
+        /* Unaligned first weight, and a tail shorter than a vector */
+        t_start = monotonic_seconds();
+        switch (algorithm) {
+        case FANN_TRAIN_QUICKPROP:
+            fann_cascade_simd_update_weights_quickprop(ann, 100, 3, ann->total_connections);
+            break;
+        case FANN_TRAIN_SARPROP:
+            fann_cascade_simd_update_weights_sarprop(ann, ann->sarprop_epoch++, 3, ann->total_connections);
+            break;
+        default:
+            fann_cascade_simd_update_weights_irpropm(ann, 3, ann->total_connections);
+            break;
+        }
+        seconds += monotonic_seconds() - t_start;
+    }
+
+    return seconds;
+}
+
+
+/*
+ * Check every weight update kernel against the scalar one.
+ *
+ * Returns 0 if they all give the same weights.
+ */
+static int check_weight_kernels(void)
+{
+    static const char *const algorithm_names[] = { "iRPROP-", "Quickprop", "SARPROP" };
+    static const enum fann_train_enum algorithms[] = {
+        FANN_TRAIN_RPROP, FANN_TRAIN_QUICKPROP, FANN_TRAIN_SARPROP
+    };
+    static const char *const kernel_names[] = { "scalar", "vector", "avx" };
+    enum fann_cascade_kernel_enum best = fann_get_cascade_weight_kernel();
+    size_t size = CHECK_WEIGHTS * sizeof(fann_type);
+    struct fann *ann;
+    fann_type *ref;
+    unsigned int a, k;
+    double seconds;
+    int ret = 0;
+
+    /* A single network at a time (fram_ann): keep the scalar results aside */
+    ann = create_shortcut(CHECK_WEIGHTS - 1, 1, FANN_SIGMOID, 0.5f);
+    ref = malloc(4 * size);
+    if (ann == NULL || ref == NULL) {
+        return 2;
+    }
+
+    for (a = 0; a < sizeof(algorithms) / sizeof(algorithms[0]); a++) {
+        seconds = check_kernel(ann, algorithms[a], FANN_CASCADE_KERNEL_SCALAR);
+        printf("%-10s scalar %.3f s", algorithm_names[a], seconds);
+        memcpy(ref, ann->weights, size);
+        memcpy(ref + CHECK_WEIGHTS, ann->prev_steps, size);
+        memcpy(ref + 2 * CHECK_WEIGHTS, ann->prev_train_slopes, size);
+        memcpy(ref + 3 * CHECK_WEIGHTS, ann->train_slopes, size);
+
+        for (k = FANN_CASCADE_KERNEL_VECTOR; k <= FANN_CASCADE_KERNEL_AVX; k++) {
+            if (fann_set_cascade_weight_kernel(k) != 0) {
+                continue;
+            }
+            seconds = check_kernel(ann, algorithms[a], k);
+            if (memcmp(ann->weights, ref, size) == 0 &&
+                memcmp(ann->prev_steps, ref + CHECK_WEIGHTS, size) == 0 &&
+                memcmp(ann->prev_train_slopes, ref + 2 * CHECK_WEIGHTS, size) == 0 &&
+                memcmp(ann->train_slopes, ref + 3 * CHECK_WEIGHTS, size) == 0) {
+                printf(", %s %.3f s (identical)", kernel_names[k], seconds);
+            }
+            else {
+                printf(", %s %.3f s (DIFFERENT)", kernel_names[k], seconds);
+                ret = 1;
+            }
+        }
+        printf("\n");
+    }
+
+    fann_set_cascade_weight_kernel(best);
+    free_shortcut(ann);
+    free(ref);
+
+    return ret;
+}
+#endif /* FANN_CASCADE_SIMD */
+
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [options] <data.train>\n"
+        "  -o <file>   write the trained network to <file> (.net)\n"
+        "  -t <file>   also report the MSE on the data file <file>\n"
+        "  -j <num>    threads training the candidates (default: 1)\n"
+        "  -S <num>    shards of the data for the training of the outputs (default: 1)\n"
+        "  -m <num>    maximum number of hidden neurons (default: 8)\n"
+        "  -e <mse>    desired error (default: 0)\n"
+        "  -a <num>    activation function of the outputs (default: 3, FANN_SIGMOID)\n"
+        "  -s <value>  steepness of the outputs (default: 0.5)\n"
+        "  -r <seed>   random seed (default: 1)\n"
+        "  -p <num>    drop the worst candidates every <num> candidate epochs (default: 0, never)\n"
+        "  -f <frac>   fraction of the candidates dropped each time (default: 0.5)\n"
+        "  -T          also train with one thread and check that the networks are identical\n"
+        "  -V          only check the vectorized weight updates against the scalar ones\n"
+        "              (builds with FANN_CASCADE_SIMD)\n",
+        prog);
+}
+
+
+int main(int argc, char **argv)
+{
+    struct options opt;
+    struct fann_train_data *data, *test;
+    struct fann *ann;
+    struct fann serial;
+    double seconds, serial_seconds;
+    int c, ret = 0;
+
+    memset(&opt, 0, sizeof(opt));
+    opt.threads = 1;
+    opt.shards = 1;
+    opt.max_neurons = 8;
+    opt.activation = FANN_SIGMOID;
+    opt.steepness = 0.5f;
+    opt.seed = 1;
+    opt.prune_fraction = 0.5f;
+
+    while ((c = getopt(argc, argv, "o:t:j:S:m:e:a:s:r:p:f:TVh")) != -1) {
+        switch (c) {
+        case 'o': opt.out_path = optarg; break;
+        case 't': opt.test_path = optarg; break;
+        case 'j': opt.threads = strtoul(optarg, NULL, 10); break;
+        case 'S': opt.shards = strtoul(optarg, NULL, 10); break;
+        case 'm': opt.max_neurons = strtoul(optarg, NULL, 10); break;
+        case 'e': opt.desired_error = strtof(optarg, NULL); break;
+        case 'a': opt.activation = strtoul(optarg, NULL, 10); break;
+        case 's': opt.steepness = strtof(optarg, NULL); break;
+        case 'r': opt.seed = strtoul(optarg, NULL, 10); break;
+        case 'p': opt.prune_epochs = strtoul(optarg, NULL, 10); break;
+        case 'f': opt.prune_fraction = strtof(optarg, NULL); break;
+        case 'T': opt.check = 1; break;
+        case 'V': opt.check_kernels = 1; break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (opt.check_kernels) {
+#ifdef FANN_CASCADE_SIMD
+        return check_weight_kernels();
+#else
+        fprintf(stderr, "%s: -V needs a build with FANN_CASCADE_SIMD\n", argv[0]);
+        return 2;
+#endif
+    }
+    if (argc - optind != 1 || opt.threads == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    opt.data_path = argv[optind];
+
+    if ((data = fann_read_train_from_file(opt.data_path)) == NULL) {
+        return 2;
+    }
+
+    if (opt.check) {
+        /* fram_ann holds the network being trained, keep the first one */
+        if ((ann = train(&opt, data, 1, &serial_seconds)) == NULL) {
+            return 2;
+        }
+        serial = *ann;
+        printf("1 thread: %.3f s\n", serial_seconds);
+    }
+
+    if ((ann = train(&opt, data, opt.threads, &seconds)) == NULL) {
+        return 2;
+    }
+    printf("%u thread(s): %.3f s, %u hidden neurons, %u connections\n", opt.threads, seconds,
+           ann->total_neurons - ann->num_input - 1 - ann->num_output, ann->total_connections);
+    printf("MSE on %s: %f\n", opt.data_path, fann_test_data(ann, data));
+
+    if (opt.check) {
+        if (same_network(&serial, ann)) {
+            printf("Identical to the single-thread network (%.2fx faster)\n", serial_seconds / seconds);
+        }
+        else {
+            printf("DIFFERENT from the single-thread network\n");
+            ret = 1;
+        }
+        free_shortcut(&serial);
+    }
+
+    if (opt.test_path != NULL) {
+        if ((test = fann_read_train_from_file(opt.test_path)) == NULL) {
+            return 2;
+        }
+        printf("MSE on %s: %f\n", opt.test_path, fann_test_data(ann, test));
+        fann_destroy_train(test);
+    }
+
+    if (opt.out_path != NULL && save_net(ann, opt.out_path) != 0) {
+        ret = 2;
+    }
+
+    fann_set_cascade_num_threads(1);
+    free_shortcut(ann);
+    fann_destroy_train(data);
+
+    return ret;
+}
@@ -0,0 +1,934 @@
+/*
+ * fann2header.c
+ *
+ * Convert FANN files into C headers to be compiled with the device code,
+ * in a single pass (replaces database/strip-train-data and
+ * database/strip-test-data, which take minutes on large data sets).
+ *
+ *   <example>_trained.net -> <example>_trained.h   (network)
+ *   <example>.test        -> <example>_test.h      (test data)
+ *
+ * Output formats (-f):
+ *   float      values copied verbatim, fann_type arrays (default, same
+ *              output as the bash scripts);
+ *   fixed      values scaled by 2^decimal_point and rounded, for a device
+ *              built with FIXEDFANN (fann_type = long);
+ *   packed     test data only: one uint8_t array holding every record as
+ *              little-endian IEEE-754 floats, inputs then outputs, ready to
+ *              be copied or streamed as is (-b also writes it to a raw file);
+ *   quantized  test data only: every column quantized to uint8_t (or
+ *              uint16_t with -q 16) with its own scale and offset
+ *              (value = offset + scale * q);
+ *   compressed test data only: records bit-packed, every column coded with
+ *              a dictionary of its distinct values (binary flags take one
+ *              bit) or, beyond 2^k values (-k), quantized on q bits (-q);
+ *              decoded on the device by fann_decompress_record().
+ *
+ * With -F (float and quantized formats), tables are placed in FRAM2:
+ *   - test data becomes a struct fann_far_data (fann_far_data.h), records
+ *     split in constant chunks of the ".fram2" section, so that data sets
+ *     larger than the lower FRAM (e.g. the 3600 thyroid records quantized on
+ *     16 bits) fit on the device;
+ *   - networks get their neurons and connections tables in ".fram2"; build
+ *     the device with FANN_FAR_MODEL to also keep the weights there.
+ *
+ * Build (from this directory):
+ *
+ *   cc -O2 -Wall -o fann2header fann2header.c -lm
+ *
+ * Usage examples (from the database directory):
+ *
+ *   ../host/fann2header thyroid_trained.net
+ *   ../host/fann2header -n 400 thyroid.test
+ *   ../host/fann2header -f quantized -n 400 -o thyroid_test_q.h thyroid.test
+ *   ../host/fann2header -f compressed -o thyroid_test_compressed.h thyroid.test
+ *   ../host/fann2header -F -f quantized -q 16 -o thyroid_test_far.h thyroid.test
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define DEFINE_WIDTH            36
+#define DEFAULT_DECIMAL_POINT   13
+#define FAR_CHUNK_BYTES         32768
+#define DEFAULT_DICT_BITS       10
+#define DEFAULT_QUANT_BITS      8
+#define MAX_CODE_BITS           16
+
+enum format {
+    FORMAT_FLOAT,
+    FORMAT_FIXED,
+    FORMAT_PACKED,
+    FORMAT_QUANTIZED,
+    FORMAT_COMPRESSED
+};
+
+static const char *const FORMAT_NAMES[] = { "float", "fixed", "packed", "quantized", "compressed" };
+
+struct options {
+    enum format format;
+    unsigned int decimal_point;
+    unsigned int dict_bits;
+    unsigned int quant_bits;
+    unsigned long num_data;         // 0 = all records
+    int far;                        // place tables in FRAM2
+    const char *in_path;
+    const char *out_path;
+    const char *bin_path;
+};
+
+
+static char *read_file(const char *path, size_t *size)
+{
+    FILE *f;
+    long len;
+    char *buf;
+
+    f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    buf = malloc(len + 1);
+    if (buf == NULL || fread(buf, 1, len, f) != (size_t) len) {
+        fprintf(stderr, "%s: cannot read file\n", path);
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    buf[len] = '\0';
+    fclose(f);
+
+    if (size != NULL) {
+        *size = len;
+    }
+    return buf;
+}
+
+
+/**
+ * Default output path: <in without extension><suffix>.h
+ */
+static char *default_out_path(const char *in_path, const char *suffix)
+{
+    const char *dot = strrchr(in_path, '.');
+    const char *slash = strrchr(in_path, '/');
+    size_t base_len = (dot != NULL && (slash == NULL || dot > slash)) ? (size_t) (dot - in_path) : strlen(in_path);
+    char *out = malloc(base_len + strlen(suffix) + 3);
+
+    memcpy(out, in_path, base_len);
+    sprintf(out + base_len, "%s.h", suffix);
+
+    return out;
+}
+
+
+/**
+ * Include guard from the output file name: thyroid_test.h -> __THYROID_TEST__
+ */
+static char *guard_name(const char *out_path)
+{
+    const char *base = strrchr(out_path, '/');
+    const char *dot;
+    char *guard, *g;
+
+    base = (base != NULL) ? base + 1 : out_path;
+    dot = strrchr(base, '.');
+    if (dot == NULL) {
+        dot = base + strlen(base);
+    }
+
+    guard = malloc((dot - base) + 5);
+    g = guard;
+    *g++ = '_';
+    *g++ = '_';
+    for (; base < dot; base++) {
+        *g++ = isalnum((unsigned char) *base) ? toupper((unsigned char) *base) : '_';
+    }
+    *g++ = '_';
+    *g++ = '_';
+    *g = '\0';
+
+    return guard;
+}
+
+
+static long to_fixed(double value, unsigned int decimal_point)
+{
+    return lround(value * (double) (1L << decimal_point));
+}
+
+
+/*
+ *******************************************************************************
+ * Network (.net)
+ *******************************************************************************
+ */
+
+/**
+ * Print a list of values "(a, b, c) (d, e, f) ..." as rows "{a, b, c},".
+ * In fixed format, the columns selected by fixed_mask are scaled.
+ */
+static void print_tuples(FILE *out, char *list, unsigned int fixed_mask, const struct options *opt)
+{
+    char *p = list, *end, *tok;
+    unsigned int col;
+    int first_row = 1;
+
+    while ((p = strchr(p, '(')) != NULL) {
+        p++;
+        if ((end = strchr(p, ')')) == NULL) {
+            break;
+        }
+        *end = '\0';
+
+        fprintf(out, "%s    {", first_row ? "" : ",\n");
+        first_row = 0;
+        for (col = 0, tok = strtok(p, ", "); tok != NULL; tok = strtok(NULL, ", "), col++) {
+            if (col > 0) {
+                fprintf(out, ", ");
+            }
+            if (opt->format == FORMAT_FIXED && (fixed_mask & (1 << col))) {
+                fprintf(out, "%ld", to_fixed(strtod(tok, NULL), opt->decimal_point));
+            }
+            else {
+                fprintf(out, "%s", tok);
+            }
+        }
+        fprintf(out, "}");
+        p = end + 1;
+    }
+    fprintf(out, " \n");
+}
+
+
+static void print_define_list(FILE *out, const char *name, char *list)
+{
+    char macro[64];
+    char *tok;
+    unsigned int idx = 1;
+
+    for (tok = strtok(list, " \t"); tok != NULL; tok = strtok(NULL, " \t")) {
+        snprintf(macro, sizeof(macro), "%s_%u", name, idx++);
+        fprintf(out, "#define %-*s %s\n", DEFINE_WIDTH, macro, tok);
+    }
+}
+
+
+static void print_table_decl(FILE *out, const char *name, unsigned int cols, const struct options *opt)
+{
+    if (opt->far) {
+        fprintf(out, "#pragma DATA_SECTION(%s, \".fram2\") // Place data in FRAM2\n", name);
+        fprintf(out, "static const fann_type %s[][%u] = {\n", name, cols);
+    }
+    else {
+        fprintf(out, "static fann_type %s[][%u] = {\n", name, cols);
+    }
+}
+
+
+static int convert_net(char *buf, FILE *out, const struct options *opt)
+{
+    char *line, *next, *value, *k;
+    char macro[128];
+
+    if (opt->format != FORMAT_FLOAT && opt->format != FORMAT_FIXED) {
+        fprintf(stderr, "%s: only float and fixed formats apply to networks\n", opt->in_path);
+        return -1;
+    }
+    fprintf(out, "\n");
+
+    for (line = buf; line != NULL && *line != '\0'; line = next) {
+        next = strchr(line, '\n');
+        if (next != NULL) {
+            *next++ = '\0';
+        }
+        line[strcspn(line, "\r")] = '\0';
+        if (*line == '\0') {
+            continue;
+        }
+
+        value = strchr(line, '=');
+        if (strstr(line, "FANN") == line) {
+            fprintf(out, "// %s\n\n", line);
+            if (opt->format == FORMAT_FIXED) {
+                fprintf(out, "#define %-*s %u\n", DEFINE_WIDTH, "DECIMAL_POINT", opt->decimal_point);
+            }
+            continue;
+        }
+        if (value == NULL) {
+            continue;
+        }
+        *value++ = '\0';
+
+        if (strcmp(line, "cascade_activation_functions") == 0) {
+            print_define_list(out, "CASCADE_ACTIVATION_FUNCTION", value);
+        }
+        else if (strcmp(line, "cascade_activation_steepnesses") == 0) {
+            print_define_list(out, "CASCADE_ACTIVATION_STEEPNESS", value);
+        }
+        else if (strcmp(line, "layer_sizes") == 0) {
+            print_define_list(out, "LAYER_SIZE", value);
+        }
+        else if (strncmp(line, "neurons", 7) == 0) {
+            /* (num_inputs, activation_function, activation_steepness) */
+            fprintf(out, "\n");
+            print_table_decl(out, "neurons", 3, opt);
+            print_tuples(out, value, 1 << 2, opt);
+            fprintf(out, "};\n\n");
+        }
+        else if (strncmp(line, "connections", 11) == 0) {
+            /* (connected_to_neuron, weight) */
+            print_table_decl(out, "connections", 2, opt);
+            print_tuples(out, value, 1 << 1, opt);
+            fprintf(out, "};\n\n");
+        }
+        else {
+            for (k = macro; *line != '\0' && k < macro + sizeof(macro) - 1; line++) {
+                *k++ = toupper((unsigned char) *line);
+            }
+            *k = '\0';
+            fprintf(out, "#define %-*s %s\n", DEFINE_WIDTH, macro, value);
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+ *******************************************************************************
+ * Test data (.test)
+ *******************************************************************************
+ */
+
+struct data_set {
+    unsigned long num_data;
+    unsigned int num_input;
+    unsigned int num_output;
+    char **tokens;                  // verbatim values, record after record
+    double *values;                 // same, parsed
+};
+
+
+static int parse_data(char *buf, struct data_set *ds, const struct options *opt)
+{
+    unsigned long declared, i, n, row_len;
+    char *p = buf, *end;
+
+    declared = strtoul(p, &p, 10);
+    ds->num_input = strtoul(p, &p, 10);
+    ds->num_output = strtoul(p, &p, 10);
+    if (declared == 0 || ds->num_input == 0 || ds->num_output == 0) {
+        fprintf(stderr, "%s: malformed FANN data file header\n", opt->in_path);
+        return -1;
+    }
+
+    ds->num_data = (opt->num_data != 0 && opt->num_data < declared) ? opt->num_data : declared;
+    row_len = ds->num_input + ds->num_output;
+    n = ds->num_data * row_len;
+
+    ds->tokens = malloc(n * sizeof(char *));
+    ds->values = malloc(n * sizeof(double));
+    if (ds->tokens == NULL || ds->values == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+
+    for (i = 0; i < n; i++) {
+        while (isspace((unsigned char) *p)) {
+            p++;
+        }
+        ds->tokens[i] = p;
+        ds->values[i] = strtod(p, &end);
+        if (end == p) {
+            fprintf(stderr, "%s: truncated at record %lu (header declares %lu)\n",
+                    opt->in_path, i / row_len, declared);
+            return -1;
+        }
+        p = end;
+        if (*p != '\0') {
+            *p++ = '\0';
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ * Print the rows of one table (inputs: col0 = 0, outputs: col0 = num_input).
+ */
+static void print_rows(FILE *out, const struct data_set *ds, unsigned int col0, unsigned int cols,
+                       const struct options *opt, const uint16_t *quantized)
+{
+    unsigned int row_len = ds->num_input + ds->num_output;
+    unsigned long i, k;
+    unsigned int j;
+
+    for (i = 0; i < ds->num_data; i++) {
+        fprintf(out, "    {");
+        for (j = 0; j < cols; j++) {
+            k = i * row_len + col0 + j;
+            if (j > 0) {
+                fprintf(out, ", ");
+            }
+            switch (opt->format) {
+            case FORMAT_FIXED:
+                fprintf(out, "%ld", to_fixed(ds->values[k], opt->decimal_point));
+                break;
+            case FORMAT_QUANTIZED:
+                fprintf(out, "%u", quantized[k]);
+                break;
+            default:
+                fprintf(out, "%s", ds->tokens[k]);
+                break;
+            }
+        }
+        fprintf(out, (i + 1 == ds->num_data) ? "}\n" : "},\n");
+    }
+}
+
+
+static void print_header_vars(FILE *out, const struct data_set *ds)
+{
+    fprintf(out, "%s num_data = %lu;\n", ds->num_data > 0xFFFF ? "uint32_t" : "uint16_t", ds->num_data);
+    fprintf(out, "%s num_input = %u;\n", ds->num_input > 0xFF ? "uint16_t" : "uint8_t", ds->num_input);
+    fprintf(out, "%s num_output = %u;\n", ds->num_output > 0xFF ? "uint16_t" : "uint8_t", ds->num_output);
+    fprintf(out, "\n");
+}
+
+
+static int write_packed(FILE *out, const struct data_set *ds, const struct options *opt)
+{
+    unsigned long n = ds->num_data * (ds->num_input + ds->num_output), i;
+    unsigned int b;
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    uint8_t bytes[4];
+    FILE *bin = NULL;
+
+    if (opt->bin_path != NULL && (bin = fopen(opt->bin_path, "wb")) == NULL) {
+        perror(opt->bin_path);
+        return -1;
+    }
+
+    fprintf(out, "/* Records of PACKED_RECORD_SIZE bytes: num_input then num_output\n"
+                 " * little-endian IEEE-754 floats. */\n");
+    fprintf(out, "#define PACKED_RECORD_SIZE ((%u + %u) * 4)\n\n", ds->num_input, ds->num_output);
+    fprintf(out, "#pragma PERSISTENT(packed_data) // Place data in FRAM\n");
+    fprintf(out, "uint8_t packed_data [%lu] = {", n * 4);
+
+    for (i = 0; i < n; i++) {
+        v.f = (float) ds->values[i];
+        for (b = 0; b < 4; b++) {
+            bytes[b] = (v.u >> (8 * b)) & 0xFF;
+        }
+        if (i % 4 == 0) {
+            fprintf(out, "\n   ");
+        }
+        fprintf(out, " 0x%02X, 0x%02X, 0x%02X, 0x%02X%s", bytes[0], bytes[1], bytes[2], bytes[3],
+                (i + 1 == n) ? "" : ",");
+        if (bin != NULL) {
+            fwrite(bytes, 1, 4, bin);
+        }
+    }
+    fprintf(out, "\n};\n\n");
+
+    if (bin != NULL) {
+        fclose(bin);
+    }
+    return 0;
+}
+
+
+/**
+ * Per-column affine quantization to bits bits: value = offset + scale * q.
+ */
+static uint16_t *quantize(const struct data_set *ds, unsigned int bits, float *scale, float *offset)
+{
+    unsigned int row_len = ds->num_input + ds->num_output, j;
+    unsigned long i;
+    double min, max, q, levels = (double) ((1UL << bits) - 1);
+    uint16_t *quantized = malloc(ds->num_data * row_len * sizeof(uint16_t));
+
+    if (quantized == NULL) {
+        return NULL;
+    }
+
+    for (j = 0; j < row_len; j++) {
+        min = max = ds->values[j];
+        for (i = 1; i < ds->num_data; i++) {
+            min = fmin(min, ds->values[i * row_len + j]);
+            max = fmax(max, ds->values[i * row_len + j]);
+        }
+        offset[j] = (float) min;
+        scale[j] = (max > min) ? (float) ((max - min) / levels) : 1.0f;
+
+        for (i = 0; i < ds->num_data; i++) {
+            q = round((ds->values[i * row_len + j] - offset[j]) / scale[j]);
+            quantized[i * row_len + j] = (uint16_t) fmax(0, fmin(levels, q));
+        }
+    }
+
+    return quantized;
+}
+
+
+static void print_float_array(FILE *out, const char *name, const float *values, unsigned int len)
+{
+    unsigned int j;
+
+    fprintf(out, "const float %s[%u] = {", name, len);
+    for (j = 0; j < len; j++) {
+        fprintf(out, "%s%.9e", j ? ", " : "", values[j]);
+    }
+    fprintf(out, "};\n");
+}
+
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}
+
+
+static unsigned int bits_for(unsigned long count)
+{
+    unsigned int bits = 0;
+
+    while ((1UL << bits) < count) {
+        bits++;
+    }
+    return bits;
+}
+
+
+/**
+ * Find value in the sorted dictionary dict[0 .. len - 1].
+ */
+static unsigned long dict_find(const double *dict, unsigned long len, double value)
+{
+    unsigned long lo = 0, hi = len - 1, mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (dict[mid] < value) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+
+static void put_bits(uint8_t *buf, unsigned long pos, unsigned long code, unsigned int bits)
+{
+    unsigned int b;
+
+    for (b = 0; b < bits; b++, pos++) {
+        if (code & (1UL << b)) {
+            buf[pos >> 3] |= 1 << (pos & 7);
+        }
+    }
+}
+
+
+/**
+ * Column-wise compression, see fann/inc/fann_compressed_data.h.
+ */
+static int write_compressed(FILE *out, const struct data_set *ds, const struct options *opt)
+{
+    unsigned int row_len = ds->num_input + ds->num_output, j, record_bits = 0;
+    unsigned long i, k, n, dict_len = 0, num_bytes, code, pos;
+    unsigned long *dict_start = calloc(row_len, sizeof(unsigned long));
+    unsigned long *dict_size = calloc(row_len, sizeof(unsigned long));
+    unsigned int *bits = calloc(row_len, sizeof(unsigned int));
+    double *scale = calloc(row_len, sizeof(double));
+    double *offset = calloc(row_len, sizeof(double));
+    double *column = malloc(ds->num_data * sizeof(double));
+    double *dict = malloc(ds->num_data * row_len * sizeof(double));
+    uint8_t *records = NULL;
+    int ret = -1;
+
+    if (!dict_start || !dict_size || !bits || !scale || !offset || !column || !dict) {
+        fprintf(stderr, "Out of memory\n");
+        goto cleanup;
+    }
+
+    /* Choose the coding of every column. */
+    for (j = 0; j < row_len; j++) {
+        for (i = 0; i < ds->num_data; i++) {
+            column[i] = ds->values[i * row_len + j];
+        }
+        qsort(column, ds->num_data, sizeof(double), compare_double);
+        for (n = 1, i = 1; i < ds->num_data; i++) {
+            if (column[i] != column[n - 1]) {
+                column[n++] = column[i];
+            }
+        }
+
+        if (n <= (1UL << opt->dict_bits)) {
+            dict_start[j] = dict_len;
+            dict_size[j] = n;
+            bits[j] = bits_for(n);
+            memcpy(dict + dict_len, column, n * sizeof(double));
+            dict_len += n;
+        }
+        else {
+            bits[j] = opt->quant_bits;
+            offset[j] = column[0];
+            scale[j] = (column[n - 1] - column[0]) / ((1UL << opt->quant_bits) - 1);
+        }
+        record_bits += bits[j];
+    }
+
+    /* Pack the records (2 padding bytes for the decoder). */
+    num_bytes = (ds->num_data * record_bits + 7) / 8 + 2;
+    records = calloc(num_bytes, 1);
+    if (records == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        goto cleanup;
+    }
+    for (pos = 0, i = 0; i < ds->num_data; i++) {
+        for (j = 0; j < row_len; j++) {
+            k = i * row_len + j;
+            if (dict_size[j] > 0) {
+                code = dict_find(dict + dict_start[j], dict_size[j], ds->values[k]);
+            }
+            else {
+                code = lround((ds->values[k] - offset[j]) / scale[j]);
+            }
+            put_bits(records, pos, code, bits[j]);
+            pos += bits[j];
+        }
+    }
+
+    fprintf(out, "#include \"fann.h\"\n\n");
+    fprintf(out, "/* Compressed records: %u bits each (uncompressed: %lu bytes) */\n",
+            record_bits, (unsigned long) row_len * 4);
+    fprintf(out, "#define %-*s %u\n", DEFINE_WIDTH, "COMPRESSED_NUM_INPUT", ds->num_input);
+    fprintf(out, "#define %-*s %u\n\n", DEFINE_WIDTH, "COMPRESSED_NUM_OUTPUT", ds->num_output);
+
+    fprintf(out, "const fann_type compressed_dict[%lu] = {", dict_len > 0 ? dict_len : 1);
+    for (k = 0, j = 0; j < row_len; j++) {
+        if (dict_size[j] == 0) {
+            continue;
+        }
+        fprintf(out, "%s\n    /* column %u */", k ? "," : "", j);
+        for (i = 0; i < dict_size[j]; i++, k++) {
+            fprintf(out, "%s%s%.9g", i ? "," : "", (i % 8 == 0) ? "\n    " : " ", dict[dict_start[j] + i]);
+        }
+    }
+    fprintf(out, "%s\n};\n\n", dict_len > 0 ? "" : "\n    0");
+
+    fprintf(out, "const struct fann_compressed_column compressed_columns[%u] = {\n", row_len);
+    for (j = 0; j < row_len; j++) {
+        if (dict_size[j] > 0) {
+            fprintf(out, "    {%u, FANN_COLUMN_DICTIONARY, %lu, 0, 0}", bits[j], dict_start[j]);
+        }
+        else {
+            fprintf(out, "    {%u, FANN_COLUMN_QUANTIZED, 0, %.9g, %.9g}", bits[j], scale[j], offset[j]);
+        }
+        fprintf(out, "%s /* %s %u */\n", (j + 1 == row_len) ? "" : ",",
+                j < ds->num_input ? "input" : "output", j < ds->num_input ? j : j - ds->num_input);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const uint8_t compressed_records[%lu] = {", num_bytes);
+    for (k = 0; k < num_bytes; k++) {
+        fprintf(out, "%s0x%02X%s", (k % 16 == 0) ? "\n    " : " ", records[k], (k + 1 == num_bytes) ? "" : ",");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const struct fann_compressed_data compressed_data = {\n");
+    fprintf(out, "    %lu, %u, %u, %u,\n", ds->num_data, ds->num_input, ds->num_output, record_bits);
+    fprintf(out, "    compressed_columns, compressed_dict, compressed_records\n};\n\n");
+
+    fprintf(stderr, "%lu records: %lu bytes compressed (%u bits per record, %lu dictionary entries), "
+            "%lu bytes as floats\n", ds->num_data,
+            num_bytes + dict_len * 4 + row_len * 12, record_bits, dict_len,
+            ds->num_data * row_len * 4);
+    ret = 0;
+
+cleanup:
+    free(dict_start);
+    free(dict_size);
+    free(bits);
+    free(scale);
+    free(offset);
+    free(column);
+    free(dict);
+    free(records);
+    return ret;
+}
+
+
+/**
+ * Far data set (-F): records in constant chunks of the ".fram2" section,
+ * described by a struct fann_far_data.
+ */
+static int write_far(FILE *out, const struct data_set *ds, const struct options *opt,
+                     const uint16_t *quantized, const float *scale, const float *offset)
+{
+    unsigned int row_len = ds->num_input + ds->num_output;
+    unsigned int value_size = (quantized == NULL) ? 4 : (opt->quant_bits > 8) ? 2 : 1;
+    const char *type = (quantized == NULL) ? "float" : (value_size == 2) ? "uint16_t" : "uint8_t";
+    unsigned long per_chunk = FAR_CHUNK_BYTES / (row_len * value_size);
+    unsigned long num_chunks, c, i, first, last, k;
+    unsigned int j;
+
+    if (per_chunk == 0) {
+        fprintf(stderr, "%s: records larger than %u bytes\n", opt->in_path, FAR_CHUNK_BYTES);
+        return -1;
+    }
+    num_chunks = (ds->num_data + per_chunk - 1) / per_chunk;
+
+    fprintf(out, "#include \"fann.h\"\n\n");
+    fprintf(out, "/* Far data set: %lu records of %u bytes, %lu bytes in FRAM2 */\n",
+            ds->num_data, row_len * value_size, ds->num_data * row_len * value_size);
+    fprintf(out, "#define %-*s %u\n", DEFINE_WIDTH, "FAR_NUM_INPUT", ds->num_input);
+    fprintf(out, "#define %-*s %u\n\n", DEFINE_WIDTH, "FAR_NUM_OUTPUT", ds->num_output);
+
+    if (quantized != NULL) {
+        print_float_array(out, "far_scale", scale, row_len);
+        print_float_array(out, "far_offset", offset, row_len);
+        fprintf(out, "\n");
+    }
+
+    for (c = 0; c < num_chunks; c++) {
+        first = c * per_chunk;
+        last = (first + per_chunk < ds->num_data) ? first + per_chunk : ds->num_data;
+
+        fprintf(out, "#pragma DATA_SECTION(far_chunk_%lu, \".fram2\") // Place data in FRAM2\n", c);
+        fprintf(out, "const %s far_chunk_%lu [%lu] = {\n", type, c, (last - first) * row_len);
+        for (i = first; i < last; i++) {
+            fprintf(out, "   ");
+            for (j = 0; j < row_len; j++) {
+                k = i * row_len + j;
+                if (quantized != NULL) {
+                    fprintf(out, " %u", quantized[k]);
+                }
+                else {
+                    fprintf(out, " %s", ds->tokens[k]);
+                }
+                if (i + 1 != last || j + 1 != row_len) {
+                    fprintf(out, ",");
+                }
+            }
+            fprintf(out, "\n");
+        }
+        fprintf(out, "};\n\n");
+    }
+
+    fprintf(out, "const void *const far_chunks[%lu] = {", num_chunks);
+    for (c = 0; c < num_chunks; c++) {
+        fprintf(out, "%sfar_chunk_%lu%s", (c % 8 == 0) ? "\n    " : " ", c, (c + 1 == num_chunks) ? "" : ",");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const struct fann_far_data far_data = {\n");
+    fprintf(out, "    %lu, %u, %u, %u, %lu,\n", ds->num_data, ds->num_input, ds->num_output, value_size, per_chunk);
+    fprintf(out, "    far_chunks, %s\n};\n\n", (quantized != NULL) ? "far_scale, far_offset" : "NULL, NULL");
+
+    fprintf(stderr, "%lu records: %lu bytes in %lu chunks of %lu records\n", ds->num_data,
+            ds->num_data * row_len * value_size, num_chunks, per_chunk);
+    return 0;
+}
+
+
+static int convert_test(char *buf, FILE *out, const struct options *opt)
+{
+    struct data_set ds;
+    const char *type = (opt->format != FORMAT_QUANTIZED) ? "fann_type" :
+                       (opt->quant_bits > 8) ? "uint16_t" : "uint8_t";
+    const char *suffix = (opt->format == FORMAT_QUANTIZED) ? "_q" : "";
+    uint16_t *quantized = NULL;
+    float *scale = NULL, *offset = NULL;
+    int ret = -1;
+
+    memset(&ds, 0, sizeof(ds));
+    if (opt->far && opt->format != FORMAT_FLOAT && opt->format != FORMAT_QUANTIZED) {
+        fprintf(stderr, "%s: only float and quantized test data can be placed in FRAM2\n", opt->in_path);
+        goto cleanup;
+    }
+    if (parse_data(buf, &ds, opt) != 0) {
+        goto cleanup;
+    }
+
+    fprintf(out, "#include <stdint.h>\n\n\n");
+    print_header_vars(out, &ds);
+
+    if (opt->format == FORMAT_PACKED) {
+        ret = write_packed(out, &ds, opt);
+        goto cleanup;
+    }
+    if (opt->format == FORMAT_COMPRESSED) {
+        ret = write_compressed(out, &ds, opt);
+        goto cleanup;
+    }
+
+    if (opt->format == FORMAT_QUANTIZED) {
+        scale = malloc((ds.num_input + ds.num_output) * sizeof(float));
+        offset = malloc((ds.num_input + ds.num_output) * sizeof(float));
+        if (scale == NULL || offset == NULL ||
+                (quantized = quantize(&ds, opt->quant_bits, scale, offset)) == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            goto cleanup;
+        }
+    }
+    if (opt->far) {
+        ret = write_far(out, &ds, opt, quantized, scale, offset);
+        goto cleanup;
+    }
+
+    if (opt->format == FORMAT_FIXED) {
+        fprintf(out, "#define %-*s %u\n\n", DEFINE_WIDTH, "TEST_DECIMAL_POINT", opt->decimal_point);
+    }
+    else if (opt->format == FORMAT_QUANTIZED) {
+        fprintf(out, "/* Quantized columns: value = offset[j] + scale[j] * q[j] */\n");
+        fprintf(out, "#define DEQUANTIZE(q, scale, offset) ((offset) + (scale) * (fann_type) (q))\n\n");
+        print_float_array(out, "input_scale", scale, ds.num_input);
+        print_float_array(out, "input_offset", offset, ds.num_input);
+        print_float_array(out, "output_scale", scale + ds.num_input, ds.num_output);
+        print_float_array(out, "output_offset", offset + ds.num_input, ds.num_output);
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "#pragma PERSISTENT(input%s) // Place data in FRAM\n", suffix);
+    fprintf(out, "%s input%s [%lu][%u] = {\n", type, suffix, ds.num_data, ds.num_input);
+    print_rows(out, &ds, 0, ds.num_input, opt, quantized);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "#pragma PERSISTENT(output%s) // Place data in FRAM\n", suffix);
+    fprintf(out, "%s output%s [%lu][%u] = {\n", type, suffix, ds.num_data, ds.num_output);
+    print_rows(out, &ds, ds.num_input, ds.num_output, opt, quantized);
+    fprintf(out, "};\n\n");
+
+    ret = 0;
+
+cleanup:
+    free(ds.tokens);
+    free(ds.values);
+    free(quantized);
+    free(scale);
+    free(offset);
+    return ret;
+}
+
+
+/*
+ *******************************************************************************
+ * main
+ *******************************************************************************
+ */
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [options] <file.net|file.test>\n"
+        "  -f <format>  float (default), fixed, packed (test data only), quantized (test data only)\n"
+        "  -p <dp>      decimal point of the fixed format (default: %d)\n"
+        "  -n <num>     number of test records to convert (default: all)\n"
+        "  -o <file>    output header (default: <file>.h for networks, <file>_test.h for test data)\n"
+        "  -b <file>    packed format: also write the raw records to <file>\n"
+        "  -k <bits>    compressed format: largest dictionary code, in bits (default: %d)\n"
+        "  -q <bits>    compressed and quantized formats: code of the quantized columns, in bits (default: %d)\n"
+        "  -F           place the tables in FRAM2 (float and quantized test data, networks)\n",
+        prog, DEFAULT_DECIMAL_POINT, DEFAULT_DICT_BITS, DEFAULT_QUANT_BITS);
+}
+
+
+int main(int argc, char **argv)
+{
+    struct options opt;
+    char *buf, *out_path, *guard;
+    FILE *out;
+    int is_net, c, ret;
+    unsigned int f;
+
+    memset(&opt, 0, sizeof(opt));
+    opt.decimal_point = DEFAULT_DECIMAL_POINT;
+    opt.dict_bits = DEFAULT_DICT_BITS;
+    opt.quant_bits = DEFAULT_QUANT_BITS;
+
+    while ((c = getopt(argc, argv, "f:p:n:o:b:k:q:Fh")) != -1) {
+        switch (c) {
+        case 'f':
+            for (f = 0; f < sizeof(FORMAT_NAMES) / sizeof(FORMAT_NAMES[0]); f++) {
+                if (strcmp(optarg, FORMAT_NAMES[f]) == 0) {
+                    break;
+                }
+            }
+            if (f == sizeof(FORMAT_NAMES) / sizeof(FORMAT_NAMES[0])) {
+                fprintf(stderr, "Unknown format '%s'\n", optarg);
+                return 2;
+            }
+            opt.format = (enum format) f;
+            break;
+        case 'p': opt.decimal_point = strtoul(optarg, NULL, 10); break;
+        case 'k': opt.dict_bits = strtoul(optarg, NULL, 10); break;
+        case 'q': opt.quant_bits = strtoul(optarg, NULL, 10); break;
+        case 'n': opt.num_data = strtoul(optarg, NULL, 10); break;
+        case 'o': opt.out_path = optarg; break;
+        case 'b': opt.bin_path = optarg; break;
+        case 'F': opt.far = 1; break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (argc - optind != 1 || opt.decimal_point > 30 ||
+            opt.dict_bits > MAX_CODE_BITS || opt.quant_bits == 0 || opt.quant_bits > MAX_CODE_BITS) {
+        usage(argv[0]);
+        return 2;
+    }
+    opt.in_path = argv[optind];
+
+    if ((buf = read_file(opt.in_path, NULL)) == NULL) {
+        return 1;
+    }
+    is_net = strncmp(buf, "FANN_", 5) == 0;
+
+    out_path = (opt.out_path != NULL) ? strdup(opt.out_path) : default_out_path(opt.in_path, is_net ? "" : "_test");
+    out = fopen(out_path, "w");
+    if (out == NULL) {
+        perror(out_path);
+        return 1;
+    }
+
+    guard = guard_name(out_path);
+    fprintf(out, "#ifndef %s\n#define %s\n\n", guard, guard);
+
+    ret = is_net ? convert_net(buf, out, &opt) : convert_test(buf, out, &opt);
+
+    fprintf(out, "\n#endif // %s\n", guard);
+    fclose(out);
+
+    if (ret != 0) {
+        remove(out_path);
+    }
+
+    free(guard);
+    free(out_path);
+    free(buf);
+
+    return ret == 0 ? 0 : 1;
+}
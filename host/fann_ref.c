@@ -0,0 +1,448 @@
+/*
+ * fann_ref.c
+ *
+ * Host-side reference implementation of the FANN forward pass.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fann_ref.h"
+
+
+static char *read_file(const char *path)
+{
+    FILE *f;
+    long size;
+    char *buf;
+
+    f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    buf = malloc(size + 1);
+    if (buf == NULL || fread(buf, 1, size, f) != (size_t) size) {
+        fprintf(stderr, "%s: cannot read file\n", path);
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    buf[size] = '\0';
+    fclose(f);
+
+    return buf;
+}
+
+
+static int ends_with(const char *s, const char *suffix)
+{
+    size_t ls = strlen(s), lx = strlen(suffix);
+
+    return ls >= lx && strcmp(s + ls - lx, suffix) == 0;
+}
+
+
+/**
+ * Allocate the per-neuron and per-connection arrays, once the layer sizes
+ * and the number of connections are known.
+ */
+static int ref_net_allocate(struct ref_net *net)
+{
+    net->num_inputs = calloc(net->total_neurons, sizeof(unsigned int));
+    net->activation = calloc(net->total_neurons, sizeof(unsigned int));
+    net->steepness = calloc(net->total_neurons, sizeof(fann_type));
+    net->first_con = calloc(net->total_neurons, sizeof(unsigned int));
+    net->values = calloc(net->total_neurons, sizeof(fann_type));
+    net->connected_to = calloc(net->total_connections + 1, sizeof(unsigned int));
+    net->weights = calloc(net->total_connections + 1, sizeof(fann_type));
+    net->output = calloc(net->num_output + 1, sizeof(fann_type));
+
+    return (net->num_inputs && net->activation && net->steepness && net->first_con &&
+            net->values && net->connected_to && net->weights && net->output) ? 0 : -1;
+}
+
+
+/**
+ * Derive num_input, num_output and total_neurons from the layer sizes,
+ * as fann_create_msp430() does.
+ */
+static void ref_net_set_sizes(struct ref_net *net)
+{
+    unsigned int i;
+
+    net->total_neurons = 0;
+    for (i = 0; i < net->num_layers; i++) {
+        net->total_neurons += net->layer_sizes[i];
+    }
+    net->num_input = net->layer_sizes[0] - 1;
+    net->num_output = net->layer_sizes[net->num_layers - 1];
+    if (net->network_type == FANN_NETTYPE_LAYER) {
+        // One too many (bias) in the output layer
+        net->num_output--;
+    }
+}
+
+
+static int ref_net_load_net(struct ref_net *net, char *buf, const char *path)
+{
+    char *p, *q;
+    unsigned int i, n, con;
+
+    if ((p = strstr(buf, "\nnum_layers=")) == NULL) {
+        goto parse_error;
+    }
+    net->num_layers = strtoul(p + 12, NULL, 10);
+    if ((p = strstr(buf, "\nnetwork_type=")) != NULL) {
+        net->network_type = strtoul(p + 14, NULL, 10);
+    }
+    net->connection_rate = 1;
+    if ((p = strstr(buf, "\nconnection_rate=")) != NULL) {
+        net->connection_rate = strtof(p + 17, NULL);
+    }
+
+    if (net->num_layers < 2 || (p = strstr(buf, "\nlayer_sizes=")) == NULL) {
+        goto parse_error;
+    }
+    p += 13;
+    net->layer_sizes = calloc(net->num_layers, sizeof(unsigned int));
+    if (net->layer_sizes == NULL) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        return -1;
+    }
+    for (i = 0; i < net->num_layers; i++) {
+        net->layer_sizes[i] = strtoul(p, &p, 10);
+    }
+    ref_net_set_sizes(net);
+
+    /* Count connections first. */
+    if ((p = strstr(buf, "\nneurons (")) == NULL || (p = strchr(p, '=')) == NULL) {
+        goto parse_error;
+    }
+    net->total_connections = 0;
+    for (q = p, i = 0; i < net->total_neurons; i++) {
+        if ((q = strchr(q, '(')) == NULL) {
+            goto parse_error;
+        }
+        net->total_connections += strtoul(q + 1, &q, 10);
+    }
+    if (ref_net_allocate(net) != 0) {
+        return -1;
+    }
+
+    for (con = 0, i = 0; i < net->total_neurons; i++) {
+        p = strchr(p, '(') + 1;
+        n = strtoul(p, &p, 10);
+        net->activation[i] = strtoul(p + 1, &p, 10);
+        net->steepness[i] = strtof(p + 1, &p);
+        net->num_inputs[i] = n;
+        net->first_con[i] = con;
+        con += n;
+    }
+
+    if ((p = strstr(buf, "\nconnections (")) == NULL || (p = strchr(p, '=')) == NULL) {
+        goto parse_error;
+    }
+    for (i = 0; i < net->total_connections; i++) {
+        if ((p = strchr(p, '(')) == NULL) {
+            goto parse_error;
+        }
+        net->connected_to[i] = strtoul(p + 1, &p, 10);
+        net->weights[i] = strtof(p + 1, &p);
+    }
+
+    return 0;
+
+parse_error:
+    fprintf(stderr, "%s: malformed FANN configuration file\n", path);
+    return -1;
+}
+
+
+/**
+ * Find the row "{" following the array declaration "name[]".
+ */
+static char *find_array(char *buf, const char *name)
+{
+    char *p = strstr(buf, name);
+
+    if (p == NULL || (p = strchr(p, '=')) == NULL || (p = strchr(p, '{')) == NULL) {
+        return NULL;
+    }
+    return p + 1;
+}
+
+
+static unsigned int count_rows(char *p)
+{
+    unsigned int rows = 0;
+    char *end = strstr(p, "};");
+
+    while ((p = strchr(p, '{')) != NULL && (end == NULL || p < end)) {
+        rows++;
+        p++;
+    }
+    return rows;
+}
+
+
+static int ref_net_load_header(struct ref_net *net, char *buf, const char *path)
+{
+    char *p, *neurons, *connections, name[32];
+    unsigned int i, con;
+
+    if ((p = strstr(buf, "#define NUM_LAYERS")) == NULL) {
+        goto parse_error;
+    }
+    net->num_layers = strtoul(p + 18, NULL, 10);
+    if ((p = strstr(buf, "#define NETWORK_TYPE")) != NULL) {
+        net->network_type = strtoul(p + 20, NULL, 10);
+    }
+    net->connection_rate = 1;
+    if ((p = strstr(buf, "#define CONNECTION_RATE")) != NULL) {
+        net->connection_rate = strtof(p + 23, NULL);
+    }
+    if (net->num_layers < 2) {
+        goto parse_error;
+    }
+
+    net->layer_sizes = calloc(net->num_layers, sizeof(unsigned int));
+    if (net->layer_sizes == NULL) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        return -1;
+    }
+    for (i = 0; i < net->num_layers; i++) {
+        sprintf(name, "#define LAYER_SIZE_%u ", i + 1);
+        if ((p = strstr(buf, name)) == NULL) {
+            goto parse_error;
+        }
+        net->layer_sizes[i] = strtoul(p + strlen(name), NULL, 10);
+    }
+    ref_net_set_sizes(net);
+
+    neurons = find_array(buf, "neurons[]");
+    connections = find_array(buf, "connections[]");
+    if (neurons == NULL || connections == NULL) {
+        goto parse_error;
+    }
+    if (count_rows(neurons) != net->total_neurons) {
+        fprintf(stderr, "%s: %u neurons listed, layer sizes add up to %u\n",
+                path, count_rows(neurons), net->total_neurons);
+        return -1;
+    }
+    net->total_connections = count_rows(connections);
+    if (ref_net_allocate(net) != 0) {
+        return -1;
+    }
+
+    for (con = 0, p = neurons, i = 0; i < net->total_neurons; i++) {
+        p = strchr(p, '{') + 1;
+        net->num_inputs[i] = (unsigned int) strtof(p, &p);
+        net->activation[i] = (unsigned int) strtof(p + 1, &p);
+        net->steepness[i] = strtof(p + 1, &p);
+        net->first_con[i] = con;
+        con += net->num_inputs[i];
+    }
+    if (con != net->total_connections) {
+        fprintf(stderr, "%s: neurons expect %u connections, %u listed\n",
+                path, con, net->total_connections);
+        return -1;
+    }
+
+    for (p = connections, i = 0; i < net->total_connections; i++) {
+        p = strchr(p, '{') + 1;
+        net->connected_to[i] = (unsigned int) strtof(p, &p);
+        net->weights[i] = strtof(p + 1, &p);
+    }
+
+    return 0;
+
+parse_error:
+    fprintf(stderr, "%s: malformed network header\n", path);
+    return -1;
+}
+
+
+int ref_net_load(struct ref_net *net, const char *path)
+{
+    char *buf;
+    int ret;
+
+    memset(net, 0, sizeof(*net));
+
+    if ((buf = read_file(path)) == NULL) {
+        return -1;
+    }
+
+    if (ends_with(path, ".h")) {
+        ret = ref_net_load_header(net, buf, path);
+    }
+    else {
+        ret = ref_net_load_net(net, buf, path);
+    }
+    free(buf);
+
+    if (ret != 0) {
+        ref_net_free(net);
+    }
+    return ret;
+}
+
+
+fann_type *ref_net_run(struct ref_net *net, const fann_type *input)
+{
+    unsigned int layer, first, last, n, i, num_connections, out;
+    const unsigned int *con;
+    const fann_type *weights;
+    fann_type neuron_sum, max_sum, steepness, *values = net->values;
+
+    /* first set the input, then the bias neuron in the input layer */
+    for (i = 0; i != net->num_input; i++) {
+        values[i] = input[i];
+    }
+    values[net->num_input] = 1;
+
+    first = net->layer_sizes[0];
+    for (layer = 1; layer < net->num_layers; layer++) {
+        last = first + net->layer_sizes[layer];
+        for (n = first; n != last; n++) {
+            if (net->num_inputs[n] == 0) {
+                /* bias neurons */
+                values[n] = 1;
+                continue;
+            }
+
+            steepness = net->steepness[n];
+            num_connections = net->num_inputs[n];
+            weights = net->weights + net->first_con[n];
+            con = net->connected_to + net->first_con[n];
+
+            /* same summation order as the unrolled loop of fann_run() */
+            neuron_sum = 0;
+            i = num_connections & 3;
+            switch (i) {
+            case 3:
+                neuron_sum += fann_mult(weights[2], values[con[2]]);
+            case 2:
+                neuron_sum += fann_mult(weights[1], values[con[1]]);
+            case 1:
+                neuron_sum += fann_mult(weights[0], values[con[0]]);
+            case 0:
+                break;
+            }
+
+            for (; i != num_connections; i += 4) {
+                neuron_sum +=
+                    fann_mult(weights[i], values[con[i]]) +
+                    fann_mult(weights[i + 1], values[con[i + 1]]) +
+                    fann_mult(weights[i + 2], values[con[i + 2]]) +
+                    fann_mult(weights[i + 3], values[con[i + 3]]);
+            }
+
+            neuron_sum = fann_mult(steepness, neuron_sum);
+
+            max_sum = 150/steepness;
+            if (neuron_sum > max_sum)
+                neuron_sum = max_sum;
+            else if (neuron_sum < -max_sum)
+                neuron_sum = -max_sum;
+
+            fann_activation_switch(net->activation[n], neuron_sum, values[n]);
+        }
+        first = last;
+    }
+
+    out = net->total_neurons - net->layer_sizes[net->num_layers - 1];
+    for (i = 0; i != net->num_output; i++) {
+        net->output[i] = values[out + i];
+    }
+
+    return net->output;
+}
+
+
+void ref_net_free(struct ref_net *net)
+{
+    free(net->layer_sizes);
+    free(net->num_inputs);
+    free(net->activation);
+    free(net->steepness);
+    free(net->first_con);
+    free(net->connected_to);
+    free(net->weights);
+    free(net->values);
+    free(net->output);
+    memset(net, 0, sizeof(*net));
+}
+
+
+int ref_data_load(struct ref_data *data, const char *path, unsigned int max_data)
+{
+    FILE *f;
+    unsigned int i, j;
+    float v;
+
+    memset(data, 0, sizeof(*data));
+
+    f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    if (fscanf(f, "%u %u %u", &data->num_data, &data->num_input, &data->num_output) != 3) {
+        fprintf(stderr, "%s: malformed FANN data file header\n", path);
+        fclose(f);
+        return -1;
+    }
+    if (max_data != 0 && max_data < data->num_data) {
+        data->num_data = max_data;
+    }
+
+    data->input = malloc((size_t) data->num_data * data->num_input * sizeof(fann_type));
+    data->output = malloc((size_t) data->num_data * data->num_output * sizeof(fann_type));
+    if (data->input == NULL || data->output == NULL) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        fclose(f);
+        ref_data_free(data);
+        return -1;
+    }
+
+    for (i = 0; i < data->num_data; i++) {
+        for (j = 0; j < data->num_input; j++) {
+            if (fscanf(f, "%f", &v) != 1) {
+                goto read_error;
+            }
+            data->input[i * data->num_input + j] = v;
+        }
+        for (j = 0; j < data->num_output; j++) {
+            if (fscanf(f, "%f", &v) != 1) {
+                goto read_error;
+            }
+            data->output[i * data->num_output + j] = v;
+        }
+    }
+    fclose(f);
+
+    return 0;
+
+read_error:
+    fprintf(stderr, "%s: truncated at record %u\n", path, i);
+    fclose(f);
+    ref_data_free(data);
+    return -1;
+}
+
+
+void ref_data_free(struct ref_data *data)
+{
+    free(data->input);
+    free(data->output);
+    memset(data, 0, sizeof(*data));
+}
@@ -0,0 +1,84 @@
+/*
+ * fann_ref.h
+ *
+ * Host-side reference implementation of the FANN forward pass, used to
+ * validate the results computed on the device.
+ *
+ * The network is loaded either from a FANN configuration file (.net) or
+ * from the header generated out of it (database/<example>_trained.h), so
+ * that the host can run exactly the network flashed on the device. The
+ * forward pass follows fann_run() operation by operation (same summation
+ * order, same clipping, same activation macros): with a float build the
+ * outputs only differ from the device by the rounding of the math library
+ * functions used by the activation (exp, sin, ...).
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#ifndef FANN_REF_H_
+#define FANN_REF_H_
+
+#include "fann.h"
+
+/**
+ * Reference network, flattened: neuron i owns connections
+ * [first_con[i], first_con[i] + num_inputs[i]).
+ */
+struct ref_net {
+    unsigned int num_layers;
+    unsigned int network_type;
+    float connection_rate;
+    unsigned int num_input;
+    unsigned int num_output;
+    unsigned int total_neurons;
+    unsigned int total_connections;
+    unsigned int *layer_sizes;      // including bias neurons
+    unsigned int *num_inputs;       // per neuron
+    unsigned int *activation;       // per neuron
+    fann_type *steepness;           // per neuron
+    unsigned int *first_con;        // per neuron
+    unsigned int *connected_to;     // per connection
+    fann_type *weights;             // per connection
+    fann_type *values;              // per neuron, scratch
+    fann_type *output;              // num_output, scratch
+};
+
+/**
+ * Test data set, stored row-major.
+ */
+struct ref_data {
+    unsigned int num_data;
+    unsigned int num_input;
+    unsigned int num_output;
+    fann_type *input;               // num_data * num_input
+    fann_type *output;              // num_data * num_output
+};
+
+/**
+ * Load a network from a .net file or from a generated *_trained.h header
+ * (selected by the file extension).
+ *
+ * @return 0 on success, -1 on failure (a message is printed on stderr).
+ */
+int ref_net_load(struct ref_net *net, const char *path);
+
+/**
+ * Run the network on one input record.
+ *
+ * @return pointer to net->output (num_output values).
+ */
+fann_type *ref_net_run(struct ref_net *net, const fann_type *input);
+
+void ref_net_free(struct ref_net *net);
+
+/**
+ * Load a FANN data file (.test / .train). If max_data is non-zero, at most
+ * max_data records are loaded.
+ *
+ * @return 0 on success, -1 on failure (a message is printed on stderr).
+ */
+int ref_data_load(struct ref_data *data, const char *path, unsigned int max_data);
+
+void ref_data_free(struct ref_data *data);
+
+#endif /* FANN_REF_H_ */
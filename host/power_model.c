@@ -0,0 +1,106 @@
+/*
+ * power_model.c
+ *
+ * Host stand-in for the power supply of the board (see power_model.h). The
+ * capacitor voltage changes linearly, by (harvest - load) / C per second.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#include <stddef.h>
+
+#include "power_model.h"
+
+static struct power_model *monitored;
+static double monitored_load;
+static double (*monitored_clock)(void);
+static double monitored_time;
+
+
+void power_model_init(struct power_model *pm, double capacitance, double harvest_current,
+                      double v_on, double v_warn, double v_off)
+{
+    pm->capacitance = capacitance;
+    pm->harvest_current = harvest_current;
+    pm->v_on = v_on;
+    pm->v_warn = v_warn;
+    pm->v_off = v_off;
+    pm->voltage = v_on;
+    pm->on = 1;
+}
+
+
+double power_model_run(struct power_model *pm, double seconds, double load_current)
+{
+    double slope = (pm->harvest_current - load_current) / pm->capacitance;
+    double left;
+
+    if (!pm->on) {
+        return 0;
+    }
+    if (slope < 0) {
+        left = (pm->v_off - pm->voltage) / slope;
+        if (left <= seconds) {
+            pm->voltage = pm->v_off;
+            pm->on = 0;
+            return left;
+        }
+    }
+    pm->voltage += slope * seconds;
+    if (pm->voltage > pm->v_on) {
+        pm->voltage = pm->v_on;
+    }
+    return seconds;
+}
+
+
+double power_model_charge(struct power_model *pm)
+{
+    double seconds = 0;
+
+    if (!pm->on) {
+        /* No harvest, no restart */
+        if (pm->harvest_current <= 0) {
+            return -1;
+        }
+        seconds = (pm->v_on - pm->voltage) * pm->capacitance / pm->harvest_current;
+        pm->voltage = pm->v_on;
+        pm->on = 1;
+    }
+    return seconds;
+}
+
+
+int power_model_low(const struct power_model *pm)
+{
+    return !pm->on || pm->voltage < pm->v_warn;
+}
+
+
+static uint8_t power_model_monitor_low(void)
+{
+    double now;
+
+    if (monitored == NULL) {
+        return 0;
+    }
+    now = monitored_clock();
+    power_model_run(monitored, now - monitored_time, monitored_load);
+    monitored_time = now;
+    return power_model_low(monitored);
+}
+
+
+const __power_monitor power_model_monitor = {
+    .init = NULL,
+    .low = power_model_monitor_low
+};
+
+
+void power_model_monitor_attach(struct power_model *pm, double load_current, double (*clock)(void))
+{
+    monitored = pm;
+    monitored_load = load_current;
+    monitored_clock = clock;
+    monitored_time = clock();
+}
@@ -0,0 +1,65 @@
+/*
+ * power_model.h
+ *
+ * Host stand-in for the power supply of the board: a storage capacitor
+ * charged by a constant harvested current and drained by the load, with the
+ * thresholds of the supervisor. It also acts as the power monitor of the
+ * just-in-time mode of interpow (see JitMonitor() in interpow.h), warning
+ * when the voltage falls under v_warn. host/sim runs the device program on
+ * it (sim -p).
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#ifndef POWER_MODEL_H_
+#define POWER_MODEL_H_
+
+#include "interpow/interpow.h"
+
+struct power_model {
+    double capacitance;         // F
+    double harvest_current;     // A
+    double v_on;                // V, the device starts above it
+    double v_warn;              // V, the monitor warns under it
+    double v_off;               // V, brown-out under it
+    double voltage;             // V
+    int on;
+};
+
+/**
+ * Start with the capacitor charged to v_on and the device on.
+ */
+void power_model_init(struct power_model *pm, double capacitance, double harvest_current,
+                      double v_on, double v_warn, double v_off);
+
+/**
+ * Run the device for the given time with the given load current.
+ * Returns the time actually run: less than seconds if the voltage falls to
+ * v_off before, in which case the device is off. A harvest larger than the
+ * load charges the capacitor up to v_on at most, the supply then being
+ * regulated.
+ */
+double power_model_run(struct power_model *pm, double seconds, double load_current);
+
+/**
+ * Charge the capacitor of a device that is off until v_on, and turn it on.
+ * Returns the time spent off.
+ */
+double power_model_charge(struct power_model *pm);
+
+/**
+ * Nonzero if the voltage is under v_warn (or the device off).
+ */
+int power_model_low(const struct power_model *pm);
+
+/**
+ * Power monitor reading the model set with power_model_monitor_attach():
+ * every reading first runs the model with the load current from the time
+ * of the previous reading, or of the attachment, to the time given by the
+ * clock (in seconds).
+ */
+extern const __power_monitor power_model_monitor;
+
+void power_model_monitor_attach(struct power_model *pm, double load_current, double (*clock)(void));
+
+#endif /* POWER_MODEL_H_ */
@@ -0,0 +1,759 @@
+/*
+ * result_receiver.c
+ *
+ * Host-side receiver and differential validator for the results sent by
+ * tester_send_data() (see tester.h for the frame layout).
+ *
+ * The receiver decodes the result frames coming from the device, recomputes
+ * every record with a reference implementation of the network (fann_ref.c)
+ * and reports:
+ *   - the per-record deviation between device and reference outputs;
+ *   - duplicate records (re-executed tasks) and whether they are consistent;
+ *   - missing records (gaps) and records received out of order;
+ *   - frames dropped because of a bad checksum or an unexpected length;
+ *   - the effective throughput of the link.
+ *
+ * Frames can be read from a serial device (e.g. the eZ-FET back-channel
+ * UART, /dev/ttyACM1), from a capture file, from stdin, or from a
+ * pseudo-terminal created on request (-P), which is handy to test the
+ * receiver against the built-in device emulator (-E):
+ *
+ *   ./result_receiver -P ../database/thyroid_trained.h ../database/thyroid.test
+ *   ./result_receiver -E /dev/pts/N -D 7 -G 50 ../database/thyroid_trained.h ../database/thyroid.test
+ *
+ * Build (from this directory):
+ *
+ *   cc -O2 -Wall -I../fann/inc -o result_receiver result_receiver.c fann_ref.c -lm
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fann_ref.h"
+
+/* Must match tester.h */
+#define FRAME_SYNC_0        0xA5
+#define FRAME_SYNC_1        0x5A
+#define FRAME_CRC_POLY      0x07
+#define FRAME_MAX_PAYLOAD   255
+#define FRAME_OVERHEAD      6       // sync (2) + index (2) + length (1) + crc (1)
+#define FRAME_MAX_LEN       (FRAME_MAX_PAYLOAD + FRAME_OVERHEAD)
+
+#define MAX_GAPS_SHOWN      20
+
+
+/*
+ *******************************************************************************
+ * Options and statistics
+ *******************************************************************************
+ */
+
+struct options {
+    const char *net_path;
+    const char *data_path;
+    const char *input_path;
+    const char *raw_path;
+    const char *emulate_path;
+    int create_pty;
+    int verbose;
+    unsigned int baud;
+    unsigned int num_tests;
+    double tolerance;
+    double idle_timeout;
+    unsigned int dup_every;
+    unsigned int gap_every;
+    unsigned int corrupt_every;
+};
+
+struct record {
+    unsigned int received;          // number of valid frames for this index
+    int inconsistent;               // a duplicate carried a different payload
+    fann_type *out;                 // first received payload
+};
+
+struct stats {
+    unsigned long bytes;
+    unsigned long skipped_bytes;
+    unsigned long valid_frames;
+    unsigned long bad_crc;
+    unsigned long bad_length;
+    unsigned long bad_index;
+    unsigned long duplicates;
+    unsigned long inconsistent;
+    unsigned long out_of_order;
+    unsigned long above_tolerance;
+    unsigned int unique;
+    long last_index;
+    double max_dev;
+    unsigned int max_dev_record;
+    unsigned int max_dev_output;
+    double sum_dev;
+    unsigned long num_dev;
+    double sse_device;
+    double sse_reference;
+    double t_first;
+    double t_last;
+};
+
+struct receiver {
+    const struct options *opt;
+    struct ref_net *net;
+    struct ref_data *data;
+    struct record *records;
+    struct stats st;
+    double now;
+    int serial_line;                // reading from a tty: report link usage
+
+    /* frame parser */
+    uint8_t frame[FRAME_MAX_LEN];
+    unsigned int frame_len;
+};
+
+
+static double monotonic_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+    uint8_t bit;
+
+    crc ^= byte;
+    for (bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ FRAME_CRC_POLY) : (uint8_t) (crc << 1);
+    }
+
+    return crc;
+}
+
+
+/*
+ *******************************************************************************
+ * Serial line / pseudo-terminal setup
+ *******************************************************************************
+ */
+
+static speed_t baud_to_speed(unsigned int baud)
+{
+    switch (baud) {
+    case 9600:   return B9600;
+    case 19200:  return B19200;
+    case 38400:  return B38400;
+    case 57600:  return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    default:     return 0;
+    }
+}
+
+
+static int set_raw(int fd, unsigned int baud)
+{
+    struct termios tio;
+    speed_t speed = baud_to_speed(baud);
+
+    if (tcgetattr(fd, &tio) != 0) {
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | PARENB);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    if (speed != 0) {
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+    }
+
+    return tcsetattr(fd, TCSANOW, &tio);
+}
+
+
+/**
+ * Create a pseudo-terminal in raw mode and return its master side.
+ * The slave side is kept open so that the master never reports a hang-up
+ * while the writer reconnects (e.g. the emulator being restarted).
+ */
+static int open_pty(unsigned int baud)
+{
+    int master, slave;
+    char *name;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0 ||
+            (name = ptsname(master)) == NULL) {
+        perror("pseudo-terminal");
+        return -1;
+    }
+
+    slave = open(name, O_RDWR | O_NOCTTY);
+    if (slave < 0 || set_raw(slave, baud) != 0) {
+        perror(name);
+        return -1;
+    }
+
+    printf("Listening on %s\n", name);
+    fflush(stdout);
+
+    return master;
+}
+
+
+/*
+ *******************************************************************************
+ * Frame decoding and validation
+ *******************************************************************************
+ */
+
+static void check_record(struct receiver *rx, unsigned int idx, const uint8_t *payload)
+{
+    const struct ref_data *data = rx->data;
+    struct record *rec = &rx->records[idx];
+    struct stats *st = &rx->st;
+    unsigned int num_output = rx->net->num_output;
+    unsigned int j;
+    fann_type out[FRAME_MAX_PAYLOAD / sizeof(fann_type)];
+    fann_type *ref, *label;
+    double dev, rec_max = 0, diff;
+
+    memcpy(out, payload, num_output * sizeof(fann_type));
+
+    if (rec->received++ > 0) {
+        st->duplicates++;
+        if (rec->out != NULL && memcmp(rec->out, out, num_output * sizeof(fann_type)) != 0) {
+            rec->inconsistent = 1;
+            st->inconsistent++;
+        }
+        if (rx->opt->verbose) {
+            printf("record %4u: duplicate%s\n", idx, rec->inconsistent ? " (payload differs!)" : "");
+        }
+        return;
+    }
+
+    /* Without a copy, duplicates of this record are only counted. */
+    rec->out = malloc(num_output * sizeof(fann_type));
+    if (rec->out != NULL) {
+        memcpy(rec->out, out, num_output * sizeof(fann_type));
+    }
+    st->unique++;
+    if ((long) idx < st->last_index) {
+        st->out_of_order++;
+    }
+    st->last_index = idx;
+
+    ref = ref_net_run(rx->net, data->input + (size_t) idx * data->num_input);
+    label = data->output + (size_t) idx * data->num_output;
+
+    for (j = 0; j < num_output; j++) {
+        dev = fabs((double) out[j] - (double) ref[j]);
+        if (dev > rec_max) {
+            rec_max = dev;
+        }
+        if (dev > st->max_dev) {
+            st->max_dev = dev;
+            st->max_dev_record = idx;
+            st->max_dev_output = j;
+        }
+        st->sum_dev += dev;
+        st->num_dev++;
+
+        diff = (double) label[j] - out[j];
+        st->sse_device += diff * diff;
+        diff = (double) label[j] - ref[j];
+        st->sse_reference += diff * diff;
+    }
+    if (rec_max > rx->opt->tolerance) {
+        st->above_tolerance++;
+    }
+
+    if (rx->opt->verbose || rec_max > rx->opt->tolerance) {
+        printf("record %4u:", idx);
+        for (j = 0; j < num_output; j++) {
+            printf(" %+.6f/%+.6f", out[j], ref[j]);
+        }
+        printf("  max dev %.3e%s\n", rec_max, rec_max > rx->opt->tolerance ? "  <-- above tolerance" : "");
+    }
+}
+
+
+static void parse_bytes(struct receiver *rx, const uint8_t *buf, size_t len);
+
+
+/**
+ * Drop the first byte of the current (invalid) frame and scan the rest
+ * again: a frame truncated by a power failure may hide the sync bytes of
+ * the next, valid one.
+ */
+static void resync(struct receiver *rx)
+{
+    uint8_t pending[FRAME_MAX_LEN];
+    unsigned int n = rx->frame_len - 1;
+
+    memcpy(pending, rx->frame + 1, n);
+    rx->frame_len = 0;
+    rx->st.skipped_bytes++;
+    parse_bytes(rx, pending, n);
+}
+
+
+static void frame_complete(struct receiver *rx)
+{
+    const uint8_t *f = rx->frame;
+    unsigned int payload_len = f[4];
+    unsigned int idx = f[2] | (f[3] << 8);
+    unsigned int i;
+    uint8_t crc = 0;
+
+    for (i = 2; i < 5 + payload_len; i++) {
+        crc = crc8_update(crc, f[i]);
+    }
+    if (crc != f[5 + payload_len]) {
+        rx->st.bad_crc++;
+        resync(rx);
+        return;
+    }
+
+    rx->frame_len = 0;
+    rx->st.valid_frames++;
+    if (rx->st.valid_frames == 1) {
+        rx->st.t_first = rx->now;
+    }
+    rx->st.t_last = rx->now;
+
+    if (payload_len != rx->net->num_output * sizeof(fann_type)) {
+        rx->st.bad_length++;
+        return;
+    }
+    if (idx >= rx->opt->num_tests) {
+        rx->st.bad_index++;
+        return;
+    }
+
+    check_record(rx, idx, f + 5);
+}
+
+
+static void parse_bytes(struct receiver *rx, const uint8_t *buf, size_t len)
+{
+    size_t i;
+    uint8_t b;
+
+    for (i = 0; i < len; i++) {
+        b = buf[i];
+
+        if (rx->frame_len == 0) {
+            if (b == FRAME_SYNC_0) {
+                rx->frame[rx->frame_len++] = b;
+            }
+            else {
+                rx->st.skipped_bytes++;
+            }
+            continue;
+        }
+
+        if (rx->frame_len == 1 && b != FRAME_SYNC_1) {
+            rx->st.skipped_bytes++;
+            rx->frame_len = 0;
+            if (b == FRAME_SYNC_0) {
+                rx->frame[rx->frame_len++] = b;
+            }
+            else {
+                rx->st.skipped_bytes++;
+            }
+            continue;
+        }
+
+        rx->frame[rx->frame_len++] = b;
+        if (rx->frame_len >= 5 && rx->frame_len == (unsigned int) rx->frame[4] + FRAME_OVERHEAD) {
+            frame_complete(rx);
+        }
+    }
+}
+
+
+static int all_received(const struct receiver *rx)
+{
+    return rx->st.unique == rx->opt->num_tests;
+}
+
+
+static int receive(struct receiver *rx)
+{
+    const struct options *opt = rx->opt;
+    struct pollfd pfd;
+    uint8_t buf[512];
+    FILE *raw = NULL;
+    ssize_t n;
+    int fd, ret;
+
+    if (opt->create_pty) {
+        fd = open_pty(opt->baud);
+    }
+    else if (opt->input_path == NULL || strcmp(opt->input_path, "-") == 0) {
+        fd = STDIN_FILENO;
+    }
+    else {
+        fd = open(opt->input_path, O_RDONLY | O_NOCTTY);
+        if (fd >= 0 && isatty(fd) && set_raw(fd, opt->baud) != 0) {
+            perror(opt->input_path);
+            return -1;
+        }
+    }
+    if (fd < 0) {
+        if (!opt->create_pty) {
+            perror(opt->input_path);
+        }
+        return -1;
+    }
+
+    if (opt->raw_path != NULL && (raw = fopen(opt->raw_path, "wb")) == NULL) {
+        perror(opt->raw_path);
+        return -1;
+    }
+
+    rx->serial_line = isatty(fd) || opt->create_pty;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+
+    while (!all_received(rx)) {
+        ret = poll(&pfd, 1, opt->idle_timeout > 0 ? (int) (opt->idle_timeout * 1000) : -1);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            break;  // idle timeout or error
+        }
+
+        n = read(fd, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;  // end of file or hang-up
+        }
+
+        rx->now = monotonic_seconds();
+        rx->st.bytes += n;
+        if (raw != NULL) {
+            fwrite(buf, 1, n, raw);
+        }
+        parse_bytes(rx, buf, n);
+    }
+
+    /* A frame still being assembled at this point was truncated. */
+    if (rx->frame_len > 0) {
+        rx->st.skipped_bytes += rx->frame_len;
+    }
+
+    if (raw != NULL) {
+        fclose(raw);
+    }
+    if (fd != STDIN_FILENO) {
+        close(fd);
+    }
+
+    return 0;
+}
+
+
+static int report(const struct receiver *rx)
+{
+    const struct stats *st = &rx->st;
+    unsigned int num_tests = rx->opt->num_tests;
+    unsigned int i, first, gaps = 0, missing = 0;
+    double dt = st->t_last - st->t_first;
+    double values = (double) st->unique * rx->net->num_output;
+
+    printf("\nFrames:\n");
+    printf("-> %lu bytes received, %lu valid frames\n", st->bytes, st->valid_frames);
+    printf("-> %lu bad checksum, %lu unexpected length, %lu index out of range, "
+           "%lu bytes skipped while resyncing\n",
+           st->bad_crc, st->bad_length, st->bad_index, st->skipped_bytes);
+
+    printf("\nRecords:\n");
+    printf("-> %u/%u received, %lu out of order\n", st->unique, num_tests, st->out_of_order);
+    printf("-> %lu duplicates (re-executed tasks), %lu with a different payload\n",
+           st->duplicates, st->inconsistent);
+
+    for (i = 0; i < num_tests; i++) {
+        if (rx->records[i].received > 0) {
+            continue;
+        }
+        first = i;
+        while (i + 1 < num_tests && rx->records[i + 1].received == 0) {
+            i++;
+        }
+        missing += i - first + 1;
+        if (gaps++ < MAX_GAPS_SHOWN) {
+            if (first == i) {
+                printf("-> missing record %u\n", first);
+            }
+            else {
+                printf("-> missing records %u-%u\n", first, i);
+            }
+        }
+    }
+    if (gaps > MAX_GAPS_SHOWN) {
+        printf("-> ... %u more gaps\n", gaps - MAX_GAPS_SHOWN);
+    }
+    if (gaps > 0) {
+        printf("-> %u records missing in %u gaps\n", missing, gaps);
+    }
+
+    if (st->unique > 0) {
+        printf("\nDeviation from reference:\n");
+        printf("-> max %.3e (record %u, output %u), mean %.3e\n",
+               st->max_dev, st->max_dev_record, st->max_dev_output, st->sum_dev / st->num_dev);
+        printf("-> %lu records above tolerance %.1e\n", st->above_tolerance, rx->opt->tolerance);
+        printf("-> MSE on %u received records: device %f, reference %f\n",
+               st->unique, st->sse_device / values, st->sse_reference / values);
+    }
+
+    if (st->valid_frames > 1 && dt > 0) {
+        printf("\nThroughput:\n");
+        printf("-> %lu frames in %.3f s: %.2f records/s, %.1f B/s",
+               st->valid_frames, dt, (st->valid_frames - 1) / dt, st->bytes / dt);
+        if (rx->serial_line) {
+            printf(" (%.1f%% of %u baud)", 100.0 * st->bytes * 10 / dt / rx->opt->baud, rx->opt->baud);
+        }
+        printf("\n");
+    }
+
+    return (missing == 0 && st->inconsistent == 0 && st->above_tolerance == 0) ? 0 : 1;
+}
+
+
+/*
+ *******************************************************************************
+ * Device emulation
+ *******************************************************************************
+ */
+
+static size_t build_frame(uint8_t *frame, unsigned int idx, const fann_type *out, unsigned int len)
+{
+    unsigned int i;
+    uint8_t crc = 0;
+
+    frame[0] = FRAME_SYNC_0;
+    frame[1] = FRAME_SYNC_1;
+    frame[2] = idx & 0xFF;
+    frame[3] = (idx >> 8) & 0xFF;
+    frame[4] = len;
+    memcpy(frame + 5, out, len);
+    for (i = 2; i < 5 + len; i++) {
+        crc = crc8_update(crc, frame[i]);
+    }
+    frame[5 + len] = crc;
+
+    return len + FRAME_OVERHEAD;
+}
+
+
+static int write_paced(int fd, const uint8_t *buf, size_t len, unsigned int baud, int paced)
+{
+    if (write(fd, buf, len) != (ssize_t) len) {
+        return -1;
+    }
+    if (paced) {
+        /* 10 bits per byte (8N1), as on the real line */
+        usleep((useconds_t) (len * 10 * 1e6 / baud));
+    }
+    return 0;
+}
+
+
+/**
+ * Play the device: compute every record with the reference network and send
+ * it as the device would, optionally re-sending (-D), dropping (-G) or
+ * corrupting (-C) some of them.
+ */
+static int emulate(const struct options *opt, struct ref_net *net, struct ref_data *data)
+{
+    uint8_t frame[FRAME_MAX_LEN];
+    unsigned int idx, len = net->num_output * sizeof(fann_type);
+    fann_type *out;
+    size_t frame_len;
+    int fd, paced;
+
+    fd = open(opt->emulate_path, O_WRONLY | O_NOCTTY | O_CREAT, 0644);
+    if (fd < 0) {
+        perror(opt->emulate_path);
+        return -1;
+    }
+    paced = isatty(fd);
+    if (paced) {
+        set_raw(fd, opt->baud);
+    }
+
+    for (idx = 0; idx < opt->num_tests; idx++) {
+        if (opt->gap_every && (idx + 1) % opt->gap_every == 0) {
+            continue;
+        }
+
+        out = ref_net_run(net, data->input + (size_t) idx * data->num_input);
+        frame_len = build_frame(frame, idx, out, len);
+
+        if (opt->corrupt_every && (idx + 1) % opt->corrupt_every == 0) {
+            frame[5 + len / 2] ^= 0x10;
+            if (write_paced(fd, frame, frame_len, opt->baud, paced) != 0) {
+                goto write_error;
+            }
+            frame[5 + len / 2] ^= 0x10;
+        }
+        if (write_paced(fd, frame, frame_len, opt->baud, paced) != 0) {
+            goto write_error;
+        }
+        if (opt->dup_every && (idx + 1) % opt->dup_every == 0 &&
+                write_paced(fd, frame, frame_len, opt->baud, paced) != 0) {
+            goto write_error;
+        }
+    }
+
+    close(fd);
+    return 0;
+
+write_error:
+    perror(opt->emulate_path);
+    close(fd);
+    return -1;
+}
+
+
+/*
+ *******************************************************************************
+ * main
+ *******************************************************************************
+ */
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [options] <network.net|network_trained.h> <data.test>\n"
+        "\n"
+        "Receive the results sent by the device and validate them against the reference network.\n"
+        "  -i <path>   read from a serial device, a pseudo-terminal or a capture file (default: stdin)\n"
+        "  -P          create a pseudo-terminal, print its path and read from it\n"
+        "  -b <baud>   baud rate of the serial line (default: 19200)\n"
+        "  -n <num>    number of tests run on the device (default: all records of the data file)\n"
+        "  -t <tol>    tolerated absolute deviation per output (default: 1e-5)\n"
+        "  -w <sec>    stop after <sec> seconds without data, 0 to wait forever (default: 5)\n"
+        "  -o <file>   save the raw received bytes to <file>\n"
+        "  -v          print one line per received record\n"
+        "\n"
+        "Emulate the device instead, sending reference results to <path>:\n"
+        "  -E <path>   output serial device, pseudo-terminal or file\n"
+        "  -D <k>      send every k-th record twice (re-executed task)\n"
+        "  -G <k>      drop every k-th record\n"
+        "  -C <k>      send a corrupted copy before every k-th record\n",
+        prog);
+}
+
+
+int main(int argc, char **argv)
+{
+    struct options opt;
+    struct ref_net net;
+    struct ref_data data;
+    struct receiver rx;
+    unsigned int i;
+    int c, ret;
+
+    memset(&opt, 0, sizeof(opt));
+    opt.baud = 19200;
+    opt.tolerance = 1e-5;
+    opt.idle_timeout = 5;
+
+    while ((c = getopt(argc, argv, "i:Pb:n:t:w:o:vE:D:G:C:h")) != -1) {
+        switch (c) {
+        case 'i': opt.input_path = optarg; break;
+        case 'P': opt.create_pty = 1; break;
+        case 'b': opt.baud = strtoul(optarg, NULL, 10); break;
+        case 'n': opt.num_tests = strtoul(optarg, NULL, 10); break;
+        case 't': opt.tolerance = strtod(optarg, NULL); break;
+        case 'w': opt.idle_timeout = strtod(optarg, NULL); break;
+        case 'o': opt.raw_path = optarg; break;
+        case 'v': opt.verbose = 1; break;
+        case 'E': opt.emulate_path = optarg; break;
+        case 'D': opt.dup_every = strtoul(optarg, NULL, 10); break;
+        case 'G': opt.gap_every = strtoul(optarg, NULL, 10); break;
+        case 'C': opt.corrupt_every = strtoul(optarg, NULL, 10); break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (argc - optind != 2 || opt.baud == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    opt.net_path = argv[optind];
+    opt.data_path = argv[optind + 1];
+
+    if (ref_net_load(&net, opt.net_path) != 0 ||
+            ref_data_load(&data, opt.data_path, opt.num_tests) != 0) {
+        return 2;
+    }
+    if (data.num_input != net.num_input || data.num_output != net.num_output) {
+        fprintf(stderr, "Network (%u inputs, %u outputs) does not match data (%u inputs, %u outputs)\n",
+                net.num_input, net.num_output, data.num_input, data.num_output);
+        return 2;
+    }
+    if (net.num_output * sizeof(fann_type) > FRAME_MAX_PAYLOAD) {
+        fprintf(stderr, "Too many outputs (%u) for a result frame\n", net.num_output);
+        return 2;
+    }
+    if (opt.num_tests == 0 || opt.num_tests > data.num_data) {
+        opt.num_tests = data.num_data;
+    }
+
+    if (opt.emulate_path != NULL) {
+        ret = emulate(&opt, &net, &data) == 0 ? 0 : 2;
+        ref_net_free(&net);
+        ref_data_free(&data);
+        return ret;
+    }
+
+    memset(&rx, 0, sizeof(rx));
+    rx.opt = &opt;
+    rx.net = &net;
+    rx.data = &data;
+    rx.st.last_index = -1;
+    rx.records = calloc(opt.num_tests, sizeof(struct record));
+    if (rx.records == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return 2;
+    }
+
+    if (receive(&rx) != 0) {
+        return 2;
+    }
+    ret = report(&rx);
+
+    for (i = 0; i < opt.num_tests; i++) {
+        free(rx.records[i].out);
+    }
+    free(rx.records);
+    ref_net_free(&net);
+    ref_data_free(&data);
+
+    return ret;
+}
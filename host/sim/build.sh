@@ -0,0 +1,63 @@
+#!/bin/bash
+#
+# build.sh
+#
+# Build the intermittent simulator (see sim.h) for the device program, with
+# the given predefined symbols, e.g.
+#
+#   ./build.sh                          # main.c as is
+#   ./build.sh -DTX_COMMIT
+#   ./build.sh -DFANN_CASCADE_ARENA -DCASCADE_TRAIN
+#
+# Every device source is compiled through a wrapper including it, followed
+# by a SIM_PERSISTENT() for every variable it places in FRAM: the #pragma
+# PERSISTENT, NOINIT and DATA_SECTION(".fram*") seen by the preprocessor
+# with the same symbols.
+#
+# Created on: Oct 19, 2026
+#
+
+set -e
+
+here=$(cd "$(dirname "$0")" && pwd)
+root=$(cd "$here/../.." && pwd)
+out=${OUT:-$here/sim}
+cc=${CC:-cc}
+build=$(mktemp -d)
+trap 'rm -rf "$build"' EXIT
+
+# Device code on the host: the 20-bit addresses of FAR_DATASET are kept in
+# 32 bits, so the program is linked at low addresses (-no-pie), and what the
+# device program does not use is dropped (--gc-sections) as the TI linker
+# does, e.g. the file I/O of FANN. INTERPOW_SIM compiles in the hooks of the
+# runtime counting the field writes and the commits.
+cflags="-O2 -std=gnu99 -Wall -Wno-unknown-pragmas -no-pie -ffunction-sections -fdata-sections -DINTERPOW_SIM -Dprintf=sim_printf -I$here -I$root -I$root/utils -I$root/fann/inc -I$root/database $*"
+
+case " $* " in
+*" -DSTREAM_INPUT "*)
+    echo "build.sh: STREAM_INPUT needs the UART, not simulated" >&2
+    exit 2
+    ;;
+esac
+
+for src in main.c libinterpow.c "$root"/fann/src/*.c; do
+    src=${src#$root/}
+    wrap=$build/$(echo "$src" | tr / _)
+    {
+        echo "#include \"$root/$src\""
+        echo "#include \"sim.h\""
+        $cc -E $cflags "$root/$src" | sed -n \
+            -e 's/^#pragma *\(PERSISTENT\|NOINIT\) *(\(.*\)).*$/SIM_PERSISTENT(\2)/p' \
+            -e 's/^#pragma *DATA_SECTION *( *\([A-Za-z0-9_]*\) *, *"\.fram.*$/SIM_PERSISTENT(\1)/p'
+    } > "$wrap"
+    if [ "$src" = main.c ]; then
+        $cc $cflags -Dmain=sim_device_main -c "$wrap" -o "$wrap.o"
+    else
+        $cc $cflags -c "$wrap" -o "$wrap.o"
+    fi
+done
+
+$cc -O2 -Wall -no-pie -Wl,--gc-sections -I"$here" -I"$root" -I"$root/utils" -I"$root/host" -o "$out" \
+    "$here/sim.c" "$here/interpow_host.c" "$here/tester_host.c" "$root/host/power_model.c" \
+    "$build"/*.o -lm
+echo "built $out"
@@ -0,0 +1,115 @@
+/*
+ * interpow_host.c
+ *
+ * Host implementation of interpow.lib for the simulator, doing what the
+ * MSP430 library does:
+ *
+ *   - the low byte of sf_state selects, per self-field code, the copy holding
+ *     the value (base_addr_1 if set), the high byte marks the codes written
+ *     since the task started;
+ *   - a self-field write goes to the other copy, then flips both bits;
+ *   - start_task() commits the writes of the task it starts by clearing its
+ *     high byte, and resume_program() rolls the uncommitted ones back.
+ *
+ * The bytes written are counted by the hooks of the write macros, and the
+ * switches of a transaction by tx_commit() (see INTERPOW_SIM in interpow.h),
+ * so that a transaction completed again after a power failure is only
+ * counted once.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#include <string.h>
+
+#include "interpow/interpow.h"
+#include "sim.h"
+
+
+void start_task(__task *task, __program_state *ps)
+{
+    sim_commit_begin();
+    task->sf_state &= 0x00FF;
+    ps->curr_task = task;
+    if (ps->tx_pending == NULL) {
+        sim_task_commit();
+    }
+    sim_commit_end();
+}
+
+
+void resume_program(__program_state *ps)
+{
+    __task *task = ps->curr_task;
+    uint16_t dirty;
+
+    if (task->has_self_channel) {
+        dirty = task->sf_state >> 8;
+        task->sf_state ^= dirty * 0x0101;
+    }
+    sim_task_run();
+    task->task_function();
+}
+
+
+static void read_field(void *field, void *dst, size_t size, uint8_t self, __program_state *ps)
+{
+    __self_field *sf;
+    __field *f;
+
+    if (self) {
+        sf = (__self_field *) field;
+        memcpy(dst, (ps->curr_task->sf_state & sf->code) ? sf->base_addr_1 : sf->base_addr_0,
+               sf->length * size);
+    }
+    else {
+        f = (__field *) field;
+        memcpy(dst, f->base_addr, f->length * size);
+    }
+}
+
+
+static void write_field(void *field, const void *src, size_t size, uint8_t self, __program_state *ps)
+{
+    __self_field *sf;
+    __field *f;
+
+    sim_commit_begin();
+    if (self) {
+        sf = (__self_field *) field;
+        memcpy((ps->curr_task->sf_state & sf->code) ? sf->base_addr_0 : sf->base_addr_1, src,
+               sf->length * size);
+        ps->curr_task->sf_state ^= sf->code * 0x0101;
+    }
+    else {
+        f = (__field *) field;
+        memcpy(f->base_addr, src, f->length * size);
+    }
+    sim_commit_end();
+}
+
+
+#define INTERPOW_HOST_FIELD(SUFFIX, TYPE)                                       \
+void read_field_##SUFFIX(void *field, TYPE *dst, uint8_t self, __program_state *ps) \
+{                                                                               \
+    read_field(field, dst, sizeof(TYPE), self, ps);                             \
+}                                                                               \
+                                                                                \
+void write_field_##SUFFIX(void *field, TYPE *src, uint8_t self, __program_state *ps) \
+{                                                                               \
+    write_field(field, src, sizeof(TYPE), self, ps);                            \
+}                                                                               \
+                                                                                \
+void write_field_element_##SUFFIX(__field *field, TYPE *src, uint16_t pos)      \
+{                                                                               \
+    sim_commit_begin();                                                         \
+    ((TYPE *) field->base_addr)[pos] = *src;                                    \
+    sim_commit_end();                                                           \
+}
+
+INTERPOW_HOST_FIELD(8, int8_t)
+INTERPOW_HOST_FIELD(u8, uint8_t)
+INTERPOW_HOST_FIELD(16, int16_t)
+INTERPOW_HOST_FIELD(u16, uint16_t)
+INTERPOW_HOST_FIELD(32, int32_t)
+INTERPOW_HOST_FIELD(u32, uint32_t)
+INTERPOW_HOST_FIELD(f32, float)
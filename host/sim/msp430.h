@@ -0,0 +1,85 @@
+/*
+ * msp430.h
+ *
+ * Stand-in for the device header of the MSP430FR5994, for the intermittent
+ * simulator (see sim.h). Peripheral registers are plain variables, defined in
+ * sim.c, and intrinsics do nothing: the device code only needs them to build.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#ifndef SIM_MSP430_H_
+#define SIM_MSP430_H_
+
+#include <stdint.h>
+
+extern volatile uint16_t WDTCTL, PM5CTL0, PMMCTL0;
+extern volatile uint16_t P1DIR, P1OUT, P2SEL0, P2SEL1, P3DIR, P3OUT;
+extern volatile uint16_t CSCTL0, CSCTL1, CSCTL3, CSCTL4;
+extern volatile uint16_t TA0CTL, TA0CCTL0, TA0CCR0, TA1CTL, TA1R, TA1CCR0, TA1CCTL0;
+extern volatile uint16_t UCA1CTLW0, UCA1MCTLW, UCA1BRW, UCA1STATW, UCA1IFG, UCA1IE, UCA1IV;
+extern volatile uint16_t UCA1TXBUF, UCA1RXBUF;
+extern volatile uint16_t CECTL0, CECTL1, CECTL2, CECTL3, CEINT, CEIV;
+
+#define BIT0                    0x0001
+#define BIT1                    0x0002
+#define BIT2                    0x0004
+#define BIT3                    0x0008
+#define BIT4                    0x0010
+#define BIT5                    0x0020
+#define BIT6                    0x0040
+#define BIT7                    0x0080
+
+#define WDTPW                   0x5A00
+#define WDTHOLD                 0x0080
+#define LOCKLPM5                0x0001
+#define PMMPW                   0xA500
+#define PMMSWBOR                0x0004
+
+#define CSKEY                   0xA500
+#define DCOFSEL                 0x000E
+#define DCOFSEL_6               0x000C
+#define DIVS                    0x0070
+#define DIVS_3                  0x0030
+#define DIVM                    0x0007
+#define SMCLKOFF                0x0002
+
+#define MC                      0x0030
+#define MC__UP                  0x0010
+#define TASSEL__SMCLK           0x0200
+#define CCIE                    0x0010
+
+#define UCSWRST                 0x0001
+#define UCSSEL__SMCLK           0x0080
+#define UCOS16                  0x0001
+#define UCRXIFG                 0x0001
+#define UCTXIFG                 0x0002
+#define UCTXCPTIFG              0x0008
+#define UCRXIE                  0x0001
+#define USCI_NONE               0x0000
+#define USCI_UART_UCRXIFG       0x0002
+#define USCI_UART_UCTXCPTIFG    0x0008
+
+#define GIE                     0x0008
+#define LPM0_bits               0x0010
+#define LPM3_bits               0x00D0
+
+#define TIMER0_A0_VECTOR        1
+#define USCI_A1_VECTOR          2
+
+#define __interrupt
+#define __no_operation()                ((void) 0)
+#define __delay_cycles(x)               ((void) 0)
+#define __bis_SR_register(x)            ((void) 0)
+#define __bic_SR_register(x)            ((void) 0)
+#define __bic_SR_register_on_exit(x)    ((void) 0)
+#define __enable_interrupt()            ((void) 0)
+#define __disable_interrupt()           ((void) 0)
+#define __even_in_range(x, y)           (x)
+
+/* 20-bit addresses of the device are 32-bit on the host, hence -no-pie */
+#define __data20_read_char(a)           (*(uint8_t *) (uintptr_t) (a))
+#define __data20_read_short(a)          (*(uint16_t *) (uintptr_t) (a))
+#define __data20_read_long(a)           (*(uint32_t *) (uintptr_t) (a))
+
+#endif /* SIM_MSP430_H_ */
@@ -0,0 +1,637 @@
+/*
+ * sim.c
+ *
+ * Intermittent execution simulator (see sim.h): boots the device program
+ * again and again, cutting its power, until it calls tester_notify_end(),
+ * then reports the forward progress and the work lost to power failures.
+ *
+ *   ./build.sh -DTX_COMMIT
+ *   ./sim -c -t 20000 -n       # fail 20 ms after every boot, plus noise_3
+ *   ./sim -c -t 20000 -r 7     # fail at random between 10 and 30 ms
+ *   ./sim -c -p 10 -i 100      # fail when a 10 uF capacitor charged by
+ *                              # 100 uA is drained by the 1 mA load
+ *
+ * Times are device times: the host runs the program -x times faster than
+ * the MSP430 at 8 MHz (1000 by default), so the timers are scaled by it.
+ * The host timers do not fire sooner than some 10 us after a boot, i.e.
+ * 10 ms of the device with the default -x.
+ *
+ * The FRAM image is kept in a file (-f, fram.bin by default) between runs;
+ * -c starts from the initial values of the program again, as a freshly
+ * flashed device, and so does a new build of the simulator (its FRAM holds
+ * pointers to its functions and variables). Without -t, the power only
+ * fails when the program calls tester_autoreset().
+ *
+ * With -p, the power comes from the capacitor model of host/power_model.c:
+ * every boot starts at SIM_V_ON and fails when the load has drained the
+ * capacitor to SIM_V_OFF, then the harvest charges it back while the device
+ * is off. The model is the power monitor of the program (see
+ * tester_power_monitor()), warning under -w volts, so that the
+ * just-in-time mode of interpow saves when it has to.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "noise.h"
+#include "power_model.h"
+#include "profiler.h"
+#include "sim.h"
+
+#define SIM_EXIT_FAILURE    3
+#define SIM_EXIT_DONE       4
+
+#define SIM_FRAM_MAGIC      0x4D4152464D495349ull   // "ISIMFRAM"
+
+/// Boots in a row without a task committed before giving up
+#define SIM_STALL_BOOTS     1000
+
+/// Stack of the device program touched before every boot
+#define SIM_STACK_SIZE      (64 * 1024)
+
+#define SIM_NOISE_LEN       (sizeof(noise_3) / sizeof(noise_3[0]))
+
+/// Supply thresholds of the capacitor model (-p), in volts: the supervisor
+/// starts the device at SIM_V_ON, which browns out at SIM_V_OFF
+#define SIM_V_ON            3.3
+#define SIM_V_OFF           1.8
+
+/// Longest boot drawn from the capacitor model, in seconds
+#define SIM_MAX_BOOT        3600.0
+
+void sim_device_main(void);
+
+/* Peripheral registers of the stub msp430.h */
+volatile uint16_t WDTCTL, PM5CTL0, PMMCTL0;
+volatile uint16_t P1DIR, P1OUT, P2SEL0, P2SEL1, P3DIR, P3OUT;
+volatile uint16_t CSCTL0, CSCTL1, CSCTL3, CSCTL4;
+volatile uint16_t TA0CTL, TA0CCTL0, TA0CCR0, TA1CTL, TA1R, TA1CCR0, TA1CCTL0;
+volatile uint16_t UCA1CTLW0, UCA1MCTLW, UCA1BRW, UCA1STATW, UCA1IFG, UCA1IE, UCA1IV;
+volatile uint16_t UCA1TXBUF, UCA1RXBUF;
+volatile uint16_t CECTL0, CECTL1, CECTL2, CECTL3, CEINT, CEIV;
+
+struct sim_var {
+    void *addr;
+    size_t size;
+    const char *name;
+};
+
+struct sim_fram_header {
+    uint64_t magic;
+    uint64_t size;
+    uint64_t build;
+};
+
+/**
+ * Counters, shared by all the boots.
+ */
+struct sim_counters {
+    unsigned long boots;
+    unsigned long failures;
+    unsigned long runs;             // task functions started by resume_program()
+    unsigned long commits;          // task switches committed
+    unsigned long interrupted;      // runs cut by a power failure
+    unsigned long lost_writes;      // of them, cut after writing to a field
+    unsigned long results;          // results sent (not re-sent) by tester_send_data()
+    unsigned long long bytes;       // bytes written to fields, directly or staged
+    double time;                    // seconds run, over all boots
+    double time_lost;               // seconds of the interrupted runs
+    double time_commit;             // seconds in start_task(), field writes and transaction commits
+    double time_off;                // device seconds charging the capacitor (-p)
+};
+
+static struct sim_var *vars;
+static size_t num_vars, max_vars;
+static uint8_t *fram;
+static size_t fram_size;
+static struct sim_counters *counters;
+static double speedup = 1000;
+static struct power_model power;
+static int powered;
+static double load_current = 1e-3;
+
+/* State of the running boot, lost with it */
+static double boot_start, commit_start, halted;
+static unsigned int commit_depth;
+static volatile double run_start;
+static volatile sig_atomic_t in_run, run_written;
+
+
+/**
+ * Seconds run by the device: the host time, less the time halted by printf.
+ */
+static double sim_clock(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9 - halted;
+}
+
+
+static double sim_since(double start)
+{
+    return sim_clock() - start;
+}
+
+
+void sim_persistent(const void *addr, size_t size, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < num_vars; i++) {
+        if (vars[i].addr == addr) {
+            return;
+        }
+    }
+    if (num_vars == max_vars) {
+        max_vars = max_vars ? 2 * max_vars : 64;
+        vars = realloc(vars, max_vars * sizeof(struct sim_var));
+        if (vars == NULL) {
+            perror("sim_persistent");
+            exit(2);
+        }
+    }
+    vars[num_vars].addr = (void *) addr;
+    vars[num_vars].size = size;
+    vars[num_vars].name = name;
+    num_vars++;
+}
+
+
+/**
+ * Copy the FRAM variables to (save) or from the image.
+ */
+static void sim_fram_copy(int save)
+{
+    uint8_t *p = fram + sizeof(struct sim_fram_header);
+    size_t i;
+
+    for (i = 0; i < num_vars; i++) {
+        if (save) {
+            memcpy(p, vars[i].addr, vars[i].size);
+        }
+        else {
+            memcpy(vars[i].addr, p, vars[i].size);
+        }
+        p += vars[i].size;
+    }
+}
+
+
+/**
+ * FNV-1a hash of the simulator executable.
+ */
+static uint64_t sim_build_hash(void)
+{
+    uint64_t hash = 14695981039346656037ull;
+    FILE *exe = fopen("/proc/self/exe", "rb");
+    int c;
+
+    if (exe == NULL) {
+        return 0;
+    }
+    while ((c = getc(exe)) != EOF) {
+        hash = (hash ^ (uint8_t) c) * 1099511628211ull;
+    }
+    fclose(exe);
+    return hash;
+}
+
+
+/**
+ * Drop the read-only variables (const tables placed in FRAM): flashed with
+ * the program, they never change, and are not in the image.
+ */
+static void sim_drop_read_only(void)
+{
+    FILE *maps = fopen("/proc/self/maps", "r");
+    unsigned long start, end;
+    char perms[5], line[512];
+    size_t i, kept = 0;
+    uintptr_t addr;
+    int writable;
+
+    if (maps == NULL) {
+        return;
+    }
+    for (i = 0; i < num_vars; i++) {
+        addr = (uintptr_t) vars[i].addr;
+        writable = 0;
+        rewind(maps);
+        while (fgets(line, sizeof(line), maps) != NULL) {
+            if (sscanf(line, "%lx-%lx %4s", &start, &end, perms) == 3
+                    && addr >= start && addr < end) {
+                writable = perms[1] == 'w';
+                break;
+            }
+        }
+        if (writable) {
+            vars[kept++] = vars[i];
+        }
+    }
+    num_vars = kept;
+    fclose(maps);
+}
+
+
+/**
+ * Map the FRAM image, created from the initial values of the variables if
+ * it comes from another build (or if clear is set).
+ */
+static int sim_fram_open(const char *path, int clear)
+{
+    struct sim_fram_header header = { SIM_FRAM_MAGIC, 0, sim_build_hash() };
+    struct stat st;
+    size_t i;
+    int fd, fresh;
+
+    sim_drop_read_only();
+    for (i = 0; i < num_vars; i++) {
+        header.size += vars[i].size;
+    }
+    fram_size = sizeof(header) + header.size;
+
+    fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(path);
+        return -1;
+    }
+    fresh = clear || (size_t) st.st_size != fram_size;
+    if (fresh && ftruncate(fd, fram_size) < 0) {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+    fram = mmap(NULL, fram_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (fram == MAP_FAILED) {
+        perror(path);
+        return -1;
+    }
+    if (!fresh && memcmp(fram, &header, sizeof(header)) != 0) {
+        fresh = 1;
+    }
+    if (fresh) {
+        /* This process never runs device code: the variables hold their
+         * initial values */
+        memcpy(fram, &header, sizeof(header));
+        sim_fram_copy(1);
+    }
+    return fresh;
+}
+
+
+static void sim_power_failure(int sig)
+{
+    (void) sig;
+
+    counters->time += sim_since(boot_start);
+    if (in_run) {
+        counters->interrupted++;
+        counters->lost_writes += run_written;
+        counters->time_lost += sim_since(run_start);
+    }
+    counters->failures++;
+    /* FRAM keeps every write: saving it takes no device time */
+    sim_fram_copy(1);
+    _exit(SIM_EXIT_FAILURE);
+}
+
+
+void sim_done(void)
+{
+    sigset_t alarm;
+
+    /* The program is done: no failure cuts the save */
+    sigemptyset(&alarm);
+    sigaddset(&alarm, SIGALRM);
+    sigprocmask(SIG_BLOCK, &alarm, NULL);
+    counters->time += sim_since(boot_start);
+    sim_fram_copy(1);
+    fflush(stdout);
+    _exit(SIM_EXIT_DONE);
+}
+
+
+void sim_schedule_failure(unsigned long microseconds)
+{
+    struct itimerval it;
+
+    microseconds = (unsigned long) (microseconds / speedup);
+    memset(&it, 0, sizeof(it));
+    it.it_value.tv_sec = microseconds / 1000000;
+    it.it_value.tv_usec = microseconds % 1000000;
+    if (microseconds == 0) {
+        it.it_value.tv_usec = 1;
+    }
+    setitimer(ITIMER_REAL, &it, NULL);
+}
+
+
+unsigned long sim_time_us(void)
+{
+    return (unsigned long) (sim_since(boot_start) * speedup * 1e6);
+}
+
+
+/**
+ * Device seconds since the boot: the clock of the capacitor model.
+ */
+static double sim_device_seconds(void)
+{
+    return sim_since(boot_start) * speedup;
+}
+
+
+const struct __power_monitor *sim_power_monitor(void)
+{
+    return powered ? &power_model_monitor : NULL;
+}
+
+
+int sim_printf(const char *format, ...)
+{
+    struct itimerval off, left;
+    double start = sim_clock();
+    va_list args;
+    int ret;
+
+    /* CIO halts the device while the debugger prints: neither its clock
+     * nor the time left before the power failure run meanwhile */
+    memset(&off, 0, sizeof(off));
+    setitimer(ITIMER_REAL, &off, &left);
+    va_start(args, format);
+    ret = vprintf(format, args);
+    va_end(args);
+    halted += sim_since(start);
+    if (left.it_value.tv_sec || left.it_value.tv_usec) {
+        setitimer(ITIMER_REAL, &left, NULL);
+    }
+    return ret;
+}
+
+
+/* profiler.h: cycles of the 8 MHz clock of the device */
+static double profiler_begin;
+
+void profiler_start()
+{
+    profiler_begin = sim_clock();
+}
+
+
+uint32_t profiler_stop()
+{
+    return (uint32_t) (sim_since(profiler_begin) * speedup * 8e6);
+}
+
+
+void sim_task_run(void)
+{
+    /* A just-in-time task switch that does not save continues the run */
+    counters->runs++;
+    if (!in_run) {
+        run_start = sim_clock();
+        in_run = 1;
+        run_written = 0;
+    }
+}
+
+
+void sim_task_commit(void)
+{
+    counters->commits++;
+    in_run = 0;
+}
+
+
+void sim_commit_begin(void)
+{
+    if (commit_depth++ == 0) {
+        commit_start = sim_clock();
+    }
+}
+
+
+void sim_commit_end(void)
+{
+    if (--commit_depth == 0) {
+        counters->time_commit += sim_since(commit_start);
+    }
+}
+
+
+void sim_field_write(uint16_t bytes)
+{
+    counters->bytes += bytes;
+    run_written = 1;
+}
+
+
+void sim_result_sent(void)
+{
+    counters->results++;
+}
+
+
+/**
+ * Take the copy-on-write faults of the stack of the new boot before its
+ * clock starts: they are fork() costs, not device work.
+ */
+static void __attribute__((noinline)) sim_touch_stack(void)
+{
+    volatile uint8_t stack[SIM_STACK_SIZE];
+    size_t i;
+
+    for (i = 0; i < sizeof(stack); i += 256) {
+        stack[i] = 0;
+    }
+}
+
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -f <file>   FRAM image (default: fram.bin)\n"
+        "  -c          start from the initial FRAM content, as after flashing\n"
+        "  -t <us>     cut the power <us> microseconds after every boot (default: 0, never)\n"
+        "  -n          add the noise_3 pattern of noise.h to -t, as tester_autoreset()\n"
+        "  -r <seed>   draw the time before each failure between -t/2 and 3*-t/2\n"
+        "  -x <factor> host speed-up over the device (default: 1000)\n"
+        "  -p <uF>     power from a capacitor of <uF> microfarads instead of -t\n"
+        "  -i <uA>     current harvested by the capacitor (default: 100)\n"
+        "  -l <uA>     current drawn by the device (default: 1000)\n"
+        "  -w <V>      voltage under which the power monitor warns (default: 2.4)\n"
+        "  -b <num>    stop after <num> boots (default: 100000)\n"
+        "  -q          discard the output of the program\n",
+        prog);
+}
+
+
+int main(int argc, char **argv)
+{
+    const char *path = "fram.bin";
+    unsigned long interval = 0, max_boots = 100000, stall = 0, commits = 0, delay;
+    unsigned int seed = 0;
+    int c, clear = 0, noise = 0, randomized = 0, quiet = 0, status, fresh;
+    double capacitance = 0, harvest_current = 100e-6, v_warn = 2.4, on_time;
+    struct power_model drained;
+    pid_t pid;
+
+    while ((c = getopt(argc, argv, "f:ct:nr:x:p:i:l:w:b:qh")) != -1) {
+        switch (c) {
+        case 'f': path = optarg; break;
+        case 'c': clear = 1; break;
+        case 't': interval = strtoul(optarg, NULL, 10); break;
+        case 'n': noise = 1; break;
+        case 'r': randomized = 1; seed = strtoul(optarg, NULL, 10); break;
+        case 'x': speedup = strtod(optarg, NULL); break;
+        case 'p': capacitance = strtod(optarg, NULL) * 1e-6; break;
+        case 'i': harvest_current = strtod(optarg, NULL) * 1e-6; break;
+        case 'l': load_current = strtod(optarg, NULL) * 1e-6; break;
+        case 'w': v_warn = strtod(optarg, NULL); break;
+        case 'b': max_boots = strtoul(optarg, NULL, 10); break;
+        case 'q': quiet = 1; break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (speedup <= 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (capacitance > 0) {
+        /* Without harvest, a drained capacitor never starts the device */
+        if (interval || harvest_current <= 0 || load_current <= 0) {
+            usage(argv[0]);
+            return 2;
+        }
+        power_model_init(&power, capacitance, harvest_current, SIM_V_ON, v_warn, SIM_V_OFF);
+        powered = 1;
+    }
+
+    if ((fresh = sim_fram_open(path, clear)) < 0) {
+        return 2;
+    }
+    counters = mmap(NULL, sizeof(*counters), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (counters == MAP_FAILED) {
+        perror("mmap");
+        return 2;
+    }
+    memset(counters, 0, sizeof(*counters));
+    fprintf(stderr, "%s: %zu FRAM variables, %zu bytes%s\n", path, num_vars,
+            fram_size - sizeof(struct sim_fram_header), fresh ? ", initialised" : "");
+    fflush(NULL);
+
+    for (;;) {
+        if (counters->boots == max_boots) {
+            fprintf(stderr, "stopped after %lu boots\n", max_boots);
+            break;
+        }
+        if (counters->commits == commits && ++stall == SIM_STALL_BOOTS) {
+            fprintf(stderr, "no task committed in %d boots, stopped\n", SIM_STALL_BOOTS);
+            break;
+        }
+        else if (counters->commits != commits) {
+            commits = counters->commits;
+            stall = 0;
+        }
+
+        delay = interval;
+        if (interval && randomized) {
+            delay = interval / 2 + (unsigned long) ((double) rand_r(&seed) / RAND_MAX * interval);
+        }
+        if (interval && noise) {
+            delay += noise_3[counters->boots % SIM_NOISE_LEN];
+        }
+        if (powered) {
+            /* The boot lasts until the load drains the capacitor */
+            counters->time_off += power_model_charge(&power);
+            drained = power;
+            on_time = power_model_run(&drained, SIM_MAX_BOOT, load_current);
+            delay = drained.on ? 0 : (unsigned long) (on_time * 1e6) + 1;
+        }
+        counters->boots++;
+
+        pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 2;
+        }
+        if (pid == 0) {
+            if (quiet) {
+                freopen("/dev/null", "w", stdout);
+            }
+            setvbuf(stdout, NULL, _IONBF, 0);
+            signal(SIGALRM, sim_power_failure);
+            sim_fram_copy(0);
+            sim_touch_stack();
+            mlockall(MCL_CURRENT);
+            boot_start = sim_clock();
+            if (powered) {
+                power_model_monitor_attach(&power, load_current, sim_device_seconds);
+            }
+            if (delay) {
+                sim_schedule_failure(delay);
+            }
+            sim_device_main();
+            sim_done();
+        }
+
+        if (waitpid(pid, &status, 0) < 0) {
+            perror("waitpid");
+            return 2;
+        }
+        if (WIFEXITED(status) && WEXITSTATUS(status) == SIM_EXIT_FAILURE) {
+            if (powered) {
+                power = drained;
+            }
+            continue;
+        }
+        if (WIFEXITED(status) && WEXITSTATUS(status) == SIM_EXIT_DONE) {
+            break;
+        }
+        fprintf(stderr, "boot %lu: program crashed (status 0x%x)\n", counters->boots, status);
+        return 1;
+    }
+
+    fprintf(stderr,
+        "boots:            %lu (%lu power failures)\n"
+        "task runs:        %lu, %lu committed, %lu interrupted (%.1f%%, %lu after field writes)\n"
+        "results sent:     %lu\n"
+        "time run:         %.3f ms (device: x%g)\n"
+        "lost in re-runs:  %.3f ms (%.1f%%)\n"
+        "commit overhead:  %.3f ms (%.1f%%), %llu bytes of field writes\n",
+        counters->boots, counters->failures,
+        counters->runs, counters->commits, counters->interrupted,
+        counters->runs ? 100.0 * counters->interrupted / counters->runs : 0.0,
+        counters->lost_writes,
+        counters->results,
+        counters->time * speedup * 1e3, speedup,
+        counters->time_lost * speedup * 1e3, counters->time ? 100 * counters->time_lost / counters->time : 0.0,
+        counters->time_commit * speedup * 1e3, counters->time ? 100 * counters->time_commit / counters->time : 0.0,
+        counters->bytes);
+    if (powered) {
+        fprintf(stderr, "time charging:    %.3f ms\n", counters->time_off * 1e3);
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * sim.h
+ *
+ * Intermittent execution simulator: runs the device program on the host,
+ * with power failures.
+ *
+ * Every boot runs the device main() in a new process, forked from a
+ * simulator that never runs device code, so SRAM (every variable not in
+ * FRAM, and the stack) starts again from its initial values. Variables
+ * placed in FRAM by #pragma PERSISTENT, NOINIT or DATA_SECTION are
+ * registered with SIM_PERSISTENT() by build.sh, loaded from an mmap'd file
+ * at boot and saved back to it when the power fails, so they keep every
+ * write made before the failure. Power failures are SIGALRM timers, after
+ * a configurable, randomized or noise_3-based time, or after the time the
+ * storage capacitor of host/power_model.c lasts.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SIM_PERSISTENT(x)           SIM_PERSISTENT_(x, __COUNTER__)
+#define SIM_PERSISTENT_(x, n)       SIM_PERSISTENT__(x, n)
+#define SIM_PERSISTENT__(x, n)                                                  \
+        static void __attribute__((constructor)) sim_persistent_##n(void)      \
+        {                                                                       \
+            sim_persistent(&(x), sizeof(x), #x);                                \
+        }
+
+/**
+ * Place a variable in the simulated FRAM (a variable registered twice is
+ * only kept once).
+ */
+void sim_persistent(const void *addr, size_t size, const char *name);
+
+/**
+ * Counters kept by the interpow runtime of the simulator, and by the hooks
+ * of libinterpow.c and of the write macros (INTERPOW_SIM in interpow.h).
+ * Commit times nest: only the outermost begin and end count.
+ */
+void sim_task_run(void);
+void sim_task_commit(void);
+void sim_commit_begin(void);
+void sim_commit_end(void);
+void sim_field_write(uint16_t bytes);
+void sim_result_sent(void);
+
+/**
+ * Cut the power after the given time (tester_autoreset()).
+ */
+void sim_schedule_failure(unsigned long microseconds);
+
+/**
+ * Monitor of the capacitor model (-p) for tester_power_monitor(), NULL
+ * without it.
+ */
+const struct __power_monitor *sim_power_monitor(void);
+
+/**
+ * The program is done (tester_notify_end()): save FRAM and stop.
+ */
+void sim_done(void);
+
+/**
+ * printf() of the device code (build.sh): the device is halted while it
+ * prints.
+ */
+int sim_printf(const char *format, ...);
+
+/**
+ * Microseconds since the boot.
+ */
+unsigned long sim_time_us(void);
+
+#endif /* SIM_H_ */
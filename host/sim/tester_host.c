@@ -0,0 +1,95 @@
+/*
+ * tester_host.c
+ *
+ * Testing facilities of tester.h for the simulator, in place of libtester.c:
+ * the start and end notifications, the results and the automatic resets go
+ * to the simulator instead of the GPIO, the UART and Timer0_A0, and the
+ * power monitor reads its capacitor model.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#include <tester.h>
+
+#include "sim.h"
+
+/* Persistent on the device too */
+unsigned int noise_idx = 0;
+unsigned int next_test_idx = 0;
+
+SIM_PERSISTENT(noise_idx)
+SIM_PERSISTENT(next_test_idx)
+
+
+void tester_send_data(uint16_t test_idx, fann_type* calc_out, unsigned int len)
+{
+    (void) calc_out;
+    (void) len;
+
+    /* Re-executed sends are dropped, as on the device */
+    if (test_idx < next_test_idx) {
+        return;
+    }
+    sim_result_sent();
+    next_test_idx++;
+}
+
+
+void uart_init(void)
+{
+}
+
+
+uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+    uint8_t i;
+
+    crc ^= byte;
+    for (i = 0; i < 8; i++) {
+        crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ TESTER_FRAME_CRC_POLY) : (uint8_t) (crc << 1);
+    }
+    return crc;
+}
+
+
+void set_clk_to_8_MHz(void)
+{
+}
+
+
+void tester_notify_start(void)
+{
+}
+
+
+void tester_notify_end(void)
+{
+    sim_done();
+}
+
+
+void tester_autoreset(unsigned int interval, void* noise_pattern, uint8_t is_signed)
+{
+    long us;
+
+    if (is_signed) {
+        us = (long) interval + ((int16_t*) noise_pattern)[noise_idx];
+    }
+    else {
+        us = (long) interval + ((uint16_t*) noise_pattern)[noise_idx];
+    }
+    if (us < 0) us = 0;
+    if (us > 0xFFFF) us = 0xFFFF;
+
+    sim_schedule_failure((unsigned long) us);
+
+    if (++noise_idx >= NOISE_LEN) {
+        noise_idx = 0;
+    }
+}
+
+
+const struct __power_monitor* tester_power_monitor(void)
+{
+    return sim_power_monitor();
+}
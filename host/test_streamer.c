@@ -0,0 +1,439 @@
+/*
+ * test_streamer.c
+ *
+ * Host side of the streaming input mode (see stream.h): send the records of
+ * a FANN data file to the device as they are requested by its credit
+ * frames, then the end-of-stream frame.
+ *
+ * Every other byte received from the device (e.g. the result frames sent
+ * with REPORT enabled) is written to the file given with -o, which can then
+ * be checked with result_receiver:
+ *
+ *   ./test_streamer -o results.bin /dev/ttyACM1 ../database/thyroid.test
+ *   ./result_receiver -i results.bin ../database/thyroid_trained.h ../database/thyroid.test
+ *
+ * With -n larger than the data file, records are sent over and over again
+ * (record i is record i % num_data of the file), to evaluate long runs.
+ *
+ * Build (from this directory):
+ *
+ *   cc -O2 -Wall -I../fann/inc -o test_streamer test_streamer.c fann_ref.c -lm
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fann_ref.h"
+
+/* Must match tester.h and stream.h */
+#define FRAME_SYNC_0        0xA5
+#define FRAME_SYNC_1        0x5A
+#define CREDIT_SYNC_1       0xC3
+#define FRAME_CRC_POLY      0x07
+#define FRAME_MAX_PAYLOAD   255
+#define FRAME_OVERHEAD      6
+#define CREDIT_LEN          5
+
+struct options {
+    const char *device;
+    const char *data_path;
+    const char *out_path;
+    unsigned int baud;
+    unsigned int slots;
+    unsigned long num_records;
+    unsigned int timeout_ms;
+    unsigned int max_retries;
+    int verbose;
+};
+
+struct streamer {
+    const struct options *opt;
+    const struct ref_data *data;
+    int fd;
+    FILE *out;
+
+    unsigned long acked;            // records consumed by the device
+    unsigned long sent;             // next record to send
+    int credit_seen;
+    int done;
+
+    /* credit frame parser */
+    uint8_t credit[CREDIT_LEN];
+    unsigned int credit_len;
+
+    unsigned long bytes_sent;
+    unsigned long records_sent;
+    unsigned long high_water;       // records sent at least once
+    unsigned long credits;
+    unsigned long timeouts;
+};
+
+
+static uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+    uint8_t bit;
+
+    crc ^= byte;
+    for (bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ FRAME_CRC_POLY) : (uint8_t) (crc << 1);
+    }
+
+    return crc;
+}
+
+
+static double monotonic_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static speed_t baud_to_speed(unsigned int baud)
+{
+    switch (baud) {
+    case 9600:   return B9600;
+    case 19200:  return B19200;
+    case 38400:  return B38400;
+    case 57600:  return B57600;
+    case 115200: return B115200;
+    default:     return 0;
+    }
+}
+
+
+static int set_raw(int fd, unsigned int baud)
+{
+    struct termios tio;
+    speed_t speed = baud_to_speed(baud);
+
+    if (tcgetattr(fd, &tio) != 0) {
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    if (speed != 0) {
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+    }
+
+    return tcsetattr(fd, TCSANOW, &tio);
+}
+
+
+static int send_frame(struct streamer *s, unsigned long idx, const fann_type *input,
+                      const fann_type *output, unsigned int len)
+{
+    uint8_t frame[FRAME_MAX_PAYLOAD + FRAME_OVERHEAD];
+    unsigned int i, in_len = s->data->num_input * sizeof(fann_type);
+    uint8_t crc = 0;
+
+    frame[0] = FRAME_SYNC_0;
+    frame[1] = FRAME_SYNC_1;
+    frame[2] = idx & 0xFF;
+    frame[3] = (idx >> 8) & 0xFF;
+    frame[4] = len;
+    if (len > 0) {
+        memcpy(frame + 5, input, in_len);
+        memcpy(frame + 5 + in_len, output, len - in_len);
+    }
+    for (i = 2; i < 5 + len; i++) {
+        crc = crc8_update(crc, frame[i]);
+    }
+    frame[5 + len] = crc;
+
+    if (write(s->fd, frame, len + FRAME_OVERHEAD) != (ssize_t) (len + FRAME_OVERHEAD)) {
+        perror(s->opt->device);
+        return -1;
+    }
+    s->bytes_sent += len + FRAME_OVERHEAD;
+
+    return 0;
+}
+
+
+/**
+ * Send every record allowed by the last credit and not sent yet, or the
+ * end-of-stream frame once the device asks for the record after the last.
+ */
+static int fill_window(struct streamer *s)
+{
+    const struct ref_data *d = s->data;
+    unsigned int len = (d->num_input + d->num_output) * sizeof(fann_type);
+    unsigned long rec;
+
+    if (s->acked == s->opt->num_records) {
+        return send_frame(s, s->acked, NULL, NULL, 0);
+    }
+
+    while (s->sent < s->acked + s->opt->slots && s->sent < s->opt->num_records) {
+        rec = s->sent % d->num_data;
+        if (send_frame(s, s->sent, d->input + rec * d->num_input, d->output + rec * d->num_output, len) != 0) {
+            return -1;
+        }
+        s->records_sent++;
+        s->sent++;
+        if (s->sent > s->high_water) {
+            s->high_water = s->sent;
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ * Credit indices are 16-bit: expand to the record number closest to the
+ * last acknowledged one.
+ */
+static void on_credit(struct streamer *s, uint16_t idx)
+{
+    unsigned long next = s->acked + (uint16_t) (idx - (uint16_t) s->acked);
+
+    if ((uint16_t) (idx - (uint16_t) s->acked) >= 0x8000) {
+        next = s->acked;    // stale credit (older than the last one)
+    }
+
+    s->credits++;
+    if (s->opt->verbose) {
+        fprintf(stderr, "credit %lu\n", next);
+    }
+
+    if (next > s->opt->num_records) {
+        return;
+    }
+    if (!s->credit_seen || next != s->acked) {
+        s->credit_seen = 1;
+        s->acked = next;
+    }
+    else {
+        /* Same credit again: the device rebooted and lost what was in
+         * flight, send the window again. */
+        s->sent = s->acked;
+    }
+    if (s->sent < s->acked) {
+        s->sent = s->acked;
+    }
+    if (s->acked == s->opt->num_records) {
+        s->done = 1;
+    }
+}
+
+
+/**
+ * Pick the credit frames out of the byte stream and pass everything else
+ * through to the output file.
+ */
+static void parse_bytes(struct streamer *s, const uint8_t *buf, size_t len)
+{
+    size_t i;
+    uint8_t b, crc;
+
+    for (i = 0; i < len; i++) {
+        b = buf[i];
+
+        if (s->credit_len == 0) {
+            if (b == FRAME_SYNC_0) {
+                s->credit[s->credit_len++] = b;
+            }
+            else if (s->out != NULL) {
+                fputc(b, s->out);
+            }
+            continue;
+        }
+        if (s->credit_len == 1 && b != CREDIT_SYNC_1) {
+            /* not a credit frame */
+            s->credit_len = 0;
+            if (s->out != NULL) {
+                fputc(FRAME_SYNC_0, s->out);
+            }
+            i--;
+            continue;
+        }
+
+        s->credit[s->credit_len++] = b;
+        if (s->credit_len == CREDIT_LEN) {
+            crc = crc8_update(crc8_update(0, s->credit[2]), s->credit[3]);
+            if (crc == s->credit[4]) {
+                on_credit(s, s->credit[2] | (s->credit[3] << 8));
+            }
+            else if (s->out != NULL) {
+                fwrite(s->credit, 1, CREDIT_LEN, s->out);
+            }
+            s->credit_len = 0;
+        }
+    }
+}
+
+
+static int stream(struct streamer *s)
+{
+    const struct options *opt = s->opt;
+    struct pollfd pfd;
+    uint8_t buf[512];
+    unsigned int retries = 0;
+    ssize_t n;
+    int ret;
+
+    pfd.fd = s->fd;
+    pfd.events = POLLIN;
+
+    while (1) {
+        ret = poll(&pfd, 1, opt->timeout_ms);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0) {
+            perror("poll");
+            return -1;
+        }
+
+        if (ret == 0) {
+            /* No news from the device: it may be off or have lost frames. */
+            if (!s->credit_seen) {
+                continue;
+            }
+            if (++retries > (s->done ? 2 : opt->max_retries)) {
+                return s->done ? 0 : -1;
+            }
+            s->timeouts++;
+            s->sent = s->acked;
+            if (fill_window(s) != 0) {
+                return -1;
+            }
+            continue;
+        }
+
+        n = read(s->fd, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            if (s->done) {
+                return 0;
+            }
+            fprintf(stderr, "%s: connection closed\n", opt->device);
+            return -1;
+        }
+        retries = 0;
+
+        parse_bytes(s, buf, n);
+        if (s->credit_seen && fill_window(s) != 0) {
+            return -1;
+        }
+    }
+}
+
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [options] <device> <data.test>\n"
+        "  -b <baud>   baud rate (default: 19200)\n"
+        "  -s <slots>  records in flight, must match STREAM_SLOTS (default: 2)\n"
+        "  -n <num>    number of records to stream (default: all records of the data file)\n"
+        "  -t <ms>     re-send timeout (default: 500)\n"
+        "  -r <num>    timeouts in a row before giving up (default: 20)\n"
+        "  -o <file>   write everything else received from the device to <file>\n"
+        "  -v          print every credit\n",
+        prog);
+}
+
+
+int main(int argc, char **argv)
+{
+    struct options opt;
+    struct ref_data data;
+    struct streamer s;
+    double t_start, dt;
+    int c, ret;
+
+    memset(&opt, 0, sizeof(opt));
+    opt.baud = 19200;
+    opt.slots = 2;
+    opt.timeout_ms = 500;
+    opt.max_retries = 20;
+
+    while ((c = getopt(argc, argv, "b:s:n:t:r:o:vh")) != -1) {
+        switch (c) {
+        case 'b': opt.baud = strtoul(optarg, NULL, 10); break;
+        case 's': opt.slots = strtoul(optarg, NULL, 10); break;
+        case 'n': opt.num_records = strtoul(optarg, NULL, 10); break;
+        case 't': opt.timeout_ms = strtoul(optarg, NULL, 10); break;
+        case 'r': opt.max_retries = strtoul(optarg, NULL, 10); break;
+        case 'o': opt.out_path = optarg; break;
+        case 'v': opt.verbose = 1; break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (argc - optind != 2 || opt.slots == 0 || opt.timeout_ms == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    opt.device = argv[optind];
+    opt.data_path = argv[optind + 1];
+
+    if (ref_data_load(&data, opt.data_path, 0) != 0) {
+        return 2;
+    }
+    if ((data.num_input + data.num_output) * sizeof(fann_type) > FRAME_MAX_PAYLOAD) {
+        fprintf(stderr, "Records too large for a frame\n");
+        return 2;
+    }
+    if (opt.num_records == 0) {
+        opt.num_records = data.num_data;
+    }
+
+    memset(&s, 0, sizeof(s));
+    s.opt = &opt;
+    s.data = &data;
+
+    s.fd = open(opt.device, O_RDWR | O_NOCTTY);
+    if (s.fd < 0 || (isatty(s.fd) && set_raw(s.fd, opt.baud) != 0)) {
+        perror(opt.device);
+        return 2;
+    }
+    if (opt.out_path != NULL && (s.out = fopen(opt.out_path, "wb")) == NULL) {
+        perror(opt.out_path);
+        return 2;
+    }
+
+    printf("Waiting for the device on %s...\n", opt.device);
+    fflush(stdout);
+
+    t_start = monotonic_seconds();
+    ret = stream(&s);
+    dt = monotonic_seconds() - t_start;
+
+    printf("%lu/%lu records consumed, %lu frames sent (%lu re-sent), %lu credits, %lu timeouts\n",
+           s.acked, opt.num_records, s.records_sent, s.records_sent - s.high_water, s.credits, s.timeouts);
+    if (dt > 0) {
+        printf("%.3f s: %.2f records/s, %.1f B/s sent\n", dt, s.acked / dt, s.bytes_sent / dt);
+    }
+
+    if (s.out != NULL) {
+        fclose(s.out);
+    }
+    close(s.fd);
+    ref_data_free(&data);
+
+    return (ret == 0 && s.done) ? 0 : 1;
+}
@@ -0,0 +1,669 @@
+#include <interpow/interpow.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef INTERPOW_TELEMETRY
+#include <stdio.h>
+#endif
+#ifdef INTERPOW_TELEMETRY_CYCLES
+#include "profiler.h"
+#endif
+
+/*
+ * Transactions (see the "Transactions" group in interpow.h).
+ *
+ * The log is a sequence of entries, each one followed by its data padded to
+ * a pointer. Nothing is written to the destinations before the commit: the
+ * commit point is the single write of tx_pending in the program state, and
+ * applying the log is idempotent, so it is simply done again by
+ * tx_resume_program() if the power fails before tx_pending is cleared.
+ */
+struct tx_entry {
+    void *dst_0;
+    void *dst_1;
+    uint16_t size;
+};
+
+#define TX_ALIGN(N) (((N) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+#define TX_ENTRY_SIZE TX_ALIGN(sizeof(struct tx_entry))
+
+
+void tx_begin(__tx *tx)
+{
+    tx->used = 0;
+}
+
+
+void tx_stage(__tx *tx, void *dst_0, void *dst_1, const void *src, uint16_t size)
+{
+    struct tx_entry *entry = (struct tx_entry *) ((uint8_t *) tx->log + tx->used);
+    uint16_t entry_size = TX_ENTRY_SIZE + TX_ALIGN(size);
+
+    if ((uint16_t) (tx->capacity - tx->used) < entry_size) {
+        /* Log too small for the transaction: a bug, not a runtime condition */
+        for (;;);
+    }
+
+    entry->dst_0 = dst_0;
+    entry->dst_1 = dst_1;
+    entry->size = size;
+    memcpy((uint8_t *) entry + TX_ENTRY_SIZE, src, size);
+
+    /* The entry only becomes part of the log here */
+    tx->used += entry_size;
+}
+
+
+static void tx_apply(const __tx *tx)
+{
+    const uint8_t *it = (const uint8_t *) tx->log;
+    const uint8_t *end = it + tx->used;
+    const struct tx_entry *entry;
+
+    while (it < end) {
+        entry = (const struct tx_entry *) it;
+        memcpy(entry->dst_0, it + TX_ENTRY_SIZE, entry->size);
+        if (entry->dst_1 != NULL) {
+            memcpy(entry->dst_1, it + TX_ENTRY_SIZE, entry->size);
+        }
+        it += TX_ENTRY_SIZE + TX_ALIGN(entry->size);
+    }
+}
+
+
+static void tx_finish(__tx *tx, __program_state *ps)
+{
+    __sim_commit_begin()
+    tx_apply(tx);
+    start_task(tx->next_task, ps);
+    ps->tx_pending = NULL;
+    __sim_commit_end()
+}
+
+
+void tx_commit(__tx *tx, __task *next, __program_state *ps)
+{
+    tx->next_task = next;
+    __tm_commit(tx, next, ps)
+    /* Commit point */
+    ps->tx_pending = tx;
+    __sim_commit()
+    tx_finish(tx, ps);
+}
+
+
+void tx_resume_program(__program_state *ps)
+{
+    /*
+     * The next task has not run yet while tx_pending is set, so the
+     * destinations still hold either the old or the logged values.
+     */
+    if (ps->tx_pending != NULL) {
+        tx_finish(ps->tx_pending, ps);
+    }
+    __tm_attempt(ps)
+    resume_program(ps);
+}
+
+
+/*
+ * Just-in-time checkpoints (see the "Just-in-time checkpoints" group in
+ * interpow.h).
+ *
+ * The descriptor lives in SRAM, so restored is cleared by every reboot:
+ * the first jit_resume() after a power failure reloads the committed image.
+ */
+static void *jit_image(__jit *j, uint16_t which)
+{
+    return (uint8_t *) j->images + which * j->size;
+}
+
+
+void jit_set_monitor(__jit *j, const __power_monitor *monitor)
+{
+    j->monitor = monitor;
+    if (monitor != NULL && monitor->init != NULL) {
+        monitor->init();
+    }
+}
+
+
+void jit_resume(__jit *j)
+{
+    uint16_t committed;
+
+    if (!j->restored) {
+        committed = *j->committed;
+        memcpy(j->state, jit_image(j, committed), j->size);
+        j->curr_task = j->tasks[committed];
+        j->restored = 1;
+    }
+    __sim_run()
+    j->curr_task->task_function();
+}
+
+
+void jit_start_task(__jit *j, __task *next, uint8_t save)
+{
+    uint16_t free;
+
+    j->curr_task = next;
+
+    /* Without a monitor, fall back to a save at every task boundary */
+    if (save || j->monitor == NULL || j->monitor->low == NULL || j->monitor->low()) {
+        __sim_commit_begin()
+        __sim_write(j->size)
+        free = *j->committed ^ 1;
+        memcpy(jit_image(j, free), j->state, j->size);
+        j->tasks[free] = next;
+        /* Commit point */
+        *j->committed = free;
+        __sim_commit()
+        __sim_commit_end()
+    }
+}
+
+
+/*
+ * Scheduler (see the "Scheduler" group in interpow.h).
+ *
+ * Posts are only collected in SRAM while a task runs, and lost with it on a
+ * power failure; sched_switch() stages them in the pending bits with the end
+ * of the running task, and commits both with the switch to the next task.
+ */
+static uint16_t sched_bit(const __scheduler *s, const __task *task)
+{
+    uint8_t i;
+
+    for (i = 0; i < s->num_entries; i++) {
+        if (s->entries[i].task == task) {
+            return 1u << i;
+        }
+    }
+    return 0;
+}
+
+
+void sched_post(__scheduler *s, __task *task)
+{
+    s->posted |= sched_bit(s, task);
+}
+
+
+void sched_switch(__scheduler *s, uint8_t begin, __program_state *ps)
+{
+    uint16_t pending = (*s->pending & ~sched_bit(s, ps->curr_task)) | s->posted;
+    const __sched_entry *entry, *best = NULL;
+    uint8_t i;
+
+    for (i = 0; i < s->num_entries; i++) {
+        entry = &s->entries[i];
+        if (best != NULL && entry->priority <= best->priority) {
+            continue;
+        }
+        if ((pending & (1u << i)) || (entry->trigger != NULL && entry->trigger())) {
+            best = entry;
+        }
+    }
+
+    if (begin) {
+        tx_begin(s->tx);
+    }
+    tx_stage(s->tx, s->pending, NULL, &pending, sizeof(pending));
+    s->posted = 0;
+    tx_commit(s->tx, best != NULL ? best->task : s->idle, ps);
+}
+
+
+/*
+ * Self-field banks (see the "Self-field banks" group in interpow.h).
+ *
+ * As for block self-fields below, the map holds two bitmaps, one bit per
+ * field telling which copy holds it, and a last word telling which bitmap
+ * is committed; a field whose bits differ in the two bitmaps has already
+ * been written in this run.
+ */
+#define SFB_COMMITTED(b) ((b)->map[2 * (b)->num_words])
+
+void sfb_begin(__self_field_bank *b)
+{
+    uint16_t committed = SFB_COMMITTED(b);
+
+    memcpy(b->map + (committed ^ 1) * b->num_words, b->map + committed * b->num_words,
+           b->num_words * sizeof(uint16_t));
+}
+
+
+void sfb_read(__bank_self_field *f, void *dst)
+{
+    __self_field_bank *b = f->bank;
+    uint16_t *work = b->map + (SFB_COMMITTED(b) ^ 1) * b->num_words;
+
+    memcpy(dst, (work[f->bit >> 4] >> (f->bit & 15)) & 1 ? f->base_addr_1 : f->base_addr_0, f->size);
+}
+
+
+void sfb_write(__bank_self_field *f, const void *src)
+{
+    __self_field_bank *b = f->bank;
+    uint16_t committed = SFB_COMMITTED(b);
+    uint16_t *done = b->map + committed * b->num_words + (f->bit >> 4);
+    uint16_t *work = b->map + (committed ^ 1) * b->num_words + (f->bit >> 4);
+    uint16_t bit = 1u << (f->bit & 15);
+    uint16_t copy = (*work & bit) ? 1 : 0;
+
+    __tm_write(f->size)
+    if ((*done & bit) == (*work & bit)) {
+        /* First write in this run: to the free copy, then switch to it */
+        memcpy(copy ? f->base_addr_0 : f->base_addr_1, src, f->size);
+        *work ^= bit;
+    }
+    else {
+        memcpy(copy ? f->base_addr_1 : f->base_addr_0, src, f->size);
+    }
+}
+
+
+void sfb_commit(__self_field_bank *b)
+{
+    SFB_COMMITTED(b) ^= 1;
+}
+
+
+void sfb_tx_commit(__self_field_bank *b, __tx *tx)
+{
+    uint16_t committed = SFB_COMMITTED(b) ^ 1;
+
+    tx_stage(tx, &SFB_COMMITTED(b), NULL, &committed, sizeof(committed));
+}
+
+
+/*
+ * Block self-fields (see the "Block self-fields" group in interpow.h).
+ *
+ * The map holds two bitmaps, one bit per block telling which copy holds the
+ * block, and a last word telling which bitmap is committed. A run works on
+ * the other bitmap: a block whose bits differ in the two bitmaps has already
+ * been copied in this run, so the working copy can be written in place. A
+ * block is copied before its bit is flipped, so an interrupted run never
+ * changes what the committed bitmap points to.
+ */
+#define BSF_COMMITTED(f) ((f)->map[2 * (f)->num_words])
+
+static uint16_t *bsf_map(__block_self_field *f, uint16_t which)
+{
+    return f->map + which * f->num_words;
+}
+
+
+static uint8_t *bsf_base(__block_self_field *f, uint16_t copy)
+{
+    return (uint8_t *) (copy ? f->base_addr_1 : f->base_addr_0);
+}
+
+
+void bsf_begin(__block_self_field *f)
+{
+    uint16_t committed = BSF_COMMITTED(f);
+
+    memcpy(bsf_map(f, committed ^ 1), bsf_map(f, committed), f->num_words * sizeof(uint16_t));
+}
+
+
+void bsf_read(__block_self_field *f, void *dst, uint16_t pos, uint16_t count)
+{
+    uint16_t *work = bsf_map(f, BSF_COMMITTED(f) ^ 1);
+    uint8_t *out = (uint8_t *) dst;
+    uint16_t block, copy, n;
+
+    while (count > 0) {
+        block = pos / f->block_length;
+        n = (block + 1) * f->block_length - pos;
+        if (n > count) {
+            n = count;
+        }
+        copy = (work[block >> 4] >> (block & 15)) & 1;
+        memcpy(out, bsf_base(f, copy) + pos * f->element_size, n * f->element_size);
+        out += n * f->element_size;
+        pos += n;
+        count -= n;
+    }
+}
+
+
+void bsf_write(__block_self_field *f, const void *src, uint16_t pos, uint16_t count)
+{
+    uint16_t committed = BSF_COMMITTED(f);
+    uint16_t *done = bsf_map(f, committed);
+    uint16_t *work = bsf_map(f, committed ^ 1);
+    const uint8_t *in = (const uint8_t *) src;
+    uint16_t block, bit, first, last, copy, n;
+
+    __tm_write(count * f->element_size)
+    while (count > 0) {
+        block = pos / f->block_length;
+        bit = 1u << (block & 15);
+        first = block * f->block_length;
+        last = first + f->block_length;
+        if (last > f->length) {
+            last = f->length;
+        }
+        n = last - pos;
+        if (n > count) {
+            n = count;
+        }
+        copy = (work[block >> 4] & bit) ? 1 : 0;
+
+        if ((done[block >> 4] & bit) == (work[block >> 4] & bit)) {
+            /* First write to the block in this run: copy it to the free copy,
+             * unless it is entirely overwritten */
+            if (pos != first || n != last - first) {
+                memcpy(bsf_base(f, copy ^ 1) + first * f->element_size,
+                       bsf_base(f, copy) + first * f->element_size,
+                       (last - first) * f->element_size);
+            }
+            memcpy(bsf_base(f, copy ^ 1) + pos * f->element_size, in, n * f->element_size);
+            work[block >> 4] ^= bit;
+        }
+        else {
+            memcpy(bsf_base(f, copy) + pos * f->element_size, in, n * f->element_size);
+        }
+
+        in += n * f->element_size;
+        pos += n;
+        count -= n;
+    }
+}
+
+
+void bsf_commit(__block_self_field *f)
+{
+    BSF_COMMITTED(f) ^= 1;
+}
+
+
+void bsf_tx_commit(__block_self_field *f, __tx *tx)
+{
+    uint16_t committed = BSF_COMMITTED(f) ^ 1;
+
+    tx_stage(tx, &BSF_COMMITTED(f), NULL, &committed, sizeof(committed));
+}
+
+
+/*
+ * Paged self-fields (see the "Paged self-fields" group in interpow.h).
+ *
+ * The table holds two page tables, the byte telling which one is committed
+ * and a bitmap of the pages of the pool in use, rebuilt by psf_begin(). An
+ * entry stores the page of the pool XOR the page of the field, so that the
+ * zero-initialised tables map every page of the field to the same page of
+ * the pool. As for block self-fields, a run works on the uncommitted table,
+ * and a page is copied before its entry is changed.
+ */
+#define PSF_COMMITTED(f) ((f)->table[2 * (f)->num_pages])
+
+static uint8_t *psf_table(__paged_self_field *f, uint8_t which)
+{
+    return f->table + which * f->num_pages;
+}
+
+
+static uint8_t *psf_used(__paged_self_field *f)
+{
+    return f->table + 2 * f->num_pages + 1;
+}
+
+
+static uint8_t *psf_page(__paged_self_field *f, uint8_t page)
+{
+    return (uint8_t *) f->pages + (uint16_t) page * f->page_length * f->element_size;
+}
+
+
+void psf_begin(__paged_self_field *f)
+{
+    uint8_t committed = PSF_COMMITTED(f);
+    uint8_t *done = psf_table(f, committed);
+    uint8_t *used = psf_used(f);
+    uint8_t page, pool;
+
+    memcpy(psf_table(f, committed ^ 1), done, f->num_pages);
+    memset(used, 0, (f->num_pages + f->num_spare + 7) / 8);
+    for (page = 0; page < f->num_pages; page++) {
+        pool = done[page] ^ page;
+        used[pool >> 3] |= 1u << (pool & 7);
+    }
+}
+
+
+void psf_read(__paged_self_field *f, void *dst, uint16_t pos, uint16_t count)
+{
+    uint8_t *work = psf_table(f, PSF_COMMITTED(f) ^ 1);
+    uint8_t *out = (uint8_t *) dst;
+    uint16_t page, offset, n;
+
+    while (count > 0) {
+        page = pos / f->page_length;
+        offset = pos - page * f->page_length;
+        n = f->page_length - offset;
+        if (n > count) {
+            n = count;
+        }
+        memcpy(out, psf_page(f, work[page] ^ page) + offset * f->element_size, n * f->element_size);
+        out += n * f->element_size;
+        pos += n;
+        count -= n;
+    }
+}
+
+
+/**
+ * INTERNAL FUNCTION
+ *
+ * Take a page of the pool used by neither table.
+ */
+static uint8_t psf_alloc(__paged_self_field *f)
+{
+    uint8_t *used = psf_used(f);
+    uint8_t pool, last = f->num_pages + f->num_spare;
+
+    for (pool = 0; pool < last; pool++) {
+        if (!(used[pool >> 3] & (1u << (pool & 7)))) {
+            used[pool >> 3] |= 1u << (pool & 7);
+            return pool;
+        }
+    }
+    /* More pages written in a run than spare pages: a bug, not a runtime condition */
+    for (;;);
+}
+
+
+void psf_write(__paged_self_field *f, const void *src, uint16_t pos, uint16_t count)
+{
+    uint8_t committed = PSF_COMMITTED(f);
+    uint8_t *done = psf_table(f, committed);
+    uint8_t *work = psf_table(f, committed ^ 1);
+    const uint8_t *in = (const uint8_t *) src;
+    uint16_t page, offset, n, page_size;
+    uint8_t pool;
+
+    __tm_write(count * f->element_size)
+    while (count > 0) {
+        page = pos / f->page_length;
+        offset = pos - page * f->page_length;
+        n = f->page_length - offset;
+        if (page * f->page_length + n > f->length) {
+            n = f->length - page * f->page_length;
+        }
+        if (n > count) {
+            n = count;
+        }
+
+        if (done[page] == work[page]) {
+            /* First write to the page in this run: shadow it, unless it is
+             * entirely overwritten */
+            pool = psf_alloc(f);
+            page_size = f->page_length * f->element_size;
+            if (offset != 0 || n != f->page_length) {
+                memcpy(psf_page(f, pool), psf_page(f, done[page] ^ page), page_size);
+            }
+            memcpy(psf_page(f, pool) + offset * f->element_size, in, n * f->element_size);
+            work[page] = pool ^ page;
+        }
+        else {
+            memcpy(psf_page(f, work[page] ^ page) + offset * f->element_size, in, n * f->element_size);
+        }
+
+        in += n * f->element_size;
+        pos += n;
+        count -= n;
+    }
+}
+
+
+void psf_commit(__paged_self_field *f)
+{
+    PSF_COMMITTED(f) ^= 1;
+}
+
+
+void psf_tx_commit(__paged_self_field *f, __tx *tx)
+{
+    uint8_t committed = PSF_COMMITTED(f) ^ 1;
+
+    tx_stage(tx, &PSF_COMMITTED(f), NULL, &committed, sizeof(committed));
+}
+
+
+/*
+ * Loop tasks (see the "Loop tasks" group in interpow.h).
+ *
+ * The index is only written by the transaction ending a run, with the
+ * writes staged by the body: a run cut by a power failure starts again from
+ * the committed index, and the last run resets it together with the switch
+ * to the next task.
+ */
+void loop_run(__loop *l, uint16_t count, __program_state *ps)
+{
+    uint16_t index = *l->index;
+    __task *next = l->task;
+
+    tx_begin(l->tx);
+    if (index < count) {
+        l->first = index;
+        l->last = (count - index > l->every) ? index + l->every - 1 : count - 1;
+        for (; index <= l->last; index++) {
+            l->body(index);
+        }
+    }
+    if (index >= count) {
+        index = 0;
+        next = l->next;
+    }
+    tx_stage(l->tx, l->index, NULL, &index, sizeof(index));
+    tx_commit(l->tx, next, ps);
+}
+
+#ifdef INTERPOW_TELEMETRY
+/*
+ * Telemetry (see the "Telemetry" group in interpow.h).
+ *
+ * The counters of a task switch are new values staged in its transaction,
+ * not increments: applying the log again after a power failure writes the
+ * same values, so a switch is counted once, when it commits. The attempts
+ * are counted when they begin, and the interrupted ones are the attempts
+ * that never completed. running and bytes only describe the attempt in
+ * progress, and timing does not survive the power: the profiler only runs
+ * from the attempt of this boot.
+ */
+#ifdef INTERPOW_TELEMETRY_CYCLES
+static uint8_t tm_timing = 0;
+#endif
+
+
+static __tm_task *tm_find(const __task *task)
+{
+    uint8_t i;
+
+    for (i = 0; i < __interpow_tm.num_tasks; i++) {
+        if (__interpow_tm.tasks[i].task == task) {
+            return &__interpow_tm.tasks[i];
+        }
+    }
+    return NULL;
+}
+
+
+void tm_start_task(__task *task, __program_state *ps)
+{
+    tx_begin(__interpow_tm.tx);
+    tx_commit(__interpow_tm.tx, task, ps);
+}
+
+
+void tm_stage(__tx *tx, __task *next, __program_state *ps)
+{
+    __tm_task *done = tm_find(ps->curr_task);
+    __tm_task *start = tm_find(next);
+    uint32_t end[3];
+    uint32_t starts;
+
+    if (done != NULL) {
+        /* completions, bytes and cycles follow each other */
+        end[0] = done->completions + 1;
+        end[1] = done->bytes + __interpow_tm.bytes;
+        end[2] = done->cycles;
+#ifdef INTERPOW_TELEMETRY_CYCLES
+        if (tm_timing) {
+            end[2] += profiler_stop();
+            tm_timing = 0;
+        }
+#endif
+        tx_stage(tx, &done->completions, NULL, end, sizeof(end));
+    }
+    if (start != NULL) {
+        starts = start->starts + 1;
+        tx_stage(tx, &start->starts, NULL, &starts, sizeof(starts));
+    }
+}
+
+
+void tm_attempt(__program_state *ps)
+{
+    __tm_task *run = tm_find(ps->curr_task);
+
+    __interpow_tm.bytes = 0;
+    __interpow_tm.running = run;
+    if (run != NULL) {
+        run->attempts++;
+#ifdef INTERPOW_TELEMETRY_CYCLES
+        profiler_start();
+        tm_timing = 1;
+#endif
+    }
+}
+
+
+void tm_write(uint16_t bytes)
+{
+    __interpow_tm.bytes += bytes;
+}
+
+
+void tm_dump(__telemetry *tm)
+{
+    const __tm_task *t;
+    uint32_t interrupted;
+
+    /* A row is only passed once printed */
+    for (; tm->next_row < tm->num_tasks; tm->next_row++) {
+        t = &tm->tasks[tm->next_row];
+        interrupted = t->attempts - t->completions - (t == tm->running ? 1 : 0);
+        printf("%s: %lu starts, %lu attempts (%lu interrupted), %lu completions, "
+               "%lu bytes, %lu cycles\n", t->name,
+               (unsigned long) t->starts, (unsigned long) t->attempts,
+               (unsigned long) interrupted, (unsigned long) t->completions,
+               (unsigned long) t->bytes, (unsigned long) t->cycles);
+    }
+}
+#endif // INTERPOW_TELEMETRY
@@ -0,0 +1,221 @@
+#include <msp430.h>
+#include <stream.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if (STREAM_SLOTS & (STREAM_SLOTS - 1)) != 0 || STREAM_SLOTS < 2
+#error STREAM_SLOTS must be a power of two, at least 2
+#endif
+
+/* Compile-time check: records must fit in a frame. */
+typedef char stream_record_fits_in_frame[(STREAM_RECORD_SIZE <= TESTER_FRAME_MAX_PAYLOAD) ? 1 : -1];
+
+/*
+ * A slot holds a record only if valid is set and index matches: the
+ * receiver clears valid before overwriting a slot and sets it again after
+ * the checksum has been verified, so a power failure in between leaves an
+ * empty slot behind.
+ */
+struct stream_slot {
+    uint16_t index;
+    uint8_t valid;
+    fann_type record[STREAM_NUM_INPUT + STREAM_NUM_OUTPUT];
+};
+
+#pragma NOINIT(stream_ring)
+struct stream_slot stream_ring[STREAM_SLOTS];
+
+#pragma NOINIT(stream_end_valid)
+uint8_t stream_end_valid;
+
+#pragma NOINIT(stream_end_index)
+uint16_t stream_end_index;
+
+/* Receiver state, lost on power failure (the host re-sends on timeout). */
+enum rx_state {
+    RX_SYNC_0,
+    RX_SYNC_1,
+    RX_IDX_L,
+    RX_IDX_H,
+    RX_LEN,
+    RX_PAYLOAD,
+    RX_CRC
+};
+
+static volatile uint16_t consumed = 0;  // every record before it is released
+static bool receiver_on = false;
+
+static enum rx_state rx_state = RX_SYNC_0;
+static uint16_t rx_idx;
+static uint8_t rx_len, rx_count, rx_crc;
+static struct stream_slot *rx_slot;     // NULL: payload discarded
+
+
+void stream_init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < STREAM_SLOTS; i++) {
+        stream_ring[i].valid = 0;
+    }
+    stream_end_valid = 0;
+}
+
+
+static void stream_put_byte(uint8_t byte)
+{
+    while (!(UCA1IFG & UCTXIFG));
+    UCA1TXBUF = byte;
+}
+
+
+void stream_ack(uint16_t next_idx)
+{
+    uint8_t crc = 0;
+
+    if (!receiver_on) {
+        set_clk_to_8_MHz();     // the receiver needs SMCLK at all times
+        uart_init();
+        UCA1IE |= UCRXIE;
+        __bis_SR_register(GIE);
+        receiver_on = true;
+    }
+
+    consumed = next_idx;
+
+    /* Send credit frame (see stream.h for the layout). */
+    crc = crc8_update(crc, next_idx & 0xFF);
+    crc = crc8_update(crc, next_idx >> 8);
+    stream_put_byte(TESTER_FRAME_SYNC_0);
+    stream_put_byte(STREAM_CREDIT_SYNC_1);
+    stream_put_byte(next_idx & 0xFF);
+    stream_put_byte(next_idx >> 8);
+    stream_put_byte(crc);
+}
+
+
+uint8_t stream_wait(uint16_t idx, fann_type **input, fann_type **output)
+{
+    struct stream_slot *slot = &stream_ring[idx % STREAM_SLOTS];
+
+    while (1) {
+        __disable_interrupt();
+        if (slot->valid && slot->index == idx) {
+            __enable_interrupt();
+            *input = slot->record;
+            *output = slot->record + STREAM_NUM_INPUT;
+            return STREAM_RECORD;
+        }
+        if (stream_end_valid && (uint16_t) (idx - stream_end_index) < 0x8000) {
+            __enable_interrupt();
+            return STREAM_END;
+        }
+        /* Sleep until the receiver stores a frame (GIE set atomically). */
+        __bis_SR_register(LPM0_bits | GIE);
+    }
+}
+
+
+/**
+ * Decide where the payload of the frame being received goes: into the slot
+ * of rx_idx if the record is inside the credit window and not received yet,
+ * nowhere otherwise.
+ */
+static void rx_select_slot(void)
+{
+    struct stream_slot *slot = &stream_ring[rx_idx % STREAM_SLOTS];
+
+    rx_slot = NULL;
+    if (rx_len != STREAM_RECORD_SIZE || (uint16_t) (rx_idx - consumed) >= STREAM_SLOTS) {
+        return;
+    }
+    if (slot->valid && slot->index == rx_idx) {
+        return;     // re-sent record, already here
+    }
+    slot->valid = 0;
+    rx_slot = slot;
+}
+
+
+static bool rx_byte(uint8_t byte)
+{
+    bool stored = false;
+
+    switch (rx_state) {
+    case RX_SYNC_0:
+        if (byte == TESTER_FRAME_SYNC_0) {
+            rx_state = RX_SYNC_1;
+        }
+        break;
+    case RX_SYNC_1:
+        rx_state = (byte == TESTER_FRAME_SYNC_1) ? RX_IDX_L :
+                   (byte == TESTER_FRAME_SYNC_0) ? RX_SYNC_1 : RX_SYNC_0;
+        rx_crc = 0;
+        break;
+    case RX_IDX_L:
+        rx_idx = byte;
+        rx_crc = crc8_update(rx_crc, byte);
+        rx_state = RX_IDX_H;
+        break;
+    case RX_IDX_H:
+        rx_idx |= (uint16_t) byte << 8;
+        rx_crc = crc8_update(rx_crc, byte);
+        rx_state = RX_LEN;
+        break;
+    case RX_LEN:
+        rx_len = byte;
+        rx_count = 0;
+        rx_crc = crc8_update(rx_crc, byte);
+        rx_select_slot();
+        rx_state = (rx_len > 0) ? RX_PAYLOAD : RX_CRC;
+        break;
+    case RX_PAYLOAD:
+        if (rx_slot != NULL) {
+            ((uint8_t*) rx_slot->record)[rx_count] = byte;
+        }
+        rx_crc = crc8_update(rx_crc, byte);
+        if (++rx_count == rx_len) {
+            rx_state = RX_CRC;
+        }
+        break;
+    case RX_CRC:
+        if (byte == rx_crc) {
+            if (rx_len == 0) {
+                stream_end_index = rx_idx;
+                stream_end_valid = 1;
+                stored = true;
+            }
+            else if (rx_slot != NULL) {
+                rx_slot->index = rx_idx;
+                rx_slot->valid = 1;
+                stored = true;
+            }
+        }
+        rx_state = RX_SYNC_0;
+        break;
+    }
+
+    return stored;
+}
+
+
+// USCI_A1 interrupt service routine
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector = USCI_A1_VECTOR
+__interrupt void USCI_A1_ISR (void)
+#elif defined(__GNUC__)
+void __attribute__ ((interrupt(USCI_A1_VECTOR))) USCI_A1_ISR (void)
+#else
+#error Compiler not supported!
+#endif
+{
+    switch (__even_in_range(UCA1IV, USCI_UART_UCTXCPTIFG)) {
+    case USCI_UART_UCRXIFG:
+        if (rx_byte(UCA1RXBUF)) {
+            __bic_SR_register_on_exit(LPM0_bits);   // wake up stream_wait()
+        }
+        break;
+    default:
+        break;
+    }
+}
@@ -1,6 +1,7 @@
 #include <msp430.h>
 #include <tester.h>
 #include <stdbool.h>
+#include <interpow/interpow.h>
 
 #pragma PERSISTENT(noise_idx)
 unsigned int noise_idx = 0;
@@ -10,9 +11,16 @@ unsigned int next_test_idx = 0;
 
 uint16_t csctl1, csctl3, csctl4;
 
+static bool uart_initialized = false;
+
 
 void uart_init()
 {
+    if (uart_initialized) {
+        return;
+    }
+    uart_initialized = true;
+
 	PM5CTL0 &= ~LOCKLPM5;       // Disable the GPIO power-on default high-impedance mode
                                 // to activate previously configured port settings
 
@@ -80,34 +88,65 @@ void restore_clock()
 }
 
 
+uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+    uint8_t bit;
+
+    crc ^= byte;
+    for (bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ TESTER_FRAME_CRC_POLY) : (uint8_t) (crc << 1);
+    }
+
+    return crc;
+}
+
+
+static void uart_put_byte(uint8_t byte)
+{
+    while (!(UCA1IFG & UCTXIFG));
+    UCA1TXBUF = byte;
+}
+
+
 void uart_send_data(uint16_t test_idx, fann_type* calc_out, unsigned int len)
 {
-	static bool uart_initialized = false;
 	uint8_t* data;
+	uint8_t crc = 0;
 
-	if (!uart_initialized) {
-		uart_init();
-		uart_initialized = true;
-	}
+	uart_init();
+
+    if (len > TESTER_FRAME_MAX_PAYLOAD) {
+        len = TESTER_FRAME_MAX_PAYLOAD;
+    }
 
     set_clk_to_8_MHz();
 
-	/* Send test index. */
+    /* Send frame header (see tester.h for the layout). */
+    uart_put_byte(TESTER_FRAME_SYNC_0);
+    uart_put_byte(TESTER_FRAME_SYNC_1);
+
+	/* Send test index (little endian). */
 	data = (uint8_t*) &test_idx;
-	while (!(UCA1IFG & UCTXIFG));
-	UCA1TXBUF = *data;
-	data++;
-	while (!(UCA1IFG & UCTXIFG));
-	UCA1TXBUF = *data;
+	crc = crc8_update(crc, data[0]);
+	uart_put_byte(data[0]);
+	crc = crc8_update(crc, data[1]);
+	uart_put_byte(data[1]);
+
+	/* Send payload length. */
+	crc = crc8_update(crc, (uint8_t) len);
+	uart_put_byte((uint8_t) len);
 
 	/* Send output data. */
 	data = (uint8_t*) calc_out;
 	while (len--) {
-		while (!(UCA1IFG & UCTXIFG));
-		UCA1TXBUF = *data;
+		crc = crc8_update(crc, *data);
+		uart_put_byte(*data);
 		data++;
 	}
 
+	/* Send checksum. */
+	uart_put_byte(crc);
+
     while (!UCTXCPTIFG);
     __delay_cycles(80000); // delay 10 ms
 
@@ -180,6 +219,45 @@ void tester_autoreset(unsigned int interval, void* noise_pattern, uint8_t is_sig
 }
 
 
+/// 12-bit code of AVCC/2 at TESTER_POWER_LOW_MV, against the 2.0 V reference
+#define POWER_LOW_CODE ((uint16_t) ((uint32_t) TESTER_POWER_LOW_MV * 4096 / 4000))
+
+static void power_monitor_init(void)
+{
+    while (REFCTL0 & REFGENBUSY);
+    REFCTL0 = REFVSEL_1 | REFON;                // 2.0 V reference, kept on
+
+    ADC12CTL0 = ADC12SHT0_4 | ADC12ON;          // sample for 64 ADC12CLK cycles
+    ADC12CTL1 = ADC12SHP;                       // sampling timer, started by ADC12SC
+    ADC12CTL2 = ADC12RES_2;                     // 12-bit conversion
+    ADC12CTL3 = ADC12BATMAP;                    // AVCC/2 on channel A31
+    ADC12MCTL0 = ADC12VRSEL_1 | ADC12INCH_31;   // VR+ = VREF buffered, VR- = AVSS
+
+    while (!(REFCTL0 & REFGENRDY));             // wait for the reference to settle
+}
+
+
+static uint8_t power_monitor_low(void)
+{
+    ADC12CTL0 |= ADC12ENC | ADC12SC;            // single conversion of AVCC/2
+    while (!(ADC12IFGR0 & ADC12IFG0));
+
+    return ADC12MEM0 < POWER_LOW_CODE;          // reading ADC12MEM0 clears the flag
+}
+
+
+static const struct __power_monitor power_monitor = {
+    .init = power_monitor_init,
+    .low = power_monitor_low
+};
+
+
+const struct __power_monitor* tester_power_monitor(void)
+{
+    return &power_monitor;
+}
+
+
 // Timer0_A0 interrupt service routine
 #if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
 #pragma vector = TIMER0_A0_VECTOR
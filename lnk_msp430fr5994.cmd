@@ -181,6 +181,9 @@ SECTIONS
     .const            : {} >> FRAM | FRAM2  /* Constant data                     */
 #endif
 
+    .fram2            : {} > FRAM2          /* Far data (fann_far_data.h)        */
+    .fram2_noinit     : {} > FRAM2, type = NOINIT /* Far model (FANN_FAR_MODEL) */
+
 #ifndef __LARGE_CODE_MODEL__
     .text             : {} > FRAM           /* Code                              */
 #else
@@ -4,10 +4,80 @@
 #include <stdlib.h>
 
 #include "fann.h"
-#include "thyroid_test.h"
 #include "profiler.h"
 /*Intermittent Tester*/
 #include <tester.h>
+#include <stream.h>
+
+//#define STREAM_INPUT          // receive test records over UART (see stream.h)
+//#define COMPRESSED_DATASET    // decode records of the full compressed data set
+//#define FAR_DATASET           // read records of the full data set from FRAM2
+//#define CASCADE_TRAIN         // grow a new network on the test set before testing it
+//#define ONLINE_TRAIN          // fine-tune the output layer on the first test records
+//#define TX_COMMIT             // commit the test index and the error counters together
+//#define LOOP_TASK             // test LOOP_EVERY records per run of a loop task (see interpow.h)
+//#define JIT_CHECKPOINT        // keep the test state in SRAM, saved when the power monitor warns
+//#define SCHEDULER             // switch tasks with a scheduler, printing the progress on a trigger
+//#define CONFUSION_BANK        // count the confusion matrix in 9 bank self-fields of the test task
+//#define BLOCK_CLASSES         // keep the class computed for every record in a block self-field
+//#define PAGED_CLASSES         // the same in a paged self-field, kept once
+
+#if defined(CASCADE_TRAIN) && !defined(FANN_CASCADE_ARENA)
+#error "CASCADE_TRAIN needs FANN_CASCADE_ARENA in the project predefined symbols"
+#endif
+#if defined(ONLINE_TRAIN) && !defined(FANN_ONLINE)
+#error "ONLINE_TRAIN needs FANN_ONLINE in the project predefined symbols"
+#endif
+#if defined(ONLINE_TRAIN) && (defined(STREAM_INPUT) || defined(COMPRESSED_DATASET) || \
+                              defined(FAR_DATASET) || defined(CASCADE_TRAIN))
+#error "ONLINE_TRAIN reads the calibration records from thyroid_test.h"
+#endif
+#if defined(LOOP_TASK) && (!defined(TX_COMMIT) || defined(STREAM_INPUT))
+#error "LOOP_TASK needs TX_COMMIT and the number of records before testing"
+#endif
+#if defined(JIT_CHECKPOINT) && (defined(TX_COMMIT) || defined(LOOP_TASK) || defined(STREAM_INPUT) || \
+                                defined(CASCADE_TRAIN) || defined(ONLINE_TRAIN))
+#error "JIT_CHECKPOINT tasks keep their state in SRAM, with no fields or transactions"
+#endif
+#if defined(SCHEDULER) && (!defined(TX_COMMIT) || defined(LOOP_TASK) || defined(STREAM_INPUT))
+#error "SCHEDULER commits the task switches in tx_test and needs the number of records"
+#endif
+#if defined(CONFUSION_BANK) && (!defined(TX_COMMIT) || defined(LOOP_TASK))
+#error "CONFUSION_BANK commits the bank with the test index, in tx_test"
+#endif
+#if (defined(BLOCK_CLASSES) || defined(PAGED_CLASSES)) && \
+    (!defined(TX_COMMIT) || defined(LOOP_TASK) || defined(STREAM_INPUT) || \
+     defined(COMPRESSED_DATASET) || defined(FAR_DATASET))
+#error "the kept classes are committed in tx_test, for the records of thyroid_test.h"
+#endif
+#if defined(BLOCK_CLASSES) && defined(PAGED_CLASSES)
+#error "BLOCK_CLASSES and PAGED_CLASSES keep the same field"
+#endif
+
+/// Number of test records used as calibration samples by ONLINE_TRAIN
+#define ONLINE_NUM_SAMPLES 100
+
+/// Number of test records per run of TASK_FANN_TEST with LOOP_TASK
+#define LOOP_EVERY 8
+
+/// Number of test records between two progress lines with SCHEDULER
+#define SCHED_PROGRESS_EVERY 100
+
+/// Number of classes of the test records, for CONFUSION_BANK and the kept classes
+#define NUM_CLASSES 3
+
+/// Number of elements per block (page) of the classes kept by BLOCK_CLASSES
+/// (PAGED_CLASSES)
+#define CLASSES_BLOCK 16
+
+#if defined(STREAM_INPUT)
+#elif defined(COMPRESSED_DATASET)
+#include "thyroid_test_compressed.h"
+#elif defined(FAR_DATASET)
+#include "thyroid_test_far.h"
+#else
+#include "thyroid_test.h"
+#endif
 
 /*
  *******************************************************************************
@@ -16,8 +86,21 @@
  */
 
 void task_fann_load(void);
+#ifdef LOOP_TASK
+void task_fann_test_record(uint16_t test_index);
+#else
 void task_fann_test(void);
+#endif
 void task_result(void);
+#ifdef CASCADE_TRAIN
+void task_cascade_train(void);
+#endif
+#ifdef ONLINE_TRAIN
+void task_online_train(void);
+#endif
+#ifdef SCHEDULER
+void task_progress(void);
+#endif
 
 /*
  *******************************************************************************
@@ -28,12 +111,29 @@ void task_result(void);
 #pragma PERSISTENT(TASK_FANN_LOAD)
 NewTask(TASK_FANN_LOAD, task_fann_load, 1) // with self-field
 
+#ifndef LOOP_TASK
 #pragma PERSISTENT(TASK_FANN_TEST)
 NewTask(TASK_FANN_TEST, task_fann_test, 1) // with self-field
+#endif
 
 #pragma PERSISTENT(TASK_RESULT)
 NewTask(TASK_RESULT, task_result, 1) // with self-field
 
+#ifdef CASCADE_TRAIN
+#pragma PERSISTENT(TASK_CASCADE_TRAIN)
+NewTask(TASK_CASCADE_TRAIN, task_cascade_train, 0) // progress kept by the arena
+#endif
+
+#ifdef ONLINE_TRAIN
+#pragma PERSISTENT(TASK_ONLINE_TRAIN)
+NewTask(TASK_ONLINE_TRAIN, task_online_train, 0) // progress kept with the weights
+#endif
+
+#ifdef SCHEDULER
+#pragma PERSISTENT(TASK_PROGRESS)
+NewTask(TASK_PROGRESS, task_progress, 0) // next line kept in progress_mark
+#endif
+
 /*
  *******************************************************************************
  * Inform the program about the task to execute on the first start of the
@@ -41,8 +141,10 @@ NewTask(TASK_RESULT, task_result, 1) // with self-field
  *******************************************************************************
  */
 
+#ifndef JIT_CHECKPOINT
 #pragma PERSISTENT(PersState)
 InitialTask(TASK_FANN_LOAD)
+#endif // JIT_CHECKPOINT (the current task is saved with the state)
 
 /*
  *******************************************************************************
@@ -52,12 +154,205 @@ InitialTask(TASK_FANN_LOAD)
 
 //// This self-field helps TASK_FIND_MIN keep track of the array whose minimum
 //// has to be found (array a to d)
+#if !defined(LOOP_TASK) && !defined(JIT_CHECKPOINT)
 #pragma PERSISTENT(PersSField0(TASK_FANN_TEST, sf_test_index))
 #pragma PERSISTENT(PersSField1(TASK_FANN_TEST, sf_test_index))
 /* task, name, type, len, code */
 NewSelfField(TASK_FANN_TEST, sf_test_index, UINT16, 1, SELF_FIELD_CODE_1)
+#endif
 //
 
+#ifdef TX_COMMIT
+/// Error counters of the committed records. The counters of fram_ann are
+/// only a working copy, restored at the beginning of every test, so that a
+/// power failure never counts a record twice.
+struct test_totals {
+    float MSE_value;
+    unsigned int num_MSE;
+    unsigned int num_bit_fail;
+};
+
+#pragma PERSISTENT(test_totals)
+struct test_totals test_totals = {0};
+
+/// Commits the next test index with the counters, the pending tasks of
+/// SCHEDULER and the fields of CONFUSION_BANK and BLOCK_CLASSES or
+/// PAGED_CLASSES (the log also fits the 8-byte pointers of host/sim)
+#pragma PERSISTENT(PersTxLog(tx_test))
+#pragma PERSISTENT(PersTx(tx_test))
+NewTransaction(tx_test, 192)
+
+static void test_totals_reset(void)
+{
+    test_totals.MSE_value = 0;
+    test_totals.num_MSE = 0;
+    test_totals.num_bit_fail = 0;
+}
+#endif // TX_COMMIT
+
+#ifdef LOOP_TASK
+/// The test index is kept and committed by the runtime, with the counters
+/// staged by the last record of every run
+#pragma PERSISTENT(TASK_FANN_TEST)
+#pragma PERSISTENT(PersLoopIndex(TASK_FANN_TEST))
+NewLoopTask(TASK_FANN_TEST, task_fann_test_record, num_data, LOOP_EVERY, TASK_RESULT, tx_test)
+#endif // LOOP_TASK
+
+#if defined(CONFUSION_BANK) || defined(BLOCK_CLASSES) || defined(PAGED_CLASSES)
+/* Class of an output or label vector: its largest value. */
+static uint8_t class_of(const fann_type *values)
+{
+    uint8_t i, best = 0;
+
+    for (i = 1; i < NUM_CLASSES; i++) {
+        if (values[i] > values[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+#endif // CONFUSION_BANK, BLOCK_CLASSES, PAGED_CLASSES
+
+#ifdef CONFUSION_BANK
+/// Count of the test records of label L classified as P in conf_LP, one
+/// bank self-field each: more than the 8 self-fields a task can own
+#pragma PERSISTENT(PersSFBankMap(TASK_FANN_TEST))
+NewSelfFieldBank(TASK_FANN_TEST, conf_00, conf_01, conf_02,
+                                 conf_10, conf_11, conf_12,
+                                 conf_20, conf_21, conf_22)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_00))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_00))
+NewBankSelfField(TASK_FANN_TEST, conf_00, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_01))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_01))
+NewBankSelfField(TASK_FANN_TEST, conf_01, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_02))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_02))
+NewBankSelfField(TASK_FANN_TEST, conf_02, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_10))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_10))
+NewBankSelfField(TASK_FANN_TEST, conf_10, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_11))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_11))
+NewBankSelfField(TASK_FANN_TEST, conf_11, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_12))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_12))
+NewBankSelfField(TASK_FANN_TEST, conf_12, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_20))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_20))
+NewBankSelfField(TASK_FANN_TEST, conf_20, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_21))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_21))
+NewBankSelfField(TASK_FANN_TEST, conf_21, UINT16, 1)
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, conf_22))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, conf_22))
+NewBankSelfField(TASK_FANN_TEST, conf_22, UINT16, 1)
+
+/// The class indexes the fields: row the label, column the output
+#define CONFUSION(L, P) &GetField(TASK_FANN_TEST, TASK_FANN_TEST, conf_##L##P)
+static __bank_self_field *const confusion[NUM_CLASSES][NUM_CLASSES] = {
+    {CONFUSION(0, 0), CONFUSION(0, 1), CONFUSION(0, 2)},
+    {CONFUSION(1, 0), CONFUSION(1, 1), CONFUSION(1, 2)},
+    {CONFUSION(2, 0), CONFUSION(2, 1), CONFUSION(2, 2)}
+};
+
+/* Count a test record in the bank, committed by the next TxCommit(). */
+static void confusion_count(const fann_type *label, const fann_type *out)
+{
+    __bank_self_field *f = confusion[class_of(label)][class_of(out)];
+    uint16_t count;
+
+    sfb_read(f, &count);
+    ++count;
+    sfb_write(f, &count);
+    TxCommitSelfFieldBank(tx_test, TASK_FANN_TEST);
+}
+#endif // CONFUSION_BANK
+
+#if defined(BLOCK_CLASSES) || defined(PAGED_CLASSES)
+/// Number of records of thyroid_test.h
+#define NUM_TEST_RECORDS (sizeof(output) / sizeof(output[0]))
+#endif
+
+#if defined(BLOCK_CLASSES)
+/// Class computed for every test record: a run copies the block of the
+/// record it writes, not the whole array
+#pragma PERSISTENT(PersSField0(TASK_FANN_TEST, sf_classes))
+#pragma PERSISTENT(PersSField1(TASK_FANN_TEST, sf_classes))
+#pragma PERSISTENT(PersBSFieldMap(TASK_FANN_TEST, sf_classes))
+NewBlockSelfField(TASK_FANN_TEST, sf_classes, UINT8, NUM_TEST_RECORDS, CLASSES_BLOCK)
+#elif defined(PAGED_CLASSES)
+/// Class computed for every test record, kept once: a run writes the page
+/// of its record to the only spare page, taken again by the next run when
+/// the power fails before the commit
+#pragma PERSISTENT(PersPSFieldPages(TASK_FANN_TEST, sf_classes))
+#pragma PERSISTENT(PersPSFieldTable(TASK_FANN_TEST, sf_classes))
+NewPagedSelfField(TASK_FANN_TEST, sf_classes, UINT8, NUM_TEST_RECORDS, CLASSES_BLOCK, 1)
+#endif // BLOCK_CLASSES, PAGED_CLASSES
+
+#ifdef SCHEDULER
+/// Number of tested records at which TASK_PROGRESS prints the next line,
+/// following the index so that a run done again sets it to the same value
+#pragma PERSISTENT(progress_mark)
+uint16_t progress_mark = SCHED_PROGRESS_EVERY;
+
+/* Trigger of TASK_PROGRESS, polled before the running task commits. */
+static uint8_t progress_due(void)
+{
+    return *SelfFieldIn(TASK_FANN_TEST, sf_test_index) >= progress_mark;
+}
+
+/// TASK_FANN_TEST posts itself while records are left, TASK_PROGRESS runs
+/// first whenever its line is due, and TASK_RESULT once no task is ready
+#pragma PERSISTENT(PersSchedPending(sched_test))
+NewScheduler(sched_test, tx_test, TASK_RESULT,
+             SchedEntry(TASK_PROGRESS, 2, progress_due),
+             SchedEntry(TASK_FANN_TEST, 1, 0))
+#endif // SCHEDULER
+
+#ifdef JIT_CHECKPOINT
+/// Next test index and error counters, in SRAM, saved to FRAM with the next
+/// task when the power monitor warns. The counters of fram_ann are only a
+/// working copy, restored at the beginning of every test, so that the tests
+/// run again after a power failure never count a record twice.
+struct test_state {
+    uint16_t index;
+    float MSE_value;
+    unsigned int num_MSE;
+    unsigned int num_bit_fail;
+};
+
+#pragma PERSISTENT(PersJitImage(jit_test))
+#pragma PERSISTENT(PersJitTask(jit_test))
+#pragma PERSISTENT(PersJitCommitted(jit_test))
+NewJit(jit_test, struct test_state, TASK_FANN_LOAD)
+#endif // JIT_CHECKPOINT
+
+#ifdef INTERPOW_TELEMETRY
+/// Runs, power failures and commits of every task, printed by TASK_RESULT
+#if defined(CASCADE_TRAIN)
+#define TELEMETRY_TRAIN TelemetryTask(TASK_CASCADE_TRAIN),
+#elif defined(ONLINE_TRAIN)
+#define TELEMETRY_TRAIN TelemetryTask(TASK_ONLINE_TRAIN),
+#else
+#define TELEMETRY_TRAIN
+#endif
+#ifdef SCHEDULER
+#define TELEMETRY_SCHED TelemetryTask(TASK_PROGRESS),
+#else
+#define TELEMETRY_SCHED
+#endif
+#pragma PERSISTENT(PersTelemetryLog)
+#pragma PERSISTENT(PersTelemetryTx)
+#pragma PERSISTENT(PersTelemetryTasks)
+#pragma PERSISTENT(PersTelemetry)
+NewTelemetry(TelemetryTask(TASK_FANN_LOAD),
+             TELEMETRY_TRAIN
+             TelemetryTask(TASK_FANN_TEST),
+             TELEMETRY_SCHED
+             TelemetryTask(TASK_RESULT))
+#endif // INTERPOW_TELEMETRY
+
 /*
  *******************************************************************************
  * main
@@ -68,8 +363,33 @@ static struct fann *ann;
 #pragma NOINIT(fram_ann)
 struct fann fram_ann;
 
+#ifdef COMPRESSED_DATASET
+/* Current record, decoded again whenever the test task (re-)starts. */
+static fann_type test_record[COMPRESSED_NUM_INPUT + COMPRESSED_NUM_OUTPUT];
+#endif
+
+#ifndef STREAM_INPUT
+/* Get the test record at test_index from the data set in use. */
+static void test_record_get(uint16_t test_index, fann_type **test_input, fann_type **test_output)
+{
+#if defined(COMPRESSED_DATASET)
+    *test_input = test_record;
+    *test_output = test_record + COMPRESSED_NUM_INPUT;
+    fann_decompress_record(&compressed_data, test_index, *test_input, *test_output);
+#elif defined(FAR_DATASET)
+    /// Copied to SRAM by the previous iteration, unless power failed since
+    *test_input = fann_far_get_record(&far_data, test_index);
+    *test_output = *test_input + FAR_NUM_INPUT;
+#else
+    *test_input = input[test_index];
+    *test_output = output[test_index];
+#endif
+}
+#endif // STREAM_INPUT
+
 //#define DEBUG
 //#define PROFILE
+//#define REPORT    // send every result over UART (see host/result_receiver.c)
 
 void main(void)
 {
@@ -82,9 +402,18 @@ void main(void)
     P1OUT &= ~BIT0;
 #endif
 
+#ifdef JIT_CHECKPOINT
+    /// Save when the supply of the board falls under TESTER_POWER_LOW_MV
+    /// (see tester.h)
+    JitMonitor(jit_test, tester_power_monitor());
+    while(1) {
+        JitResume(jit_test);
+    }
+#else
     while(1) {
         Resume();
     }
+#endif // JIT_CHECKPOINT
 }
 
 void task_fann_load(void) {
@@ -96,6 +425,28 @@ void task_fann_load(void) {
 
     fann_create_from_header();
     fann_reset_MSE(&fram_ann);
+#ifdef TX_COMMIT
+    test_totals_reset();
+#endif // TX_COMMIT
+#ifdef SCHEDULER
+    progress_mark = SCHED_PROGRESS_EVERY;
+#endif // SCHEDULER
+#ifdef STREAM_INPUT
+    stream_init();
+#endif // STREAM_INPUT
+#ifdef CASCADE_TRAIN
+    /// Start from scratch: only the training parameters and the output
+    /// activations of the loaded network are kept
+    fann_cascade_arena_init(&fram_ann, FANN_CASCADE_MAX_NEURONS, 0.0f);
+    StartTask(TASK_CASCADE_TRAIN);
+    return;
+#endif // CASCADE_TRAIN
+#ifdef ONLINE_TRAIN
+    /// Start from the output weights of the loaded network
+    fann_online_init(&fram_ann);
+    StartTask(TASK_ONLINE_TRAIN);
+    return;
+#endif // ONLINE_TRAIN
 #ifdef PROFILE
     /* Stop counting clock cycles. */
      uint32_t clk_cycles = profiler_stop();
@@ -111,38 +462,273 @@ void task_fann_load(void) {
     /* Start counting clock cycles. */
     profiler_start();
 #endif // PROFILE
+#ifdef JIT_CHECKPOINT
+    jit_test.index = 0;
+    jit_test.MSE_value = 0;
+    jit_test.num_MSE = 0;
+    jit_test.num_bit_fail = 0;
+    JitStartTask(jit_test, TASK_FANN_TEST);
+#elif defined(SCHEDULER)
+    Post(sched_test, TASK_FANN_TEST);
+    Schedule(sched_test);
+#else
     StartTask(TASK_FANN_TEST);
+#endif // JIT_CHECKPOINT, SCHEDULER
 }
 
+#ifdef LOOP_TASK
+void task_fann_test_record(uint16_t test_index) {
+    /// Toggle LED for every time
+#ifdef DEBUG
+    P1OUT ^= BIT0;
+#endif
+
+    fann_type *test_input, *test_output;
+
+    /// Drop the errors counted by an interrupted run
+    if (test_index == LoopFirst(TASK_FANN_TEST)) {
+        fram_ann.MSE_value = test_totals.MSE_value;
+        fram_ann.num_MSE = test_totals.num_MSE;
+        fram_ann.num_bit_fail = test_totals.num_bit_fail;
+    }
+
+    test_record_get(test_index, &test_input, &test_output);
+
+    fann_type* calc_out = fann_test(&fram_ann, test_input, test_output);
+
+#ifdef REPORT
+    /* Report the computed outputs, to be checked by host/result_receiver. */
+    tester_send_data(test_index, calc_out, fram_ann.num_output * sizeof(fann_type));
+#endif // REPORT
+
+#ifdef FAR_DATASET
+    /// Fetch the next record from FRAM2 while the current one is at hand
+    if (test_index + 1 < num_data) {
+        fann_far_prefetch(&far_data, test_index + 1);
+    }
+#endif // FAR_DATASET
+
+    /// The errors of the run are committed with the index following it
+    if (test_index == LoopLast(TASK_FANN_TEST)) {
+        struct test_totals totals = {fram_ann.MSE_value, fram_ann.num_MSE, fram_ann.num_bit_fail};
+        TxWrite(tx_test, &test_totals, &totals, sizeof(totals));
+    }
+}
+#elif defined(JIT_CHECKPOINT)
 void task_fann_test(void) {
     /// Toggle LED for every time
 #ifdef DEBUG
     P1OUT ^= BIT0;
 #endif
 
-    uint16_t test_index;
-    ReadSelfField_U16(TASK_FANN_TEST, sf_test_index, &test_index);
-    //uint8_t test_index;
-    //ReadSelfField_U8(TASK_FANN_TEST, sf_test_index, &test_index);
+    fann_type *test_input, *test_output;
+    uint16_t test_index = jit_test.index;
+
+    /// Drop the errors counted since the last save
+    fram_ann.MSE_value = jit_test.MSE_value;
+    fram_ann.num_MSE = jit_test.num_MSE;
+    fram_ann.num_bit_fail = jit_test.num_bit_fail;
 
-    fann_type* calc_out = fann_test(&fram_ann, input[test_index], output[test_index]);
+    test_record_get(test_index, &test_input, &test_output);
 
-    /*Report results*/
-    /* You need to include that statement at the termination of your intermittent program*/
-    //tester_send_data(test_index, output[test_index], 3*sizeof(fann_type*));
+    fann_type* calc_out = fann_test(&fram_ann, test_input, test_output);
 
+#ifdef REPORT
+    /* Report the computed outputs, to be checked by host/result_receiver. */
+    tester_send_data(test_index, calc_out, fram_ann.num_output * sizeof(fann_type));
+#endif // REPORT
+
+    jit_test.index = ++test_index;
+    jit_test.MSE_value = fram_ann.MSE_value;
+    jit_test.num_MSE = fram_ann.num_MSE;
+    jit_test.num_bit_fail = fram_ann.num_bit_fail;
+
+    /// All data processed? -> save before printing the result
+    if(test_index == num_data) {
+        JitCommitTask(jit_test, TASK_RESULT);
+        return;
+    }
+
+#ifdef FAR_DATASET
+    /// Fetch the next record from FRAM2 while the current one is at hand
+    fann_far_prefetch(&far_data, test_index);
+#endif // FAR_DATASET
+
+    JitStartTask(jit_test, TASK_FANN_TEST);
+}
+#else
+void task_fann_test(void) {
+    /// Toggle LED for every time
+#ifdef DEBUG
+    P1OUT ^= BIT0;
+#endif
+
+    fann_type *test_input, *test_output;
+    /// Read straight from the copy in use, with no library call
+    uint16_t test_index = *SelfFieldIn(TASK_FANN_TEST, sf_test_index);
+
+#ifdef TX_COMMIT
+    /// Drop the writes staged and the errors counted by an interrupted test
+    TxBegin(tx_test);
+    fram_ann.MSE_value = test_totals.MSE_value;
+    fram_ann.num_MSE = test_totals.num_MSE;
+    fram_ann.num_bit_fail = test_totals.num_bit_fail;
+#endif // TX_COMMIT
+#ifdef CONFUSION_BANK
+    BeginSelfFieldBank(TASK_FANN_TEST);
+#endif // CONFUSION_BANK
+#if defined(BLOCK_CLASSES)
+    BeginBlockSelfField(TASK_FANN_TEST, sf_classes);
+#elif defined(PAGED_CLASSES)
+    BeginPagedSelfField(TASK_FANN_TEST, sf_classes);
+#endif // BLOCK_CLASSES, PAGED_CLASSES
+
+#ifdef STREAM_INPUT
+    /// Release the records before the committed index, wait for the next one
+    stream_ack(test_index);
+    if (stream_wait(test_index, &test_input, &test_output) == STREAM_END) {
+        StartTask(TASK_RESULT);
+        return;
+    }
+#else
+    test_record_get(test_index, &test_input, &test_output);
+#endif // STREAM_INPUT
+
+    fann_type* calc_out = fann_test(&fram_ann, test_input, test_output);
+
+#ifdef REPORT
+    /* Report the computed outputs, to be checked by host/result_receiver. */
+    tester_send_data(test_index, calc_out, fram_ann.num_output * sizeof(fann_type));
+#endif // REPORT
+#ifdef CONFUSION_BANK
+    confusion_count(test_output, calc_out);
+#endif // CONFUSION_BANK
+#if defined(BLOCK_CLASSES)
+    uint8_t test_class = class_of(calc_out);
+
+    WriteBlockSelfField(TASK_FANN_TEST, sf_classes, &test_class, test_index, 1);
+    TxCommitBlockSelfField(tx_test, TASK_FANN_TEST, sf_classes);
+#elif defined(PAGED_CLASSES)
+    uint8_t test_class = class_of(calc_out);
+
+    WritePagedSelfField(TASK_FANN_TEST, sf_classes, &test_class, test_index, 1);
+    TxCommitPagedSelfField(tx_test, TASK_FANN_TEST, sf_classes);
+#endif // BLOCK_CLASSES, PAGED_CLASSES
+
+    ++test_index;
+#ifdef TX_COMMIT
+    /// The errors of this record are committed with the next index
+    struct test_totals totals = {fram_ann.MSE_value, fram_ann.num_MSE, fram_ann.num_bit_fail};
+    TxWrite(tx_test, &test_totals, &totals, sizeof(totals));
+#endif // TX_COMMIT
+#ifndef STREAM_INPUT
     /// All data processed? -> Done!
-    if(++test_index == num_data) {
+    /// (a stream ends when stream_wait() says so)
+    if(test_index == num_data) {
+#if defined(SCHEDULER)
+        /// Nothing posted: TASK_RESULT runs as the idle task
+        ScheduleTx(sched_test);
+#elif defined(TX_COMMIT)
+        TxCommit(tx_test, TASK_RESULT);
+#else
         StartTask(TASK_RESULT);
-    } else {
-        /// Some data left? -> update field and call task again
-        //WriteSelfField_U8(TASK_FANN_TEST, sf_test_index, &test_index);
-        WriteSelfField_U16(TASK_FANN_TEST, sf_test_index, &test_index);
-        StartTask(TASK_FANN_TEST);
+#endif // TX_COMMIT
+        return;
+    }
+#endif // STREAM_INPUT
+
+#ifdef FAR_DATASET
+    /// Fetch the next record from FRAM2 while the current one is at hand
+    fann_far_prefetch(&far_data, test_index);
+#endif // FAR_DATASET
+
+    /// Some data left? -> update field and call task again
+#ifdef TX_COMMIT
+    TxWriteSelfField(tx_test, TASK_FANN_TEST, sf_test_index, &test_index);
+#ifdef SCHEDULER
+    Post(sched_test, TASK_FANN_TEST);
+    ScheduleTx(sched_test);
+#else
+    TxCommit(tx_test, TASK_FANN_TEST);
+#endif // SCHEDULER
+#else
+    *SelfFieldOut(TASK_FANN_TEST, sf_test_index) = test_index;
+    PublishSelfField(TASK_FANN_TEST, sf_test_index);
+    StartTask(TASK_FANN_TEST);
+#endif // TX_COMMIT
+}
+#endif // LOOP_TASK, JIT_CHECKPOINT
+
+#ifdef CASCADE_TRAIN
+void task_cascade_train(void) {
+    struct fann_train_data train_data;
+
+    /// Train on the test set, read in place
+    fann_create_tests_from_header(&train_data);
+
+    /// One epoch per run, committed by the arena: a power failure only
+    /// loses the epoch in progress
+    if (fann_cascade_arena_step(&train_data) == 0) {
+        StartTask(TASK_CASCADE_TRAIN);
+        return;
     }
+
+    /// Done -> test the grown network
+    fram_ann = *fann_cascade_arena_ann();
+    fann_reset_MSE(&fram_ann);
+#ifdef TX_COMMIT
+    test_totals_reset();
+#endif // TX_COMMIT
+#ifdef PROFILE
+    /* Start counting clock cycles. */
+    profiler_start();
+#endif // PROFILE
+    StartTask(TASK_FANN_TEST);
+}
+#endif // CASCADE_TRAIN
+
+#ifdef ONLINE_TRAIN
+void task_online_train(void) {
+    /// The sample count is committed with the weights, so a power failure
+    /// never trains twice on the same record
+    uint16_t train_index = (uint16_t) fann_online_get_num_samples();
+
+    if (train_index < ONLINE_NUM_SAMPLES && train_index < num_data) {
+        fann_online_train(&fram_ann, input[train_index], output[train_index]);
+        StartTask(TASK_ONLINE_TRAIN);
+        return;
+    }
+
+    /// Done -> test the fine-tuned network
+    printf("MSE on %u calibration records: %f\n\n", train_index, fann_online_get_MSE());
+    fann_online_sync(&fram_ann);
+#ifdef PROFILE
+    /* Start counting clock cycles. */
+    profiler_start();
+#endif // PROFILE
+    StartTask(TASK_FANN_TEST);
 }
+#endif // ONLINE_TRAIN
+
+#ifdef SCHEDULER
+void task_progress(void) {
+    uint16_t num_tested = *SelfFieldIn(TASK_FANN_TEST, sf_test_index);
+
+    /// Counters committed with the last tested record (the line is printed
+    /// again if the power fails before the switch commits)
+    printf("%u records tested, MSE %f\n", num_tested,
+           test_totals.num_MSE ? test_totals.MSE_value / test_totals.num_MSE : 0.0f);
+
+    /// Not staged: the trigger is polled before the commit, and would run
+    /// this task again on the old mark
+    progress_mark = (num_tested / SCHED_PROGRESS_EVERY + 1) * SCHED_PROGRESS_EVERY;
+    Schedule(sched_test);
+}
+#endif // SCHEDULER
 
 void task_result(void) {
+    unsigned int num_tests = fram_ann.num_MSE;
+
 #ifdef DEBUG
     /// Turn on LED
     /// Error for 400 tests: 0.022107
@@ -158,19 +744,60 @@ void task_result(void) {
     printf("Run %u tests:\n"
            "-> execution cycles = %lu (%lu per test)\n"
            "-> execution time = %.3f ms (%.3f ms per test)\n\n",
-           num_data,
-           clk_cycles, clk_cycles / num_data,
-           (float) clk_cycles / 8000, (float) clk_cycles / 8000 / num_data);
+           num_tests,
+           clk_cycles, clk_cycles / num_tests,
+           (float) clk_cycles / 8000, (float) clk_cycles / 8000 / num_tests);
 #endif // PROFILE
 
     /* Print error. */
-    printf("MSE error on %d test data: %f\n\n", num_data, fann_get_MSE(&fram_ann));
+    printf("MSE error on %u test data: %f\n\n", num_tests, fann_get_MSE(&fram_ann));
+#ifdef CONFUSION_BANK
+    /// The test task is done: its writes are all committed
+    uint16_t count[NUM_CLASSES][NUM_CLASSES];
+
+    BeginSelfFieldBank(TASK_FANN_TEST);
+    for (uint8_t i = 0; i < NUM_CLASSES; i++) {
+        for (uint8_t j = 0; j < NUM_CLASSES; j++) {
+            sfb_read(confusion[i][j], &count[i][j]);
+        }
+    }
+    /// In one line, to print it within a power cycle
+    printf("Confusion matrix (label x output): %u %u %u / %u %u %u / %u %u %u\n\n",
+           count[0][0], count[0][1], count[0][2], count[1][0], count[1][1], count[1][2],
+           count[2][0], count[2][1], count[2][2]);
+#endif // CONFUSION_BANK
+#if defined(BLOCK_CLASSES) || defined(PAGED_CLASSES)
+    /// Check the kept classes against the labels, a block at a time
+    uint8_t classes[CLASSES_BLOCK];
+    uint16_t num_right = 0;
+
+#if defined(BLOCK_CLASSES)
+    BeginBlockSelfField(TASK_FANN_TEST, sf_classes);
+#else
+    BeginPagedSelfField(TASK_FANN_TEST, sf_classes);
+#endif
+    for (uint16_t i = 0; i < NUM_TEST_RECORDS; i += CLASSES_BLOCK) {
+        uint16_t n = NUM_TEST_RECORDS - i < CLASSES_BLOCK ? NUM_TEST_RECORDS - i : CLASSES_BLOCK;
+
+#if defined(BLOCK_CLASSES)
+        ReadBlockSelfField(TASK_FANN_TEST, sf_classes, classes, i, n);
+#else
+        ReadPagedSelfField(TASK_FANN_TEST, sf_classes, classes, i, n);
+#endif
+        for (uint16_t j = 0; j < n; j++) {
+            num_right += classes[j] == class_of(output[i + j]);
+        }
+    }
+    printf("Classes kept: %u of %u test data right\n\n", num_right, (unsigned int) NUM_TEST_RECORDS);
+#endif // BLOCK_CLASSES, PAGED_CLASSES
+    TelemetryDump();
 
     /* Clean-up. */
     /// TODO(rh): Clean-up is not working because of free() calls
     //fann_destroy(&fram_ann);
     //__no_operation();
 
+    tester_notify_end();
     while(1);
 
 
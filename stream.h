@@ -0,0 +1,94 @@
+/*
+ * stream.h
+ *
+ * Streaming of test records over UART, as an alternative to the data set
+ * compiled into FRAM (see host/test_streamer.c for the host side).
+ *
+ * Records are received by the UART RX interrupt into a ring of STREAM_SLOTS
+ * FRAM slots (double-buffered by default), so that the next record is
+ * received while the current one is being processed. The consumer
+ * acknowledges a record by committing the index of the next one (e.g. in a
+ * self-field) and passing it to stream_ack() at the beginning of the next
+ * task: only then is the slot of the previous record given back to the
+ * receiver and a credit sent to the host. A record being processed when
+ * power fails is therefore still in its slot when the task is re-executed.
+ *
+ * Host -> device, record frame (same layout as the result frames of tester.h):
+ *
+ *   +------+------+-------+-------+-----+-------------------+-----+
+ *   | 0xA5 | 0x5A | idx_l | idx_h | len | input, output ... | crc |
+ *   +------+------+-------+-------+-----+-------------------+-----+
+ *
+ * with len = STREAM_RECORD_SIZE; len = 0 marks the end of the stream, idx
+ * being then the number of records sent. Indices are modulo 2^16, so the
+ * stream length is not bounded.
+ *
+ * Device -> host, credit frame:
+ *
+ *   +------+------+-------+-------+-----+
+ *   | 0xA5 | 0xC3 | idx_l | idx_h | crc |
+ *   +------+------+-------+-------+-----+
+ *
+ * meaning "every record before idx has been consumed": the host may send
+ * records idx .. idx + STREAM_SLOTS - 1. CRCs are CRC-8 (polynomial 0x07,
+ * initial value 0) over idx, len and payload.
+ *
+ * UART: UCA1, TX pin P2.5, RX pin P2.6, 19200 baud, 8N1. Streaming keeps
+ * MCLK and SMCLK at 8 MHz, since the receiver must stay clocked.
+ *
+ * Created on: Oct 19, 2026
+ */
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+#include <msp430.h>
+#include <stdint.h>
+#include <tester.h>
+
+#ifndef STREAM_NUM_INPUT
+#define STREAM_NUM_INPUT            21
+#endif
+#ifndef STREAM_NUM_OUTPUT
+#define STREAM_NUM_OUTPUT           3
+#endif
+#ifndef STREAM_SLOTS
+#define STREAM_SLOTS                2
+#endif
+
+#define STREAM_RECORD_SIZE          ((STREAM_NUM_INPUT + STREAM_NUM_OUTPUT) * sizeof(fann_type))
+#define STREAM_CREDIT_SYNC_1        0xC3
+
+/* Return values of stream_wait() */
+#define STREAM_RECORD               0
+#define STREAM_END                  1
+
+/**
+ * Reset the ring and the end-of-stream marker, to be called once at the
+ * beginning of a run (e.g. in the initial task). Idempotent.
+ */
+void stream_init(void);
+
+/**
+ * Release every record before next_idx and send a credit to the host.
+ * To be called at the beginning of the consumer task with the committed
+ * index of the record to process; the UART receiver is (re-)enabled on the
+ * first call after a reboot.
+ *
+ * @param next_idx index of the next record to process
+ */
+void stream_ack(uint16_t next_idx);
+
+/**
+ * Wait (in LPM0) for record idx or for the end of the stream.
+ * The record is not copied: input and output point into its FRAM slot and
+ * stay valid until the record is released by stream_ack().
+ *
+ * @param idx index of the record
+ * @param input set to the record inputs (STREAM_NUM_INPUT values)
+ * @param output set to the record outputs (STREAM_NUM_OUTPUT values)
+ * @return STREAM_RECORD, or STREAM_END if the stream ended before idx
+ */
+uint8_t stream_wait(uint16_t idx, fann_type **input, fann_type **output);
+
+#endif /* STREAM_H_ */
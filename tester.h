@@ -24,16 +24,52 @@ typedef float fann_type;
 
 #define NOISE_LEN 200
 
+/*
+ * Result frame sent by tester_send_data():
+ *
+ *   +------+------+-------+-------+-----+-------------+-----+
+ *   | 0xA5 | 0x5A | idx_l | idx_h | len | payload ... | crc |
+ *   +------+------+-------+-------+-----+-------------+-----+
+ *
+ * idx is the test index (little endian), len the payload length in bytes,
+ * payload the raw fann_type outputs (little endian, as stored on the device)
+ * and crc a CRC-8 (polynomial 0x07, initial value 0) computed over idx, len
+ * and payload. The two sync bytes let a receiver re-align after a power
+ * failure truncated a frame. See host/result_receiver.c for the host side.
+ */
+#define TESTER_FRAME_SYNC_0         0xA5
+#define TESTER_FRAME_SYNC_1         0x5A
+#define TESTER_FRAME_CRC_POLY       0x07
+#define TESTER_FRAME_MAX_PAYLOAD    255
+
 /**
- * Send result over UART.
- * TX pin: P2.5, RX pin: P2.6
+ * Send result over UART, wrapped in a result frame (see above).
+ * TX pin: P2.5, RX pin: P2.6, 19200 baud, 8N1.
+ * Re-executed sends (test_idx already sent) are dropped on the device side.
  *
  * @param text_idx test index (from 0 to num_test - 1)
  * @param calc_out pointer to the result array
- * @param len length in byte of the data to send
+ * @param len length in byte of the data to send (at most
+ *            TESTER_FRAME_MAX_PAYLOAD)
  */
 void tester_send_data(uint16_t test_idx, fann_type* calc_out, unsigned int len);
 
+/**
+ * Configure UCA1 for 19200 baud with an 8 MHz SMCLK (only once per boot).
+ * Also used by the stream receiver (stream.h).
+ */
+void uart_init(void);
+
+/**
+ * Update a CRC-8 (polynomial TESTER_FRAME_CRC_POLY) with one byte.
+ */
+uint8_t crc8_update(uint8_t crc, uint8_t byte);
+
+/**
+ * Switch MCLK and SMCLK to 8 MHz, saving the previous configuration.
+ */
+void set_clk_to_8_MHz(void);
+
 /**
  * Notify the starting by raising a GPIO.
  * Notification pin: P1.2
@@ -57,4 +93,23 @@ void tester_notify_end(void);
  */
 void tester_autoreset(unsigned int interval, void* noise_pattern, uint8_t is_signed);
 
+/**
+ * Supply voltage in mV under which tester_power_monitor() warns, well above
+ * the 1.8 V brown-out of the MCU (as sim -w 2.4).
+ */
+#ifndef TESTER_POWER_LOW_MV
+#define TESTER_POWER_LOW_MV 2400
+#endif
+
+/**
+ * Power monitor of the board, for the just-in-time mode of interpow (see
+ * JitMonitor() in interpow.h). The board has no supply supervisor wired to
+ * the MCU, so the monitor measures AVCC/2 with the ADC12_B (channel A31,
+ * 2.0 V reference) at every just-in-time task switch, and warns under
+ * TESTER_POWER_LOW_MV. The reference stays on once the monitor is set.
+ * The simulator (host/sim) returns the monitor of its capacitor model when
+ * run with one, and NULL otherwise: every task switch then saves.
+ */
+const struct __power_monitor* tester_power_monitor(void);
+
 #endif /* TESTER_H_ */
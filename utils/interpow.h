@@ -50,9 +50,38 @@
  * \defgroup interpow_read_write Read and Write
  * Macros for read/write operations, differentiated by field types.
  *
+ * \defgroup interpow_direct Direct access
+ * Macros resolving the copy of a self-field to use, for plain loads and stores.
+ *
+ * \defgroup interpow_tx Transactions
+ * Macros to commit writes to several fields, of any channel, as one unit.
+ *
+ * \defgroup interpow_jit Just-in-time checkpoints
+ * Macros to run tasks on volatile state, saved only when power runs low.
+ *
+ * \defgroup interpow_sched Scheduler
+ * Macros to run the most important ready task instead of a fixed sequence.
+ *
+ * \defgroup interpow_bank Self-field banks
+ * Macros for tasks with more self-fields than self-field codes.
+ *
+ * \defgroup interpow_block Block self-fields
+ * Macros for large array self-fields, only copied where they are written.
+ *
+ * \defgroup interpow_paged Paged self-fields
+ * Macros for large array self-fields kept once, plus the pages written.
+ *
+ * \defgroup interpow_loop Loop tasks
+ * Macros for tasks running a loop body, committing the index every few
+ * iterations.
+ *
+ * \defgroup interpow_telemetry Telemetry
+ * Macros to count, per task, the runs, the power failures and the commits.
+ *
  * @}
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
 
@@ -130,8 +159,110 @@ typedef struct __task {
     uint16_t        sf_state;
 } __task;
 
+typedef struct __tx {
+    void            **log;
+    uint16_t        capacity;
+    uint16_t        used;
+    __task          *next_task;
+} __tx;
+
+typedef struct __power_monitor {
+    void            (*init) (void);
+    uint8_t         (*low) (void);
+} __power_monitor;
+
+typedef struct __jit {
+    void            *state;
+    void            *images;
+    __task          **tasks;
+    uint16_t        *committed;
+    uint16_t        size;
+    const __power_monitor *monitor;
+    __task          *curr_task;
+    uint8_t         restored;
+} __jit;
+
+typedef struct __sched_entry {
+    __task          *task;
+    uint8_t         priority;
+    uint8_t         (*trigger) (void);
+} __sched_entry;
+
+typedef struct __scheduler {
+    const __sched_entry *entries;
+    uint8_t         num_entries;
+    uint16_t        *pending;
+    uint16_t        posted;
+    __task          *idle;
+    __tx            *tx;
+} __scheduler;
+
+typedef struct __self_field_bank {
+    uint16_t        *map;
+    uint16_t        num_words;
+} __self_field_bank;
+
+typedef struct __bank_self_field {
+    __self_field_bank *bank;
+    void            *base_addr_0;
+    void            *base_addr_1;
+    uint16_t        size;
+    uint16_t        bit;
+} __bank_self_field;
+
+typedef struct __block_self_field {
+    void            *base_addr_0;
+    void            *base_addr_1;
+    uint16_t        *map;
+    uint16_t        length;
+    uint16_t        block_length;
+    uint16_t        num_words;
+    uint8_t         element_size;
+} __block_self_field;
+
+typedef struct __paged_self_field {
+    void            *pages;
+    uint8_t         *table;
+    uint16_t        length;
+    uint16_t        page_length;
+    uint8_t         num_pages;
+    uint8_t         num_spare;
+    uint8_t         element_size;
+} __paged_self_field;
+
+typedef struct __loop {
+    __task          *task;
+    __task          *next;
+    void            (*body) (uint16_t);
+    uint16_t        *index;
+    uint16_t        every;
+    __tx            *tx;
+    uint16_t        first;
+    uint16_t        last;
+} __loop;
+
+typedef struct __tm_task {
+    __task          *task;
+    const char      *name;
+    uint32_t        starts;
+    uint32_t        attempts;
+    uint32_t        completions;
+    uint32_t        bytes;
+    uint32_t        cycles;
+} __tm_task;
+
+typedef struct __telemetry {
+    __tm_task       *tasks;
+    uint8_t         num_tasks;
+    uint8_t         next_row;
+    __tm_task       *running;
+    uint32_t        bytes;
+    __tx            *tx;
+} __telemetry;
+
 typedef struct __program_state {
     __task          *curr_task;
+    __tx            *tx_pending;
 } __program_state;
 
 
@@ -173,6 +304,90 @@ void start_task(__task*, __program_state*);
 
 void resume_program(__program_state*);
 
+void tx_begin(__tx*);
+void tx_stage(__tx*, void*, void*, const void*, uint16_t);
+void tx_commit(__tx*, __task*, __program_state*);
+void tx_resume_program(__program_state*);
+
+void jit_set_monitor(__jit*, const __power_monitor*);
+void jit_resume(__jit*);
+void jit_start_task(__jit*, __task*, uint8_t);
+
+void sched_post(__scheduler*, __task*);
+void sched_switch(__scheduler*, uint8_t, __program_state*);
+
+void sfb_begin(__self_field_bank*);
+void sfb_read(__bank_self_field*, void*);
+void sfb_write(__bank_self_field*, const void*);
+void sfb_commit(__self_field_bank*);
+void sfb_tx_commit(__self_field_bank*, __tx*);
+
+void bsf_begin(__block_self_field*);
+void bsf_read(__block_self_field*, void*, uint16_t, uint16_t);
+void bsf_write(__block_self_field*, const void*, uint16_t, uint16_t);
+void bsf_commit(__block_self_field*);
+void bsf_tx_commit(__block_self_field*, __tx*);
+
+void psf_begin(__paged_self_field*);
+void psf_read(__paged_self_field*, void*, uint16_t, uint16_t);
+void psf_write(__paged_self_field*, const void*, uint16_t, uint16_t);
+void psf_commit(__paged_self_field*);
+void psf_tx_commit(__paged_self_field*, __tx*);
+
+void loop_run(__loop*, uint16_t, __program_state*);
+
+void tm_start_task(__task*, __program_state*);
+void tm_stage(__tx*, __task*, __program_state*);
+void tm_attempt(__program_state*);
+void tm_write(uint16_t);
+void tm_dump(__telemetry*);
+
+/*
+ * Hooks of the intermittent simulator (host/sim), only defined by its
+ * build.sh: the bytes written to fields, and the runs and commits done by
+ * libinterpow.c rather than by resume_program() and start_task().
+ */
+#ifdef INTERPOW_SIM
+void sim_task_run(void);
+void sim_task_commit(void);
+void sim_commit_begin(void);
+void sim_commit_end(void);
+void sim_field_write(uint16_t);
+#define __sim_run()                 sim_task_run();
+#define __sim_commit()              sim_task_commit();
+#define __sim_commit_begin()        sim_commit_begin();
+#define __sim_commit_end()          sim_commit_end();
+#define __sim_write(BYTES)          sim_field_write(BYTES);
+#else
+#define __sim_run()
+#define __sim_commit()
+#define __sim_commit_begin()
+#define __sim_commit_end()
+#define __sim_write(BYTES)
+#endif
+
+/*
+ * Telemetry hooks of the macros and of libinterpow.c, compiled out unless
+ * INTERPOW_TELEMETRY is defined (see \ref interpow_telemetry). The writes
+ * are counted by the simulator too. Every transaction keeps room for the
+ * two entries of counters staged by tm_stage(): two headers of at most
+ * three pointers, 12 and 4 bytes of data padded to a pointer.
+ */
+#ifdef INTERPOW_TELEMETRY
+extern __telemetry __interpow_tm;
+#define __start_task(TASK, PS)      tm_start_task(TASK, PS)
+#define __tm_attempt(PS)            tm_attempt(PS);
+#define __tm_write(BYTES)           tm_write(BYTES); __sim_write(BYTES)
+#define __tm_commit(TX, TASK, PS)   tm_stage(TX, TASK, PS);
+#define __tm_tx_reserve             (8 * sizeof(void *) + 16)
+#else
+#define __start_task(TASK, PS)      start_task(TASK, PS)
+#define __tm_attempt(PS)
+#define __tm_write(BYTES)           __sim_write(BYTES)
+#define __tm_commit(TX, TASK, PS)
+#define __tm_tx_reserve             0
+#endif
+
 
 /*
  *******************************************************************************
@@ -190,9 +405,28 @@ void resume_program(__program_state*);
 
 #define PersSField0(T, F)           __##T##T##F##_0
 #define PersSField1(T, F)           __##T##T##F##_1
+#define PersSFieldCode(T, F)        __##T##T##F##_code
+#define PersJitImage(NAME)          __jit_##NAME##_image
+#define PersJitTask(NAME)           __jit_##NAME##_task
+#define PersJitCommitted(NAME)      __jit_##NAME##_committed
+#define PersSchedPending(NAME)      __sched_##NAME##_pending
+#define PersSFBankMap(T)            __##T##_sfb_map
+#define PersBSFieldMap(T, F)        __##T##T##F##_map
+#define PersPSFieldPages(T, F)      __##T##T##F##_pages
+#define PersPSFieldTable(T, F)      __##T##T##F##_table
 
 #define GetField(S, D, F)           __##S##D##F##__
 
+#define PersTx(NAME)                __tx_##NAME
+#define PersTxLog(NAME)             __tx_##NAME##_log
+
+#define PersLoopIndex(NAME)         __loop_##NAME##_index
+
+#define PersTelemetry               __interpow_tm
+#define PersTelemetryTasks          __interpow_tm_tasks
+#define PersTelemetryTx             PersTx(__interpow_tm)
+#define PersTelemetryLog            PersTxLog(__interpow_tm)
+
 
 /**
  * \ingroup interpow_declaration
@@ -245,6 +479,7 @@ void resume_program(__program_state*);
 #define InitialTask(TASK)                                                       \
         static __program_state __prog_state = {                                 \
             .curr_task = &TASK,                                                 \
+            .tx_pending = 0                                                     \
         };
 
 
@@ -316,7 +551,8 @@ void resume_program(__program_state*);
             .base_addr_0 = &__##TASK##TASK##NAME##_0,                           \
             .base_addr_1 = &__##TASK##TASK##NAME##_1,                           \
             .code = CODE                                                        \
-        };
+        };                                                                      \
+        enum { __##TASK##TASK##NAME##_code = CODE };
 
 
 /**
@@ -579,6 +815,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_8(SRC_TASK, DST_TASK, FLD, SRC)                              \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(int8_t))   \
         write_field_8(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -597,6 +834,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_U8(SRC_TASK, DST_TASK, FLD, SRC)                             \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(uint8_t))  \
         write_field_u8(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -614,6 +852,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_8(TASK, FLD, SRC)                                        \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(int8_t))           \
         write_field_8(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -631,6 +870,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_U8(TASK, FLD, SRC)                                       \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(uint8_t))          \
         write_field_u8(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -649,6 +889,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_16(SRC_TASK, DST_TASK, FLD, SRC)                             \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(int16_t))  \
         write_field_16(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -667,6 +908,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_U16(SRC_TASK, DST_TASK, FLD, SRC)                            \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(uint16_t)) \
         write_field_u16(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -684,6 +926,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_16(TASK, FLD, SRC)                                       \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(int16_t))          \
         write_field_16(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -701,6 +944,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_U16(TASK, FLD, SRC)                                      \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(uint16_t))         \
         write_field_u16(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -719,6 +963,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_32(SRC_TASK, DST_TASK, FLD, SRC)                             \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(int32_t))  \
         write_field_32(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -737,6 +982,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_U32(SRC_TASK, DST_TASK, FLD, SRC)                            \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(uint32_t)) \
         write_field_u32(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -754,6 +1000,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_32(TASK, FLD, SRC)                                       \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(int32_t))          \
         write_field_32(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -771,6 +1018,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_U32(TASK, FLD, SRC)                                      \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(uint32_t))         \
         write_field_u32(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -789,6 +1037,7 @@ void resume_program(__program_state*);
  * @param SRC       address of the variable to write into the field
  */
 #define WriteField_F32(SRC_TASK, DST_TASK, FLD, SRC)                              \
+        __tm_write(GetField(SRC_TASK, DST_TASK, FLD).length * sizeof(float))    \
         write_field_f32(&GetField(SRC_TASK, DST_TASK, FLD), SRC, 0, &__prog_state);
 
 
@@ -806,6 +1055,7 @@ void resume_program(__program_state*);
  * @param SRC   address of the variable to write into the field
  */
 #define WriteSelfField_F32(TASK, FLD, SRC)                                        \
+        __tm_write(GetField(TASK, TASK, FLD).length * sizeof(float))            \
         write_field_f32(&GetField(TASK, TASK, FLD), SRC, 1, &__prog_state);
 
 
@@ -825,6 +1075,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_8(SRC_TASK, DST_TASK, FLD, SRC, POS)                  \
+        __tm_write(sizeof(int8_t))                                              \
         write_field_element_8(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -844,6 +1095,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_U8(SRC_TASK, DST_TASK, FLD, SRC, POS)                 \
+        __tm_write(sizeof(uint8_t))                                             \
         write_field_element_u8(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -863,6 +1115,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_16(SRC_TASK, DST_TASK, FLD, SRC, POS)                 \
+        __tm_write(sizeof(int16_t))                                             \
         write_field_element_16(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -882,6 +1135,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_U16(SRC_TASK, DST_TASK, FLD, SRC, POS)                \
+        __tm_write(sizeof(uint16_t))                                            \
         write_field_element_u16(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -901,6 +1155,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_32(SRC_TASK, DST_TASK, FLD, SRC, POS)                 \
+        __tm_write(sizeof(int32_t))                                             \
         write_field_element_32(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -920,6 +1175,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_U32(SRC_TASK, DST_TASK, FLD, SRC, POS)                \
+        __tm_write(sizeof(uint32_t))                                            \
         write_field_element_u32(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -939,6 +1195,7 @@ void resume_program(__program_state*);
  * @param POS       offset of the element to write
  */
 #define WriteFieldElement_F32(SRC_TASK, DST_TASK, FLD, SRC, POS)                  \
+        __tm_write(sizeof(float))                                               \
         write_field_element_f32(&GetField(SRC_TASK, DST_TASK, FLD), SRC, POS);
 
 
@@ -953,7 +1210,7 @@ void resume_program(__program_state*);
  * @param TASK  task to switch to
  */
 #define StartTask(TASK)                                                         \
-        start_task(&TASK, &__prog_state);
+        __start_task(&TASK, &__prog_state);
 
 
 /**
@@ -963,9 +1220,1136 @@ void resume_program(__program_state*);
  *
  * \brief
  * Resume program from last executing task. Call inside the \e main's loop.
+ *
+ * A transaction committed by the last task but not fully written yet is
+ * completed first (see \ref interpow_tx).
  */
 #define Resume()                                                                \
-        resume_program(&__prog_state);
+        tx_resume_program(&__prog_state);
+
+
+/**
+ * \ingroup interpow_direct
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Address of the copy of the self-field \e FLD of channel (\e TASK, \e TASK )
+ * holding its value, typed as the field. Use to read the field.
+ *
+ * \par Direct access
+ * `SelfFieldIn()` and `SelfFieldOut()` take the copy from the self-field
+ * state of \e TASK and the code of the field, known at compile time, with
+ * no call to the library. Resolve both at the beginning of the task, then
+ * access the field with plain loads and stores, e.g.
+ * \verbatim
+   const uint16_t *in = SelfFieldIn(T, myField);
+   uint16_t *out = SelfFieldOut(T, myField);
+   for (i = 0; i < n; i++) {
+       out[i] = in[i] + 1;
+   }
+   PublishSelfField(T, myField);
+   \endverbatim
+ * As with `WriteSelfField_*()`, every element of the field has to be
+ * written to the copy returned by `SelfFieldOut()` before publishing it, and
+ * a field can be published at most once per run of its task. The pointers
+ * are no longer valid after `PublishSelfField()`.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to read
+ */
+#define SelfFieldIn(TASK, FLD)                                                  \
+        ((TASK.sf_state & PersSFieldCode(TASK, FLD)) ?                          \
+            PersSField1(TASK, FLD) : PersSField0(TASK, FLD))
+
+
+/**
+ * \ingroup interpow_direct
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Address of the free copy of the self-field \e FLD of channel (\e TASK,
+ * \e TASK ), typed as the field. Write the new value of the field there,
+ * then call `PublishSelfField()`.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to write
+ */
+#define SelfFieldOut(TASK, FLD)                                                 \
+        ((TASK.sf_state & PersSFieldCode(TASK, FLD)) ?                          \
+            PersSField0(TASK, FLD) : PersSField1(TASK, FLD))
+
+
+/**
+ * \ingroup interpow_direct
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Make the copy returned by `SelfFieldOut()` the value of the self-field
+ * \e FLD of channel (\e TASK, \e TASK ), as `WriteSelfField_*()` does after
+ * copying: committed by the next `StartTask()`, dropped if the power fails
+ * before.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to publish
+ */
+#define PublishSelfField(TASK, FLD)                                             \
+        __tm_write(sizeof(PersSField0(TASK, FLD)))                              \
+        TASK.sf_state ^= PersSFieldCode(TASK, FLD) * 0x0101u;
+
+
+/**
+ * \ingroup interpow_direct
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Address of the field \e FLD of channel (\e SRC_TASK, \e DST_TASK ), typed
+ * as the field. Fields are kept once, so loads and stores go straight to it.
+ *
+ * @param SRC_TASK  channel's source task
+ * @param DST_TASK  channel's destination task
+ * @param FLD       field to access
+ */
+#define FieldPtr(SRC_TASK, DST_TASK, FLD)                                       \
+        (PersField(SRC_TASK, DST_TASK, FLD))
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief Create a new transaction, able to stage up to \e SIZE bytes of
+ *        writes before a commit.
+ *
+ * @param NAME  transaction's name
+ * @param SIZE  size of the log in bytes: every staged write takes the size of
+ *              the data, rounded up to a pointer, plus three words
+ *
+ * \par Commit
+ * Writes staged with `TxWrite*()` only reach their fields at `TxCommit()`,
+ * all together: the commit publishes the log with a single word written to
+ * FRAM, then copies the data to the fields and starts the next task. If the
+ * power fails before that word is written, none of the writes happened and
+ * the task runs again; if it fails after, `Resume()` completes the copy and
+ * the task switch before running any task.
+ *
+ * \par Self-fields
+ * A transaction writes both copies of a self-field, so a self-field written
+ * by a transaction must not be written by `WriteSelfField_*()` in the same
+ * run of its task.
+ *
+ * \par Non-volatility
+ * Transactions have to be non-volatile. Before declaring a transaction
+ * \e myTx, two `#pragma` have to be used, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersTxLog(myTx))
+   #pragma PERSISTENT(PersTx(myTx))
+   NewTransaction(myTx, size)
+   \endverbatim
+ */
+#define NewTransaction(NAME, SIZE)                                              \
+        void *__tx_##NAME##_log[                                                \
+            ((SIZE) + __tm_tx_reserve + sizeof(void *) - 1) / sizeof(void *)] = {0}; \
+        __tx __tx_##NAME = {                                                    \
+            .log = __tx_##NAME##_log,                                           \
+            .capacity = sizeof(__tx_##NAME##_log),                              \
+            .used = 0,                                                          \
+            .next_task = 0                                                      \
+        };
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Start staging writes, dropping the ones staged by an interrupted run of
+ * the task. Call at the beginning of the task.
+ *
+ * @param NAME  transaction's name
+ */
+#define TxBegin(NAME)                                                           \
+        tx_begin(&PersTx(NAME));
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage a write of the whole field \e FLD of channel (\e SRC_TASK, \e DST_TASK ).
+ *
+ * @param NAME      transaction's name
+ * @param SRC_TASK  channel's source task
+ * @param DST_TASK  channel's destination task
+ * @param FLD       field to write
+ * @param SRC       address of the variable to write into the field
+ */
+#define TxWriteField(NAME, SRC_TASK, DST_TASK, FLD, SRC)                        \
+        __tm_write(sizeof(PersField(SRC_TASK, DST_TASK, FLD)))                  \
+        tx_stage(&PersTx(NAME), PersField(SRC_TASK, DST_TASK, FLD), 0, SRC,     \
+                 sizeof(PersField(SRC_TASK, DST_TASK, FLD)));
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage a write of a single element of the field \e FLD of channel
+ * (\e SRC_TASK, \e DST_TASK ).
+ *
+ * @param NAME      transaction's name
+ * @param SRC_TASK  channel's source task
+ * @param DST_TASK  channel's destination task
+ * @param FLD       field to write
+ * @param SRC       address of the variable to write into the field
+ * @param POS       offset of the element to write
+ */
+#define TxWriteFieldElement(NAME, SRC_TASK, DST_TASK, FLD, SRC, POS)            \
+        __tm_write(sizeof(PersField(SRC_TASK, DST_TASK, FLD)[0]))               \
+        tx_stage(&PersTx(NAME), &PersField(SRC_TASK, DST_TASK, FLD)[POS], 0, SRC, \
+                 sizeof(PersField(SRC_TASK, DST_TASK, FLD)[0]));
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage a write of the whole self-field \e FLD of channel (\e TASK, \e TASK ).
+ *
+ * @param NAME  transaction's name
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to write
+ * @param SRC   address of the variable to write into the field
+ */
+#define TxWriteSelfField(NAME, TASK, FLD, SRC)                                  \
+        __tm_write(sizeof(PersSField0(TASK, FLD)))                              \
+        tx_stage(&PersTx(NAME), PersSField0(TASK, FLD), PersSField1(TASK, FLD), \
+                 SRC, sizeof(PersSField0(TASK, FLD)));
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage a write of \e SIZE bytes to any non-volatile variable, e.g. a
+ * result slot or accumulators kept outside of the fields.
+ *
+ * @param NAME  transaction's name
+ * @param DST   address of the non-volatile variable
+ * @param SRC   address of the data to write into it
+ * @param SIZE  number of bytes to write
+ */
+#define TxWrite(NAME, DST, SRC, SIZE)                                           \
+        __tm_write(SIZE)                                                        \
+        tx_stage(&PersTx(NAME), DST, 0, SRC, SIZE);
+
+
+/**
+ * \ingroup interpow_tx
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Commit the staged writes and switch to another task, as a single step.
+ * Use instead of `StartTask()` at the end of the task.
+ *
+ * @param NAME  transaction's name
+ * @param TASK  task to switch to
+ */
+#define TxCommit(NAME, TASK)                                                    \
+        tx_commit(&PersTx(NAME), &TASK, &__prog_state);
+
+
+/**
+ * \ingroup interpow_jit
+ *
+ * \hideinitializer
+ *
+ * \brief Declare \e NAME, the volatile state of the tasks run in
+ *        just-in-time mode, starting from \e INITIAL. \e INITIAL has to be
+ *        defined before using this macro.
+ *
+ * @param NAME      name of the state variable
+ * @param TYPE      type of the state, usually a struct
+ * @param INITIAL   first task to run
+ *
+ * \par Just-in-time mode
+ * Tasks run with `JitResume()` keep their data in the variable \e NAME, in
+ * SRAM, and end with `JitStartTask()`. A task switch only saves \e NAME and
+ * the next task to FRAM when the power monitor set with `JitMonitor()`
+ * reports that power is about to fail; without a monitor, every task switch
+ * saves them, as `StartTask()` would. After a power failure, `JitResume()`
+ * restarts from the last save, so the monitor must warn early enough for a
+ * task and a save to complete. Tasks in this mode do not use fields or
+ * self-fields, and end with `JitCommitTask()` before a task with effects
+ * outside of \e NAME, e.g. sending results.
+ *
+ * \par Commit
+ * A save writes \e NAME and the next task to the free one of two images,
+ * then switches images with a single word.
+ *
+ * \par Non-volatility
+ * The images have to be non-volatile, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersJitImage(myState))
+   #pragma PERSISTENT(PersJitTask(myState))
+   #pragma PERSISTENT(PersJitCommitted(myState))
+   NewJit(myState, struct my_state, TASK_FIRST)
+   \endverbatim
+ */
+#define NewJit(NAME, TYPE, INITIAL)                                             \
+        TYPE NAME;                                                              \
+        TYPE __jit_##NAME##_image[2] = {0};                                     \
+        __task *__jit_##NAME##_task[2] = {&INITIAL, &INITIAL};                  \
+        uint16_t __jit_##NAME##_committed = 0;                                  \
+        __jit __jit_##NAME = {                                                  \
+            .state = &NAME,                                                     \
+            .images = __jit_##NAME##_image,                                     \
+            .tasks = __jit_##NAME##_task,                                       \
+            .committed = &__jit_##NAME##_committed,                             \
+            .size = sizeof(TYPE),                                               \
+            .monitor = 0,                                                       \
+            .curr_task = 0,                                                     \
+            .restored = 0                                                       \
+        };
+
+
+/**
+ * \ingroup interpow_jit
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Set the power monitor telling when to save the state \e NAME, and call
+ * its \e init function if any. Call in the \e main, before its loop.
+ *
+ * @param NAME      name of the state variable
+ * @param MONITOR   address of a `__power_monitor`, whose \e low function
+ *                  returns nonzero when power is about to fail
+ */
+#define JitMonitor(NAME, MONITOR)                                               \
+        jit_set_monitor(&__jit_##NAME, MONITOR);
+
+
+/**
+ * \ingroup interpow_jit
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Run the current task in just-in-time mode, restoring the last saved state
+ * first after a power failure. Call inside the \e main's loop, instead of
+ * `Resume()`.
+ *
+ * @param NAME  name of the state variable
+ */
+#define JitResume(NAME)                                                         \
+        jit_resume(&__jit_##NAME);
+
+
+/**
+ * \ingroup interpow_jit
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Switch to another task in just-in-time mode, saving the state only if the
+ * power monitor asks to. Use instead of `StartTask()` at the end of the task.
+ *
+ * @param NAME  name of the state variable
+ * @param TASK  task to switch to
+ */
+#define JitStartTask(NAME, TASK)                                                \
+        jit_start_task(&__jit_##NAME, &TASK, 0);
+
+
+/**
+ * \ingroup interpow_jit
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Switch to another task in just-in-time mode, always saving the state.
+ *
+ * @param NAME  name of the state variable
+ * @param TASK  task to switch to
+ */
+#define JitCommitTask(NAME, TASK)                                               \
+        jit_start_task(&__jit_##NAME, &TASK, 1);
+
+
+/**
+ * \ingroup interpow_sched
+ *
+ * \hideinitializer
+ *
+ * \brief Create a new scheduler, choosing among the tasks listed with
+ *        `SchedEntry()`, up to 16. The tasks, \e IDLE and the transaction
+ *        \e TX have to be defined before using this macro.
+ *
+ * @param NAME  scheduler's name
+ * @param TX    name of the transaction committing the task switches
+ * @param IDLE  task to run when no task is ready
+ * @param ...   entries of the scheduled tasks, using `SchedEntry()`
+ *
+ * \par Scheduling
+ * A task ends with `Schedule()` instead of `StartTask()`. The scheduler then
+ * starts the ready task of highest priority, the first one listed on a tie,
+ * or \e IDLE if none is ready. A task is ready when it has been posted with
+ * `Post()` and has not ended since, or when its trigger returns nonzero.
+ * Triggers are polled at every `Schedule()`, so they can test flags set by
+ * interrupts, e.g. "results buffer not empty"; \e IDLE would typically wait
+ * for an interrupt and call `Schedule()` again. Triggers are polled before
+ * the writes of the running task are committed, so a task making work for
+ * another one should post it.
+ *
+ * \par Intermittence
+ * The ready queue is a word of pending bits, updated in a transaction: the
+ * end of a task, the tasks it posted and the start of the next task commit
+ * together, so a task interrupted by a power failure runs again and
+ * neither loses nor repeats its posts.
+ *
+ * \par Non-volatility
+ * The ready queue has to be non-volatile, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersSchedPending(mySched))
+   NewScheduler(mySched, myTx, TASK_IDLE,
+                SchedEntry(TASK_SENSE, 3, sensor_due),
+                SchedEntry(TASK_INFER, 2, 0),
+                SchedEntry(TASK_REPORT, 1, results_pending))
+   \endverbatim
+ */
+#define NewScheduler(NAME, TX, IDLE, ...)                                       \
+        uint16_t __sched_##NAME##_pending = 0;                                  \
+        static const __sched_entry __sched_##NAME##_entries[] = { __VA_ARGS__ }; \
+        typedef char __sched_##NAME##_fits[                                     \
+            (sizeof(__sched_##NAME##_entries) / sizeof(__sched_entry) <= 16) ? 1 : -1]; \
+        __scheduler __sched_##NAME = {                                          \
+            .entries = __sched_##NAME##_entries,                                \
+            .num_entries = sizeof(__sched_##NAME##_entries) / sizeof(__sched_entry), \
+            .pending = &__sched_##NAME##_pending,                               \
+            .posted = 0,                                                        \
+            .idle = &IDLE,                                                      \
+            .tx = &PersTx(TX)                                                   \
+        };
+
+
+/**
+ * \ingroup interpow_sched
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Entry of a scheduled task, to be listed in `NewScheduler()`.
+ *
+ * @param TASK      task to schedule
+ * @param PRIO      static priority, the higher the sooner
+ * @param TRIGGER   function returning nonzero while \e TASK has work to do,
+ *                  or 0 for a task only run when posted
+ */
+#define SchedEntry(TASK, PRIO, TRIGGER)                                         \
+        { .task = &TASK, .priority = PRIO, .trigger = TRIGGER }
+
+
+/**
+ * \ingroup interpow_sched
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Make \e TASK ready, when the running task ends with `Schedule()`. Only
+ * call from tasks: an interrupt signals work to do through a trigger.
+ *
+ * @param NAME  scheduler's name
+ * @param TASK  task to post
+ */
+#define Post(NAME, TASK)                                                        \
+        sched_post(&__sched_##NAME, &TASK);
+
+
+/**
+ * \ingroup interpow_sched
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * End the running task and switch to the most important ready task. Use
+ * instead of `StartTask()` at the end of the task.
+ *
+ * @param NAME  scheduler's name
+ */
+#define Schedule(NAME)                                                          \
+        sched_switch(&__sched_##NAME, 1, &__prog_state);
+
+
+/**
+ * \ingroup interpow_sched
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * As `Schedule()`, also committing the writes staged by the running task in
+ * the transaction of the scheduler, begun with `TxBegin()`.
+ *
+ * @param NAME  scheduler's name
+ */
+#define ScheduleTx(NAME)                                                        \
+        sched_switch(&__sched_##NAME, 0, &__prog_state);
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief Define the self-field bank of \e TASK, holding the bank
+ *        self-fields named after \e TASK. \e TASK has to be defined before
+ *        using this macro.
+ *
+ * @param TASK  task owning the bank
+ * @param ...   names of the bank self-fields of \e TASK
+ *
+ * \par Bank
+ * The self-field state of a task holds 8 codes. A bank replaces it with a
+ * bitmap of one bit per name, kept twice, and a word telling which bitmap is
+ * committed. Every bank self-field gets the bit of its name in the list,
+ * with no code to choose: the fields can be declared anywhere after the
+ * bank, and a field missing from the list, or listed twice, does not
+ * compile.
+ *
+ * \par Commit
+ * A run works on the uncommitted bitmap, copied from the committed one by
+ * `BeginSelfFieldBank()`. `CommitSelfFieldBank()` commits every bank
+ * self-field written in the run with a single word, whatever \e NUM.
+ *
+ * \par Non-volatility
+ * Banks have to be non-volatile. Before declaring the bank of \e T, a
+ * `#pragma` has to be used, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersSFBankMap(T))
+   NewSelfFieldBank(T, myField, myOtherField)
+   \endverbatim
+ */
+#define NewSelfFieldBank(TASK, ...)                                             \
+        struct __##TASK##_sfb_fields { char __VA_ARGS__; };                     \
+        uint16_t __##TASK##_sfb_map[                                            \
+            2 * ((sizeof(struct __##TASK##_sfb_fields) + 15) / 16) + 1] = {0};  \
+        __self_field_bank __##TASK##_sfb = {                                    \
+            .map = __##TASK##_sfb_map,                                          \
+            .num_words = (sizeof(struct __##TASK##_sfb_fields) + 15) / 16       \
+        };
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief Define a new bank self-field, conceptually belonging to the
+ *        self-channel (\e TASK, \e TASK ). The bank of \e TASK, listing
+ *        \e NAME, has to be defined before using this macro.
+ *
+ * @param TASK  channel's source and destination task
+ * @param NAME  field's name
+ * @param TYPE  field's TYPE, must be a value of \ref FIELD_TYPES
+ * @param LEN   field's length (if LEN>1 the field is an array)
+ *
+ * \par Non-volatility
+ * Bank self-fields are kept twice like self-fields, and need the same
+ * `#pragma`, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersSField0(T, myField))
+   #pragma PERSISTENT(PersSField1(T, myField))
+   NewBankSelfField(T, myField, type, len)
+   \endverbatim
+ */
+#define NewBankSelfField(TASK, NAME, TYPE, LEN)                                 \
+        TYPE __##TASK##TASK##NAME##_0[LEN] = {0};                               \
+        TYPE __##TASK##TASK##NAME##_1[LEN] = {0};                               \
+        __bank_self_field __##TASK##TASK##NAME##__ = {                          \
+            .bank = &__##TASK##_sfb,                                            \
+            .base_addr_0 = &__##TASK##TASK##NAME##_0,                           \
+            .base_addr_1 = &__##TASK##TASK##NAME##_1,                           \
+            .size = sizeof(__##TASK##TASK##NAME##_0),                           \
+            .bit = offsetof(struct __##TASK##_sfb_fields, NAME)                 \
+        };
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Drop the writes of an interrupted run to the bank self-fields of \e TASK.
+ * Call at the beginning of the task, before any other access to them.
+ *
+ * @param TASK  task owning the bank
+ */
+#define BeginSelfFieldBank(TASK)                                                \
+        sfb_begin(&__##TASK##_sfb);
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Read the bank self-field \e FLD of channel (\e TASK, \e TASK ), including
+ * a value written in this run.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to read
+ * @param DST   address to store the result at
+ */
+#define ReadBankSelfField(TASK, FLD, DST)                                       \
+        sfb_read(&GetField(TASK, TASK, FLD), DST);
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Write the whole bank self-field \e FLD of channel (\e TASK, \e TASK ).
+ * Unlike self-fields, a bank self-field can be written several times in a
+ * run.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to write
+ * @param SRC   address of the variable to write into the field
+ */
+#define WriteBankSelfField(TASK, FLD, SRC)                                      \
+        sfb_write(&GetField(TASK, TASK, FLD), SRC);
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Commit the writes of this run to the bank self-fields of \e TASK. Call
+ * right before `StartTask(TASK)`, in a task with no self-field written in
+ * the same run.
+ *
+ * @param TASK  task owning the bank
+ */
+#define CommitSelfFieldBank(TASK)                                               \
+        sfb_commit(&__##TASK##_sfb);
+
+
+/**
+ * \ingroup interpow_bank
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage the commit of the bank self-fields of \e TASK in a transaction, to
+ * commit them with other fields or when switching to another task (see
+ * \ref interpow_tx).
+ *
+ * @param NAME  transaction's name
+ * @param TASK  task owning the bank
+ */
+#define TxCommitSelfFieldBank(NAME, TASK)                                       \
+        sfb_tx_commit(&__##TASK##_sfb, &PersTx(NAME));
+
+
+/**
+ * \ingroup interpow_block
+ *
+ * \hideinitializer
+ *
+ * \brief Define a new block self-field, conceptually belonging to the
+ *        self-channel (\e TASK, \e TASK ), split in blocks of \e BLOCK
+ *        elements. \e TASK has to be defined before using this macro.
+ *
+ * @param TASK  channel's source and destination task
+ * @param NAME  field's name
+ * @param TYPE  field's TYPE, must be a value of \ref FIELD_TYPES
+ * @param LEN   field's length
+ * @param BLOCK number of elements per block
+ *
+ * \par Blocks
+ * As a self-field, a block self-field is kept twice, but the copy in use is
+ * chosen block by block: the first write to a block in a run of the task
+ * copies that block only, and the following writes go straight to the copy.
+ * A run costs writes proportional to the blocks it touches, not to \e LEN,
+ * plus one bit per block, cleared again by `BeginBlockSelfField()`.
+ *
+ * \par Commit
+ * The writes of a run become visible to the next runs all together, with a
+ * single word written by `CommitBlockSelfField()`. Block self-fields do not
+ * use self-field codes, and do not count against the 8 self-fields of
+ * \e TASK.
+ *
+ * \par Non-volatility
+ * Block self-fields have to be non-volatile. Before declaring a block
+ * self-field \e myField, belonging to the self-channel (\e T, \e T ), three
+ * `#pragma` have to be used, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersSField0(T, myField))
+   #pragma PERSISTENT(PersSField1(T, myField))
+   #pragma PERSISTENT(PersBSFieldMap(T, myField))
+   NewBlockSelfField(T, myField, type, len, block)
+   \endverbatim
+ */
+#define NewBlockSelfField(TASK, NAME, TYPE, LEN, BLOCK)                         \
+        TYPE __##TASK##TASK##NAME##_0[LEN] = {0};                               \
+        TYPE __##TASK##TASK##NAME##_1[LEN] = {0};                               \
+        uint16_t __##TASK##TASK##NAME##_map[                                    \
+            2 * (((LEN) + 16 * (BLOCK) - 1) / (16 * (BLOCK))) + 1] = {0};       \
+        __block_self_field __##TASK##TASK##NAME##__ = {                         \
+            .base_addr_0 = &__##TASK##TASK##NAME##_0,                           \
+            .base_addr_1 = &__##TASK##TASK##NAME##_1,                           \
+            .map = __##TASK##TASK##NAME##_map,                                  \
+            .length = LEN,                                                      \
+            .block_length = BLOCK,                                              \
+            .num_words = ((LEN) + 16 * (BLOCK) - 1) / (16 * (BLOCK)),           \
+            .element_size = sizeof(TYPE)                                        \
+        };
+
+
+/**
+ * \ingroup interpow_block
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Drop the writes of an interrupted run to the block self-field \e FLD of
+ * channel (\e TASK, \e TASK ). Call at the beginning of the task, before any
+ * other access to the field.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to begin
+ */
+#define BeginBlockSelfField(TASK, FLD)                                          \
+        bsf_begin(&GetField(TASK, TASK, FLD));
+
+
+/**
+ * \ingroup interpow_block
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Read \e CNT elements, starting at \e POS, of the block self-field \e FLD of
+ * channel (\e TASK, \e TASK ), including the ones written in this run.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to read
+ * @param DST   address to store the elements at
+ * @param POS   offset of the first element to read
+ * @param CNT   number of elements to read
+ */
+#define ReadBlockSelfField(TASK, FLD, DST, POS, CNT)                            \
+        bsf_read(&GetField(TASK, TASK, FLD), DST, POS, CNT);
+
+
+/**
+ * \ingroup interpow_block
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Write \e CNT elements, starting at \e POS, of the block self-field \e FLD
+ * of channel (\e TASK, \e TASK ). Blocks entirely overwritten are not copied.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to write
+ * @param SRC   address of the elements to write into the field
+ * @param POS   offset of the first element to write
+ * @param CNT   number of elements to write
+ */
+#define WriteBlockSelfField(TASK, FLD, SRC, POS, CNT)                           \
+        bsf_write(&GetField(TASK, TASK, FLD), SRC, POS, CNT);
+
+
+/**
+ * \ingroup interpow_block
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Commit the writes of this run to the block self-field \e FLD of channel
+ * (\e TASK, \e TASK ). Call right before `StartTask(TASK)`, in a task with no
+ * other self-field written in the same run.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to commit
+ */
+#define CommitBlockSelfField(TASK, FLD)                                         \
+        bsf_commit(&GetField(TASK, TASK, FLD));
+
+
+/**
+ * \ingroup interpow_block
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage the commit of the block self-field \e FLD of channel (\e TASK,
+ * \e TASK ) in a transaction, to commit it with other fields or when
+ * switching to another task (see \ref interpow_tx).
+ *
+ * @param NAME  transaction's name
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to commit
+ */
+#define TxCommitBlockSelfField(NAME, TASK, FLD)                                 \
+        bsf_tx_commit(&GetField(TASK, TASK, FLD), &PersTx(NAME));
+
+
+/**
+ * \ingroup interpow_paged
+ *
+ * \hideinitializer
+ *
+ * \brief Define a new paged self-field, conceptually belonging to the
+ *        self-channel (\e TASK, \e TASK ), split in pages of \e PAGE
+ *        elements. \e TASK has to be defined before using this macro.
+ *
+ * @param TASK  channel's source and destination task
+ * @param NAME  field's name
+ * @param TYPE  field's TYPE, must be a value of \ref FIELD_TYPES
+ * @param LEN   field's length
+ * @param PAGE  number of elements per page
+ * @param SPARE number of spare pages, i.e. the most pages a run can write
+ *
+ * \par Pages
+ * A paged self-field is kept once, in a pool of pages with \e SPARE pages
+ * more than needed, and a table maps every page of the field to a page of
+ * the pool. The first write to a page in a run of the task copies it to a
+ * spare page, which the following writes of the run update in place. A run
+ * writing to more than \e SPARE pages traps. The pool holds at most 255
+ * pages, table entries being bytes: a larger field does not compile, and
+ * needs larger pages.
+ *
+ * \par Commit
+ * The table is kept twice, the one in use being switched with a single
+ * byte written by `CommitPagedSelfField()`; the pages replaced become the
+ * spare pages of the next run.
+ *
+ * \par Non-volatility
+ * Paged self-fields have to be non-volatile. Before declaring a paged
+ * self-field \e myField, belonging to the self-channel (\e T, \e T ), two
+ * `#pragma` have to be used, i.e.
+ * \verbatim
+   #pragma PERSISTENT(PersPSFieldPages(T, myField))
+   #pragma PERSISTENT(PersPSFieldTable(T, myField))
+   NewPagedSelfField(T, myField, type, len, page, spare)
+   \endverbatim
+ */
+#define NewPagedSelfField(TASK, NAME, TYPE, LEN, PAGE, SPARE)                   \
+        typedef char __##TASK##TASK##NAME##_fits[                               \
+            (((LEN) + (PAGE) - 1) / (PAGE) + (SPARE) <= 255) ? 1 : -1];         \
+        TYPE __##TASK##TASK##NAME##_pages[                                      \
+            (((LEN) + (PAGE) - 1) / (PAGE) + (SPARE)) * (PAGE)] = {0};          \
+        uint8_t __##TASK##TASK##NAME##_table[                                   \
+            2 * (((LEN) + (PAGE) - 1) / (PAGE)) + 1 +                           \
+            (((LEN) + (PAGE) - 1) / (PAGE) + (SPARE) + 7) / 8] = {0};           \
+        __paged_self_field __##TASK##TASK##NAME##__ = {                         \
+            .pages = __##TASK##TASK##NAME##_pages,                              \
+            .table = __##TASK##TASK##NAME##_table,                              \
+            .length = LEN,                                                      \
+            .page_length = PAGE,                                                \
+            .num_pages = ((LEN) + (PAGE) - 1) / (PAGE),                         \
+            .num_spare = SPARE,                                                 \
+            .element_size = sizeof(TYPE)                                        \
+        };
+
+
+/**
+ * \ingroup interpow_paged
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Drop the pages written by an interrupted run to the paged self-field
+ * \e FLD of channel (\e TASK, \e TASK ). Call at the beginning of the task,
+ * before any other access to the field.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to begin
+ */
+#define BeginPagedSelfField(TASK, FLD)                                          \
+        psf_begin(&GetField(TASK, TASK, FLD));
+
+
+/**
+ * \ingroup interpow_paged
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Read \e CNT elements, starting at \e POS, of the paged self-field \e FLD
+ * of channel (\e TASK, \e TASK ), including the ones written in this run.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to read
+ * @param DST   address to store the elements at
+ * @param POS   offset of the first element to read
+ * @param CNT   number of elements to read
+ */
+#define ReadPagedSelfField(TASK, FLD, DST, POS, CNT)                            \
+        psf_read(&GetField(TASK, TASK, FLD), DST, POS, CNT);
+
+
+/**
+ * \ingroup interpow_paged
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Write \e CNT elements, starting at \e POS, of the paged self-field \e FLD
+ * of channel (\e TASK, \e TASK ). Pages entirely overwritten are not copied.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to write
+ * @param SRC   address of the elements to write into the field
+ * @param POS   offset of the first element to write
+ * @param CNT   number of elements to write
+ */
+#define WritePagedSelfField(TASK, FLD, SRC, POS, CNT)                           \
+        psf_write(&GetField(TASK, TASK, FLD), SRC, POS, CNT);
+
+
+/**
+ * \ingroup interpow_paged
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Commit the writes of this run to the paged self-field \e FLD of channel
+ * (\e TASK, \e TASK ). Call right before `StartTask(TASK)`, in a task with no
+ * other self-field written in the same run.
+ *
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to commit
+ */
+#define CommitPagedSelfField(TASK, FLD)                                         \
+        psf_commit(&GetField(TASK, TASK, FLD));
+
+
+/**
+ * \ingroup interpow_paged
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Stage the commit of the paged self-field \e FLD of channel (\e TASK,
+ * \e TASK ) in a transaction, to commit it with other fields or when
+ * switching to another task (see \ref interpow_tx).
+ *
+ * @param NAME  transaction's name
+ * @param TASK  channel's source and destination task
+ * @param FLD   field to commit
+ */
+#define TxCommitPagedSelfField(NAME, TASK, FLD)                                 \
+        psf_tx_commit(&GetField(TASK, TASK, FLD), &PersTx(NAME));
+
+
+/**
+ * \ingroup interpow_loop
+ *
+ * \hideinitializer
+ *
+ * \brief Create a new task running \e BODY for every index from 0 to
+ *        \e COUNT - 1, then switching to \e NEXT. Unlike the tasks of
+ *        `NewTask()`, a loop task is declared after `InitialTask()`, with
+ *        the fields; \e BODY, \e NEXT and the transaction \e TX have to be
+ *        defined before using this macro.
+ *
+ * @param NAME  task's name
+ * @param BODY  function called with each index, void (uint16_t)
+ * @param COUNT number of iterations, evaluated at every run
+ * @param EVERY iterations per run, a constant
+ * @param NEXT  task to switch to at the end of the loop
+ * @param TX    name of the transaction committing the runs
+ *
+ * \par Commits
+ * The index is kept by the runtime: a run calls \e BODY for up to \e EVERY
+ * indexes, then commits the next index and restarts the task, in \e TX
+ * with the writes staged by \e BODY. The last run resets the index and
+ * switches to \e NEXT in the same commit, so the loop starts from 0 when
+ * it is started again. This saves a task switch per iteration and the code
+ * reading, incrementing and writing the index.
+ *
+ * \par Intermittence
+ * A power failure runs the interrupted run again from its first index, so
+ * the iterations of a run have to be idempotent together, e.g. by staging
+ * their writes in \e TX (`TxBegin()` is done by the runtime). `LoopFirst()`
+ * and `LoopLast()` tell \e BODY where the run starts and ends.
+ *
+ * \par Non-volatility
+ * The task and the index have to be non-volatile, i.e.
+ * \verbatim
+   #pragma PERSISTENT(TASK_FILTER)
+   #pragma PERSISTENT(PersLoopIndex(TASK_FILTER))
+   NewLoopTask(TASK_FILTER, filter_sample, num_samples, 16, TASK_SEND, myTx)
+   \endverbatim
+ */
+#define NewLoopTask(NAME, BODY, COUNT, EVERY, NEXT, TX)                         \
+        static void __loop_##NAME##_run(void);                                  \
+        __task NAME = {                                                         \
+            .task_function = __loop_##NAME##_run,                               \
+            .has_self_channel = 0,                                              \
+            .sf_state = 0                                                       \
+        };                                                                      \
+        uint16_t __loop_##NAME##_index = 0;                                     \
+        typedef char __loop_##NAME##_every[((EVERY) > 0) ? 1 : -1];             \
+        static __loop __loop_##NAME = {                                         \
+            .task = &NAME,                                                      \
+            .next = &NEXT,                                                      \
+            .body = BODY,                                                       \
+            .index = &__loop_##NAME##_index,                                    \
+            .every = EVERY,                                                     \
+            .tx = &PersTx(TX),                                                  \
+            .first = 0,                                                         \
+            .last = 0                                                           \
+        };                                                                      \
+        static void __loop_##NAME##_run(void)                                   \
+        {                                                                       \
+            loop_run(&__loop_##NAME, COUNT, &__prog_state);                     \
+        }
+
+
+/**
+ * \ingroup interpow_loop
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * First index of the run of the loop task \e NAME in progress, e.g. to
+ * restore the working copy of data committed by the previous run.
+ *
+ * @param NAME  loop task's name
+ */
+#define LoopFirst(NAME)                                                         \
+        (__loop_##NAME.first)
+
+
+/**
+ * \ingroup interpow_loop
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Last index of the run of the loop task \e NAME in progress, e.g. to
+ * stage once the data to commit with the index.
+ *
+ * @param NAME  loop task's name
+ */
+#define LoopLast(NAME)                                                          \
+        (__loop_##NAME.last)
+
+
+/**
+ * \ingroup interpow_telemetry
+ *
+ * \hideinitializer
+ *
+ * \brief Create the telemetry block, counting for each task listed with
+ *        `TelemetryTask()`:
+ *   \li \e starts, the `StartTask()` (or transaction commits) switching to it;
+ *   \li \e attempts, its runs by `Resume()`, re-executions included;
+ *   \li \e completions, the runs ended by their commit;
+ *   \li \e interrupted, printed by `TelemetryDump()`: the attempts that
+ *       did not complete, i.e. were cut by a power failure, less the run in
+ *       progress;
+ *   \li \e bytes, the bytes written to fields by the completed runs;
+ *   \li \e cycles, the clock cycles of the completed runs, measured with
+ *       profiler.h if `INTERPOW_TELEMETRY_CYCLES` is defined too.
+ *
+ * The telemetry is only compiled in with `INTERPOW_TELEMETRY` in the project
+ * predefined symbols: without it, the runtime and the macros do not touch it
+ * and the declarations below have to be left out. The cycles of a run
+ * interrupted by a power failure are unknown, the profiler stopping with the
+ * power, and `INTERPOW_TELEMETRY_CYCLES` takes the Timer of the profiler from
+ * the program. The tasks run by `JitResume()` are not counted.
+ *
+ * \par Commit
+ * The new starts, completions, bytes and cycles of a task switch are staged
+ * in its transaction, so they are committed with it, exactly once; every
+ * `NewTransaction()` keeps room for them. `StartTask()` commits through a
+ * transaction of the telemetry.
+ *
+ * \par Non-volatility
+ * The counters and the transaction of the telemetry have to be
+ * non-volatile, i.e.
+ * \verbatim
+   #ifdef INTERPOW_TELEMETRY
+   #pragma PERSISTENT(PersTelemetryLog)
+   #pragma PERSISTENT(PersTelemetryTx)
+   #pragma PERSISTENT(PersTelemetryTasks)
+   #pragma PERSISTENT(PersTelemetry)
+   NewTelemetry(TelemetryTask(TASK_LOAD),
+                TelemetryTask(TASK_TEST))
+   #endif
+   \endverbatim
+ */
+#define NewTelemetry(...)                                                       \
+        NewTransaction(__interpow_tm, 0)                                        \
+        __tm_task __interpow_tm_tasks[] = { __VA_ARGS__ };                      \
+        __telemetry __interpow_tm = {                                           \
+            .tasks = __interpow_tm_tasks,                                       \
+            .num_tasks = sizeof(__interpow_tm_tasks) / sizeof(__tm_task),       \
+            .next_row = 0,                                                      \
+            .running = 0,                                                       \
+            .bytes = 0,                                                         \
+            .tx = &PersTelemetryTx                                              \
+        };
+
+
+/**
+ * \ingroup interpow_telemetry
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Counters of a task, to be listed in `NewTelemetry()`.
+ *
+ * @param TASK  task to count
+ */
+#define TelemetryTask(TASK)                                                     \
+        { .task = &TASK, .name = #TASK }
+
+
+/**
+ * \ingroup interpow_telemetry
+ *
+ * \hideinitializer
+ *
+ * \brief
+ * Print the counters of every task with printf(), one line per task. Does
+ * nothing without `INTERPOW_TELEMETRY`.
+ *
+ * The next line to print is kept with the counters: a dump cut by a power
+ * failure goes on from the line it was printing, which may come out twice,
+ * and a completed dump is not printed again.
+ */
+#ifdef INTERPOW_TELEMETRY
+#define TelemetryDump()                                                         \
+        tm_dump(&PersTelemetry);
+#else
+#define TelemetryDump()
+#endif
 
 
 #endif /* INC_INTERPOW_H_ */